@@ -44,11 +44,13 @@
 #cmakedefine HAVE_OPENMP
 #cmakedefine HAVE_OMP_COLLAPSE
 #cmakedefine HAVE_QT5
+#cmakedefine HAVE_ZLIB
 #cmakedefine HAVE_F90_INTERFACE
 #cmakedefine AVOID_COMPLEX_MPI
 #cmakedefine HAVE_UNIFORM_INT
 #cmakedefine HAVE_UNIFORM_REAL
 #cmakedefine HAVE_STEADYCLOCK
+#cmakedefine HAVE_MMAP
 #cmakedefine HAVE_MPI_REDUCE_SCATTER_BLOCK
 #cmakedefine HAVE_MPI_IN_PLACE
 #cmakedefine HAVE_MPI_LONG_LONG
@@ -57,6 +59,7 @@
 #cmakedefine HAVE_MPI_QUERY_THREAD
 #cmakedefine HAVE_MPI3_NONBLOCKING_COLLECTIVES
 #cmakedefine HAVE_MPIX_NONBLOCKING_COLLECTIVES
+#cmakedefine HAVE_MPI3_RMA
 #cmakedefine REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
 #cmakedefine USE_BYTE_ALLGATHERS
 #cmakedefine USE_64BIT_INTS
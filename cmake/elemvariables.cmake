@@ -9,6 +9,7 @@ CXX = @CMAKE_CXX_COMPILER@
 CXX_FLAGS = @CXX_FLAGS@
 
 MATH_LIBS = @MATH_LIBSTRING@
+ZLIB_LIBS = @ZLIB_LIBSTRING@
 
 MPI_CXX_COMPILE_FLAGS = @MPI_CXX_COMPILE_FLAGS@
 MPI_CXX_LINK_FLAGS = @MPI_CXX_LINK_FLAGS@
@@ -36,9 +37,10 @@ HAVE_QT5 = @HAVE_QT5@
 ifeq (${HAVE_QT5},TRUE)
   ELEM_COMPILE_FLAGS = ${CXX_FLAGS} -I${ELEM_INC} ${MPI_CXX_INCSTRING} \
                        @QT5_COMPILESTRING@ @QT5_INCSTRING@ @QT5_DEFSTRING@
-  ELEM_LIBS = -lelemental ${PMRRR_LIBS} ${MATH_LIBS} ${MPI_CXX_LIBSTRING} \
-              @QT5_LIBSTRING@
+  ELEM_LIBS = -lelemental ${PMRRR_LIBS} ${MATH_LIBS} ${ZLIB_LIBS} \
+              ${MPI_CXX_LIBSTRING} @QT5_LIBSTRING@
 else
   ELEM_COMPILE_FLAGS = ${CXX_FLAGS} -I${ELEM_INC} ${MPI_CXX_INCSTRING}
-  ELEM_LIBS = -lelemental ${PMRRR_LIBS} ${MATH_LIBS} ${MPI_CXX_LIBSTRING}
+  ELEM_LIBS = -lelemental ${PMRRR_LIBS} ${MATH_LIBS} ${ZLIB_LIBS} \
+              ${MPI_CXX_LIBSTRING}
 endif
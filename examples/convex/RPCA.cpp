@@ -9,6 +9,7 @@
 // NOTE: It is possible to simply include "elemental.hpp" instead
 #include "elemental-lite.hpp"
 #include ELEM_AXPY_INC
+#include ELEM_FUSED_INC
 #include ELEM_SCALE_INC
 #include ELEM_FROBENIUSNORM_INC
 #include ELEM_ENTRYWISEONENORM_INC
@@ -82,6 +83,7 @@ void RPCA_ADMM
   Base<F> tau, 
   Base<F> tol, 
   Int numStepsQR,
+  bool partialSVT,
   Int maxIts,
   bool print )
 {
@@ -108,6 +110,9 @@ void RPCA_ADMM
     DistMatrix<F> E( M.Grid() ), Y( M.Grid() );
     Zeros( Y, m, n );
 
+    // The right singular vectors retained by the last partial SVT
+    DistMatrix<F> VSVT( M.Grid() );
+
     const Real frobM = FrobeniusNorm( M );
     const Real maxM = MaxNorm( M );
     if( commRank == 0 )
@@ -120,26 +125,23 @@ void RPCA_ADMM
         ++numIts;
 
         // ST_{tau/beta}(M - L + Y/beta)
-        S = M;
-        Axpy( F(-1), L, S );
-        Axpy( F(1)/beta, Y, S );
-        SoftThreshold( S, tau/beta );
+        fused::Evaluate
+        ( fused::SoftThreshold
+          ( fused::Ref(M)-fused::Ref(L)+fused::Ref(Y)/F(beta), tau/beta ), S );
         const Int numNonzeros = ZeroNorm( S );
 
         // SVT_{1/beta}(M - S + Y/beta)
-        L = M;
-        Axpy( F(-1), S, L );
-        Axpy( F(1)/beta, Y, L );
+        fused::Evaluate( fused::Ref(M)-fused::Ref(S)+fused::Ref(Y)/F(beta), L );
         Int rank;
-        if( numStepsQR == -1 )
+        if( partialSVT )
+            rank = svt::Partial( L, Real(1)/beta, VSVT );
+        else if( numStepsQR == -1 )
             rank = SVT( L, Real(1)/beta );
         else
             rank = SVT( L, Real(1)/beta, numStepsQR );
       
         // E := M - (L + S)
-        E = M;    
-        Axpy( F(-1), L, E );
-        Axpy( F(-1), S, E );
+        fused::Evaluate( fused::Ref(M)-fused::Ref(L)-fused::Ref(S), E );
         const Real frobE = FrobeniusNorm( E );
 
         if( frobE/frobM <= tol )            
@@ -181,7 +183,7 @@ template<typename F>
 void RPCA_ALM
 ( const DistMatrix<F>& M, DistMatrix<F>& L, DistMatrix<F>& S, 
   Base<F> beta, Base<F> tau, Base<F> rho, Base<F> tol, 
-  Int numStepsQR, Int maxIts, bool print )
+  Int numStepsQR, bool partialSVT, Int maxIts, bool print )
 {
     typedef Base<F> Real;
 
@@ -225,6 +227,7 @@ void RPCA_ALM
 
     Int numIts=0, numPrimalIts=0;
     DistMatrix<F> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
+    DistMatrix<F> VSVT( M.Grid() );
     while( true )
     {
         ++numIts;
@@ -238,19 +241,20 @@ void RPCA_ALM
             SLast = S;
 
             // ST_{tau/beta}(M - L + Y/beta)
-            S = M;
-            Axpy( F(-1), L, S );
-            Axpy( F(1)/beta, Y, S );
-            SoftThreshold( S, tau/beta );
+            fused::Evaluate
+            ( fused::SoftThreshold
+              ( fused::Ref(M)-fused::Ref(L)+fused::Ref(Y)/F(beta),
+                tau/beta ), S );
             numNonzeros = ZeroNorm( S );
 
             // SVT_{1/beta}(M - S + Y/beta)
-            L = M;
-            Axpy( F(-1), S, L );
-            Axpy( F(1)/beta, Y, L );
+            fused::Evaluate
+            ( fused::Ref(M)-fused::Ref(S)+fused::Ref(Y)/F(beta), L );
             if( commRank == 0 )
                 std::cout << "beta=" << beta << std::endl;
-            if( numStepsQR == -1 )
+            if( partialSVT )
+                rank = svt::Partial( L, Real(1)/beta, VSVT );
+            else if( numStepsQR == -1 )
                 rank = SVT( L, Real(1)/beta );
             else
                 rank = SVT( L, Real(1)/beta, numStepsQR );
@@ -285,9 +289,7 @@ void RPCA_ALM
         }
 
         // E := M - (L + S)
-        E = M;    
-        Axpy( -1., L, E );
-        Axpy( -1., S, E );
+        fused::Evaluate( fused::Ref(M)-fused::Ref(L)-fused::Ref(S), E );
         const Real frobE = FrobeniusNorm( E );
 
         if( frobE/frobM <= tol )            
@@ -346,6 +348,8 @@ main( int argc, char* argv[] )
         const Int maxIts = Input("--maxIts","maximum iterations",1000);
         const double tol = Input("--tol","tolerance",1.e-5);
         const Int numStepsQR = Input("--numStepsQR","number of steps of QR",-1);
+        const bool partialSVT =
+            Input("--partialSVT","use warm-started partial SVT?",false);
         const bool useALM = Input("--useALM","use ALM algorithm?",true);
         const bool display = Input("--display","display matrices",true);
         const bool print = Input("--print","print matrices",false);
@@ -410,9 +414,12 @@ main( int argc, char* argv[] )
         Zeros( S, m, n ); 
 
         if( useALM )
-            RPCA_ALM( M, L, S, beta, tau, rho, tol, numStepsQR, maxIts, print );
+            RPCA_ALM
+            ( M, L, S, beta, tau, rho, tol, numStepsQR, partialSVT, maxIts,
+              print );
         else
-            RPCA_ADMM( M, L, S, beta, tau, tol, numStepsQR, maxIts, print );
+            RPCA_ADMM
+            ( M, L, S, beta, tau, tol, numStepsQR, partialSVT, maxIts, print );
 
         if( display )
         {
@@ -0,0 +1,74 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_HERMITIANEIG_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_IDENTITY_INC
+#include ELEM_LAPLACIAN_INC
+using namespace std;
+using namespace elem;
+
+typedef double Real;
+typedef Complex<Real> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    try
+    {
+        const Int nx = Input("--nx","size of grid in x direction",30);
+        const Int ny = Input("--ny","size of grid in y direction",30);
+        const Int k = Input("--numEigs","number of eigenpairs",10);
+        const bool largest = Input("--largest","largest eigenpairs?",false);
+        const Int maxIts = Input("--maxIts","maximum iterations",500);
+        const Real tol = Input("--tol","relative residual tol.",Real(0));
+        const bool progress = Input("--progress","print progress?",false);
+        const bool display = Input("--display","display matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid& g = DefaultGrid();
+        auto A = Laplacian<C>( g, nx, ny );
+        const Real frobA = FrobeniusNorm( A );
+
+        DistMatrix<C> X(g);
+        DistMatrix<Real,VR,STAR> w(g);
+        const Int numIts = herm_eig::LOBPCG
+        ( LOWER, A, k, w, X, largest, maxIts, tol, progress );
+
+        if( display )
+        {
+            Display( X, "X" );
+            Display( w, "w" );
+        }
+
+        DistMatrix<C> E( X );
+        DiagonalScale( RIGHT, NORMAL, w, E );
+        Gemm( NORMAL, NORMAL, C(1), A, X, C(-1), E );
+        const Real frobE = FrobeniusNorm( E );
+        Identity( E, k, k );
+        Herk( LOWER, ADJOINT, C(-1), X, C(1), E );
+        const Real frobOrthog = HermitianFrobeniusNorm( LOWER, E );
+        if( mpi::WorldRank() == 0 )
+        {
+            std::cout << " LOBPCG took " << numIts << " iterations\n"
+                      << " || A X - X W ||_F / || A ||_F = " << frobE/frobA
+                      << "\n"
+                      << " || I - X^H X ||_F            = " << frobOrthog
+                      << "\n" << std::endl;
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
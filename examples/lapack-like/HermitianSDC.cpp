@@ -30,6 +30,8 @@ main( int argc, char* argv[] )
         const Int maxInnerIts = Input("--maxInnerIts","maximum RURV its",1);
         const Int maxOuterIts = Input("--maxOuterIts","maximum it's/split",10);
         const Real relTol = Input("--relTol","rel. tol.",Real(0));
+        const bool zolotarev =
+            Input("--zolotarev","use Zolotarev sign iteration?",false);
         const bool display = Input("--display","display matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -43,7 +45,8 @@ main( int argc, char* argv[] )
         DistMatrix<C> ACopy( A ), Q(g);
         DistMatrix<Real,VR,STAR>  w(g);
         herm_eig::SDC
-        ( LOWER, ACopy, w, Q, cutoff, maxInnerIts, maxOuterIts, relTol );
+        ( LOWER, ACopy, w, Q, cutoff, maxInnerIts, maxOuterIts, relTol,
+          false, zolotarev );
 
         if( display )
         {
@@ -0,0 +1,73 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_HERMITIANEIG_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_IDENTITY_INC
+#include ELEM_WIGNER_INC
+using namespace std;
+using namespace elem;
+
+typedef double Real;
+typedef Complex<Real> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    try 
+    {
+        const Int n = Input("--size","height of matrix",100);
+        const Int numSlices = Input("--numSlices","number of slices (0=auto)",0);
+        const Int maxRounds = Input("--maxRounds","max multisection rounds",20);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool display = Input("--display","display matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid& g = DefaultGrid();
+        auto A = Wigner<C>( g, n );
+        const Real frobA = FrobeniusNorm( A );
+
+        // Compute the spectral decomposition of A, but do not overwrite A
+        DistMatrix<C> ACopy( A ), Q(g);
+        DistMatrix<Real,VR,STAR> w(g);
+        herm_eig::SpectrumSlicing
+        ( LOWER, ACopy, w, Q, numSlices, maxRounds, progress );
+
+        if( display )
+        {
+            Display( A, "A" );
+            Display( Q, "Q" );
+            Display( w, "w" );
+        }
+
+        auto G( Q );
+        DiagonalScale( RIGHT, NORMAL, w, G );
+        Gemm( NORMAL, ADJOINT, C(-1), G, Q, C(1), A );
+        const Real frobE = FrobeniusNorm( A ); 
+        MakeIdentity( A );
+        Herk( LOWER, ADJOINT, C(-1), Q, C(1), A );
+        const Real frobOrthog = HermitianFrobeniusNorm( LOWER, A );
+        if( mpi::WorldRank() == 0 )
+        {
+            std::cout << " || A - Q D Q^H ||_F / || A ||_F = " << frobE/frobA 
+                      << "\n"
+                      << " || I - Q^H Q ||_F   / || A ||_F = " 
+                      << frobOrthog/frobA << "\n"
+                      << std::endl;
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_DIAGONALSCALE_INC
+#include ELEM_GEMM_INC
+#include ELEM_HERK_INC
+#include ELEM_HERMITIANTRIDIAGEIG_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_MAXNORM_INC
+#include ELEM_IDENTITY_INC
+#include ELEM_LEGENDRE_INC
+#include ELEM_ONETWOONE_INC
+#include ELEM_WILKINSON_INC
+using namespace std;
+using namespace elem;
+
+typedef double Real;
+
+// Solve the tridiagonal eigenvalue problem defined by the diagonal and
+// subdiagonal of T and report the time, residual, and orthogonality
+void
+Solve
+( const DistMatrix<Real>& T, HermitianTridiagEigAlg alg,
+  DistMatrix<Real,VR,STAR>& w, bool display )
+{
+    const Grid& g = T.Grid();
+    const Int n = T.Height();
+    auto d = T.GetDiagonal();
+    auto e = T.GetDiagonal( -1 );
+
+    DistMatrix<Real> Z(g);
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    HermitianTridiagEig( d, e, w, Z, ASCENDING, alg );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( display )
+    {
+        Display( w, "w" );
+        Display( Z, "Z" );
+    }
+
+    DistMatrix<Real> E( Z );
+    DiagonalScale( RIGHT, NORMAL, w, E );
+    Gemm( NORMAL, NORMAL, Real(1), T, Z, Real(-1), E );
+    const Real frobT = FrobeniusNorm( T );
+    const Real frobResid = FrobeniusNorm( E );
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Z, Real(1), E );
+    const Real frobOrthog = HermitianFrobeniusNorm( LOWER, E );
+    if( mpi::WorldRank() == 0 )
+    {
+        cout << "  "
+             << ( alg==HERMITIAN_TRIDIAG_EIG_DC ? "D&C " : "MRRR" )
+             << ": " << runTime << " seconds\n"
+             << "    || T Z - Z W ||_F / || T ||_F = " << frobResid/frobT
+             << "\n"
+             << "    || I - Z^T Z ||_F             = " << frobOrthog
+             << endl;
+    }
+}
+
+void
+Compare( const DistMatrix<Real>& T, const std::string& title, bool display )
+{
+    if( mpi::WorldRank() == 0 )
+        cout << title << " (n=" << T.Height() << "):" << endl;
+    DistMatrix<Real,VR,STAR> wMRRR(T.Grid()), wDC(T.Grid());
+    Solve( T, HERMITIAN_TRIDIAG_EIG_MRRR, wMRRR, display );
+    Solve( T, HERMITIAN_TRIDIAG_EIG_DC, wDC, display );
+    Axpy( Real(-1), wMRRR, wDC );
+    const Real maxDiff = MaxNorm( wDC );
+    if( mpi::WorldRank() == 0 )
+        cout << "  || w_MRRR - w_D&C ||_max = " << maxDiff << "\n" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    try
+    {
+        const Int n = Input("--size","size of matrices",1000);
+        const bool display = Input("--display","display matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid& g = DefaultGrid();
+        DistMatrix<Real> T(g);
+
+        Wilkinson( T, n/2 );
+        Compare( T, "Wilkinson", display );
+
+        Legendre( T, n );
+        Compare( T, "Legendre", display );
+
+        OneTwoOne( T, n );
+        Compare( T, "1-2-1", display );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
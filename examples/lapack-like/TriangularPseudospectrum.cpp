@@ -37,6 +37,12 @@ main( int argc, char* argv[] )
         const Real yWidth = Input("--yWidth","y width of image",0.);
         const Int xSize = Input("--xSize","number of x samples",100);
         const Int ySize = Input("--ySize","number of y samples",100);
+        const bool adaptive =
+            Input("--adaptive","refine towards the contours?",false);
+        const Int numContours =
+            Input("--numContours","contours at 10^-1,...,10^-numContours",3);
+        const Int numRefine =
+            Input("--numRefine","number of adaptive refinements",3);
         const bool lanczos = Input("--lanczos","use Lanczos?",true);
         const Int krylovSize = Input("--krylovSize","num Lanczos vectors",10);
         const bool reorthog = Input("--reorthog","reorthog basis?",true);
@@ -58,6 +64,9 @@ main( int argc, char* argv[] )
             LogicError("Invalid file format integer, should be in [1,",
                        FileFormat_MAX,")");
 
+        if( adaptive && (xWidth == 0. || yWidth == 0.) )
+            LogicError("Adaptive refinement requires --xWidth and --yWidth");
+
         FileFormat format = static_cast<FileFormat>(formatInt);
         ColorMap colorMap = static_cast<ColorMap>(colorMapInt);
         SetColorMap( colorMap );
@@ -83,7 +92,17 @@ main( int argc, char* argv[] )
         // for a grid of complex sigma's.
         DistMatrix<Real> invNormMap;
         DistMatrix<Int> itCountMap;
-        if( xWidth != 0. && yWidth != 0. )
+        if( adaptive )
+        {
+            std::vector<Real> contours( numContours );
+            for( Int k=0; k<numContours; ++k )
+                contours[k] = Pow( Real(10), Real(-(k+1)) );
+            itCountMap = TriangularPseudospectrum
+            ( A, invNormMap, center, xWidth, yWidth, xSize, ySize, contours,
+              numRefine, lanczos, krylovSize, reorthog, deflate, maxIts, tol,
+              progress );
+        }
+        else if( xWidth != 0. && yWidth != 0. )
             itCountMap = TriangularPseudospectrum
             ( A, invNormMap, center, xWidth, yWidth, xSize, ySize,
               lanczos, krylovSize, reorthog, deflate, maxIts, tol, progress );
@@ -0,0 +1,69 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_POLAR_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+// Typedef our real and complex types to 'Real' and 'C' for convenience
+typedef double Real;
+typedef Complex<Real> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int numTerms =
+            Input("--numTerms","terms per iteration (0=auto)",0);
+        const Int numTeams =
+            Input("--numTeams","number of subgrids (0=auto)",0);
+        ProcessInput();
+        PrintInputReport();
+
+        DistMatrix<C> A, Q, P;
+        Uniform( A, m, n );
+        const Real frobA = FrobeniusNorm( A );
+
+        // Compute the polar decomp of A using the Zolotarev-based iteration,
+        // with the terms of each iteration spread over numTeams subgrids
+        Q = A;
+        const Int numItsZolo = polar::Zolotarev( Q, numTerms, numTeams );
+        Zeros( P, n, n );
+        Gemm( ADJOINT, NORMAL, C(1), Q, A, C(0), P );
+
+        // Check and report overall and orthogonality error
+        DistMatrix<C> B( A );
+        Gemm( NORMAL, NORMAL, C(-1), Q, P, C(1), B );
+        const Real frobZolo = FrobeniusNorm( B );
+        Identity( B, n, n );
+        Herk( LOWER, ADJOINT, C(1), Q, C(-1), B );
+        const Real frobZoloOrthog = HermitianFrobeniusNorm( LOWER, B );
+        if( mpi::WorldRank() == 0 )
+        {
+            std::cout << numItsZolo << " iterations of Zolo-PD\n"
+                      << "||A - QP||_F / ||A||_F = "
+                      << frobZolo/frobA << "\n"
+                      << "||I - QQ^H||_F / ||A||_F = "
+                      << frobZoloOrthog/frobA << "\n"
+                      << std::endl;
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -19,6 +19,9 @@
 #include "./level1/DiagonalSolve.hpp"
 #include "./level1/Dot.hpp"
 #include "./level1/Dotu.hpp"
+#include "./level1/EntrywiseMap.hpp"
+#include "./level1/EntrywiseReduce.hpp"
+#include "./level1/Fused.hpp"
 #include "./level1/Hadamard.hpp"
 #include "./level1/HilbertSchmidt.hpp"
 #include "./level1/MakeHermitian.hpp"
@@ -10,6 +10,8 @@
 #ifndef ELEM_CONJUGATE_HPP
 #define ELEM_CONJUGATE_HPP
 
+#include ELEM_ENTRYWISEMAP_INC
+
 namespace elem {
 
 #ifndef SWIG
@@ -25,11 +27,7 @@ inline void
 Conjugate( Matrix<Complex<Z>>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("Conjugate (in-place)"))
-    const Int m = A.Height();
-    const Int n = A.Width();
-    for( Int j=0; j<n; ++j )
-        for( Int i=0; i<m; ++i )
-            A.Set(i,j,Conj(A.Get(i,j)));
+    EntrywiseMap( A, []( Complex<Z> alpha ) { return Conj(alpha); } );
 }
 #else // ifndef SWIG
 // Avoid what seems to be a bug in SWIG's template instantiation
@@ -38,11 +36,7 @@ inline void
 Conjugate( Matrix<T>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("Conjugate (in-place)"))
-    const Int m = A.Height();
-    const Int n = A.Width();
-    for( Int j=0; j<n; ++j )
-        for( Int i=0; i<m; ++i )
-            A.Set(i,j,Conj(A.Get(i,j)));
+    EntrywiseMap( A, []( T alpha ) { return Conj(alpha); } );
 }
 #endif // ifndef SWIG
 
@@ -51,12 +45,7 @@ inline void
 Conjugate( const Matrix<T>& A, Matrix<T>& B )
 {
     DEBUG_ONLY(CallStackEntry cse("Conjugate"))
-    const Int m = A.Height();
-    const Int n = A.Width();
-    B.Resize( m, n );
-    for( Int j=0; j<n; ++j )
-        for( Int i=0; i<m; ++i )
-            B.Set(i,j,Conj(A.Get(i,j)));
+    EntrywiseMap( A, B, []( T alpha ) { return Conj(alpha); } );
 }
 
 template<typename T,Dist U,Dist V>
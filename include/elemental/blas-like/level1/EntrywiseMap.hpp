@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_ENTRYWISEMAP_HPP
+#define ELEM_ENTRYWISEMAP_HPP
+
+// A(i,j) := func(A(i,j)), or B(i,j) := func(A(i,j)), computed with a
+// unit-stride sweep over each local column (so that the compiler may
+// vectorize it) and with the local columns split among OpenMP threads.
+//
+// The trapezoidal variants only touch the entries which would be kept by
+// MakeTrapezoidal( uplo, A, offset ).
+
+namespace elem {
+
+namespace internal {
+
+// The local layout of a (possibly distributed) matrix
+struct EntrywiseLayout
+{
+    Int height, localHeight, localWidth;
+    Int colShift, colStride, rowShift, rowStride;
+
+    template<typename T>
+    EntrywiseLayout( const Matrix<T>& A )
+    : height(A.Height()), localHeight(A.Height()), localWidth(A.Width()),
+      colShift(0), colStride(1), rowShift(0), rowStride(1)
+    { }
+
+    template<typename T,Dist U,Dist V>
+    EntrywiseLayout( const DistMatrix<T,U,V>& A )
+    : height(A.Height()), localHeight(A.LocalHeight()),
+      localWidth(A.LocalWidth()),
+      colShift(A.ColShift()), colStride(A.ColStride()),
+      rowShift(A.RowShift()), rowStride(A.RowStride())
+    { }
+};
+
+// The range of local rows, [iLocBeg,iLocEnd), of local column jLoc which lie
+// within the trapezoid
+inline void
+TrapezoidRows
+( UpperOrLower uplo, Int offset, const EntrywiseLayout& layout, Int jLoc,
+  Int& iLocBeg, Int& iLocEnd )
+{
+    const Int j = layout.rowShift + jLoc*layout.rowStride;
+    if( uplo == LOWER )
+    {
+        const Int iBeg = Min( Max(j-offset,0), layout.height );
+        iLocBeg = Length_( iBeg, layout.colShift, layout.colStride );
+        iLocEnd = layout.localHeight;
+    }
+    else
+    {
+        const Int iEnd = Min( Max(j-offset+1,0), layout.height );
+        iLocBeg = 0;
+        iLocEnd = Length_( iEnd, layout.colShift, layout.colStride );
+    }
+}
+
+template<typename S,typename T,class Function>
+inline void
+LocalEntrywiseMap
+( const EntrywiseLayout& layout, const S* ABuf, Int ALDim,
+  T* BBuf, Int BLDim, Function func )
+{
+    const Int localHeight = layout.localHeight;
+    const Int localWidth = layout.localWidth;
+    PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const S* ACol = &ABuf[jLoc*ALDim];
+        T* BCol = &BBuf[jLoc*BLDim];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            BCol[iLoc] = func(ACol[iLoc]);
+    }
+}
+
+template<typename T,class Function>
+inline void
+LocalEntrywiseMap
+( UpperOrLower uplo, Int offset, const EntrywiseLayout& layout,
+  T* buffer, Int ldim, Function func )
+{
+    const Int localWidth = layout.localWidth;
+    PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        Int iLocBeg, iLocEnd;
+        TrapezoidRows( uplo, offset, layout, jLoc, iLocBeg, iLocEnd );
+        T* col = &buffer[jLoc*ldim];
+        for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+            col[iLoc] = func(col[iLoc]);
+    }
+}
+
+} // namespace internal
+
+template<typename T,class Function>
+inline void
+EntrywiseMap( Matrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    internal::LocalEntrywiseMap
+    ( internal::EntrywiseLayout(A), A.LockedBuffer(), A.LDim(),
+      A.Buffer(), A.LDim(), func );
+}
+
+template<typename T,Dist U,Dist V,class Function>
+inline void
+EntrywiseMap( DistMatrix<T,U,V>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    EntrywiseMap( A.Matrix(), func );
+}
+
+template<typename T,class Function>
+inline void
+EntrywiseMap( UpperOrLower uplo, Matrix<T>& A, Function func, Int offset=0 )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    internal::LocalEntrywiseMap
+    ( uplo, offset, internal::EntrywiseLayout(A), A.Buffer(), A.LDim(),
+      func );
+}
+
+template<typename T,Dist U,Dist V,class Function>
+inline void
+EntrywiseMap
+( UpperOrLower uplo, DistMatrix<T,U,V>& A, Function func, Int offset=0 )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    internal::LocalEntrywiseMap
+    ( uplo, offset, internal::EntrywiseLayout(A), A.Buffer(), A.LDim(),
+      func );
+}
+
+template<typename S,typename T,class Function>
+inline void
+EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    B.Resize( A.Height(), A.Width() );
+    internal::LocalEntrywiseMap
+    ( internal::EntrywiseLayout(A), A.LockedBuffer(), A.LDim(),
+      B.Buffer(), B.LDim(), func );
+}
+
+template<typename S,typename T,Dist U,Dist V,class Function>
+inline void
+EntrywiseMap
+( const DistMatrix<S,U,V>& A, DistMatrix<T,U,V>& B, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    if( A.Grid() != B.Grid() )
+        LogicError("A and B must use the same grid");
+    B.AlignWith( A.DistData() );
+    B.Resize( A.Height(), A.Width() );
+    EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
+}
+
+} // namespace elem
+
+#endif // ifndef ELEM_ENTRYWISEMAP_HPP
@@ -0,0 +1,249 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_ENTRYWISEREDUCE_HPP
+#define ELEM_ENTRYWISEREDUCE_HPP
+
+#include ELEM_ENTRYWISEMAP_INC
+
+// Return reduce( func(A(0,0)), func(A(1,0)), ... ), where 'identity' must be
+// an identity of the (associative and commutative) reduction. Each local
+// column is swept with unit stride, the local columns are split among OpenMP
+// threads, and, for distributed matrices, the local results are combined
+// over the distribution communicator using the reduction's MPI operation.
+//
+// The trapezoidal variants only visit the entries which would be kept by
+// MakeTrapezoidal( uplo, A, offset ).
+//
+// HermitianEntrywiseSum returns the sum of func over every entry of the
+// Hermitian matrix implicitly stored in the 'uplo' triangle of A, i.e., the
+// strictly triangular entries are counted twice, in a single sweep.
+
+namespace elem {
+
+template<typename R>
+struct SumReduction
+{
+    R operator()( R alpha, R beta ) const { return alpha+beta; }
+    mpi::Op Op() const { return mpi::SUM; }
+};
+
+template<typename R>
+struct MaxReduction
+{
+    R operator()( R alpha, R beta ) const { return Max(alpha,beta); }
+    mpi::Op Op() const { return mpi::MAX; }
+};
+
+template<typename R>
+struct MinReduction
+{
+    R operator()( R alpha, R beta ) const { return Min(alpha,beta); }
+    mpi::Op Op() const { return mpi::MIN; }
+};
+
+namespace internal {
+
+template<typename T,typename R,class Function,class Reduction>
+inline R
+ReduceColumn
+( const T* col, Int iLocBeg, Int iLocEnd, R result,
+  Function func, Reduction reduce )
+{
+    for( Int iLoc=iLocBeg; iLoc<iLocEnd; ++iLoc )
+        result = reduce( result, func(col[iLoc]) );
+    return result;
+}
+
+template<typename T,typename R,class Function,class Reduction>
+inline R
+LocalEntrywiseReduce
+( bool trapezoidal, UpperOrLower uplo, Int offset,
+  const EntrywiseLayout& layout, const T* buffer, Int ldim,
+  R identity, Function func, Reduction reduce )
+{
+    const Int localWidth = layout.localWidth;
+    R result = identity;
+#ifdef HAVE_OPENMP
+    #pragma omp parallel
+    {
+        R threadResult = identity;
+        #pragma omp for
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            Int iLocBeg=0, iLocEnd=layout.localHeight;
+            if( trapezoidal )
+                TrapezoidRows( uplo, offset, layout, jLoc, iLocBeg, iLocEnd );
+            threadResult = ReduceColumn
+            ( &buffer[jLoc*ldim], iLocBeg, iLocEnd, threadResult,
+              func, reduce );
+        }
+        #pragma omp critical
+        result = reduce( result, threadResult );
+    }
+#else
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        Int iLocBeg=0, iLocEnd=layout.localHeight;
+        if( trapezoidal )
+            TrapezoidRows( uplo, offset, layout, jLoc, iLocBeg, iLocEnd );
+        result = ReduceColumn
+        ( &buffer[jLoc*ldim], iLocBeg, iLocEnd, result, func, reduce );
+    }
+#endif
+    return result;
+}
+
+// Returns func summed over the 'uplo' triangle with the strictly triangular
+// entries counted twice. The diagonal entry of a local column, if it is
+// stored there, is the first local row of a lower triangle and the last of
+// an upper one, so it is split off of the strictly triangular sweep.
+template<typename T,class Function>
+inline auto
+LocalHermitianEntrywiseSum
+( UpperOrLower uplo, const EntrywiseLayout& layout, const T* buffer, Int ldim,
+  Function func ) -> decltype(func(T()))
+{
+    typedef decltype(func(T())) R;
+    const Int localWidth = layout.localWidth;
+    R result = 0;
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for reduction(+:result)
+#endif
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        Int iLocBeg, iLocEnd;
+        TrapezoidRows( uplo, 0, layout, jLoc, iLocBeg, iLocEnd );
+        if( iLocBeg >= iLocEnd )
+            continue;
+        const T* col = &buffer[jLoc*ldim];
+        const Int j = layout.rowShift + jLoc*layout.rowStride;
+        const Int iLocDiag = ( uplo==LOWER ? iLocBeg : iLocEnd-1 );
+        R diagTerm = 0;
+        if( layout.colShift + iLocDiag*layout.colStride == j )
+        {
+            diagTerm = func(col[iLocDiag]);
+            if( uplo == LOWER )
+                ++iLocBeg;
+            else
+                --iLocEnd;
+        }
+        const R strictSum = ReduceColumn
+        ( col, iLocBeg, iLocEnd, R(0), func, SumReduction<R>() );
+        result += 2*strictSum + diagTerm;
+    }
+    return result;
+}
+
+template<typename T,Dist U,Dist V,typename R,class Function,class Reduction>
+inline R
+DistEntrywiseReduce
+( bool trapezoidal, UpperOrLower uplo, Int offset,
+  const DistMatrix<T,U,V>& A, R identity, Function func, Reduction reduce )
+{
+    R result = identity;
+    if( A.Participating() )
+    {
+        const R localResult = LocalEntrywiseReduce
+        ( trapezoidal, uplo, offset, EntrywiseLayout(A),
+          A.LockedBuffer(), A.LDim(), identity, func, reduce );
+        result = mpi::AllReduce( localResult, reduce.Op(), A.DistComm() );
+    }
+    mpi::Broadcast( result, A.Root(), A.CrossComm() );
+    return result;
+}
+
+} // namespace internal
+
+template<typename T,typename R,class Function,class Reduction>
+inline R
+EntrywiseReduce
+( const Matrix<T>& A, R identity, Function func, Reduction reduce )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseReduce"))
+    return internal::LocalEntrywiseReduce
+    ( false, LOWER, 0, internal::EntrywiseLayout(A),
+      A.LockedBuffer(), A.LDim(), identity, func, reduce );
+}
+
+template<typename T,Dist U,Dist V,typename R,class Function,class Reduction>
+inline R
+EntrywiseReduce
+( const DistMatrix<T,U,V>& A, R identity, Function func, Reduction reduce )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseReduce"))
+    return internal::DistEntrywiseReduce
+    ( false, LOWER, 0, A, identity, func, reduce );
+}
+
+template<typename T,typename R,class Function,class Reduction>
+inline R
+EntrywiseReduce
+( UpperOrLower uplo, const Matrix<T>& A, R identity,
+  Function func, Reduction reduce, Int offset=0 )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseReduce"))
+    return internal::LocalEntrywiseReduce
+    ( true, uplo, offset, internal::EntrywiseLayout(A),
+      A.LockedBuffer(), A.LDim(), identity, func, reduce );
+}
+
+template<typename T,Dist U,Dist V,typename R,class Function,class Reduction>
+inline R
+EntrywiseReduce
+( UpperOrLower uplo, const DistMatrix<T,U,V>& A, R identity,
+  Function func, Reduction reduce, Int offset=0 )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseReduce"))
+    return internal::DistEntrywiseReduce
+    ( true, uplo, offset, A, identity, func, reduce );
+}
+
+template<typename T,class Function>
+inline auto
+HermitianEntrywiseSum
+( UpperOrLower uplo, const Matrix<T>& A, Function func )
+-> decltype(func(T()))
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("HermitianEntrywiseSum");
+        if( A.Height() != A.Width() )
+            LogicError("Hermitian matrices must be square.");
+    )
+    return internal::LocalHermitianEntrywiseSum
+    ( uplo, internal::EntrywiseLayout(A), A.LockedBuffer(), A.LDim(), func );
+}
+
+template<typename T,Dist U,Dist V,class Function>
+inline auto
+HermitianEntrywiseSum
+( UpperOrLower uplo, const DistMatrix<T,U,V>& A, Function func )
+-> decltype(func(T()))
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("HermitianEntrywiseSum");
+        if( A.Height() != A.Width() )
+            LogicError("Hermitian matrices must be square.");
+    )
+    typedef decltype(func(T())) R;
+    R sum = 0;
+    if( A.Participating() )
+    {
+        const R localSum = internal::LocalHermitianEntrywiseSum
+        ( uplo, internal::EntrywiseLayout(A), A.LockedBuffer(), A.LDim(),
+          func );
+        sum = mpi::AllReduce( localSum, A.DistComm() );
+    }
+    mpi::Broadcast( sum, A.Root(), A.CrossComm() );
+    return sum;
+}
+
+} // namespace elem
+
+#endif // ifndef ELEM_ENTRYWISEREDUCE_HPP
@@ -0,0 +1,329 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_FUSED_HPP
+#define ELEM_FUSED_HPP
+
+// Lazy entrywise expressions over the local data of (Dist)Matrix's, e.g.,
+//
+//   using namespace fused;
+//   Evaluate( SoftThreshold( Ref(M)-Ref(L)+(F(1)/beta)*Ref(Y), tau ), S );
+//
+// forms S := ST_tau(M - L + Y/beta) in a single sweep over the local buffers
+// with no temporaries, rather than with two Axpy's and a SoftThreshold pass.
+// Each column is traversed with unit stride so that the inner loop can be
+// vectorized by the compiler, and the columns are split among OpenMP threads.
+// Since the expressions are entrywise, the result may alias any operand.
+//
+// All of the distributed operands of an expression must share the same grid,
+// distribution, and alignments.
+
+namespace elem {
+namespace fused {
+
+// The (local) shape shared by every operand of an expression
+struct Shape
+{
+    Int height, width, localHeight, localWidth;
+    bool distributed;
+    Dist colDist, rowDist;
+    Int colAlign, rowAlign;
+    const Grid* grid;
+};
+
+inline void
+CheckConformal( const Shape& A, const Shape& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("fused::CheckConformal"))
+    if( A.height != B.height || A.width != B.width )
+        LogicError("Operands must have the same dimensions");
+    if( A.distributed != B.distributed )
+        LogicError("Cannot mix Matrix and DistMatrix operands");
+    if( A.distributed )
+    {
+        if( A.grid != B.grid )
+            LogicError("Operands must be distributed over the same grid");
+        if( A.colDist != B.colDist || A.rowDist != B.rowDist )
+            LogicError("Operands must have the same distribution");
+        if( A.colAlign != B.colAlign || A.rowAlign != B.rowAlign )
+            LogicError("Operands must be aligned");
+    }
+}
+
+// The base class for all expressions, which allows the operators below to
+// only match expression types
+template<typename Derived>
+struct Expr
+{
+    const Derived& Self() const { return static_cast<const Derived&>(*this); }
+};
+
+// A reference to the local data of an existing matrix
+template<typename T>
+class Leaf : public Expr<Leaf<T>>
+{
+public:
+    typedef T Type;
+
+    Leaf( const Matrix<T>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim())
+    {
+        shape_.height = shape_.localHeight = A.Height();
+        shape_.width = shape_.localWidth = A.Width();
+        shape_.distributed = false;
+        shape_.colDist = shape_.rowDist = STAR;
+        shape_.colAlign = shape_.rowAlign = 0;
+        shape_.grid = nullptr;
+    }
+
+    template<Dist U,Dist V>
+    Leaf( const DistMatrix<T,U,V>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim())
+    {
+        shape_.height = A.Height();
+        shape_.width = A.Width();
+        shape_.localHeight = A.LocalHeight();
+        shape_.localWidth = A.LocalWidth();
+        shape_.distributed = true;
+        shape_.colDist = U;
+        shape_.rowDist = V;
+        shape_.colAlign = A.ColAlign();
+        shape_.rowAlign = A.RowAlign();
+        shape_.grid = &A.Grid();
+    }
+
+    const Shape& GetShape() const { return shape_; }
+    T operator()( Int iLoc, Int jLoc ) const
+    { return buffer_[iLoc+jLoc*ldim_]; }
+
+private:
+    const T* buffer_;
+    Int ldim_;
+    Shape shape_;
+};
+
+template<typename T>
+inline Leaf<T> Ref( const Matrix<T>& A ) { return Leaf<T>( A ); }
+
+template<typename T,Dist U,Dist V>
+inline Leaf<T> Ref( const DistMatrix<T,U,V>& A ) { return Leaf<T>( A ); }
+
+// f(A)
+template<typename E,class Op>
+class Unary : public Expr<Unary<E,Op>>
+{
+public:
+    typedef typename E::Type Type;
+
+    Unary( const E& e, const Op& op ) : e_(e), op_(op) { }
+
+    const Shape& GetShape() const { return e_.GetShape(); }
+    Type operator()( Int iLoc, Int jLoc ) const
+    { return op_( e_(iLoc,jLoc) ); }
+
+private:
+    const E e_;
+    const Op op_;
+};
+
+// f(A,B)
+template<typename L,typename R,class Op>
+class Binary : public Expr<Binary<L,R,Op>>
+{
+public:
+    typedef typename L::Type Type;
+
+    Binary( const L& l, const R& r )
+    : l_(l), r_(r)
+    { CheckConformal( l.GetShape(), r.GetShape() ); }
+
+    const Shape& GetShape() const { return l_.GetShape(); }
+    Type operator()( Int iLoc, Int jLoc ) const
+    { return Op::Apply( l_(iLoc,jLoc), r_(iLoc,jLoc) ); }
+
+private:
+    const L l_;
+    const R r_;
+};
+
+template<typename T>
+struct ScaleOp
+{
+    T alpha;
+    ScaleOp( T alpha_ ) : alpha(alpha_) { }
+    T operator()( T beta ) const { return alpha*beta; }
+};
+
+template<typename T>
+struct ShiftOp
+{
+    T alpha;
+    ShiftOp( T alpha_ ) : alpha(alpha_) { }
+    T operator()( T beta ) const { return alpha+beta; }
+};
+
+template<typename T>
+struct SoftThresholdOp
+{
+    Base<T> tau;
+    SoftThresholdOp( Base<T> tau_ ) : tau(tau_) { }
+    T operator()( T alpha ) const
+    {
+        const Base<T> scale = Abs(alpha);
+        return ( scale <= tau ? T(0) : alpha*(1-tau/scale) );
+    }
+};
+
+template<typename T>
+struct SumOp
+{ static T Apply( T alpha, T beta ) { return alpha+beta; } };
+
+template<typename T>
+struct DifferenceOp
+{ static T Apply( T alpha, T beta ) { return alpha-beta; } };
+
+template<typename T>
+struct ProductOp
+{ static T Apply( T alpha, T beta ) { return alpha*beta; } };
+
+template<typename L,typename R>
+inline Binary<L,R,SumOp<typename L::Type>>
+operator+( const Expr<L>& l, const Expr<R>& r )
+{ return Binary<L,R,SumOp<typename L::Type>>( l.Self(), r.Self() ); }
+
+template<typename L,typename R>
+inline Binary<L,R,DifferenceOp<typename L::Type>>
+operator-( const Expr<L>& l, const Expr<R>& r )
+{ return Binary<L,R,DifferenceOp<typename L::Type>>( l.Self(), r.Self() ); }
+
+template<typename E>
+inline Unary<E,ScaleOp<typename E::Type>>
+operator-( const Expr<E>& e )
+{
+    typedef typename E::Type T;
+    return Unary<E,ScaleOp<T>>( e.Self(), ScaleOp<T>(T(-1)) );
+}
+
+template<typename E>
+inline Unary<E,ScaleOp<typename E::Type>>
+operator*( typename E::Type alpha, const Expr<E>& e )
+{
+    typedef typename E::Type T;
+    return Unary<E,ScaleOp<T>>( e.Self(), ScaleOp<T>(alpha) );
+}
+
+template<typename E>
+inline Unary<E,ScaleOp<typename E::Type>>
+operator*( const Expr<E>& e, typename E::Type alpha )
+{ return alpha*e; }
+
+template<typename E>
+inline Unary<E,ScaleOp<typename E::Type>>
+operator/( const Expr<E>& e, typename E::Type alpha )
+{
+    typedef typename E::Type T;
+    return Unary<E,ScaleOp<T>>( e.Self(), ScaleOp<T>(T(1)/alpha) );
+}
+
+template<typename E>
+inline Unary<E,ShiftOp<typename E::Type>>
+operator+( typename E::Type alpha, const Expr<E>& e )
+{
+    typedef typename E::Type T;
+    return Unary<E,ShiftOp<T>>( e.Self(), ShiftOp<T>(alpha) );
+}
+
+template<typename E>
+inline Unary<E,ShiftOp<typename E::Type>>
+operator+( const Expr<E>& e, typename E::Type alpha )
+{ return alpha+e; }
+
+// The entrywise product, A(i,j) B(i,j)
+template<typename L,typename R>
+inline Binary<L,R,ProductOp<typename L::Type>>
+Hadamard( const Expr<L>& l, const Expr<R>& r )
+{ return Binary<L,R,ProductOp<typename L::Type>>( l.Self(), r.Self() ); }
+
+// Entrywise soft-thresholding, sgn(alpha) max(|alpha|-tau,0)
+template<typename E>
+inline Unary<E,SoftThresholdOp<typename E::Type>>
+SoftThreshold( const Expr<E>& e, BASE(typename E::Type) tau )
+{
+    typedef typename E::Type T;
+    DEBUG_ONLY(
+        CallStackEntry cse("fused::SoftThreshold");
+        if( tau < 0 )
+            LogicError("Negative threshold does not make sense");
+    )
+    return Unary<E,SoftThresholdOp<T>>( e.Self(), SoftThresholdOp<T>(tau) );
+}
+
+// An arbitrary entrywise function, f(A(i,j))
+template<typename E,class Function>
+inline Unary<E,Function>
+Map( const Expr<E>& e, const Function& func )
+{ return Unary<E,Function>( e.Self(), func ); }
+
+namespace internal {
+
+template<typename T,typename E>
+inline void
+LocalEvaluate( const E& e, T* buffer, Int ldim )
+{
+    const Shape& shape = e.GetShape();
+    const Int localHeight = shape.localHeight;
+    const Int localWidth = shape.localWidth;
+    PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        T* col = &buffer[jLoc*ldim];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            col[iLoc] = e(iLoc,jLoc);
+    }
+}
+
+} // namespace internal
+
+// B := e
+template<typename T,typename E>
+inline void
+Evaluate( const Expr<E>& expr, Matrix<T>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("fused::Evaluate"))
+    const E& e = expr.Self();
+    const Shape& shape = e.GetShape();
+    if( shape.distributed )
+        LogicError("Cannot evaluate a distributed expression into a Matrix");
+    B.Resize( shape.height, shape.width );
+    internal::LocalEvaluate( e, B.Buffer(), B.LDim() );
+}
+
+template<typename T,Dist U,Dist V,typename E>
+inline void
+Evaluate( const Expr<E>& expr, DistMatrix<T,U,V>& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("fused::Evaluate"))
+    const E& e = expr.Self();
+    const Shape& shape = e.GetShape();
+    if( !shape.distributed )
+        LogicError("Cannot evaluate a local expression into a DistMatrix");
+    if( shape.grid != &B.Grid() )
+        LogicError("B must be distributed over the same grid as the operands");
+    if( shape.colDist != U || shape.rowDist != V )
+        LogicError("B must have the same distribution as the operands");
+    if( B.ColAlign() != shape.colAlign || B.RowAlign() != shape.rowAlign )
+        B.Align( shape.colAlign, shape.rowAlign );
+    B.Resize( shape.height, shape.width );
+    internal::LocalEvaluate( e, B.Buffer(), B.LDim() );
+}
+
+} // namespace fused
+} // namespace elem
+
+#endif // ifndef ELEM_FUSED_HPP
@@ -10,6 +10,8 @@
 #ifndef ELEM_HADAMARD_HPP
 #define ELEM_HADAMARD_HPP
 
+#include ELEM_FUSED_INC
+
 // C(i,j) := A(i,j) B(i,j)
 
 namespace elem {
@@ -20,13 +22,7 @@ inline void Hadamard( const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
     DEBUG_ONLY(CallStackEntry cse("Hadamard"))
     if( A.Height() != B.Height() || A.Width() != B.Width() )
         LogicError("Hadamard product requires equal dimensions");
-    C.Resize( A.Height(), A.Width() );
-
-    const Int height = A.Height();
-    const Int width = A.Width();
-    for( Int j=0; j<width; ++j )
-        for( Int i=0; i<height; ++i )
-            C.Set( i, j, A.Get(i,j)*B.Get(i,j) );
+    fused::Evaluate( fused::Hadamard( fused::Ref(A), fused::Ref(B) ), C );
 }
 
 template<typename T,Dist U,Dist V> 
@@ -40,21 +36,7 @@ inline void Hadamard
         LogicError("A and B must have the same grids");
     if( A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() )
         LogicError("A and B must be aligned");
-    const Grid& g = A.Grid();
-    C.AlignWith( A );
-    C.Resize( A.Height(), A.Width() );
-
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
-    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-    {
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const T alpha = A.GetLocal(iLoc,jLoc); 
-            const T beta = B.GetLocal(iLoc,jLoc);
-            C.SetLocal( iLoc, jLoc, alpha*beta );
-        }
-    }
+    fused::Evaluate( fused::Hadamard( fused::Ref(A), fused::Ref(B) ), C );
 }
 
 } // namespace elem
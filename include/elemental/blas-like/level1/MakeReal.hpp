@@ -10,6 +10,8 @@
 #ifndef ELEM_MAKEREAL_HPP
 #define ELEM_MAKEREAL_HPP
 
+#include ELEM_ENTRYWISEMAP_INC
+
 namespace elem {
 
 template<typename T>
@@ -17,13 +19,7 @@ inline void
 MakeReal( Matrix<T>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("MakeReal"))
-    T* ABuffer = A.Buffer();
-    const Int height = A.Height();
-    const Int width = A.Width();
-    const Int ldim = A.LDim();
-    for( Int j=0; j<width; ++j )
-        for( Int i=0; i<height; ++i )
-            ABuffer[i+j*ldim] = RealPart(ABuffer[i+j*ldim]);
+    EntrywiseMap( A, []( T alpha ) { return T(RealPart(alpha)); } );
 }
 
 template<typename T,Dist U,Dist V>
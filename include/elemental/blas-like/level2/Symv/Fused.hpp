@@ -0,0 +1,227 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_SYMV_FUSED_HPP
+#define ELEM_SYMV_FUSED_HPP
+
+#include ELEM_ENTRYWISEMAP_INC
+
+namespace elem {
+namespace internal {
+
+// The local contributions to z := alpha A x, where A is symmetric (or
+// Hermitian, if 'conjugate' is true) and only its 'uplo' triangle is
+// referenced, i.e., for uplo == LOWER,
+//
+//   zCol += alpha tril(A) xRow,
+//   zRow += alpha tril(A,-1)^{T/H} xCol,
+//
+// where xCol and zCol are indexed like the local rows of A (e.g., [MC,* ])
+// and xRow and zRow are indexed like its local columns (e.g., [MR,* ]).
+//
+// Rather than making separate sweeps over A for the two products (after
+// copying the triangle and zeroing the rest of it), the local columns are
+// swept in narrow blocks, each of which stays in cache while it is used for
+// both products, so that every local column is only streamed from memory
+// once. The rectangular part of each block is handled by a pair of Gemv
+// calls, while the few entries which straddle the diagonal are handled one
+// column at a time, with each column simultaneously yielding its axpy into
+// zCol and its dot product with xCol. LocalFusedGemv does the same for the
+// pair
+//
+//   zCol += alpha A xRow,
+//   zRow += alpha A^{T/H} xCol,
+//
+// which is needed for the off-diagonal panels.
+//
+// The blocks are split among OpenMP threads. Each entry of zRow is only
+// updated by the thread which owns its column, whereas every thread updates
+// all of zCol, so each thread accumulates into its own copy of zCol and the
+// copies are summed once the columns have been swept.
+
+// Only the local rows in [iLocLo,iLocHi) of the column are accessed
+template<typename T>
+inline void
+FusedSymvColumn
+( UpperOrLower uplo, const EntrywiseLayout& layout, Int jLoc,
+  Int iLocLo, Int iLocHi,
+  T alpha, const T* ACol, const T* xCol, Int incxCol, T xRowEntry,
+  T* zCol, Int inczCol, T& zRowEntry, bool conjugate )
+{
+    const Int strictOffset = ( uplo==LOWER ? -1 : 1 );
+    Int iLocBeg, iLocEnd, iLocStrictBeg, iLocStrictEnd;
+    TrapezoidRows( uplo, 0, layout, jLoc, iLocBeg, iLocEnd );
+    TrapezoidRows
+    ( uplo, strictOffset, layout, jLoc, iLocStrictBeg, iLocStrictEnd );
+    iLocBeg = Max( iLocBeg, iLocLo );
+    iLocEnd = Min( iLocEnd, iLocHi );
+    iLocStrictBeg = Min( Max( iLocStrictBeg, iLocLo ), iLocHi );
+    iLocStrictEnd = Max( Min( iLocStrictEnd, iLocHi ), iLocLo );
+
+    const T tau = alpha*xRowEntry;
+    T dot = 0;
+    if( conjugate )
+    {
+        for( Int iLoc=iLocStrictBeg; iLoc<iLocStrictEnd; ++iLoc )
+        {
+            const T value = ACol[iLoc];
+            zCol[iLoc*inczCol] += value*tau;
+            dot += Conj(value)*xCol[iLoc*incxCol];
+        }
+    }
+    else
+    {
+        for( Int iLoc=iLocStrictBeg; iLoc<iLocStrictEnd; ++iLoc )
+        {
+            const T value = ACol[iLoc];
+            zCol[iLoc*inczCol] += value*tau;
+            dot += value*xCol[iLoc*incxCol];
+        }
+    }
+
+    // The diagonal entry, if it is local, only contributes to zCol
+    for( Int iLoc=iLocBeg; iLoc<iLocStrictBeg; ++iLoc )
+        zCol[iLoc*inczCol] += ACol[iLoc]*tau;
+    for( Int iLoc=iLocStrictEnd; iLoc<iLocEnd; ++iLoc )
+        zCol[iLoc*inczCol] += ACol[iLoc]*tau;
+
+    zRowEntry += alpha*dot;
+}
+
+template<typename T>
+inline void
+FusedGemvBlock
+( Int height, Int width, T alpha, const T* A, Int ALDim,
+  const T* xCol, Int incxCol, const T* xRow, Int incxRow,
+        T* zCol, Int inczCol,       T* zRow, Int inczRow, bool conjugate )
+{
+    if( height == 0 || width == 0 )
+        return;
+    const char orientChar = ( conjugate ? 'C' : 'T' );
+    blas::Gemv
+    ( 'N', height, width,
+      alpha, A, ALDim, xRow, incxRow, T(1), zCol, inczCol );
+    blas::Gemv
+    ( orientChar, height, width,
+      alpha, A, ALDim, xCol, incxCol, T(1), zRow, inczRow );
+}
+
+// The number of local columns in each block: enough to amortize the Gemv
+// calls, but few enough that the block remains in cache between them
+inline Int
+FusedBlockWidth( Int localHeight )
+{ return Max( Min( (1<<14)/Max(localHeight,Int(1)), Int(32) ), Int(1) ); }
+
+// Calls sweep( jLocBeg, jLocEnd, zAcc, incAcc ) for each block of local
+// columns, where the block's contributions to zCol are to be added into zAcc
+template<typename T,class BlockSweep>
+inline void
+FusedBlockSweeps
+( Int localHeight, Int localWidth, T* zCol, Int inczCol, BlockSweep sweep )
+{
+    const Int blockWidth = FusedBlockWidth( localHeight );
+    const Int numBlocks = (localWidth+blockWidth-1) / blockWidth;
+#ifdef HAVE_OPENMP
+    const Int maxThreads = omp_get_max_threads();
+    if( maxThreads > 1 && numBlocks > 1 )
+    {
+        std::vector<T> zAccs( maxThreads*localHeight, T(0) );
+        #pragma omp parallel
+        {
+            T* zAcc = &zAccs[omp_get_thread_num()*localHeight];
+            #pragma omp for
+            for( Int k=0; k<numBlocks; ++k )
+                sweep
+                ( k*blockWidth, Min((k+1)*blockWidth,localWidth), zAcc, 1 );
+
+            #pragma omp for
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                T sum = 0;
+                for( Int t=0; t<maxThreads; ++t )
+                    sum += zAccs[iLoc+t*localHeight];
+                zCol[iLoc*inczCol] += sum;
+            }
+        }
+        return;
+    }
+#endif
+    for( Int k=0; k<numBlocks; ++k )
+        sweep
+        ( k*blockWidth, Min((k+1)*blockWidth,localWidth), zCol, inczCol );
+}
+
+template<typename T>
+inline void
+LocalFusedGemv
+( T alpha, const DistMatrix<T>& A,
+  const T* xCol, Int incxCol, const T* xRow, Int incxRow,
+        T* zCol, Int inczCol,       T* zRow, Int inczRow,
+  bool conjugate=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::LocalFusedGemv"))
+    const Int localHeight = A.LocalHeight();
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    FusedBlockSweeps
+    ( localHeight, A.LocalWidth(), zCol, inczCol,
+      [&]( Int jLocBeg, Int jLocEnd, T* zAcc, Int incAcc )
+      { FusedGemvBlock
+        ( localHeight, jLocEnd-jLocBeg, alpha, &ABuf[jLocBeg*ALDim], ALDim,
+          xCol, incxCol, &xRow[jLocBeg*incxRow], incxRow,
+          zAcc, incAcc, &zRow[jLocBeg*inczRow], inczRow, conjugate ); } );
+}
+
+template<typename T>
+inline void
+LocalFusedSymv
+( UpperOrLower uplo, T alpha, const DistMatrix<T>& A,
+  const T* xCol, Int incxCol, const T* xRow, Int incxRow,
+        T* zCol, Int inczCol,       T* zRow, Int inczRow,
+  bool conjugate=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::LocalFusedSymv"))
+    const EntrywiseLayout layout( A );
+    const Int localHeight = layout.localHeight;
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    FusedBlockSweeps
+    ( localHeight, layout.localWidth, zCol, inczCol,
+      [&]( Int jLocBeg, Int jLocEnd, T* zAcc, Int incAcc )
+      {
+          // The local rows [iLocRectBeg,iLocRectEnd) lie strictly within the
+          // triangle for every column of the block
+          Int iLocRectBeg, iLocRectEnd;
+          if( uplo == LOWER )
+              TrapezoidRows
+              ( LOWER, -1, layout, jLocEnd-1, iLocRectBeg, iLocRectEnd );
+          else
+              TrapezoidRows
+              ( UPPER, 1, layout, jLocBeg, iLocRectBeg, iLocRectEnd );
+          const Int iLocLo = ( uplo==LOWER ? 0 : iLocRectEnd );
+          const Int iLocHi = ( uplo==LOWER ? iLocRectBeg : localHeight );
+          for( Int jLoc=jLocBeg; jLoc<jLocEnd; ++jLoc )
+              FusedSymvColumn
+              ( uplo, layout, jLoc, iLocLo, iLocHi,
+                alpha, &ABuf[jLoc*ALDim], xCol, incxCol, xRow[jLoc*incxRow],
+                zAcc, incAcc, zRow[jLoc*inczRow], conjugate );
+          FusedGemvBlock
+          ( iLocRectEnd-iLocRectBeg, jLocEnd-jLocBeg,
+            alpha, &ABuf[iLocRectBeg+jLocBeg*ALDim], ALDim,
+            &xCol[iLocRectBeg*incxCol], incxCol,
+            &xRow[jLocBeg*incxRow], incxRow,
+            &zAcc[iLocRectBeg*incAcc], incAcc,
+            &zRow[jLocBeg*inczRow], inczRow, conjugate );
+      } );
+}
+
+} // namespace internal
+} // namespace elem
+
+#endif // ifndef ELEM_SYMV_FUSED_HPP
@@ -10,9 +10,8 @@
 #ifndef ELEM_SYMV_L_HPP
 #define ELEM_SYMV_L_HPP
 
-#include ELEM_MAKETRIANGULAR_INC
-#include ELEM_SETDIAGONAL_INC
 #include ELEM_GEMV_INC
+#include "./Fused.hpp"
 
 namespace elem {
 namespace internal {
@@ -57,12 +56,10 @@ LocalSymvColAccumulateL
             LogicError("Partial matrix distributions are misaligned");
     )
     const Grid& g = A.Grid();
-    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
     // Matrix views
     DistMatrix<T> A11(g),
                   A21(g);
-    DistMatrix<T> D11(g);
 
     DistMatrix<T,MC,STAR> 
         xT_MC_STAR(g),  x0_MC_STAR(g),
@@ -98,17 +95,18 @@ LocalSymvColAccumulateL
         View( z2_MC_STAR, z_MC_STAR, n0+n1, 0, n2, 1 );
         View( z1_MR_STAR, z_MR_STAR, n0,    0, n1, 1 );
  
-        D11.AlignWith( A11 );
         //--------------------------------------------------------------------//
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTriangular( LOWER, D11 );
-        LocalGemv( NORMAL, alpha, D11, x1_MR_STAR, T(1), z1_MC_STAR );
-        SetDiagonal( D11, T(0) );
-        LocalGemv( orientation, alpha, D11, x1_MC_STAR, T(1), z1_MR_STAR );
-
-        LocalGemv( NORMAL, alpha, A21, x1_MR_STAR, T(1), z2_MC_STAR );
-        LocalGemv( orientation, alpha, A21, x2_MC_STAR, T(1), z1_MR_STAR );
+        LocalFusedSymv
+        ( LOWER, alpha, A11,
+          x1_MC_STAR.LockedBuffer(), 1, x1_MR_STAR.LockedBuffer(), 1,
+          z1_MC_STAR.Buffer(),       1, z1_MR_STAR.Buffer(),       1,
+          conjugate );
+
+        LocalFusedGemv
+        ( alpha, A21,
+          x2_MC_STAR.LockedBuffer(), 1, x1_MR_STAR.LockedBuffer(), 1,
+          z2_MC_STAR.Buffer(),       1, z1_MR_STAR.Buffer(),       1,
+          conjugate );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionDown
@@ -160,12 +158,10 @@ LocalSymvRowAccumulateL
             LogicError("Partial matrix distributions are misaligned");
     )
     const Grid& g = A.Grid();
-    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
     // Matrix views
     DistMatrix<T> A11(g),
                   A21(g);
-    DistMatrix<T> D11(g);
 
     DistMatrix<T,STAR,MC> 
         xL_STAR_MC(g), xR_STAR_MC(g),
@@ -196,17 +192,20 @@ LocalSymvRowAccumulateL
         View( z2_STAR_MC, z_STAR_MC, 0, n0+n1, 1, n2 );
         View( z1_STAR_MR, z_STAR_MR, 0, n0,    1, n1 );
 
-        D11.AlignWith( A11 );
         //--------------------------------------------------------------------//
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTriangular( LOWER, D11 );
-        LocalGemv( NORMAL, alpha, D11, x1_STAR_MR, T(1), z1_STAR_MC );
-        SetDiagonal( D11, T(0) );
-        LocalGemv( orientation, alpha, D11, x1_STAR_MC, T(1), z1_STAR_MR );
-
-        LocalGemv( NORMAL, alpha, A21, x1_STAR_MR, T(1), z2_STAR_MC );
-        LocalGemv( orientation, alpha, A21, x2_STAR_MC, T(1), z1_STAR_MR );
+        LocalFusedSymv
+        ( LOWER, alpha, A11,
+          x1_STAR_MC.LockedBuffer(), x1_STAR_MC.LDim(),
+          x1_STAR_MR.LockedBuffer(), x1_STAR_MR.LDim(),
+          z1_STAR_MC.Buffer(),       z1_STAR_MC.LDim(),
+          z1_STAR_MR.Buffer(),       z1_STAR_MR.LDim(), conjugate );
+
+        LocalFusedGemv
+        ( alpha, A21,
+          x2_STAR_MC.LockedBuffer(), x2_STAR_MC.LDim(),
+          x1_STAR_MR.LockedBuffer(), x1_STAR_MR.LDim(),
+          z2_STAR_MC.Buffer(),       z2_STAR_MC.LDim(),
+          z1_STAR_MR.Buffer(),       z1_STAR_MR.LDim(), conjugate );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -10,9 +10,8 @@
 #ifndef ELEM_SYMV_U_HPP
 #define ELEM_SYMV_U_HPP
 
-#include ELEM_MAKETRIANGULAR_INC
-#include ELEM_SETDIAGONAL_INC
 #include ELEM_GEMV_INC
+#include "./Fused.hpp"
 
 namespace elem {
 namespace internal {
@@ -57,11 +56,9 @@ LocalSymvColAccumulateU
             LogicError("Partial matrix distributions are misaligned");
     )
     const Grid& g = A.Grid();
-    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
     // Matrix views
     DistMatrix<T> A11(g), A12(g);
-    DistMatrix<T> D11(g);
 
     DistMatrix<T,MC,STAR> x1_MC_STAR(g);
     DistMatrix<T,MR,STAR> 
@@ -98,17 +95,18 @@ LocalSymvColAccumulateU
         View( z1_MR_STAR, z_MR_STAR, n0,    0, n1, 1 );
         View( z2_MR_STAR, z_MR_STAR, n0+n1, 0, n2, 1 );
 
-        D11.AlignWith( A11 );
         //--------------------------------------------------------------------//
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTriangular( UPPER, D11 );
-        LocalGemv( NORMAL, alpha, D11, x1_MR_STAR, T(1), z1_MC_STAR );
-        SetDiagonal( D11, T(0) );
-        LocalGemv( orientation, alpha, D11, x1_MC_STAR, T(1), z1_MR_STAR );
+        LocalFusedSymv
+        ( UPPER, alpha, A11,
+          x1_MC_STAR.LockedBuffer(), 1, x1_MR_STAR.LockedBuffer(), 1,
+          z1_MC_STAR.Buffer(),       1, z1_MR_STAR.Buffer(),       1,
+          conjugate );
         
-        LocalGemv( NORMAL, alpha, A12, x2_MR_STAR, T(1), z1_MC_STAR );
-        LocalGemv( orientation, alpha, A12, x1_MC_STAR, T(1), z2_MR_STAR );
+        LocalFusedGemv
+        ( alpha, A12,
+          x1_MC_STAR.LockedBuffer(), 1, x2_MR_STAR.LockedBuffer(), 1,
+          z1_MC_STAR.Buffer(),       1, z2_MR_STAR.Buffer(),       1,
+          conjugate );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionDown
@@ -160,11 +158,9 @@ LocalSymvRowAccumulateU
             LogicError("Partial matrix distributions are misaligned");
     )
     const Grid& g = A.Grid();
-    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
     // Matrix views
     DistMatrix<T> A11(g), A12(g);
-    DistMatrix<T> D11(g);
 
     DistMatrix<T,STAR,MC> x1_STAR_MC(g);
     DistMatrix<T,STAR,MR> 
@@ -195,17 +191,20 @@ LocalSymvRowAccumulateU
         View( z1_STAR_MR, z_STAR_MR, 0, n0,    1, n1 );
         View( z2_STAR_MR, z_STAR_MR, 0, n0+n1, 1, n2 );
 
-        D11.AlignWith( A11 );
         //--------------------------------------------------------------------//
-        // TODO: These diagonal block updates can be greatly improved
-        D11 = A11;
-        MakeTriangular( UPPER, D11 );
-        LocalGemv( NORMAL, alpha, D11, x1_STAR_MR, T(1), z1_STAR_MC );
-        SetDiagonal( D11, T(0) );
-        LocalGemv( orientation, alpha, D11, x1_STAR_MC, T(1), z1_STAR_MR );
-
-        LocalGemv( NORMAL, alpha, A12, x2_STAR_MR, T(1), z1_STAR_MC );
-        LocalGemv( orientation, alpha, A12, x1_STAR_MC, T(1), z2_STAR_MR );
+        LocalFusedSymv
+        ( UPPER, alpha, A11,
+          x1_STAR_MC.LockedBuffer(), x1_STAR_MC.LDim(),
+          x1_STAR_MR.LockedBuffer(), x1_STAR_MR.LDim(),
+          z1_STAR_MC.Buffer(),       z1_STAR_MC.LDim(),
+          z1_STAR_MR.Buffer(),       z1_STAR_MR.LDim(), conjugate );
+
+        LocalFusedGemv
+        ( alpha, A12,
+          x1_STAR_MC.LockedBuffer(), x1_STAR_MC.LDim(),
+          x2_STAR_MR.LockedBuffer(), x2_STAR_MR.LDim(),
+          z1_STAR_MC.Buffer(),       z1_STAR_MC.LDim(),
+          z2_STAR_MR.Buffer(),       z2_STAR_MR.LDim(), conjugate );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
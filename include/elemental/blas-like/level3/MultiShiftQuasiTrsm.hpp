@@ -0,0 +1,441 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_MULTISHIFTQUASITRSM_HPP
+#define ELEM_MULTISHIFTQUASITRSM_HPP
+
+#include ELEM_MULTISHIFTTRSM_INC
+
+namespace elem {
+namespace msquasitrsm {
+
+// Solves against shifted real upper quasi-triangular matrices, such as the
+// real Schur factors of real matrices, with complex shifts and right-hand
+// sides. The 2x2 diagonal blocks are marked by nonzero subdiagonal entries,
+// and so the strictly lower triangle beneath the first subdiagonal is never
+// accessed. Keeping the matrix real halves its storage and the flops of
+// every update with it, and the trailing updates are performed by a single
+// real Gemm on the split real and imaginary parts of the solved rows.
+
+// C := C - op(A) B, where A is real and B and C are complex
+template<typename Real>
+inline void
+LocalUpdate
+( Orientation orientation, const Matrix<Real>& A,
+  const Matrix<Complex<Real> >& B, Matrix<Complex<Real> >& C )
+{
+    DEBUG_ONLY(CallStackEntry cse("msquasitrsm::LocalUpdate"))
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = B.Height();
+    if( m == 0 || n == 0 || k == 0 )
+        return;
+
+    // BSplit := [real(B), imag(B)]
+    Matrix<Real> BSplit( k, 2*n ), CSplit;
+    for( Int j=0; j<n; ++j )
+    {
+        const Complex<Real>* b = B.LockedBuffer(0,j);
+        Real* bReal = BSplit.Buffer(0,j);
+        Real* bImag = BSplit.Buffer(0,j+n);
+        for( Int i=0; i<k; ++i )
+        {
+            bReal[i] = b[i].real();
+            bImag[i] = b[i].imag();
+        }
+    }
+    Zeros( CSplit, m, 2*n );
+    Gemm( orientation, NORMAL, Real(1), A, BSplit, Real(0), CSplit );
+    for( Int j=0; j<n; ++j )
+    {
+        Complex<Real>* c = C.Buffer(0,j);
+        const Real* cReal = CSplit.LockedBuffer(0,j);
+        const Real* cImag = CSplit.LockedBuffer(0,j+n);
+        for( Int i=0; i<m; ++i )
+            c[i] -= Complex<Real>(cReal[i],cImag[i]);
+    }
+}
+
+template<typename Real>
+inline void
+LeftUnb
+( Orientation orientation, const Matrix<Real>& U,
+  const Matrix<Complex<Real> >& shifts, Matrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("msquasitrsm::LeftUnb");
+        if( shifts.Height() != X.Width() )
+            LogicError("Incompatible number of shifts");
+    )
+    typedef Complex<Real> C;
+    const Int n = U.Height();
+    const Int numShifts = shifts.Height();
+    if( n == 0 || numShifts == 0 )
+        return;
+    const bool conjugate = ( orientation == ADJOINT );
+    const Real* UBuf = U.LockedBuffer();
+    const Int ldim = U.LDim();
+
+    const Int shiftBlocksize = mstrsm::ShiftBlocksize<C>( n );
+    std::vector<C> XT( shiftBlocksize*n ), sigma( shiftBlocksize );
+    for( Int s0=0; s0<numShifts; s0+=shiftBlocksize )
+    {
+        const Int sb = Min(shiftBlocksize,numShifts-s0);
+
+        // XT := X(:,s0:s0+sb-1)^T
+        for( Int s=0; s<sb; ++s )
+        {
+            const C* xCol = X.LockedBuffer(0,s0+s);
+            for( Int i=0; i<n; ++i )
+                XT[s+i*sb] = xCol[i];
+            sigma[s] = ( conjugate ? Conj(shifts.Get(s0+s,0))
+                                   : shifts.Get(s0+s,0) );
+        }
+
+        if( orientation == NORMAL )
+        {
+            // Sweep backwards, solving against each diagonal block and then
+            // subtracting its contribution from the unsolved entries above
+            Int i = n-1;
+            while( i >= 0 )
+            {
+                const Real* uCol = &UBuf[i*ldim];
+                C* xi = &XT[i*sb];
+                if( i > 0 && UBuf[i+(i-1)*ldim] != Real(0) )
+                {
+                    const Real* uPrevCol = &UBuf[(i-1)*ldim];
+                    const Real alpha = uPrevCol[i-1];
+                    const Real beta = uCol[i-1];
+                    const Real gamma = uPrevCol[i];
+                    const Real delta = uCol[i];
+                    C* xPrev = &XT[(i-1)*sb];
+                    for( Int s=0; s<sb; ++s )
+                    {
+                        const C alphaShift = alpha - sigma[s];
+                        const C deltaShift = delta - sigma[s];
+                        const C det = alphaShift*deltaShift - beta*gamma;
+                        const C rho0 = xPrev[s];
+                        const C rho1 = xi[s];
+                        xPrev[s] = (deltaShift*rho0 - beta*rho1)/det;
+                        xi[s] = (alphaShift*rho1 - gamma*rho0)/det;
+                    }
+                    for( Int k=0; k<i-1; ++k )
+                    {
+                        const Real eta0 = uPrevCol[k];
+                        const Real eta1 = uCol[k];
+                        C* xk = &XT[k*sb];
+                        for( Int s=0; s<sb; ++s )
+                            xk[s] -= eta0*xPrev[s] + eta1*xi[s];
+                    }
+                    i -= 2;
+                }
+                else
+                {
+                    const Real tau = uCol[i];
+                    for( Int s=0; s<sb; ++s )
+                        xi[s] /= tau - sigma[s];
+                    for( Int k=0; k<i; ++k )
+                    {
+                        const Real eta = uCol[k];
+                        C* xk = &XT[k*sb];
+                        for( Int s=0; s<sb; ++s )
+                            xk[s] -= eta*xi[s];
+                    }
+                    i -= 1;
+                }
+            }
+        }
+        else
+        {
+            // Sweep forwards, subtracting the contributions of the solved
+            // entries from each diagonal block of U^T before solving
+            // against it
+            Int i = 0;
+            while( i < n )
+            {
+                const Real* uCol = &UBuf[i*ldim];
+                C* xi = &XT[i*sb];
+                if( i < n-1 && UBuf[(i+1)+i*ldim] != Real(0) )
+                {
+                    const Real* uNextCol = &UBuf[(i+1)*ldim];
+                    C* xNext = &XT[(i+1)*sb];
+                    for( Int k=0; k<i; ++k )
+                    {
+                        const Real eta0 = uCol[k];
+                        const Real eta1 = uNextCol[k];
+                        const C* xk = &XT[k*sb];
+                        for( Int s=0; s<sb; ++s )
+                        {
+                            xi[s] -= eta0*xk[s];
+                            xNext[s] -= eta1*xk[s];
+                        }
+                    }
+                    const Real alpha = uCol[i];
+                    const Real beta = uNextCol[i];
+                    const Real gamma = uCol[i+1];
+                    const Real delta = uNextCol[i+1];
+                    for( Int s=0; s<sb; ++s )
+                    {
+                        const C alphaShift = alpha - sigma[s];
+                        const C deltaShift = delta - sigma[s];
+                        const C det = alphaShift*deltaShift - beta*gamma;
+                        const C rho0 = xi[s];
+                        const C rho1 = xNext[s];
+                        xi[s] = (deltaShift*rho0 - gamma*rho1)/det;
+                        xNext[s] = (alphaShift*rho1 - beta*rho0)/det;
+                    }
+                    i += 2;
+                }
+                else
+                {
+                    for( Int k=0; k<i; ++k )
+                    {
+                        const Real eta = uCol[k];
+                        const C* xk = &XT[k*sb];
+                        for( Int s=0; s<sb; ++s )
+                            xi[s] -= eta*xk[s];
+                    }
+                    const Real tau = uCol[i];
+                    for( Int s=0; s<sb; ++s )
+                        xi[s] /= tau - sigma[s];
+                    i += 1;
+                }
+            }
+        }
+
+        // X(:,s0:s0+sb-1) := XT^T
+        for( Int s=0; s<sb; ++s )
+        {
+            C* xCol = X.Buffer(0,s0+s);
+            for( Int i=0; i<n; ++i )
+                xCol[i] = XT[s+i*sb];
+        }
+    }
+}
+
+// Since a 2x2 diagonal block must not be split between two blocks of rows,
+// the block boundaries are moved down by one where necessary, so the
+// subdiagonal of U is required on every process
+
+template<typename Real>
+inline void
+LUN
+( Complex<Real> alpha, const Matrix<Real>& U,
+  const Matrix<Complex<Real> >& shifts, Matrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("msquasitrsm::LUN"))
+    Scale( alpha, X );
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int bsize = Blocksize();
+    Int kEnd = m;
+    while( kEnd > 0 )
+    {
+        Int k = Max(kEnd-bsize,0);
+        if( k > 0 && U.Get(k,k-1) != Real(0) )
+            --k;
+
+        auto U01 = LockedViewRange( U, 0, k, k,    kEnd );
+        auto U11 = LockedViewRange( U, k, k, kEnd, kEnd );
+
+        auto X0 = ViewRange( X, 0, 0, k,    n );
+        auto X1 = ViewRange( X, k, 0, kEnd, n );
+
+        LeftUnb( NORMAL, U11, shifts, X1 );
+        LocalUpdate( NORMAL, U01, X1, X0 );
+        kEnd = k;
+    }
+}
+
+template<typename Real>
+inline void
+LUN
+( Complex<Real> alpha, const DistMatrix<Real>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+  DistMatrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("msquasitrsm::LUN"))
+    typedef Complex<Real> C;
+    Scale( alpha, X );
+
+    const Grid& g = U.Grid();
+    DistMatrix<Real,MC,  STAR> U01_MC_STAR(g);
+    DistMatrix<Real,STAR,STAR> U11_STAR_STAR(g);
+    DistMatrix<C,   STAR,MR  > X1_STAR_MR(g);
+    DistMatrix<C,   STAR,VR  > X1_STAR_VR(g);
+    DistMatrix<Real,STAR,STAR> subdiag( U.GetDiagonal(-1) );
+
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int bsize = Blocksize();
+    Int kEnd = m;
+    while( kEnd > 0 )
+    {
+        Int k = Max(kEnd-bsize,0);
+        if( k > 0 && subdiag.GetLocal(k-1,0) != Real(0) )
+            --k;
+
+        auto U01 = LockedViewRange( U, 0, k, k,    kEnd );
+        auto U11 = LockedViewRange( U, k, k, kEnd, kEnd );
+
+        auto X0 = ViewRange( X, 0, 0, k,    n );
+        auto X1 = ViewRange( X, k, 0, kEnd, n );
+
+        // X1[* ,VR] := U11^-1[* ,* ] X1[* ,VR]
+        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[MC,MR]
+        X1_STAR_VR.AlignWith( shifts );
+        X1_STAR_VR = X1; // X1[* ,VR] <- X1[MC,MR]
+        LeftUnb
+        ( NORMAL, U11_STAR_STAR.LockedMatrix(), shifts.LockedMatrix(),
+          X1_STAR_VR.Matrix() );
+
+        X1_STAR_MR.AlignWith( X0 );
+        X1_STAR_MR = X1_STAR_VR; // X1[* ,MR]  <- X1[* ,VR]
+        X1 = X1_STAR_MR; // X1[MC,MR] <- X1[* ,MR]
+
+        // X0[MC,MR] -= U01[MC,* ] X1[* ,MR]
+        U01_MC_STAR.AlignWith( X0 );
+        U01_MC_STAR = U01; // U01[MC,* ] <- U01[MC,MR]
+        LocalUpdate
+        ( NORMAL, U01_MC_STAR.LockedMatrix(), X1_STAR_MR.LockedMatrix(),
+          X0.Matrix() );
+        kEnd = k;
+    }
+}
+
+template<typename Real>
+inline void
+LUT
+( Orientation orientation, Complex<Real> alpha, const Matrix<Real>& U,
+  const Matrix<Complex<Real> >& shifts, Matrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("msquasitrsm::LUT"))
+    Scale( alpha, X );
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int bsize = Blocksize();
+    Int k = 0;
+    while( k < m )
+    {
+        Int kEnd = Min(k+bsize,m);
+        if( kEnd < m && U.Get(kEnd,kEnd-1) != Real(0) )
+            ++kEnd;
+
+        auto U11 = LockedViewRange( U, k, k,    kEnd, kEnd );
+        auto U12 = LockedViewRange( U, k, kEnd, kEnd, m    );
+
+        auto X1 = ViewRange( X, k,    0, kEnd, n );
+        auto X2 = ViewRange( X, kEnd, 0, m,    n );
+
+        LeftUnb( orientation, U11, shifts, X1 );
+        LocalUpdate( TRANSPOSE, U12, X1, X2 );
+        k = kEnd;
+    }
+}
+
+template<typename Real>
+inline void
+LUT
+( Orientation orientation, Complex<Real> alpha, const DistMatrix<Real>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+  DistMatrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("msquasitrsm::LUT"))
+    typedef Complex<Real> C;
+    Scale( alpha, X );
+
+    const Grid& g = U.Grid();
+    DistMatrix<Real,STAR,STAR> U11_STAR_STAR(g);
+    DistMatrix<Real,STAR,MC  > U12_STAR_MC(g);
+    DistMatrix<C,   STAR,MR  > X1_STAR_MR(g);
+    DistMatrix<C,   STAR,VR  > X1_STAR_VR(g);
+    DistMatrix<Real,STAR,STAR> subdiag( U.GetDiagonal(-1) );
+
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int bsize = Blocksize();
+    Int k = 0;
+    while( k < m )
+    {
+        Int kEnd = Min(k+bsize,m);
+        if( kEnd < m && subdiag.GetLocal(kEnd-1,0) != Real(0) )
+            ++kEnd;
+
+        auto U11 = LockedViewRange( U, k, k,    kEnd, kEnd );
+        auto U12 = LockedViewRange( U, k, kEnd, kEnd, m    );
+
+        auto X1 = ViewRange( X, k,    0, kEnd, n );
+        auto X2 = ViewRange( X, kEnd, 0, m,    n );
+
+        // X1[* ,VR] := U11^-'[*,*] X1[* ,VR]
+        U11_STAR_STAR = U11; // U11[* ,* ] <- U11[MC,MR]
+        X1_STAR_VR.AlignWith( shifts );
+        X1_STAR_VR = X1;  // X1[* ,VR] <- X1[MC,MR]
+        LeftUnb
+        ( orientation, U11_STAR_STAR.LockedMatrix(), shifts.LockedMatrix(),
+          X1_STAR_VR.Matrix() );
+
+        X1_STAR_MR.AlignWith( X2 );
+        X1_STAR_MR  = X1_STAR_VR; // X1[* ,MR]  <- X1[* ,VR]
+        X1          = X1_STAR_MR; // X1[MC,MR]  <- X1[* ,MR]
+
+        // X2[MC,MR] -= (U12[* ,MC])^T X1[* ,MR]
+        U12_STAR_MC.AlignWith( X2 );
+        U12_STAR_MC = U12; // U12[* ,MC] <- U12[MC,MR]
+        LocalUpdate
+        ( TRANSPOSE, U12_STAR_MC.LockedMatrix(), X1_STAR_MR.LockedMatrix(),
+          X2.Matrix() );
+        k = kEnd;
+    }
+}
+
+} // namespace msquasitrsm
+
+template<typename Real>
+inline void
+MultiShiftQuasiTrsm
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  Complex<Real> alpha, const Matrix<Real>& U,
+  const Matrix<Complex<Real> >& shifts, Matrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("MultiShiftQuasiTrsm"))
+    if( side == LEFT && uplo == UPPER )
+    {
+        if( orientation == NORMAL )
+            msquasitrsm::LUN( alpha, U, shifts, X );
+        else
+            msquasitrsm::LUT( orientation, alpha, U, shifts, X );
+    }
+    else
+        LogicError("This option is not yet supported");
+}
+
+template<typename Real>
+inline void
+MultiShiftQuasiTrsm
+( LeftOrRight side, UpperOrLower uplo, Orientation orientation,
+  Complex<Real> alpha, const DistMatrix<Real>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+  DistMatrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("MultiShiftQuasiTrsm"))
+    if( side == LEFT && uplo == UPPER )
+    {
+        if( orientation == NORMAL )
+            msquasitrsm::LUN( alpha, U, shifts, X );
+        else
+            msquasitrsm::LUT( orientation, alpha, U, shifts, X );
+    }
+    else
+        LogicError("This option is not yet supported");
+}
+
+} // namespace elem
+
+#endif // ifndef ELEM_MULTISHIFTQUASITRSM_HPP
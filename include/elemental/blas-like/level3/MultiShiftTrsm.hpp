@@ -13,43 +13,112 @@
 namespace elem {
 namespace mstrsm {
 
+// The right-hand sides are solved in blocks of shifts which are stored in a
+// transposed workspace, XT, so that the right-hand sides for different shifts
+// are contiguous. Each update of the triangular sweep is then a vectorizable
+// loop over the shifts, the shifted diagonal need not be formed explicitly,
+// and the blocksize is chosen so that the workspace remains in cache.
+
+template<typename F>
+inline Int
+ShiftBlocksize( Int n )
+{
+    const Int target = (1<<18) / (Max(n,Int(1))*Int(sizeof(F)));
+    return Max(Min(target,Int(128)),Int(8));
+}
+
 template<typename F>
 inline void
 LeftUnb
 ( UpperOrLower uplo, Orientation orientation, F alpha, 
-  Matrix<F>& T, const Matrix<F>& shifts, Matrix<F>& X ) 
+  const Matrix<F>& T, const Matrix<F>& shifts, Matrix<F>& X ) 
 {
     DEBUG_ONLY(
         CallStackEntry cse("mstrsm::LeftUnb");
         if( shifts.Height() != X.Width() )
             LogicError("Incompatible number of shifts");
     )
-    const char uploChar = ( uplo==LOWER ? 'L' : 'U' );
-    char orientChar; 
-    switch( orientation )
-    {
-    case NORMAL:    orientChar = 'N'; break;
-    case TRANSPOSE: orientChar = 'T'; break;
-    case ADJOINT:   orientChar = 'C'; break;
-    }
-    auto diag = T.GetDiagonal();
+    Scale( alpha, X );
     const Int n = T.Height();
-    const Int ldim = T.LDim();
     const Int numShifts = shifts.Height();
-    Scale( alpha, X );
-    for( Int j=0; j<numShifts; ++j )
+    if( n == 0 || numShifts == 0 )
+        return;
+    const bool conjugate = ( orientation == ADJOINT );
+    // op(T) is upper triangular if and only if we must sweep backwards
+    const bool backward = ( (uplo==UPPER) == (orientation==NORMAL) );
+    const F* TBuf = T.LockedBuffer();
+    const Int ldim = T.LDim();
+
+    const Int shiftBlocksize = ShiftBlocksize<F>( n );
+    std::vector<F> XT( shiftBlocksize*n ), sigma( shiftBlocksize );
+    for( Int s0=0; s0<numShifts; s0+=shiftBlocksize )
     {
-        UpdateDiagonal( T, -shifts.Get(j,0) );
-        blas::Trsv
-        ( uploChar, orientChar, 'N', n, 
-          T.LockedBuffer(), ldim, X.Buffer(0,j), 1 );
-        T.SetDiagonal( diag );
+        const Int sb = Min(shiftBlocksize,numShifts-s0);
+
+        // XT := X(:,s0:s0+sb-1)^T
+        for( Int s=0; s<sb; ++s )
+        {
+            const F* xCol = X.LockedBuffer(0,s0+s);
+            for( Int i=0; i<n; ++i )
+                XT[s+i*sb] = xCol[i];
+            sigma[s] = ( conjugate ? Conj(shifts.Get(s0+s,0)) 
+                                   : shifts.Get(s0+s,0) );
+        }
+
+        for( Int t=0; t<n; ++t )
+        {
+            const Int i = ( backward ? n-1-t : t );
+            const F* tCol = &TBuf[i*ldim];
+            F* xi = &XT[i*sb];
+            if( orientation == NORMAL )
+            {
+                // x(i) /= T(i,i) - sigma, then subtract x(i) T(k,i) from 
+                // each unsolved x(k)
+                const F tau = tCol[i];
+                for( Int s=0; s<sb; ++s )
+                    xi[s] /= tau - sigma[s];
+                const Int kBeg = ( backward ? 0 : i+1 );
+                const Int kEnd = ( backward ? i : n   );
+                for( Int k=kBeg; k<kEnd; ++k )
+                {
+                    const F eta = tCol[k];
+                    F* xk = &XT[k*sb];
+                    for( Int s=0; s<sb; ++s )
+                        xk[s] -= FastMul(eta,xi[s]);
+                }
+            }
+            else
+            {
+                // Subtract op(T(k,i)) x(k) for each solved x(k), then 
+                // x(i) /= op(T(i,i) - sigma)
+                const Int kBeg = ( backward ? i+1 : 0 );
+                const Int kEnd = ( backward ? n   : i );
+                for( Int k=kBeg; k<kEnd; ++k )
+                {
+                    const F eta = ( conjugate ? Conj(tCol[k]) : tCol[k] );
+                    const F* xk = &XT[k*sb];
+                    for( Int s=0; s<sb; ++s )
+                        xi[s] -= FastMul(eta,xk[s]);
+                }
+                const F tau = ( conjugate ? Conj(tCol[i]) : tCol[i] );
+                for( Int s=0; s<sb; ++s )
+                    xi[s] /= tau - sigma[s];
+            }
+        }
+
+        // X(:,s0:s0+sb-1) := XT^T
+        for( Int s=0; s<sb; ++s )
+        {
+            F* xCol = X.Buffer(0,s0+s);
+            for( Int i=0; i<n; ++i )
+                xCol[i] = XT[s+i*sb];
+        }
     }
 }
 
 template<typename F>
 inline void
-LUN( F alpha, Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X ) 
+LUN( F alpha, const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X ) 
 {
     DEBUG_ONLY(CallStackEntry cse("mstrsm::LUN"))
     Scale( alpha, X );
@@ -62,7 +131,7 @@ LUN( F alpha, Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X )
         const Int nb = Min(bsize,m-k);
 
         auto U01 = LockedViewRange( U, 0, k, k,    k+nb );
-        auto U11 =       ViewRange( U, k, k, k+nb, k+nb );
+        auto U11 = LockedViewRange( U, k, k, k+nb, k+nb );
 
         auto X0 = ViewRange( X, 0, 0, k,    n );
         auto X1 = ViewRange( X, k, 0, k+nb, n );
@@ -124,7 +193,7 @@ template<typename F>
 inline void
 LUT
 ( Orientation orientation, F alpha, 
-  Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X ) 
+  const Matrix<F>& U, const Matrix<F>& shifts, Matrix<F>& X ) 
 {
     DEBUG_ONLY(CallStackEntry cse("mstrsm::LUT"))
     Scale( alpha, X );
@@ -136,7 +205,7 @@ LUT
     {
         const Int nb = Min(bsize,m-k);
 
-        auto U11 =       ViewRange( U, k, k,    k+nb, k+nb );
+        auto U11 = LockedViewRange( U, k, k,    k+nb, k+nb );
         auto U12 = LockedViewRange( U, k, k+nb, k+nb, m    );
 
         auto X1 = ViewRange( X, k,    0, k+nb, n );
@@ -12,6 +12,7 @@
 
 #include ELEM_ADJOINT_INC
 #include "./Sylvester.hpp"
+#include "./Lyapunov/LowRankADI.hpp"
 
 namespace elem {
 
@@ -72,6 +73,68 @@ Lyapunov( const DistMatrix<F>& A, const DistMatrix<F>& C, DistMatrix<F>& X )
     return Sylvester( m, W, X );
 }
 
+namespace lyapunov {
+
+// The Bartels-Stewart algorithm for A X + X A^H = C: a single Schur
+// decomposition, A = Q T Q^H, reduces the problem to the triangular
+// Sylvester equation T Y + Y T^H = Q^H C Q, and then X = Q Y Q^H. It only
+// requires that no two eigenvalues of A sum to zero, i.e., that A and -A^H
+// have disjoint spectra.
+
+template<typename F>
+inline void
+BartelsStewart( const Matrix<F>& A, const Matrix<F>& C, Matrix<F>& X )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("lyapunov::BartelsStewart");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( C.Height() != A.Height() || C.Width() != A.Height() )
+            LogicError("C must conform with A");
+    )
+    Matrix<F> T( A ), Q, Z;
+    Matrix<Complex<BASE(F)>> w;
+    Schur( T, w, Q );
+
+    Gemm( ADJOINT, NORMAL, F(1), Q, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, Q, X );
+    sylvester::Triangular( ADJOINT, T, T, X );
+    Gemm( NORMAL, NORMAL, F(1), Q, X, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, Q, X );
+}
+
+template<typename F>
+inline void
+BartelsStewart
+( const DistMatrix<F>& A, const DistMatrix<F>& C, DistMatrix<F>& X )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("lyapunov::BartelsStewart");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( C.Height() != A.Height() || C.Width() != A.Height() )
+            LogicError("C must conform with A");
+        if( A.Grid() != C.Grid() )
+            LogicError("A and C must have the same grid");
+    )
+    typedef Complex<BASE(F)> CF;
+    const Grid& g = A.Grid();
+    DistMatrix<CF> T(g), Q(g), Y(g), Z(g);
+    DistMatrix<CF,VR,STAR> w(g);
+    sylvester::MakeComplex( A, T );
+    Schur( T, w, Q );
+
+    sylvester::MakeComplex( C, Z );
+    Gemm( ADJOINT, NORMAL, CF(1), Q, Z, Y );
+    Gemm( NORMAL, NORMAL, CF(1), Y, Q, Z );
+    sylvester::Triangular( ADJOINT, T, T, Z );
+    Gemm( NORMAL, NORMAL, CF(1), Q, Z, Y );
+    Gemm( NORMAL, ADJOINT, CF(1), Y, Q, Z );
+    sylvester::TakeReal( Z, X );
+}
+
+} // namespace lyapunov
+
 } // namespace elem
 
 #endif // ifndef ELEM_LYAPUNOV_HPP
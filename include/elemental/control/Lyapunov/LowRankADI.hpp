@@ -0,0 +1,528 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_LYAPUNOV_LOWRANKADI_HPP
+#define ELEM_LYAPUNOV_LOWRANKADI_HPP
+
+#include ELEM_AXPY_INC
+#include ELEM_SCALE_INC
+#include ELEM_GEMM_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_LU_INC
+#include ELEM_HESSENBERG_INC
+#include ELEM_MULTISHIFTHESSSOLVE_INC
+#include ELEM_SCHUR_INC
+#include ELEM_UNIFORM_INC
+
+namespace elem {
+namespace lyapunov {
+
+// When C = B B^H has low rank, the solution of A X + X A^H = C is typically
+// of low numerical rank, and the low-rank ADI iteration directly computes a
+// factor Z, with k columns per iteration, such that X ~= Z Z^H. Given the
+// shifts p_j, which must lie in the open right-half plane,
+//
+//   V_j := (A + p_j I)^{-1} W_{j-1},
+//   W_j := W_{j-1} - 2 Re(p_j) V_j,
+//   Z_j := [Z_{j-1}, sqrt(2 Re(p_j)) V_j],
+//
+// starting from W_0 = B, and the residual of Z_j Z_j^H is exactly
+// -W_j W_j^H, so that convergence can be monitored with O(nk) work.
+// A is reduced to upper Hessenberg form, A = Q H Q^H, once, and the
+// iteration is run with H in place of A and Q^H B in place of B, so that
+// each shifted solve is a multi-shift Hessenberg solve requiring O(n^2 k)
+// work. Only the n x n Hessenberg factorization is stored, regardless of the
+// number of shifts, and the final factor is multiplied by Q.
+//
+// See Benner, Kurschner, and Saak's "An improved numerical method for
+// balanced truncation for symmetric second-order systems", as well as
+// Li and White's "Low rank solution of Lyapunov equations".
+
+namespace adi {
+
+template<typename Real>
+inline void
+MakeShift( Complex<Real> alpha, Real& shift )
+{ shift = alpha.real(); }
+
+template<typename Real>
+inline void
+MakeShift( Complex<Real> alpha, Complex<Real>& shift )
+{ shift = alpha; }
+
+// The contraction of the ADI error operator over eigenvalue lambda for the
+// shift p
+template<typename Real>
+inline Real
+Contraction( Complex<Real> p, Complex<Real> lambda )
+{ return Abs(lambda-Conj(p)) / Abs(lambda+p); }
+
+// Penzl's heuristic: greedily choose the shifts from the Ritz values so as
+// to minimize the largest contraction over all of them. For real data, the
+// shifts are kept real by instead choosing the magnitude of each Ritz
+// value, which is the best real shift for the pair lambda, conj(lambda).
+template<typename F>
+inline void
+PenzlShifts
+( const std::vector<Complex<BASE(F)>>& ritz, Int numShifts,
+  std::vector<F>& shifts )
+{
+    DEBUG_ONLY(CallStackEntry cse("lyapunov::adi::PenzlShifts"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    std::vector<C> stable, candidates;
+    for( Int i=0; i<Int(ritz.size()); ++i )
+    {
+        if( ritz[i].real() <= Real(0) )
+            continue;
+        stable.push_back( ritz[i] );
+        if( IsComplex<F>::val )
+            candidates.push_back( ritz[i] );
+        else
+            candidates.push_back( C(Abs(ritz[i])) );
+    }
+    if( candidates.size() == 0 )
+        RuntimeError("No Ritz values were in the open right-half plane");
+
+    std::vector<C> chosen;
+    Real bestMax = -1;
+    Int best = 0;
+    for( Int i=0; i<Int(candidates.size()); ++i )
+    {
+        Real maxContraction = 0;
+        for( Int j=0; j<Int(stable.size()); ++j )
+            maxContraction =
+                Max( maxContraction, Contraction(candidates[i],stable[j]) );
+        if( bestMax < Real(0) || maxContraction < bestMax )
+        {
+            bestMax = maxContraction;
+            best = i;
+        }
+    }
+    chosen.push_back( candidates[best] );
+
+    // Repeatedly add the shift corresponding to the worst-resolved Ritz value
+    while( Int(chosen.size()) < numShifts )
+    {
+        Real worst = -1;
+        Int worstIndex = 0;
+        for( Int j=0; j<Int(stable.size()); ++j )
+        {
+            Real product = 1;
+            for( Int i=0; i<Int(chosen.size()); ++i )
+                product *= Contraction( chosen[i], stable[j] );
+            if( product > worst )
+            {
+                worst = product;
+                worstIndex = j;
+            }
+        }
+        const C lambda = stable[worstIndex];
+        const C next = ( IsComplex<F>::val ? lambda : C(Abs(lambda)) );
+        bool duplicate = false;
+        for( Int i=0; i<Int(chosen.size()); ++i )
+            if( chosen[i] == next )
+                duplicate = true;
+        if( duplicate )
+            break;
+        chosen.push_back( next );
+    }
+
+    shifts.resize( chosen.size() );
+    for( Int i=0; i<Int(chosen.size()); ++i )
+        MakeShift( chosen[i], shifts[i] );
+}
+
+// Run numSteps steps of Arnoldi, with two passes of classical Gram-Schmidt,
+// using the operator v := op(v), and return the Ritz values
+template<typename F,class OpType>
+inline void
+Ritz
+( OpType op, Int n, Int numSteps, std::vector<Complex<BASE(F)>>& ritz )
+{
+    DEBUG_ONLY(CallStackEntry cse("lyapunov::adi::Ritz"))
+    typedef Base<F> Real;
+    numSteps = Min( numSteps, n );
+    Matrix<F> V( n, numSteps+1 ), H, h;
+    Zeros( H, numSteps+1, numSteps );
+    auto v0 = View( V, 0, 0, n, 1 );
+    MakeUniform( v0 );
+    Scale( Real(1)/FrobeniusNorm(v0), v0 );
+
+    Int k=0;
+    for( ; k<numSteps; ++k )
+    {
+        auto VPrev = View( V, 0, 0,   n, k+1 );
+        auto vk    = View( V, 0, k,   n, 1   );
+        auto vNext = View( V, 0, k+1, n, 1   );
+        vNext = vk;
+        op( vNext );
+        for( Int pass=0; pass<2; ++pass )
+        {
+            Gemm( ADJOINT, NORMAL, F(1), VPrev, vNext, h );
+            Gemm( NORMAL, NORMAL, F(-1), VPrev, h, F(1), vNext );
+            for( Int i=0; i<=k; ++i )
+                H.Update( i, k, h.Get(i,0) );
+        }
+        const Real beta = FrobeniusNorm( vNext );
+        H.Set( k+1, k, beta );
+        if( beta == Real(0) )
+        {
+            // An invariant subspace was found
+            ++k;
+            break;
+        }
+        Scale( Real(1)/beta, vNext );
+    }
+
+    auto HSquare = LockedView( H, 0, 0, k, k );
+    Matrix<F> HCopy( HSquare );
+    Matrix<Complex<Real>> w;
+    schur::QR( HCopy, w );
+    ritz.resize( k );
+    for( Int i=0; i<k; ++i )
+        ritz[i] = w.Get(i,0);
+}
+
+template<typename F,class OpType>
+inline void
+Ritz
+( OpType op, const Grid& g, Int n, Int numSteps,
+  std::vector<Complex<BASE(F)>>& ritz )
+{
+    DEBUG_ONLY(CallStackEntry cse("lyapunov::adi::Ritz"))
+    typedef Base<F> Real;
+    numSteps = Min( numSteps, n );
+    DistMatrix<F> V( n, numSteps+1, g ), h(g);
+    Matrix<F> H;
+    Zeros( H, numSteps+1, numSteps );
+    auto v0 = View( V, 0, 0, n, 1 );
+    MakeUniform( v0 );
+    Scale( Real(1)/FrobeniusNorm(v0), v0 );
+
+    Int k=0;
+    for( ; k<numSteps; ++k )
+    {
+        auto VPrev = View( V, 0, 0,   n, k+1 );
+        auto vk    = View( V, 0, k,   n, 1   );
+        auto vNext = View( V, 0, k+1, n, 1   );
+        vNext = vk;
+        op( vNext );
+        for( Int pass=0; pass<2; ++pass )
+        {
+            Gemm( ADJOINT, NORMAL, F(1), VPrev, vNext, h );
+            Gemm( NORMAL, NORMAL, F(-1), VPrev, h, F(1), vNext );
+            DistMatrix<F,STAR,STAR> h_STAR_STAR( h );
+            for( Int i=0; i<=k; ++i )
+                H.Update( i, k, h_STAR_STAR.GetLocal(i,0) );
+        }
+        const Real beta = FrobeniusNorm( vNext );
+        H.Set( k+1, k, beta );
+        if( beta == Real(0) )
+        {
+            ++k;
+            break;
+        }
+        Scale( Real(1)/beta, vNext );
+    }
+
+    // Every process redundantly computes the Ritz values
+    auto HSquare = LockedView( H, 0, 0, k, k );
+    Matrix<F> HCopy( HSquare );
+    Matrix<Complex<Real>> w;
+    schur::QR( HCopy, w );
+    ritz.resize( k );
+    for( Int i=0; i<k; ++i )
+        ritz[i] = w.Get(i,0);
+}
+
+// Compute the Ritz values of both A and A^{-1} (the latter approximate the
+// eigenvalues of A of smallest magnitude), and then apply Penzl's heuristic
+template<typename F>
+inline void
+Shifts( const Matrix<F>& A, Int numShifts, Matrix<F>& shifts )
+{
+    DEBUG_ONLY(CallStackEntry cse("lyapunov::adi::Shifts"))
+    typedef Complex<BASE(F)> C;
+    const Int n = A.Height();
+    const Int numSteps = 2*numShifts;
+    std::vector<C> ritzPlus, ritzMinus;
+    Ritz<F>
+    ( [&]( Matrix<F>& v )
+      { Matrix<F> w( v ); Gemm( NORMAL, NORMAL, F(1), A, w, F(0), v ); },
+      n, numSteps, ritzPlus );
+    Matrix<F> ALU( A );
+    Matrix<Int> p;
+    LU( ALU, p );
+    Ritz<F>
+    ( [&]( Matrix<F>& v ) { lu::SolveAfter( NORMAL, ALU, p, v ); },
+      n, numSteps, ritzMinus );
+    for( Int i=0; i<Int(ritzMinus.size()); ++i )
+        ritzPlus.push_back( C(1)/ritzMinus[i] );
+
+    std::vector<F> shiftVec;
+    PenzlShifts( ritzPlus, numShifts, shiftVec );
+    const Int numChosen = shiftVec.size();
+    shifts.Resize( numChosen, 1 );
+    for( Int i=0; i<numChosen; ++i )
+        shifts.Set( i, 0, shiftVec[i] );
+}
+
+template<typename F>
+inline void
+Shifts
+( const DistMatrix<F>& A, Int numShifts, DistMatrix<F,STAR,STAR>& shifts )
+{
+    DEBUG_ONLY(CallStackEntry cse("lyapunov::adi::Shifts"))
+    typedef Complex<BASE(F)> C;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int numSteps = 2*numShifts;
+    std::vector<C> ritzPlus, ritzMinus;
+    Ritz<F>
+    ( [&]( DistMatrix<F>& v )
+      { DistMatrix<F> w( v );
+        Gemm( NORMAL, NORMAL, F(1), A, w, F(0), v ); },
+      g, n, numSteps, ritzPlus );
+    DistMatrix<F> ALU( A );
+    DistMatrix<Int,VC,STAR> p(g);
+    LU( ALU, p );
+    Ritz<F>
+    ( [&]( DistMatrix<F>& v ) { lu::SolveAfter( NORMAL, ALU, p, v ); },
+      g, n, numSteps, ritzMinus );
+    for( Int i=0; i<Int(ritzMinus.size()); ++i )
+        ritzPlus.push_back( C(1)/ritzMinus[i] );
+
+    std::vector<F> shiftVec;
+    PenzlShifts( ritzPlus, numShifts, shiftVec );
+    const Int numChosen = shiftVec.size();
+    shifts.SetGrid( g );
+    shifts.Resize( numChosen, 1 );
+    for( Int i=0; i<numChosen; ++i )
+        shifts.SetLocal( i, 0, shiftVec[i] );
+}
+
+// Z(:,width:width+k-1) := alpha V, doubling the capacity of Z when needed so
+// that the total cost of the appends is linear in the final size of Z
+template<typename F>
+inline void
+Append( Matrix<F>& Z, Int& width, F alpha, const Matrix<F>& V )
+{
+    DEBUG_ONLY(CallStackEntry cse("lyapunov::adi::Append"))
+    const Int n = V.Height();
+    const Int k = V.Width();
+    if( width+k > Z.Width() )
+    {
+        Matrix<F> ZNew( n, Max(2*Z.Width(),width+k) );
+        if( width > 0 )
+        {
+            auto ZLeft = LockedView( Z, 0, 0, n, width );
+            auto ZNewLeft = View( ZNew, 0, 0, n, width );
+            ZNewLeft = ZLeft;
+        }
+        Z = std::move(ZNew);
+    }
+    auto ZRight = View( Z, 0, width, n, k );
+    ZRight = V;
+    Scale( alpha, ZRight );
+    width += k;
+}
+
+template<typename F>
+inline void
+Append( DistMatrix<F>& Z, Int& width, F alpha, const DistMatrix<F>& V )
+{
+    DEBUG_ONLY(CallStackEntry cse("lyapunov::adi::Append"))
+    const Int n = V.Height();
+    const Int k = V.Width();
+    if( width+k > Z.Width() )
+    {
+        DistMatrix<F> ZNew( n, Max(2*Z.Width(),width+k), Z.Grid() );
+        if( width > 0 )
+        {
+            auto ZLeft = LockedView( Z, 0, 0, n, width );
+            auto ZNewLeft = View( ZNew, 0, 0, n, width );
+            ZNewLeft = ZLeft;
+        }
+        Z = std::move(ZNew);
+    }
+    auto ZRight = View( Z, 0, width, n, k );
+    ZRight = V;
+    Scale( alpha, ZRight );
+    width += k;
+}
+
+} // namespace adi
+
+// Returns the number of iterations. The iteration stops once
+// ||W_j||_F^2 <= tol ||B||_F^2, which, if tol=0, defaults to n eps.
+template<typename F>
+inline Int
+LowRankADI
+( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& shifts,
+  Matrix<F>& Z, Int maxIts=100, BASE(F) tol=0, bool progress=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("lyapunov::LowRankADI");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( B.Height() != A.Height() )
+            LogicError("B must be the same height as A");
+        if( shifts.Height() == 0 )
+            LogicError("At least one shift is required");
+    )
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    const Int numShifts = shifts.Height();
+    if( tol == Real(0) )
+        tol = n*lapack::MachineEpsilon<Real>();
+
+    for( Int j=0; j<numShifts; ++j )
+        if( RealPart(shifts.Get(j,0)) <= Real(0) )
+            LogicError("Shifts must lie in the open right-half plane");
+
+    // A = Q H Q^H, where Q is stored as packed reflectors below the
+    // subdiagonal of H (which the Hessenberg solves do not access)
+    Matrix<F> H( A ), t;
+    Hessenberg( UPPER, H, t );
+
+    const Real BFrob = FrobeniusNorm( B );
+    const Int k = B.Width();
+    Matrix<F> W( B ), V, ZCap, negShifts( k, 1 );
+    hessenberg::ApplyQ( UPPER, LEFT, ADJOINT, H, t, W );
+    Int width = 0;
+    Int numIts=0;
+    while( numIts < maxIts )
+    {
+        // V := (H + p_j I)^{-1} W
+        const Int j = numIts % numShifts;
+        const F shift = shifts.Get(j,0);
+        const Real twoRealShift = 2*RealPart(shift);
+        for( Int i=0; i<k; ++i )
+            negShifts.Set( i, 0, -shift );
+        V = W;
+        MultiShiftHessSolve( UPPER, NORMAL, F(1), H, negShifts, V );
+        Axpy( F(-twoRealShift), V, W );
+        adi::Append( ZCap, width, F(Sqrt(twoRealShift)), V );
+        ++numIts;
+
+        const Real WFrob = FrobeniusNorm( W );
+        const Real residual = (WFrob*WFrob) / (BFrob*BFrob);
+        if( progress )
+            std::cout << "iteration " << numIts << ": || W W^H ||_F / "
+                      << "|| B B^H ||_F <= " << residual << std::endl;
+        if( residual <= tol )
+            break;
+    }
+    auto ZActive = LockedView( ZCap, 0, 0, n, width );
+    Z = ZActive;
+    hessenberg::ApplyQ( UPPER, LEFT, NORMAL, H, t, Z );
+    return numIts;
+}
+
+template<typename F>
+inline Int
+LowRankADI
+( const DistMatrix<F>& A, const DistMatrix<F>& B,
+  const DistMatrix<F,STAR,STAR>& shifts, DistMatrix<F>& Z,
+  Int maxIts=100, BASE(F) tol=0, bool progress=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("lyapunov::LowRankADI");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( B.Height() != A.Height() )
+            LogicError("B must be the same height as A");
+        if( A.Grid() != B.Grid() || B.Grid() != shifts.Grid() )
+            LogicError("A, B, and the shifts must have the same grid");
+        if( shifts.Height() == 0 )
+            LogicError("At least one shift is required");
+    )
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int numShifts = shifts.Height();
+    if( tol == Real(0) )
+        tol = n*lapack::MachineEpsilon<Real>();
+
+    for( Int j=0; j<numShifts; ++j )
+        if( RealPart(shifts.GetLocal(j,0)) <= Real(0) )
+            LogicError("Shifts must lie in the open right-half plane");
+
+    DistMatrix<F> H( A );
+    DistMatrix<F,STAR,STAR> t(g);
+    Hessenberg( UPPER, H, t );
+
+    // Each process solves against the right-hand sides which it owns
+    const Real BFrob = FrobeniusNorm( B );
+    const Int k = B.Width();
+    DistMatrix<F> W( B ), V(g), ZCap(g);
+    DistMatrix<F,STAR,VR> V_STAR_VR(g);
+    DistMatrix<F,VR,STAR> negShifts( k, 1, g );
+    hessenberg::ApplyQ( UPPER, LEFT, ADJOINT, H, t, W );
+    Int width = 0;
+    Int numIts=0;
+    while( numIts < maxIts )
+    {
+        const Int j = numIts % numShifts;
+        const F shift = shifts.GetLocal(j,0);
+        const Real twoRealShift = 2*RealPart(shift);
+        for( Int iLoc=0; iLoc<negShifts.LocalHeight(); ++iLoc )
+            negShifts.SetLocal( iLoc, 0, -shift );
+        V_STAR_VR = W;
+        MultiShiftHessSolve( UPPER, NORMAL, F(1), H, negShifts, V_STAR_VR );
+        V = V_STAR_VR;
+        Axpy( F(-twoRealShift), V, W );
+        adi::Append( ZCap, width, F(Sqrt(twoRealShift)), V );
+        ++numIts;
+
+        const Real WFrob = FrobeniusNorm( W );
+        const Real residual = (WFrob*WFrob) / (BFrob*BFrob);
+        if( progress && g.Rank() == 0 )
+            std::cout << "iteration " << numIts << ": || W W^H ||_F / "
+                      << "|| B B^H ||_F <= " << residual << std::endl;
+        if( residual <= tol )
+            break;
+    }
+    auto ZActive = LockedView( ZCap, 0, 0, n, width );
+    Z = ZActive;
+    hessenberg::ApplyQ( UPPER, LEFT, NORMAL, H, t, Z );
+    return numIts;
+}
+
+// Choose the shifts with Penzl's heuristic using 2 numShifts steps of
+// Arnoldi with both A and A^{-1}
+template<typename F>
+inline Int
+LowRankADI
+( const Matrix<F>& A, const Matrix<F>& B, Matrix<F>& Z,
+  Int numShifts=10, Int maxIts=100, BASE(F) tol=0, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("lyapunov::LowRankADI"))
+    Matrix<F> shifts;
+    adi::Shifts( A, numShifts, shifts );
+    return LowRankADI( A, B, shifts, Z, maxIts, tol, progress );
+}
+
+template<typename F>
+inline Int
+LowRankADI
+( const DistMatrix<F>& A, const DistMatrix<F>& B, DistMatrix<F>& Z,
+  Int numShifts=10, Int maxIts=100, BASE(F) tol=0, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("lyapunov::LowRankADI"))
+    DistMatrix<F,STAR,STAR> shifts( A.Grid() );
+    adi::Shifts( A, numShifts, shifts );
+    return LowRankADI( A, B, shifts, Z, maxIts, tol, progress );
+}
+
+} // namespace lyapunov
+} // namespace elem
+
+#endif // ifndef ELEM_LYAPUNOV_LOWRANKADI_HPP
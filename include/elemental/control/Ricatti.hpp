@@ -28,15 +28,16 @@ namespace elem {
 // The solution, X, to the equation
 //   X K X - A^H X - X A = L
 // is returned, as well as the number of Newton iterations for computing sgn(W).
+// The Newton workspace may be reused across calls of any size.
 //
 // See Chapter 2 of Nicholas J. Higham's "Functions of Matrices"
 
 template<typename F>
 inline int
-Ricatti( Matrix<F>& W, Matrix<F>& X )
+Ricatti( Matrix<F>& W, Matrix<F>& X, sign::NewtonWorkspace<F>& work )
 {
     DEBUG_ONLY(CallStackEntry cse("Ricatti"))
-    const Int numIts = sign::Newton( W );
+    const Int numIts = sign::Newton( W, work );
     const Int n = W.Height()/2;
     Matrix<F> WTL, WTR,
               WBL, WBR;
@@ -58,11 +59,21 @@ Ricatti( Matrix<F>& W, Matrix<F>& X )
 
 template<typename F>
 inline int
-Ricatti( DistMatrix<F>& W, DistMatrix<F>& X )
+Ricatti( Matrix<F>& W, Matrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("Ricatti"))
+    sign::NewtonWorkspace<F> work;
+    return Ricatti( W, X, work );
+}
+
+template<typename F>
+inline int
+Ricatti
+( DistMatrix<F>& W, DistMatrix<F>& X, sign::DistNewtonWorkspace<F>& work )
 {
     DEBUG_ONLY(CallStackEntry cse("Ricatti"))
     const Grid& g = W.Grid();
-    const Int numIts = sign::Newton( W );
+    const Int numIts = sign::Newton( W, work );
     const Int n = W.Height()/2;
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
@@ -82,11 +93,21 @@ Ricatti( DistMatrix<F>& W, DistMatrix<F>& X )
     return numIts;
 }
 
+template<typename F>
+inline int
+Ricatti( DistMatrix<F>& W, DistMatrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("Ricatti"))
+    sign::DistNewtonWorkspace<F> work( W.Grid() );
+    return Ricatti( W, X, work );
+}
+
 template<typename F>
 inline int
 Ricatti
 ( UpperOrLower uplo, 
-  const Matrix<F>& A, const Matrix<F>& K, const Matrix<F>& L, Matrix<F>& X )
+  const Matrix<F>& A, const Matrix<F>& K, const Matrix<F>& L, Matrix<F>& X,
+  sign::NewtonWorkspace<F>& work )
 {
     DEBUG_ONLY(
         CallStackEntry cse("Sylvester");
@@ -112,7 +133,18 @@ Ricatti
     WBL = K; MakeHermitian( uplo, WBL );
     WTR = L; MakeHermitian( uplo, WTR );
 
-    return Ricatti( W, X );
+    return Ricatti( W, X, work );
+}
+
+template<typename F>
+inline int
+Ricatti
+( UpperOrLower uplo, 
+  const Matrix<F>& A, const Matrix<F>& K, const Matrix<F>& L, Matrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("Ricatti"))
+    sign::NewtonWorkspace<F> work;
+    return Ricatti( uplo, A, K, L, X, work );
 }
 
 template<typename F>
@@ -120,7 +152,7 @@ inline int
 Ricatti
 ( UpperOrLower uplo, 
   const DistMatrix<F>& A, const DistMatrix<F>& K, const DistMatrix<F>& L, 
-  DistMatrix<F>& X )
+  DistMatrix<F>& X, sign::DistNewtonWorkspace<F>& work )
 {
     DEBUG_ONLY(
         CallStackEntry cse("Sylvester");
@@ -149,7 +181,19 @@ Ricatti
     WBL = K; MakeHermitian( uplo, WBL );
     WTR = L; MakeHermitian( uplo, WTR );
 
-    return Ricatti( W, X );
+    return Ricatti( W, X, work );
+}
+
+template<typename F>
+inline int
+Ricatti
+( UpperOrLower uplo, 
+  const DistMatrix<F>& A, const DistMatrix<F>& K, const DistMatrix<F>& L, 
+  DistMatrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("Ricatti"))
+    sign::DistNewtonWorkspace<F> work( A.Grid() );
+    return Ricatti( uplo, A, K, L, X, work );
 }
 
 } // namespace elem
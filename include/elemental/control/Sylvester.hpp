@@ -16,9 +16,12 @@
 
 #include ELEM_FROBENIUSNORM_INC
 #include ELEM_SIGN_INC
+#include ELEM_SCHUR_INC
 
 #include ELEM_ZEROS_INC
 
+#include "./Sylvester/Triangular.hpp"
+
 namespace elem {
 
 // W = | A -C |, where A is m x m, B is n x n, and both are assumed to have 
@@ -27,15 +30,16 @@ namespace elem {
 // The solution, X, to the equation
 //   A X + X B = C
 // is returned, as well as the number of Newton iterations for computing sgn(W).
+// The Newton workspace may be reused across calls of any size.
 //
 // See Chapter 2 of Nicholas J. Higham's "Functions of Matrices"
 
 template<typename F>
 inline int
-Sylvester( Int m, Matrix<F>& W, Matrix<F>& X )
+Sylvester( Int m, Matrix<F>& W, Matrix<F>& X, sign::NewtonWorkspace<F>& work )
 {
     DEBUG_ONLY(CallStackEntry cse("Sylvester"))
-    const Int numIts = sign::Newton( W );
+    const Int numIts = sign::Newton( W, work );
     Matrix<F> WTL, WTR,
               WBL, WBR;
     PartitionDownDiagonal
@@ -62,11 +66,22 @@ Sylvester( Int m, Matrix<F>& W, Matrix<F>& X )
 
 template<typename F>
 inline int
-Sylvester( Int m, DistMatrix<F>& W, DistMatrix<F>& X )
+Sylvester( Int m, Matrix<F>& W, Matrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("Sylvester"))
+    sign::NewtonWorkspace<F> work;
+    return Sylvester( m, W, X, work );
+}
+
+template<typename F>
+inline int
+Sylvester
+( Int m, DistMatrix<F>& W, DistMatrix<F>& X, 
+  sign::DistNewtonWorkspace<F>& work )
 {
     DEBUG_ONLY(CallStackEntry cse("Sylvester"))
     const Grid& g = W.Grid();
-    const Int numIts = sign::Newton( W );
+    const Int numIts = sign::Newton( W, work );
     DistMatrix<F> WTL(g), WTR(g),
                   WBL(g), WBR(g);
     PartitionDownDiagonal
@@ -92,11 +107,20 @@ Sylvester( Int m, DistMatrix<F>& W, DistMatrix<F>& X )
     return numIts;
 }
 
+template<typename F>
+inline int
+Sylvester( Int m, DistMatrix<F>& W, DistMatrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("Sylvester"))
+    sign::DistNewtonWorkspace<F> work( W.Grid() );
+    return Sylvester( m, W, X, work );
+}
 
 template<typename F>
 inline int
 Sylvester
-( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& C, Matrix<F>& X )
+( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& C, Matrix<F>& X,
+  sign::NewtonWorkspace<F>& work )
 {
     DEBUG_ONLY(
         CallStackEntry cse("Sylvester");
@@ -118,14 +142,24 @@ Sylvester
     WTL = A;
     WBR = B; Scale( F(-1), WBR );
     WTR = C; Scale( F(-1), WTR );
-    return Sylvester( m, W, X );
+    return Sylvester( m, W, X, work );
+}
+
+template<typename F>
+inline int
+Sylvester
+( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& C, Matrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("Sylvester"))
+    sign::NewtonWorkspace<F> work;
+    return Sylvester( A, B, C, X, work );
 }
 
 template<typename F>
 inline int
 Sylvester
 ( const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& C, 
-  DistMatrix<F>& X )
+  DistMatrix<F>& X, sign::DistNewtonWorkspace<F>& work )
 {
     DEBUG_ONLY(
         CallStackEntry cse("Sylvester");
@@ -150,9 +184,148 @@ Sylvester
     WTL = A;
     WBR = B; Scale( F(-1), WBR );
     WTR = C; Scale( F(-1), WTR );
-    return Sylvester( m, W, X );
+    return Sylvester( m, W, X, work );
 }
 
+template<typename F>
+inline int
+Sylvester
+( const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& C, 
+  DistMatrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("Sylvester"))
+    sign::DistNewtonWorkspace<F> work( A.Grid() );
+    return Sylvester( A, B, C, X, work );
+}
+
+namespace sylvester {
+
+// The distributed Schur decomposition does not reliably produce a real
+// quasi-triangular factor for real matrices, and so distributed problems are
+// always solved in complex arithmetic
+
+template<typename Real>
+inline void
+MakeComplex( const DistMatrix<Real>& A, DistMatrix<Complex<Real>>& ACpx )
+{
+    DEBUG_ONLY(CallStackEntry cse("sylvester::MakeComplex"))
+    ACpx.SetGrid( A.Grid() );
+    ACpx.AlignWith( A );
+    ACpx.Resize( A.Height(), A.Width() );
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            ACpx.SetLocal( iLoc, jLoc, A.GetLocal(iLoc,jLoc) );
+}
+
+template<typename Real>
+inline void
+MakeComplex
+( const DistMatrix<Complex<Real>>& A, DistMatrix<Complex<Real>>& ACpx )
+{
+    DEBUG_ONLY(CallStackEntry cse("sylvester::MakeComplex"))
+    ACpx.SetGrid( A.Grid() );
+    ACpx = A;
+}
+
+template<typename Real>
+inline void
+TakeReal( const DistMatrix<Complex<Real>>& XCpx, DistMatrix<Real>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("sylvester::TakeReal"))
+    DistMatrix<Real> XReal( XCpx.Grid() );
+    XReal.AlignWith( XCpx );
+    XReal.Resize( XCpx.Height(), XCpx.Width() );
+    const Int mLocal = XCpx.LocalHeight();
+    const Int nLocal = XCpx.LocalWidth();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            XReal.SetLocal( iLoc, jLoc, RealPart(XCpx.GetLocal(iLoc,jLoc)) );
+    X = XReal;
+}
+
+template<typename Real>
+inline void
+TakeReal
+( const DistMatrix<Complex<Real>>& XCpx, DistMatrix<Complex<Real>>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("sylvester::TakeReal"))
+    X = XCpx;
+}
+
+// The Bartels-Stewart algorithm: the Schur decompositions A = Q_A T_A Q_A^H
+// and B = Q_B T_B Q_B^H reduce A X + X B = C to the triangular problem
+//   T_A Y + Y T_B = Q_A^H C Q_B,
+// which is solved by sylvester::Triangular before forming X = Q_A Y Q_B^H.
+// Unlike the sign-based solver, the only requirement is that A and -B have
+// no eigenvalues in common, and the dominant cost is that of the two Schur
+// decompositions rather than of repeated inversions of a matrix of order
+// m+n.
+
+template<typename F>
+inline void
+BartelsStewart
+( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& C, Matrix<F>& X )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("sylvester::BartelsStewart");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( B.Height() != B.Width() )
+            LogicError("B must be square");
+        if( C.Height() != A.Height() || C.Width() != B.Height() )
+            LogicError("C must conform with A and B");
+    )
+    Matrix<F> TA( A ), TB( B ), QA, QB, Z;
+    Matrix<Complex<BASE(F)>> w;
+    Schur( TA, w, QA );
+    Schur( TB, w, QB );
+
+    Gemm( ADJOINT, NORMAL, F(1), QA, C, Z );
+    Gemm( NORMAL, NORMAL, F(1), Z, QB, X );
+    Triangular( NORMAL, TA, TB, X );
+    Gemm( NORMAL, NORMAL, F(1), QA, X, Z );
+    Gemm( NORMAL, ADJOINT, F(1), Z, QB, X );
+}
+
+template<typename F>
+inline void
+BartelsStewart
+( const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& C,
+  DistMatrix<F>& X )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("sylvester::BartelsStewart");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( B.Height() != B.Width() )
+            LogicError("B must be square");
+        if( C.Height() != A.Height() || C.Width() != B.Height() )
+            LogicError("C must conform with A and B");
+        if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
+            LogicError("A, B, and C must have the same grid");
+    )
+    typedef Complex<BASE(F)> CF;
+    const Grid& g = A.Grid();
+    DistMatrix<CF> TA(g), TB(g), QA(g), QB(g), Y(g), Z(g);
+    DistMatrix<CF,VR,STAR> w(g);
+    MakeComplex( A, TA );
+    MakeComplex( B, TB );
+    Schur( TA, w, QA );
+    Schur( TB, w, QB );
+
+    MakeComplex( C, Z );
+    Gemm( ADJOINT, NORMAL, CF(1), QA, Z, Y );
+    Gemm( NORMAL, NORMAL, CF(1), Y, QB, Z );
+    Triangular( NORMAL, TA, TB, Z );
+    Gemm( NORMAL, NORMAL, CF(1), QA, Z, Y );
+    Gemm( NORMAL, ADJOINT, CF(1), Y, QB, Z );
+    TakeReal( Z, X );
+}
+
+} // namespace sylvester
+
 } // namespace elem
 
 #endif // ifndef ELEM_SYLVESTER_HPP
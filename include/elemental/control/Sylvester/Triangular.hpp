@@ -0,0 +1,349 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_SYLVESTER_TRIANGULAR_HPP
+#define ELEM_SYLVESTER_TRIANGULAR_HPP
+
+#include ELEM_GEMM_INC
+#include ELEM_MAXNORM_INC
+
+namespace elem {
+namespace sylvester {
+
+// Solves U X + X op(V) = C for X, overwriting C, where U is m x m, V is n x n,
+// and both are upper triangular or, for real data, upper quasi-triangular
+// (as produced by a real Schur decomposition), in which case the 2x2
+// diagonal blocks are marked by nonzero subdiagonal entries. Nothing below
+// the first subdiagonal of U or V is ever accessed.
+//
+// The problem is recursively halved along its larger dimension, so that
+// nearly all of the work is performed by Gemm, until both dimensions fall
+// beneath the algorithmic blocksize. The remaining blocks are then solved
+// one pair of diagonal blocks at a time, as in LAPACK's trsyl, with pivots
+// smaller than eps max(||U||_max,||V||_max) perturbed to that value.
+//
+// See Jonsson and Kagstrom's "Recursive blocked algorithms for solving
+// triangular systems -- Part I: one-sided and coupled Sylvester-type matrix
+// equations".
+
+// The size of the diagonal block of T which begins at index k
+template<typename F>
+inline Int
+DiagonalBlocksize( const Matrix<F>& T, Int k )
+{
+    if( !IsComplex<F>::val && k+1 < T.Height() && T.Get(k+1,k) != F(0) )
+        return 2;
+    else
+        return 1;
+}
+
+// Move the split index k of T forward if it would separate a 2x2 block
+template<typename F>
+inline Int
+SplitIndex( const Matrix<F>& T, Int k )
+{
+    if( !IsComplex<F>::val && k > 0 && T.Get(k,k-1) != F(0) )
+        return k+1;
+    else
+        return k;
+}
+
+template<typename F>
+inline Int
+SplitIndex( const DistMatrix<F>& T, Int k )
+{
+    if( !IsComplex<F>::val && k > 0 && T.Get(k,k-1) != F(0) )
+        return k+1;
+    else
+        return k;
+}
+
+// Solve the (at most 4 x 4) Kronecker form of U11 X + X op(V11) = B, where
+// U11 and V11 are diagonal blocks, and overwrite B with the solution
+template<typename F>
+inline void
+SmallSolve
+( Orientation orientation, const Matrix<F>& U11, const Matrix<F>& V11,
+  Matrix<F>& B, BASE(F) smin )
+{
+    DEBUG_ONLY(CallStackEntry cse("sylvester::SmallSolve"))
+    const Int p = U11.Height();
+    const Int q = V11.Height();
+    const Int r = p*q;
+    F K[16], y[4];
+    for( Int k=0; k<r*r; ++k )
+        K[k] = 0;
+    for( Int j=0; j<q; ++j )
+    {
+        for( Int i=0; i<p; ++i )
+        {
+            const Int row = i + j*p;
+            y[row] = B.Get(i,j);
+            for( Int k=0; k<p; ++k )
+                K[row+(k+j*p)*r] += U11.Get(i,k);
+            for( Int l=0; l<q; ++l )
+            {
+                const F nu =
+                    ( orientation == NORMAL ? V11.Get(l,j) :
+                      orientation == TRANSPOSE ? V11.Get(j,l) :
+                                                 Conj(V11.Get(j,l)) );
+                K[row+(i+l*p)*r] += nu;
+            }
+        }
+    }
+
+    // Gaussian elimination with partial pivoting
+    for( Int k=0; k<r; ++k )
+    {
+        Int pivot = k;
+        for( Int i=k+1; i<r; ++i )
+            if( Abs(K[i+k*r]) > Abs(K[pivot+k*r]) )
+                pivot = i;
+        if( pivot != k )
+        {
+            for( Int j=k; j<r; ++j )
+                std::swap( K[k+j*r], K[pivot+j*r] );
+            std::swap( y[k], y[pivot] );
+        }
+        if( Abs(K[k+k*r]) < smin )
+            K[k+k*r] = smin;
+        for( Int i=k+1; i<r; ++i )
+        {
+            const F gamma = K[i+k*r] / K[k+k*r];
+            for( Int j=k+1; j<r; ++j )
+                K[i+j*r] -= gamma*K[k+j*r];
+            y[i] -= gamma*y[k];
+        }
+    }
+    for( Int k=r-1; k>=0; --k )
+    {
+        for( Int j=k+1; j<r; ++j )
+            y[k] -= K[k+j*r]*y[j];
+        y[k] /= K[k+k*r];
+    }
+
+    for( Int j=0; j<q; ++j )
+        for( Int i=0; i<p; ++i )
+            B.Set( i, j, y[i+j*p] );
+}
+
+template<typename F>
+inline void
+TriangularUnb
+( Orientation orientation, const Matrix<F>& U, const Matrix<F>& V,
+  Matrix<F>& X, BASE(F) smin )
+{
+    DEBUG_ONLY(CallStackEntry cse("sylvester::TriangularUnb"))
+    const Int m = X.Height();
+    const Int n = X.Width();
+    std::vector<Int> rowStarts, colStarts;
+    for( Int i=0; i<m; i+=DiagonalBlocksize(U,i) )
+        rowStarts.push_back( i );
+    rowStarts.push_back( m );
+    for( Int j=0; j<n; j+=DiagonalBlocksize(V,j) )
+        colStarts.push_back( j );
+    colStarts.push_back( n );
+    const Int numRowBlocks = rowStarts.size()-1;
+    const Int numColBlocks = colStarts.size()-1;
+
+    for( Int t=0; t<numColBlocks; ++t )
+    {
+        // The columns of X decouple from left to right if op(V) is upper
+        // triangular, and from right to left if it is lower triangular
+        const Int s = ( orientation == NORMAL ? t : numColBlocks-1-t );
+        const Int j = colStarts[s];
+        const Int q = colStarts[s+1] - j;
+        auto V11 = LockedView( V, j, j, q, q );
+        for( Int u=numRowBlocks-1; u>=0; --u )
+        {
+            const Int i = rowStarts[u];
+            const Int p = rowStarts[u+1] - i;
+            auto U01 = LockedView( U, 0, i, i, p );
+            auto U11 = LockedView( U, i, i, p, p );
+            auto X01 = View( X, 0, j, i, q );
+            auto X11 = View( X, i, j, p, q );
+            SmallSolve( orientation, U11, V11, X11, smin );
+            Gemm( NORMAL, NORMAL, F(-1), U01, X11, F(1), X01 );
+        }
+
+        auto X1 = View( X, 0, j, m, q );
+        if( orientation == NORMAL )
+        {
+            auto V12 = LockedView( V, j, j+q, q, n-(j+q) );
+            auto X2 = View( X, 0, j+q, m, n-(j+q) );
+            Gemm( NORMAL, NORMAL, F(-1), X1, V12, F(1), X2 );
+        }
+        else
+        {
+            auto V01 = LockedView( V, 0, j, j, q );
+            auto X0 = View( X, 0, 0, m, j );
+            Gemm( NORMAL, orientation, F(-1), X1, V01, F(1), X0 );
+        }
+    }
+}
+
+template<typename F>
+inline void
+TriangularRec
+( Orientation orientation, const Matrix<F>& U, const Matrix<F>& V,
+  Matrix<F>& X, BASE(F) smin )
+{
+    DEBUG_ONLY(CallStackEntry cse("sylvester::TriangularRec"))
+    const Int m = X.Height();
+    const Int n = X.Width();
+    // A 2x2 block cannot be split, so the base case is at least 2 x 2
+    const Int cutoff = Max( Blocksize(), Int(2) );
+    if( m <= cutoff && n <= cutoff )
+    {
+        TriangularUnb( orientation, U, V, X, smin );
+        return;
+    }
+
+    if( m >= n )
+    {
+        // U = | U11 U12 |, X = | X1 |
+        //     |  0  U22 |      | X2 |
+        const Int k = SplitIndex( U, m/2 );
+        auto U11 = LockedViewRange( U, 0, 0, k, k );
+        auto U12 = LockedViewRange( U, 0, k, k, m );
+        auto U22 = LockedViewRange( U, k, k, m, m );
+        auto X1 = ViewRange( X, 0, 0, k, n );
+        auto X2 = ViewRange( X, k, 0, m, n );
+        TriangularRec( orientation, U22, V, X2, smin );
+        Gemm( NORMAL, NORMAL, F(-1), U12, X2, F(1), X1 );
+        TriangularRec( orientation, U11, V, X1, smin );
+    }
+    else
+    {
+        // V = | V11 V12 |, X = | X1 X2 |
+        //     |  0  V22 |
+        const Int k = SplitIndex( V, n/2 );
+        auto V11 = LockedViewRange( V, 0, 0, k, k );
+        auto V12 = LockedViewRange( V, 0, k, k, n );
+        auto V22 = LockedViewRange( V, k, k, n, n );
+        auto X1 = ViewRange( X, 0, 0, m, k );
+        auto X2 = ViewRange( X, 0, k, m, n );
+        if( orientation == NORMAL )
+        {
+            TriangularRec( orientation, U, V11, X1, smin );
+            Gemm( NORMAL, NORMAL, F(-1), X1, V12, F(1), X2 );
+            TriangularRec( orientation, U, V22, X2, smin );
+        }
+        else
+        {
+            TriangularRec( orientation, U, V22, X2, smin );
+            Gemm( NORMAL, orientation, F(-1), X2, V12, F(1), X1 );
+            TriangularRec( orientation, U, V11, X1, smin );
+        }
+    }
+}
+
+template<typename F>
+inline void
+TriangularRec
+( Orientation orientation, const DistMatrix<F>& U, const DistMatrix<F>& V,
+  DistMatrix<F>& X, BASE(F) smin )
+{
+    DEBUG_ONLY(CallStackEntry cse("sylvester::TriangularRec"))
+    const Int m = X.Height();
+    const Int n = X.Width();
+    const Int cutoff = Max( Blocksize(), Int(2) );
+    if( m <= cutoff && n <= cutoff )
+    {
+        // Redundantly solve the small problem on every process
+        DistMatrix<F,STAR,STAR> U_STAR_STAR( U ), V_STAR_STAR( V ),
+                                X_STAR_STAR( X );
+        TriangularUnb
+        ( orientation, U_STAR_STAR.LockedMatrix(),
+          V_STAR_STAR.LockedMatrix(), X_STAR_STAR.Matrix(), smin );
+        X = X_STAR_STAR;
+        return;
+    }
+
+    if( m >= n )
+    {
+        const Int k = SplitIndex( U, m/2 );
+        auto U11 = LockedViewRange( U, 0, 0, k, k );
+        auto U12 = LockedViewRange( U, 0, k, k, m );
+        auto U22 = LockedViewRange( U, k, k, m, m );
+        auto X1 = ViewRange( X, 0, 0, k, n );
+        auto X2 = ViewRange( X, k, 0, m, n );
+        TriangularRec( orientation, U22, V, X2, smin );
+        Gemm( NORMAL, NORMAL, F(-1), U12, X2, F(1), X1 );
+        TriangularRec( orientation, U11, V, X1, smin );
+    }
+    else
+    {
+        const Int k = SplitIndex( V, n/2 );
+        auto V11 = LockedViewRange( V, 0, 0, k, k );
+        auto V12 = LockedViewRange( V, 0, k, k, n );
+        auto V22 = LockedViewRange( V, k, k, n, n );
+        auto X1 = ViewRange( X, 0, 0, m, k );
+        auto X2 = ViewRange( X, 0, k, m, n );
+        if( orientation == NORMAL )
+        {
+            TriangularRec( orientation, U, V11, X1, smin );
+            Gemm( NORMAL, NORMAL, F(-1), X1, V12, F(1), X2 );
+            TriangularRec( orientation, U, V22, X2, smin );
+        }
+        else
+        {
+            TriangularRec( orientation, U, V22, X2, smin );
+            Gemm( NORMAL, orientation, F(-1), X2, V12, F(1), X1 );
+            TriangularRec( orientation, U, V11, X1, smin );
+        }
+    }
+}
+
+template<typename F>
+inline void
+Triangular
+( Orientation orientation, const Matrix<F>& U, const Matrix<F>& V,
+  Matrix<F>& C )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("sylvester::Triangular");
+        if( U.Height() != U.Width() || V.Height() != V.Width() )
+            LogicError("U and V must be square");
+        if( C.Height() != U.Height() || C.Width() != V.Height() )
+            LogicError("C must conform with U and V");
+    )
+    typedef Base<F> Real;
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real safeMin = lapack::MachineSafeMin<Real>();
+    const Real smin = Max( eps*Max(MaxNorm(U),MaxNorm(V)), safeMin );
+    TriangularRec( orientation, U, V, C, smin );
+}
+
+template<typename F>
+inline void
+Triangular
+( Orientation orientation, const DistMatrix<F>& U, const DistMatrix<F>& V,
+  DistMatrix<F>& C )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("sylvester::Triangular");
+        if( U.Height() != U.Width() || V.Height() != V.Width() )
+            LogicError("U and V must be square");
+        if( C.Height() != U.Height() || C.Width() != V.Height() )
+            LogicError("C must conform with U and V");
+        if( U.Grid() != V.Grid() || V.Grid() != C.Grid() )
+            LogicError("U, V, and C must have the same grid");
+    )
+    typedef Base<F> Real;
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real safeMin = lapack::MachineSafeMin<Real>();
+    const Real smin = Max( eps*Max(MaxNorm(U),MaxNorm(V)), safeMin );
+    TriangularRec( orientation, U, V, C, smin );
+}
+
+} // namespace sylvester
+} // namespace elem
+
+#endif // ifndef ELEM_SYLVESTER_TRIANGULAR_HPP
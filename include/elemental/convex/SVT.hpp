@@ -11,6 +11,7 @@
 #define ELEM_SVT_HPP
 
 #include "./SVT/Normal.hpp"
+#include "./SVT/Partial.hpp"
 #include "./SVT/Cross.hpp"
 #include "./SVT/PivotedQR.hpp"
 #include "./SVT/TSQR.hpp"
@@ -0,0 +1,194 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_SVT_PARTIAL_HPP
+#define ELEM_SVT_PARTIAL_HPP
+
+#include ELEM_DIAGONALSCALE_INC
+#include ELEM_ZERO_INC
+#include ELEM_ZERONORM_INC
+#include ELEM_QR_INC
+#include ELEM_SVD_INC
+#include ELEM_SOFTTHRESHOLD_INC
+#include ELEM_UNIFORM_INC
+
+namespace elem {
+namespace svt {
+
+// Soft-threshold only the leading singular triplets of A, which are computed
+// with randomized subspace iteration (see Halko, Martinsson, and Tropp's
+// "Finding structure with randomness: Probabilistic algorithms for
+// constructing approximate matrix decompositions").
+//
+// On entry, the columns of V, if any, are used to warm-start the subspace
+// (e.g., with the right singular vectors retained by a previous call), and
+// oversample random columns are appended. If the smallest of the computed
+// singular values still exceeds the threshold, then the rank of the result
+// may be underestimated, and so the subspace is doubled and the iteration
+// is repeated. On exit, V holds the retained right singular vectors. When
+// the thresholded rank, r, is small, the cost is O(m n r) rather than that
+// of a full SVD, which makes this well suited to iterations such as RPCA,
+// where successive thresholded matrices are close.
+
+template<typename F>
+inline Int
+Partial
+( Matrix<F>& A, BASE(F) tau, Matrix<F>& V, Int oversample=10,
+  Int numPowerIts=1, bool relative=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("svt::Partial");
+        if( V.Width() != 0 && V.Height() != A.Width() )
+            LogicError("V must be empty or have as many rows as A has cols");
+    )
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    Int k = Min( V.Width()+Max(oversample,Int(1)), minDim );
+
+    Matrix<F> Omega( V ), Y, Z, W;
+    Matrix<Real> s;
+    while( true )
+    {
+        // Omega := [Omega, random columns]
+        const Int kOld = Min( Omega.Width(), k );
+        Matrix<F> OmegaNew( n, k );
+        if( kOld > 0 )
+        {
+            auto OmegaLeft = LockedView( Omega, 0, 0, n, kOld );
+            auto OmegaNewLeft = View( OmegaNew, 0, 0, n, kOld );
+            OmegaNewLeft = OmegaLeft;
+        }
+        auto OmegaNewRight = View( OmegaNew, 0, kOld, n, k-kOld );
+        MakeUniform( OmegaNewRight );
+        Omega = OmegaNew;
+
+        // Y := orth(A Omega), with numPowerIts steps of subspace iteration
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Y );
+        qr::Explicit( Y );
+        for( Int it=0; it<numPowerIts; ++it )
+        {
+            Gemm( ADJOINT, NORMAL, F(1), A, Y, Z );
+            qr::Explicit( Z );
+            Gemm( NORMAL, NORMAL, F(1), A, Z, Y );
+            qr::Explicit( Y );
+        }
+
+        // A^H Y = Z diag(s) W^H, so that Y Y^H A = (Y W) diag(s) Z^H
+        Gemm( ADJOINT, NORMAL, F(1), A, Y, Z );
+        SVD( Z, s, W );
+        const Real thresh = ( relative ? tau*s.Get(0,0) : tau );
+        if( k == minDim || s.Get(k-1,0) <= thresh )
+            break;
+
+        // Warm-start the doubled subspace with the current estimate
+        Omega = Z;
+        k = Min( 2*k, minDim );
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+    if( rank == 0 )
+    {
+        Zero( A );
+        V.Resize( n, 0 );
+        return 0;
+    }
+    Matrix<F> U;
+    Gemm( NORMAL, NORMAL, F(1), Y, W, U );
+    auto UL = View( U, 0, 0, m, rank );
+    auto sT = LockedView( s, 0, 0, rank, 1 );
+    auto ZL = LockedView( Z, 0, 0, n, rank );
+    DiagonalScale( RIGHT, NORMAL, sT, UL );
+    Gemm( NORMAL, ADJOINT, F(1), UL, ZL, F(0), A );
+    V = ZL;
+
+    return rank;
+}
+
+template<typename F>
+inline Int
+Partial
+( DistMatrix<F>& A, BASE(F) tau, DistMatrix<F>& V, Int oversample=10,
+  Int numPowerIts=1, bool relative=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("svt::Partial");
+        if( V.Width() != 0 && V.Height() != A.Width() )
+            LogicError("V must be empty or have as many rows as A has cols");
+    )
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    Int k = Min( V.Width()+Max(oversample,Int(1)), minDim );
+
+    V.SetGrid( g );
+    DistMatrix<F> Omega( V ), Y(g), Z(g), W(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    while( true )
+    {
+        const Int kOld = Min( Omega.Width(), k );
+        DistMatrix<F> OmegaNew( n, k, g );
+        if( kOld > 0 )
+        {
+            auto OmegaLeft = LockedView( Omega, 0, 0, n, kOld );
+            auto OmegaNewLeft = View( OmegaNew, 0, 0, n, kOld );
+            OmegaNewLeft = OmegaLeft;
+        }
+        auto OmegaNewRight = View( OmegaNew, 0, kOld, n, k-kOld );
+        MakeUniform( OmegaNewRight );
+        Omega = OmegaNew;
+
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Y );
+        qr::Explicit( Y );
+        for( Int it=0; it<numPowerIts; ++it )
+        {
+            Gemm( ADJOINT, NORMAL, F(1), A, Y, Z );
+            qr::Explicit( Z );
+            Gemm( NORMAL, NORMAL, F(1), A, Z, Y );
+            qr::Explicit( Y );
+        }
+
+        Gemm( ADJOINT, NORMAL, F(1), A, Y, Z );
+        SVD( Z, s, W );
+        const Real thresh = ( relative ? tau*s.Get(0,0) : tau );
+        if( k == minDim || s.Get(k-1,0) <= thresh )
+            break;
+
+        Omega = Z;
+        k = Min( 2*k, minDim );
+    }
+
+    SoftThreshold( s, tau, relative );
+    const Int rank = ZeroNorm( s );
+    if( rank == 0 )
+    {
+        Zero( A );
+        V.Resize( n, 0 );
+        return 0;
+    }
+    DistMatrix<F> U(g);
+    Gemm( NORMAL, NORMAL, F(1), Y, W, U );
+    auto UL = View( U, 0, 0, m, rank );
+    auto sT = LockedView( s, 0, 0, rank, 1 );
+    auto ZL = LockedView( Z, 0, 0, n, rank );
+    DiagonalScale( RIGHT, NORMAL, sT, UL );
+    Gemm( NORMAL, ADJOINT, F(1), UL, ZL, F(0), A );
+    V = ZL;
+
+    return rank;
+}
+
+} // namespace svt
+} // namespace elem
+
+#endif // ifndef ELEM_SVT_PARTIAL_HPP
@@ -10,6 +10,7 @@
 #ifndef ELEM_SOFTTHRESHOLD_HPP
 #define ELEM_SOFTTHRESHOLD_HPP
 
+#include ELEM_FUSED_INC
 #include ELEM_MAXNORM_INC
 
 namespace elem {
@@ -34,11 +35,7 @@ SoftThreshold( Matrix<F>& A, BASE(F) tau, bool relative=false )
     DEBUG_ONLY(CallStackEntry cse("SoftThreshold"))
     if( relative )
         tau *= MaxNorm(A);
-    const Int height = A.Height();
-    const Int width = A.Width();
-    for( Int j=0; j<width; ++j )
-        for( Int i=0; i<height; ++i )
-            A.Set( i, j, SoftThreshold(A.Get(i,j),tau) );
+    fused::Evaluate( fused::SoftThreshold( fused::Ref(A), tau ), A );
 }
 
 template<typename F,Dist U,Dist V>
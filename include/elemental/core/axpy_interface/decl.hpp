@@ -17,6 +17,14 @@
 
 namespace elem {
 
+// Whether or not AxpyInterface should use MPI-3 one-sided communication, when
+// it is available, instead of its two-sided protocol. It is off by default
+// since not every MPI implementation can create windows in every
+// configuration; the two-sided protocol is also used if the window cannot be
+// created.
+void SetAxpyInterfaceOneSided( bool oneSided );
+bool AxpyInterfaceOneSided();
+
 namespace axpy_type_wrapper {
 enum AxpyType { LOCAL_TO_GLOBAL, GLOBAL_TO_LOCAL };
 }
@@ -51,6 +59,7 @@ private:
     byte sendDummy_, recvDummy_;
     DistMatrix<T,MC,MR>* localToGlobalMat_;
     const DistMatrix<T,MC,MR>* globalToLocalMat_;
+    bool oneSided_;
 
     std::vector<bool> sentEomTo_, haveEomFrom_;
     std::vector<byte> recvVector_;
@@ -82,6 +91,28 @@ private:
       std::deque<std::vector<byte> >& sendVectors,
       std::deque<mpi::Request>& requests, 
       std::deque<bool>& requestStatuses );
+
+#ifdef HAVE_MPI3_RMA
+    // With MPI-3 one-sided communication enabled, updates are accumulated
+    // directly into (and data is read directly from) a window over the local
+    // buffer of the attached matrix, which is held within a single passive
+    // epoch until Detach. Contributions are packed into a staging buffer
+    // which is only recycled after a flush of all outstanding operations, and
+    // each process's piece of a submatrix is transferred in one operation.
+    static const Int MIN_STAGING_SIZE=1<<16;
+
+    mpi::Window window_;
+    std::vector<Int> remoteLDims_;
+    std::vector<T> stagingBuffer_;
+    Int numStaged_;
+
+    bool CreateWindow();
+    T* Stage( Int numEntries );
+
+    void OneSidedAxpyLocalToGlobal( T alpha, const Matrix<T>& X, Int i, Int j );
+    void OneSidedAxpyGlobalToLocal( T alpha,       Matrix<T>& Y, Int i, Int j );
+    void OneSidedDetach();
+#endif
 };
 
 } // namespace elem
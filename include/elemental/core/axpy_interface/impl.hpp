@@ -274,83 +274,28 @@ template<typename T>
 inline
 AxpyInterface<T>::AxpyInterface()
 : attachedForLocalToGlobal_(false), attachedForGlobalToLocal_(false), 
-  localToGlobalMat_(0), globalToLocalMat_(0)
+  localToGlobalMat_(0), globalToLocalMat_(0), oneSided_(false)
 { }
 
 template<typename T>
 inline
 AxpyInterface<T>::AxpyInterface( AxpyType type, DistMatrix<T,MC,MR>& Z )
+: attachedForLocalToGlobal_(false), attachedForGlobalToLocal_(false),
+  localToGlobalMat_(0), globalToLocalMat_(0), oneSided_(false)
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::AxpyInterface"))
-    if( type == LOCAL_TO_GLOBAL )
-    {
-        attachedForLocalToGlobal_ = true;
-        attachedForGlobalToLocal_ = false;
-        localToGlobalMat_ = &Z;
-        globalToLocalMat_ = 0;
-    }
-    else
-    {
-        attachedForLocalToGlobal_ = false;
-        attachedForGlobalToLocal_ = true;
-        localToGlobalMat_ = 0;
-        globalToLocalMat_ = &Z;
-    }
-
-    const Int p = Z.Grid().Size();
-    sentEomTo_.resize( p, false );
-    haveEomFrom_.resize( p, false );
-
-    sendingData_.resize( p );
-    sendingRequest_.resize( p );
-    sendingReply_.resize( p );
-
-    dataVectors_.resize( p );
-    requestVectors_.resize( p );
-    replyVectors_.resize( p );
-
-    dataSendRequests_.resize( p );
-    requestSendRequests_.resize( p );
-    replySendRequests_.resize( p );
-
-    eomSendRequests_.resize( p );
+    Attach( type, Z );
 }
 
 template<typename T>
 inline
 AxpyInterface<T>::AxpyInterface
 ( AxpyType type, const DistMatrix<T,MC,MR>& X )
+: attachedForLocalToGlobal_(false), attachedForGlobalToLocal_(false),
+  localToGlobalMat_(0), globalToLocalMat_(0), oneSided_(false)
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::AxpyInterface"))
-    if( type == LOCAL_TO_GLOBAL )
-    {
-        LogicError("Cannot update a constant matrix");
-    }
-    else
-    {
-        attachedForLocalToGlobal_ = false;
-        attachedForGlobalToLocal_ = true;
-        localToGlobalMat_ = 0;
-        globalToLocalMat_ = &X;
-    }
-
-    const Int p = X.Grid().Size();
-    sentEomTo_.resize( p, false );
-    haveEomFrom_.resize( p, false );
-
-    sendingData_.resize( p );
-    sendingRequest_.resize( p );
-    sendingReply_.resize( p );
-
-    dataVectors_.resize( p );
-    requestVectors_.resize( p );
-    replyVectors_.resize( p );
-
-    dataSendRequests_.resize( p );
-    requestSendRequests_.resize( p );
-    replySendRequests_.resize( p );
-
-    eomSendRequests_.resize( p );
+    Attach( type, X );
 }
 
 template<typename T>
@@ -401,6 +346,11 @@ AxpyInterface<T>::Attach( AxpyType type, DistMatrix<T,MC,MR>& Z )
         globalToLocalMat_ = &Z;
     }
 
+#ifdef HAVE_MPI3_RMA
+    oneSided_ = AxpyInterfaceOneSided() && CreateWindow();
+    if( oneSided_ )
+        return;
+#endif
     const Int p = Z.Grid().Size();
     sentEomTo_.resize( p, false );
     haveEomFrom_.resize( p, false );
@@ -438,6 +388,11 @@ AxpyInterface<T>::Attach( AxpyType type, const DistMatrix<T,MC,MR>& X )
         globalToLocalMat_ = &X;
     }
 
+#ifdef HAVE_MPI3_RMA
+    oneSided_ = AxpyInterfaceOneSided() && CreateWindow();
+    if( oneSided_ )
+        return;
+#endif
     const Int p = X.Grid().Size();
     sentEomTo_.resize( p, false );
     haveEomFrom_.resize( p, false );
@@ -462,6 +417,16 @@ inline void
 AxpyInterface<T>::Axpy( T alpha, Matrix<T>& Z, Int i, Int j )
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::Axpy"))
+#ifdef HAVE_MPI3_RMA
+    if( oneSided_ )
+    {
+        if( attachedForLocalToGlobal_ )
+            OneSidedAxpyLocalToGlobal( alpha, Z, i, j );
+        else
+            OneSidedAxpyGlobalToLocal( alpha, Z, i, j );
+        return;
+    }
+#endif
     if( attachedForLocalToGlobal_ )
         AxpyLocalToGlobal( alpha, Z, i, j );
     else if( attachedForGlobalToLocal_ )
@@ -475,6 +440,13 @@ inline void
 AxpyInterface<T>::Axpy( T alpha, const Matrix<T>& Z, Int i, Int j )
 {
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::Axpy"))
+#ifdef HAVE_MPI3_RMA
+    if( oneSided_ && attachedForLocalToGlobal_ )
+    {
+        OneSidedAxpyLocalToGlobal( alpha, Z, i, j );
+        return;
+    }
+#endif
     if( attachedForLocalToGlobal_ )
         AxpyLocalToGlobal( alpha, Z, i, j );
     else if( attachedForGlobalToLocal_ )
@@ -734,6 +706,13 @@ AxpyInterface<T>::Detach()
     DEBUG_ONLY(CallStackEntry cse("AxpyInterface::Detach"))
     if( !attachedForLocalToGlobal_ && !attachedForGlobalToLocal_ )
         LogicError("Must attach before detaching.");
+#ifdef HAVE_MPI3_RMA
+    if( oneSided_ )
+    {
+        OneSidedDetach();
+        return;
+    }
+#endif
 
     const Grid& g = ( attachedForLocalToGlobal_ ? 
                       localToGlobalMat_->Grid() : 
@@ -771,6 +750,243 @@ AxpyInterface<T>::Detach()
     eomSendRequests_.clear();
 }
 
+#ifdef HAVE_MPI3_RMA
+// Returns whether or not the window could be created and locked on every
+// process, so that the caller may fall back to the two-sided protocol.
+// Failures are only reported (rather than aborting) when MPI errors are
+// returned on the VC communicator, as is the case in debug builds.
+template<typename T>
+inline bool
+AxpyInterface<T>::CreateWindow()
+{
+    DEBUG_ONLY(CallStackEntry cse("AxpyInterface::CreateWindow"))
+    const DistMatrix<T,MC,MR>& A = ( attachedForLocalToGlobal_ ?
+                                     *localToGlobalMat_ :
+                                     *globalToLocalMat_ );
+    const Grid& g = A.Grid();
+    const Int p = g.Size();
+
+    // Every process needs the leading dimensions of all of the local buffers
+    // in order to compute the displacements of their columns
+    const Int ldim = A.LDim();
+    remoteLDims_.resize( p );
+    mpi::AllGather( &ldim, 1, remoteLDims_.data(), 1, g.VCComm() );
+
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const mpi::Aint numEntries =
+        ( localHeight > 0 && localWidth > 0 ?
+          (localWidth-1)*ldim + localHeight : 0 );
+    T* buffer = const_cast<T*>(A.LockedBuffer());
+    int created=0, locked=0;
+    try
+    {
+        mpi::WindowCreate
+        ( buffer, numEntries*sizeof(T), sizeof(T), g.VCComm(), window_ );
+        created = 1;
+        mpi::WindowLockAll( window_ );
+        locked = 1;
+    }
+    catch( std::exception& e ) { }
+    numStaged_ = 0;
+
+    const int createdEverywhere =
+        mpi::AllReduce( created, mpi::MIN, g.VCComm() );
+    const int lockedEverywhere =
+        mpi::AllReduce( locked, mpi::MIN, g.VCComm() );
+    if( lockedEverywhere )
+        return true;
+    if( locked )
+        mpi::WindowUnlockAll( window_ );
+    // Freeing the window is collective, so a window which could not be
+    // created on every process is abandoned rather than risking a hang
+    if( createdEverywhere )
+        mpi::WindowFree( window_ );
+    remoteLDims_.clear();
+    return false;
+}
+
+template<typename T>
+inline T*
+AxpyInterface<T>::Stage( Int numEntries )
+{
+    DEBUG_ONLY(CallStackEntry cse("AxpyInterface::Stage"))
+    const Int capacity = stagingBuffer_.size();
+    if( numStaged_+numEntries > capacity )
+    {
+        if( numStaged_ != 0 )
+        {
+            mpi::WindowFlushAll( window_ );
+            numStaged_ = 0;
+        }
+        if( numEntries > capacity )
+            stagingBuffer_.resize( Max(numEntries,MIN_STAGING_SIZE) );
+    }
+    T* stage = &stagingBuffer_[numStaged_];
+    numStaged_ += numEntries;
+    return stage;
+}
+
+// Update Y(i:i+height-1,j:j+width-1) += alpha X, where X is height x width
+template<typename T>
+inline void
+AxpyInterface<T>::OneSidedAxpyLocalToGlobal
+( T alpha, const Matrix<T>& X, Int i, Int j )
+{
+    DEBUG_ONLY(CallStackEntry cse("AxpyInterface::OneSidedAxpyLocalToGlobal"))
+    DistMatrix<T,MC,MR>& Y = *localToGlobalMat_;
+    if( i < 0 || j < 0 )
+        LogicError("Submatrix offsets must be non-negative");
+    if( i+X.Height() > Y.Height() || j+X.Width() > Y.Width() )
+        LogicError("Submatrix out of bounds of global matrix");
+
+    const Grid& g = Y.Grid();
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int colAlign = (Y.ColAlign() + i) % r;
+    const Int rowAlign = (Y.RowAlign() + j) % c;
+
+    const Int height = X.Height();
+    const Int width = X.Width();
+    const T* XBuffer = X.LockedBuffer();
+    const Int XLDim = X.LDim();
+
+    // Even our own contribution is accumulated through the window so that it
+    // is atomic with respect to the contributions of other processes. Each
+    // destination receives its entire piece in a single accumulate.
+    for( Int receivingCol=0; receivingCol<c; ++receivingCol )
+    {
+        const Int rowShift = Shift( receivingCol, rowAlign, c );
+        const Int localWidth = Length( width, rowShift, c );
+        if( localWidth == 0 )
+            continue;
+        const Int jLocalOffset =
+            Length( j, Shift(receivingCol,Y.RowAlign(),c), c );
+        for( Int receivingRow=0; receivingRow<r; ++receivingRow )
+        {
+            const Int colShift = Shift( receivingRow, colAlign, r );
+            const Int localHeight = Length( height, colShift, r );
+            if( localHeight == 0 )
+                continue;
+            const Int iLocalOffset =
+                Length( i, Shift(receivingRow,Y.ColAlign(),r), r );
+            const Int destination = receivingRow + r*receivingCol;
+            const Int ldim = remoteLDims_[destination];
+
+            T* stage = Stage( localHeight*localWidth );
+            for( Int t=0; t<localWidth; ++t )
+            {
+                T* stageCol = &stage[t*localHeight];
+                const T* XCol = &XBuffer[colShift+(rowShift+t*c)*XLDim];
+                for( Int s=0; s<localHeight; ++s )
+                    stageCol[s] = alpha*XCol[s*r];
+            }
+            const mpi::Aint disp = iLocalOffset + jLocalOffset*ldim;
+            mpi::Accumulate
+            ( stage, localHeight, localWidth, ldim, destination, disp, 
+              window_ );
+        }
+    }
+}
+
+// Update Y += alpha X(i:i+height-1,j:j+width-1), where X is the dist-matrix
+template<typename T>
+inline void
+AxpyInterface<T>::OneSidedAxpyGlobalToLocal
+( T alpha, Matrix<T>& Y, Int i, Int j )
+{
+    DEBUG_ONLY(CallStackEntry cse("AxpyInterface::OneSidedAxpyGlobalToLocal"))
+    const DistMatrix<T,MC,MR>& X = *globalToLocalMat_;
+
+    const Int height = Y.Height();
+    const Int width = Y.Width();
+    if( i+height > X.Height() || j+width > X.Width() )
+        LogicError("Invalid AxpyGlobalToLocal submatrix");
+
+    const Grid& g = X.Grid();
+    const Int r = g.Height();
+    const Int c = g.Width();
+    const Int colAlign = (X.ColAlign() + i) % r;
+    const Int rowAlign = (X.RowAlign() + j) % c;
+
+    // Since the staging buffer is flushed at the end of every request, a
+    // single contiguous block can hold the pieces from every process
+    T* stage = Stage( height*width );
+
+    // Issue all of the reads, one per process, before waiting on any of them
+    T* stageHead = stage;
+    for( Int sendingCol=0; sendingCol<c; ++sendingCol )
+    {
+        const Int rowShift = Shift( sendingCol, rowAlign, c );
+        const Int localWidth = Length( width, rowShift, c );
+        const Int jLocalOffset =
+            Length( j, Shift(sendingCol,X.RowAlign(),c), c );
+        for( Int sendingRow=0; sendingRow<r; ++sendingRow )
+        {
+            const Int colShift = Shift( sendingRow, colAlign, r );
+            const Int localHeight = Length( height, colShift, r );
+            if( localHeight == 0 || localWidth == 0 )
+                continue;
+            const Int iLocalOffset =
+                Length( i, Shift(sendingRow,X.ColAlign(),r), r );
+            const Int source = sendingRow + r*sendingCol;
+            const Int ldim = remoteLDims_[source];
+            const mpi::Aint disp = iLocalOffset + jLocalOffset*ldim;
+            mpi::Get
+            ( stageHead, localHeight, localWidth, ldim, source, disp, 
+              window_ );
+            stageHead += localHeight*localWidth;
+        }
+    }
+    mpi::WindowFlushAll( window_ );
+    numStaged_ = 0;
+
+    // Unpack the pieces in the same order in which they were requested
+    stageHead = stage;
+    T* YBuffer = Y.Buffer();
+    const Int YLDim = Y.LDim();
+    for( Int sendingCol=0; sendingCol<c; ++sendingCol )
+    {
+        const Int rowShift = Shift( sendingCol, rowAlign, c );
+        const Int localWidth = Length( width, rowShift, c );
+        for( Int sendingRow=0; sendingRow<r; ++sendingRow )
+        {
+            const Int colShift = Shift( sendingRow, colAlign, r );
+            const Int localHeight = Length( height, colShift, r );
+            for( Int t=0; t<localWidth; ++t )
+            {
+                T* YCol = &YBuffer[colShift+(rowShift+t*c)*YLDim];
+                for( Int s=0; s<localHeight; ++s )
+                    YCol[s*r] += alpha*stageHead[s];
+                stageHead += localHeight;
+            }
+        }
+    }
+}
+
+template<typename T>
+inline void
+AxpyInterface<T>::OneSidedDetach()
+{
+    DEBUG_ONLY(CallStackEntry cse("AxpyInterface::OneSidedDetach"))
+    const Grid& g = ( attachedForLocalToGlobal_ ?
+                      localToGlobalMat_->Grid() :
+                      globalToLocalMat_->Grid() );
+
+    // Complete our own operations, then wait for everyone else's before
+    // exposing the local buffer again
+    mpi::WindowUnlockAll( window_ );
+    mpi::Barrier( g.VCComm() );
+    mpi::WindowFree( window_ );
+
+    attachedForLocalToGlobal_ = false;
+    attachedForGlobalToLocal_ = false;
+    oneSided_ = false;
+    remoteLDims_.clear();
+    numStaged_ = 0;
+}
+#endif // ifdef HAVE_MPI3_RMA
+
 } // namespace elem
 
 #endif // ifndef ELEM_AXPYINTERFACE_IMPL_HPP
@@ -103,6 +103,13 @@ Real SafeAbs( const Complex<Real>& alpha );
 template<typename F>
 BASE(F) FastAbs( const F& alpha );
 
+// Multiplication without the special handling of infinities and NaNs which
+// std::complex requires (and which prevents vectorization)
+template<typename Real>
+Real FastMul( const Real& alpha, const Real& beta );
+template<typename Real>
+Complex<Real> FastMul( const Complex<Real>& alpha, const Complex<Real>& beta );
+
 // Conjugation
 template<typename Real>
 Real Conj( const Real& alpha );
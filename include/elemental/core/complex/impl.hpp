@@ -105,6 +105,21 @@ inline Base<F>
 FastAbs( const F& alpha )
 { return Abs(RealPart(alpha)) + Abs(ImagPart(alpha)); }
 
+template<typename Real>
+inline Real
+FastMul( const Real& alpha, const Real& beta )
+{ return alpha*beta; }
+
+template<typename Real>
+inline Complex<Real>
+FastMul( const Complex<Real>& alpha, const Complex<Real>& beta )
+{
+    const Real alphaRe=alpha.real(), alphaIm=alpha.imag(),
+               betaRe=beta.real(),   betaIm=beta.imag();
+    return Complex<Real>
+           ( alphaRe*betaRe-alphaIm*betaIm, alphaRe*betaIm+alphaIm*betaRe );
+}
+
 template<typename Real>
 inline Real
 Conj( const Real& alpha )
@@ -180,6 +180,18 @@ public:
     void MakeLocalReal( Int iLoc, Int jLoc );
     void ConjugateLocal( Int iLoc, Int jLoc );
 
+    // Batched global entry manipulation
+    // ---------------------------------
+    // NOTE: Entries may be queued by any process in the grid for any global
+    //       index, and are only routed to (every copy of) their owners within
+    //       the collective ProcessQueues. Queued overwrites are applied before
+    //       queued updates; conflicting overwrites from different processes
+    //       are resolved in favor of the highest rank in the VC communicator.
+    void Reserve( Int numRemoteUpdates, Int numRemoteSets=0 );
+    void QueueUpdate( Int i, Int j, T value );
+    void QueueSet( Int i, Int j, T value );
+    void ProcessQueues();
+
     // Diagonal manipulation
     // =====================
     void MakeDiagonalReal( Int offset=0 );
@@ -305,6 +317,10 @@ protected:
     Int height_, width_;
     Memory<T> auxMemory_;
     elem::Matrix<T> matrix_;
+
+    // Queued global entries
+    // ---------------------
+    std::vector<ValueIntPair<T> > remoteUpdates_, remoteSets_;
     
     // Process grid and distribution metadata
     // --------------------------------------
@@ -100,6 +100,17 @@ int SymmetricTridiagEig
   double vl, double vu, int il, int iu, double abstol,
   double* w, double* Z, int ldz );
 
+//
+// Compute the i'th (zero-indexed) eigenvalue of diag(d) + rho z z^T, where 
+// d is strictly increasing, z has unit norm, and rho > 0. The j'th entry of 
+// delta is set to d(j) - lambda.
+//
+
+float SecularEigenvalue
+( int n, int i, const float* d, const float* z, float rho, float* delta );
+double SecularEigenvalue
+( int n, int i, const double* d, const double* z, double rho, double* delta );
+
 //
 // Compute the eigen-values/pairs of a Hermitian matrix
 //
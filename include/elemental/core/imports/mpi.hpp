@@ -34,11 +34,14 @@ typedef MPI_Aint Aint;
 typedef MPI_Comm Comm;
 typedef MPI_Datatype Datatype;
 typedef MPI_Errhandler ErrorHandler;
+typedef MPI_File File;
 typedef MPI_Group Group;
+typedef MPI_Offset Offset;
 typedef MPI_Op Op;
 typedef MPI_Request Request;
 typedef MPI_Status Status;
 typedef MPI_User_function UserFunction;
+typedef MPI_Win Window;
 
 // Standard constants
 const int ANY_SOURCE = MPI_ANY_SOURCE;
@@ -73,6 +76,9 @@ const Op LOGICAL_XOR = MPI_LXOR;
 const Op BINARY_AND = MPI_BAND;
 const Op BINARY_OR = MPI_BOR;
 const Op BINARY_XOR = MPI_BXOR;
+const int MODE_RDONLY = MPI_MODE_RDONLY;
+const int MODE_WRONLY = MPI_MODE_WRONLY;
+const int MODE_CREATE = MPI_MODE_CREATE;
 
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
@@ -130,6 +136,75 @@ bool IProbe( int source, int tag, Comm comm, Status& status );
 template<typename T>
 int GetCount( Status& status );
 
+// Derived datatypes
+void TypeVector
+( int count, int blockLength, int stride, Datatype oldType, 
+  Datatype& newType );
+void TypeHVector
+( int count, int blockLength, Aint stride, Datatype oldType, 
+  Datatype& newType );
+void TypeCommit( Datatype& type );
+void TypeFree( Datatype& type );
+
+// Parallel file I/O
+// =================
+void FileOpen( Comm comm, const std::string filename, int mode, File& file );
+void FileClose( File& file );
+Offset FileGetSize( File file );
+void FileSetSize( File file, Offset size );
+void FileSetView( File file, Offset disp, Datatype eType, Datatype fileType );
+void FileReadAtAll
+( File file, Offset offset, void* buf, int count, Datatype type );
+void FileWriteAtAll
+( File file, Offset offset, const void* buf, int count, Datatype type );
+void FileReadAll( File file, void* buf, int count, Datatype type );
+void FileWriteAll( File file, const void* buf, int count, Datatype type );
+
+#ifdef HAVE_MPI3_RMA
+// One-sided communication
+// =======================
+// NOTE: Displacements are in units of the window's displacement unit, which
+//       should be sizeof(T) for windows over buffers of T's
+void WindowCreate
+( void* base, Aint size, int dispUnit, Comm comm, Window& window );
+void WindowFree( Window& window );
+void WindowLockAll( Window window );
+void WindowUnlockAll( Window window );
+void WindowFlushAll( Window window );
+template<typename R>
+void Accumulate
+( const R* buf, int count, int target, Aint disp, Window window );
+template<typename R>
+void Accumulate
+( const Complex<R>* buf, int count, int target, Aint disp, Window window );
+template<typename R>
+void Get( R* buf, int count, int target, Aint disp, Window window );
+template<typename R>
+void Get( Complex<R>* buf, int count, int target, Aint disp, Window window );
+// Accumulate a contiguous height x width column-major block into (or get one
+// from) the column-major block with leading dimension ldim which begins at
+// disp within the target's window, in a single operation
+template<typename R>
+void Accumulate
+( const R* buf, int height, int width, int ldim, int target, Aint disp, 
+  Window window );
+template<typename R>
+void Accumulate
+( const Complex<R>* buf, int height, int width, int ldim, int target, 
+  Aint disp, Window window );
+template<typename R>
+void Get
+( R* buf, int height, int width, int ldim, int target, Aint disp, 
+  Window window );
+template<typename R>
+void Get
+( Complex<R>* buf, int height, int width, int ldim, int target, Aint disp, 
+  Window window );
+// Atomically add to a single remote entry and return its previous value
+template<typename T>
+T FetchAndAdd( T value, int target, Aint disp, Window window );
+#endif // ifdef HAVE_MPI3_RMA
+
 // Point-to-point communication
 // ============================
 
@@ -38,6 +38,12 @@
   "elemental/blas-like/level1/Dot.hpp"
 #define ELEM_DOTU_INC \
   "elemental/blas-like/level1/Dotu.hpp"
+#define ELEM_ENTRYWISEMAP_INC \
+  "elemental/blas-like/level1/EntrywiseMap.hpp"
+#define ELEM_ENTRYWISEREDUCE_INC \
+  "elemental/blas-like/level1/EntrywiseReduce.hpp"
+#define ELEM_FUSED_INC \
+  "elemental/blas-like/level1/Fused.hpp"
 #define ELEM_HADAMARD_INC \
   "elemental/blas-like/level1/Hadamard.hpp"
 #define ELEM_HILBERTSCHMIDT_INC \
@@ -129,6 +135,8 @@
 #define ELEM_HER2K_INC        "elemental/blas-like/level3/Her2k.hpp"
 #define ELEM_HERK_INC         "elemental/blas-like/level3/Herk.hpp"
 #define ELEM_MULTISHIFTTRSM_INC "elemental/blas-like/level3/MultiShiftTrsm.hpp"
+#define ELEM_MULTISHIFTQUASITRSM_INC \
+  "elemental/blas-like/level3/MultiShiftQuasiTrsm.hpp"
 #define ELEM_SYMM_INC         "elemental/blas-like/level3/Symm.hpp"
 #define ELEM_SYR2K_INC        "elemental/blas-like/level3/Syr2k.hpp"
 #define ELEM_SYRK_INC         "elemental/blas-like/level3/Syrk.hpp"
@@ -182,11 +190,19 @@
 
 // Specific HermitianEig routines
 // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+#define ELEM_HERMITIANEIG_LOBPCG_INC \
+  "elemental/lapack-like/decomp/HermitianEig/LOBPCG.hpp"
 #define ELEM_HERMITIANEIG_SDC_INC \
   "elemental/lapack-like/decomp/HermitianEig/SDC.hpp"
+#define ELEM_HERMITIANEIG_SPECTRUMSLICING_INC \
+  "elemental/lapack-like/decomp/HermitianEig/SpectrumSlicing.hpp"
 
 // Specific HermitianTridiagEig routines
 // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+#define ELEM_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_INC \
+  "elemental/lapack-like/decomp/HermitianTridiagEig/DivideAndConquer.hpp"
+#define ELEM_HERMITIANTRIDIAGEIG_SINGLEPRECISION_INC \
+  "elemental/lapack-like/decomp/HermitianTridiagEig/SinglePrecision.hpp"
 #define ELEM_HERMITIANTRIDIAGEIG_SORT_INC \
   "elemental/lapack-like/decomp/HermitianTridiagEig/Sort.hpp"
 
@@ -196,6 +212,8 @@
   "elemental/lapack-like/decomp/Polar/QDWH.hpp"
 #define ELEM_POLAR_SVD_INC \
   "elemental/lapack-like/decomp/Polar/SVD.hpp"
+#define ELEM_POLAR_ZOLOTAREV_INC \
+  "elemental/lapack-like/decomp/Polar/Zolotarev.hpp"
 
 // Specific Schur routines
 // ^^^^^^^^^^^^^^^^^^^^^^^
@@ -278,6 +296,8 @@
   "elemental/lapack-like/factor/QR/Householder.hpp"
 #define ELEM_QR_PANELHOUSEHOLDER_INC \
   "elemental/lapack-like/factor/QR/PanelHouseholder.hpp"
+#define ELEM_QR_STACKEDIDENTITY_INC \
+  "elemental/lapack-like/factor/QR/StackedIdentity.hpp"
 #define ELEM_QR_TS_INC \
   "elemental/lapack-like/factor/QR/TS.hpp"
 
@@ -339,6 +359,8 @@
   "elemental/lapack-like/props/Trace.hpp"
 // Specific condition-number routines
 // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+#define ELEM_CONDITIONESTIMATE_INC \
+  "elemental/lapack-like/props/Condition/Estimate.hpp"
 #define ELEM_FROBENIUSCONDITION_INC \
   "elemental/lapack-like/props/Condition/Frobenius.hpp"
 #define ELEM_INFINITYCONDITION_INC \
@@ -411,6 +433,8 @@
   "elemental/lapack-like/util/Reflector.hpp"
 #define ELEM_SORT_INC \
   "elemental/lapack-like/util/Sort.hpp"
+#define ELEM_TEAMS_INC \
+  "elemental/lapack-like/util/Teams.hpp"
 
 // Special matrices
 // ================
@@ -486,11 +510,14 @@
 #define ELEM_IO_DECL_INC "elemental/io/decl.hpp"
 #define ELEM_IO_IMPL_INC "elemental/io/impl.hpp"
 
-#define ELEM_DISPLAY_INC "elemental/io/Display.hpp"
-#define ELEM_PRINT_INC   "elemental/io/Print.hpp"
-#define ELEM_READ_INC    "elemental/io/Read.hpp"
-#define ELEM_SPY_INC     "elemental/io/Spy.hpp"
-#define ELEM_WRITE_INC   "elemental/io/Write.hpp"
+#define ELEM_CHECKPOINT_INC "elemental/io/Checkpoint.hpp"
+#define ELEM_DISPLAY_INC    "elemental/io/Display.hpp"
+#define ELEM_MAP_INC        "elemental/io/Map.hpp"
+#define ELEM_MPIIO_INC      "elemental/io/MPIIO.hpp"
+#define ELEM_PRINT_INC      "elemental/io/Print.hpp"
+#define ELEM_READ_INC       "elemental/io/Read.hpp"
+#define ELEM_SPY_INC        "elemental/io/Spy.hpp"
+#define ELEM_WRITE_INC      "elemental/io/Write.hpp"
 
 // Support for convex optimization
 // ===============================
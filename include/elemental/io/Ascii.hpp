@@ -0,0 +1,976 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_ASCII_HPP
+#define ELEM_ASCII_HPP
+
+#include <cctype>
+#include <cstdio>
+
+// Routines for parsing and formatting matrices stored as text.
+//
+// A text buffer is split into one chunk per thread, each of which begins at
+// the start of a row, and each chunk is parsed independently after a cheap
+// pass which counts the rows in each chunk. Distributed reads apply the same
+// scheme across processes, with each process loading and parsing the rows
+// which begin within its portion of the bytes of the file.
+//
+// All text buffers are required to be followed by a null character so that
+// numbers which fall off of the fast conversion path may be handed to strtod.
+
+namespace elem {
+namespace ascii {
+
+inline Int
+NumThreads()
+{
+#ifdef HAVE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+// Rows are terminated by newlines (and also by semicolons in MATLAB syntax)
+inline bool
+IsRowEnd( char c, bool semicolons )
+{ return c == '\n' || (semicolons && c == ';'); }
+
+inline bool
+IsBlank( char c )
+{ return c == ' ' || c == '\t' || c == '\r' || c == ','; }
+
+// Return the beginning of the row following the one containing pos
+inline const char*
+NextRow( const char* pos, const char* end, bool semicolons )
+{
+    while( pos != end && !IsRowEnd(*pos,semicolons) )
+        ++pos;
+    return ( pos == end ? end : pos+1 );
+}
+
+// Blank rows, comments, and the closing bracket of a MATLAB matrix do not
+// contain any entries
+inline bool
+RowIsEmpty( const char* pos, const char* end, bool semicolons )
+{
+    while( pos != end && IsBlank(*pos) )
+        ++pos;
+    return pos == end || IsRowEnd(*pos,semicolons) ||
+           *pos == ']' || *pos == '%';
+}
+
+inline Int
+CountRows( const char* beg, const char* end, bool semicolons )
+{
+    Int numRows = 0;
+    for( const char* pos=beg; pos!=end; pos=NextRow(pos,end,semicolons) )
+        if( !RowIsEmpty(pos,end,semicolons) )
+            ++numRows;
+    return numRows;
+}
+
+// Split [beg,end) into one chunk per thread, each beginning at the start of
+// a row, and count the nonempty rows preceding each chunk
+inline void
+SplitRows
+( const char* beg, const char* end, bool semicolons,
+  std::vector<const char*>& splits, std::vector<Int>& offsets )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::SplitRows"))
+    const Int numChunks = NumThreads();
+    const std::size_t size = end - beg;
+    splits.resize( numChunks+1 );
+    splits[0] = beg;
+    splits[numChunks] = end;
+    for( Int c=1; c<numChunks; ++c )
+    {
+        const char* pos = beg + (size*c)/numChunks;
+        if( pos != beg && !IsRowEnd(pos[-1],semicolons) )
+            pos = NextRow( pos, end, semicolons );
+        splits[c] = std::max( pos, splits[c-1] );
+    }
+
+    std::vector<Int> counts( numChunks );
+    PARALLEL_FOR
+    for( Int c=0; c<numChunks; ++c )
+        counts[c] = CountRows( splits[c], splits[c+1], semicolons );
+    offsets.resize( numChunks+1 );
+    offsets[0] = 0;
+    for( Int c=0; c<numChunks; ++c )
+        offsets[c+1] = offsets[c] + counts[c];
+}
+
+// Number conversion
+// =================
+
+// Clinger's fast path: the conversion is exact when the decimal mantissa and
+// the power of ten are both exactly representable
+inline bool
+FastConvert( unsigned long long mantissa, Int exponent, double& value )
+{
+    static const double powers[] =
+        { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+          1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+          1e22 };
+    if( mantissa > (1ULL<<53) || exponent < -22 || exponent > 22 )
+        return false;
+    value = double(mantissa);
+    value = ( exponent >= 0 ? value*powers[exponent]
+                            : value/powers[-exponent] );
+    return true;
+}
+
+inline bool
+FastConvert( unsigned long long mantissa, Int exponent, float& value )
+{
+    static const float powers[] =
+        { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    if( mantissa > (1ULL<<24) || exponent < -10 || exponent > 10 )
+        return false;
+    value = float(mantissa);
+    value = ( exponent >= 0 ? value*powers[exponent]
+                            : value/powers[-exponent] );
+    return true;
+}
+
+template<typename Real>
+inline bool
+FastConvert( unsigned long long mantissa, Int exponent, Real& value )
+{
+    double alpha;
+    if( !FastConvert( mantissa, exponent, alpha ) )
+        return false;
+    value = Real(alpha);
+    return true;
+}
+
+inline double
+SlowConvert( const char* pos, char** numEnd, double )
+{ return std::strtod( pos, numEnd ); }
+
+inline float
+SlowConvert( const char* pos, char** numEnd, float )
+{ return std::strtof( pos, numEnd ); }
+
+template<typename Real>
+inline Real
+SlowConvert( const char* pos, char** numEnd, Real )
+{ return Real(std::strtod( pos, numEnd )); }
+
+// Parse a real number beginning at pos and advance pos past it. Returns false
+// if pos does not point to a number.
+template<typename Real>
+inline bool
+ParseReal( const char*& pos, const char* end, Real& value )
+{
+    const char* p = pos;
+    bool negative = false;
+    if( p != end && (*p == '+' || *p == '-') )
+    {
+        negative = ( *p == '-' );
+        ++p;
+    }
+
+    // Accumulate up to 19 significant digits
+    const Int maxDigits = 19;
+    unsigned long long mantissa = 0;
+    Int numDigits = 0, exponent = 0;
+    bool sawDigit = false, exact = true;
+    for( ; p != end && *p >= '0' && *p <= '9'; ++p )
+    {
+        sawDigit = true;
+        if( numDigits < maxDigits )
+        {
+            mantissa = 10*mantissa + (*p-'0');
+            if( mantissa != 0 )
+                ++numDigits;
+        }
+        else
+        {
+            ++exponent;
+            exact = exact && *p == '0';
+        }
+    }
+    if( p != end && *p == '.' )
+    {
+        for( ++p; p != end && *p >= '0' && *p <= '9'; ++p )
+        {
+            sawDigit = true;
+            if( numDigits < maxDigits )
+            {
+                mantissa = 10*mantissa + (*p-'0');
+                if( mantissa != 0 )
+                    ++numDigits;
+                --exponent;
+            }
+            else
+                exact = exact && *p == '0';
+        }
+    }
+    if( sawDigit && p != end && (*p == 'e' || *p == 'E') )
+    {
+        const char* q = p+1;
+        bool negativeExp = false;
+        if( q != end && (*q == '+' || *q == '-') )
+        {
+            negativeExp = ( *q == '-' );
+            ++q;
+        }
+        if( q != end && *q >= '0' && *q <= '9' )
+        {
+            Int exp = 0;
+            for( ; q != end && *q >= '0' && *q <= '9'; ++q )
+                if( exp < 100000 )
+                    exp = 10*exp + (*q-'0');
+            exponent += ( negativeExp ? -exp : exp );
+            p = q;
+        }
+    }
+
+    if( sawDigit && exact && FastConvert( mantissa, exponent, value ) )
+    {
+        if( negative )
+            value = -value;
+        pos = p;
+        return true;
+    }
+
+    // Fall back to the C library, which also handles infinities and NaN's
+    char* numEnd;
+    value = SlowConvert( pos, &numEnd, Real(0) );
+    if( numEnd == pos )
+        return false;
+    pos = numEnd;
+    return true;
+}
+
+template<typename Real>
+inline bool
+ParseEntry( const char*& pos, const char* end, Real& value )
+{ return ParseReal( pos, end, value ); }
+
+// Complex entries are of the form a+bi, a-bi, or a+-bi (as produced by
+// operator<<), or purely imaginary
+template<typename Real>
+inline bool
+ParseEntry( const char*& pos, const char* end, Complex<Real>& value )
+{
+    Real realPart, imagPart=0;
+    if( !ParseReal( pos, end, realPart ) )
+        return false;
+    if( pos != end && (*pos == '+' || *pos == '-') )
+    {
+        const char* p = pos;
+        if( p[0] == '+' && p+1 != end && p[1] == '-' )
+            ++p;
+        if( !ParseReal( p, end, imagPart ) ||
+            p == end || (*p != 'i' && *p != 'j') )
+            return false;
+        pos = p+1;
+    }
+    else if( pos != end && (*pos == 'i' || *pos == 'j') )
+    {
+        imagPart = realPart;
+        realPart = 0;
+        ++pos;
+    }
+    value = Complex<Real>(realPart,imagPart);
+    return true;
+}
+
+// Parse the entries of the row beginning at pos into buffer[0], buffer[ldim],
+// ..., storing at most maxEntries of them, and advance pos to the next row.
+// Returns the number of entries in the row, or -1 if it could not be parsed.
+template<typename T>
+inline Int
+ParseRow
+( const char*& pos, const char* end, bool semicolons,
+  T* buffer, Int ldim, Int maxEntries )
+{
+    Int numEntries = 0;
+    while( true )
+    {
+        while( pos != end && IsBlank(*pos) )
+            ++pos;
+        if( pos == end || IsRowEnd(*pos,semicolons) ||
+            *pos == ']' || *pos == '%' )
+            break;
+        T value;
+        if( !ParseEntry( pos, end, value ) )
+        {
+            numEntries = -1;
+            break;
+        }
+        if( numEntries < maxEntries )
+            buffer[numEntries*ldim] = value;
+        ++numEntries;
+    }
+    pos = NextRow( pos, end, semicolons );
+    return numEntries;
+}
+
+// Return the number of entries in the first nonempty row of [beg,end)
+template<typename T>
+inline Int
+FirstRowWidth( const char* beg, const char* end, bool semicolons )
+{
+    const char* pos = beg;
+    while( pos != end && RowIsEmpty(pos,end,semicolons) )
+        pos = NextRow( pos, end, semicolons );
+    if( pos == end )
+        return 0;
+    return ParseRow<T>( pos, end, semicolons, nullptr, 0, 0 );
+}
+
+// Parse the nonempty rows of [beg,end), which must each contain width
+// entries, into A. Returns false if any row could not be parsed.
+template<typename T>
+inline bool
+ParseDense
+( const char* beg, const char* end, bool semicolons, Int width,
+  Matrix<T>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::ParseDense"))
+    std::vector<const char*> splits;
+    std::vector<Int> offsets;
+    SplitRows( beg, end, semicolons, splits, offsets );
+    const Int numChunks = splits.size()-1;
+    A.Resize( offsets[numChunks], width );
+
+    T* ABuf = A.Buffer();
+    const Int ldim = A.LDim();
+    bool valid = true;
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for reduction(&&:valid)
+#endif
+    for( Int c=0; c<numChunks; ++c )
+    {
+        const char* pos = splits[c];
+        const char* chunkEnd = splits[c+1];
+        Int i = offsets[c];
+        while( pos != chunkEnd )
+        {
+            if( RowIsEmpty(pos,chunkEnd,semicolons) )
+            {
+                pos = NextRow( pos, chunkEnd, semicolons );
+                continue;
+            }
+            if( ParseRow( pos, chunkEnd, semicolons, &ABuf[i], ldim, width )
+                != width )
+                valid = false;
+            ++i;
+        }
+    }
+    return valid;
+}
+
+// Return the offset of the first entry of a file written by write::Ascii
+// (which may begin with a title) or write::AsciiMatlab (which begins with
+// "title = [")
+inline std::streamoff
+DataOffset( std::istream& file, bool matlab )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::DataOffset"))
+    std::string line;
+    std::streamoff lineBeg = file.tellg();
+    while( std::getline( file, line ) )
+    {
+        if( matlab )
+        {
+            const std::size_t bracket = line.find('[');
+            if( bracket != std::string::npos )
+                return lineBeg + bracket + 1;
+        }
+        else
+        {
+            const std::size_t first = line.find_first_not_of(" \t\r");
+            if( first != std::string::npos &&
+                std::string("0123456789+-.nNiI").find(line[first]) !=
+                std::string::npos )
+                return lineBeg;
+        }
+        lineBeg = file.tellg();
+    }
+    file.clear();
+    file.seekg( 0, std::ios::end );
+    return file.tellg();
+}
+
+// Formatting
+// ==========
+
+// Enough digits are printed for the values to be recovered exactly
+inline void
+FormatReal( std::string& s, double alpha )
+{
+    char buf[32];
+    const int n = std::snprintf( buf, 32, "%.16e", alpha );
+    s.append( buf, n );
+}
+
+inline void
+FormatReal( std::string& s, float alpha )
+{
+    char buf[32];
+    const int n = std::snprintf( buf, 32, "%.8e", double(alpha) );
+    s.append( buf, n );
+}
+
+template<typename Real>
+inline void
+FormatReal( std::string& s, Real alpha )
+{
+    std::ostringstream os;
+    os << alpha;
+    s += os.str();
+}
+
+template<typename Real>
+inline void
+FormatEntry( std::string& s, Real alpha )
+{ FormatReal( s, alpha ); }
+
+template<typename Real>
+inline void
+FormatEntry( std::string& s, Complex<Real> alpha )
+{
+    FormatReal( s, alpha.real() );
+    if( !(alpha.imag() < Real(0)) )
+        s += '+';
+    FormatReal( s, alpha.imag() );
+    s += 'i';
+}
+
+// Write the rows of A, one per line, formatting batches of rows in parallel
+template<typename T>
+inline void
+FormatRows( const Matrix<T>& A, std::ostream& os )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::FormatRows"))
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const T* ABuf = A.LockedBuffer();
+    const Int ldim = A.LDim();
+    const Int batchSize = Max( (Int(1)<<20)/Max(width,Int(1)), Int(1) );
+    std::vector<std::string> rows( Min(batchSize,height) );
+    for( Int iBeg=0; iBeg<height; iBeg+=batchSize )
+    {
+        const Int b = Min(batchSize,height-iBeg);
+        PARALLEL_FOR
+        for( Int k=0; k<b; ++k )
+        {
+            std::string& row = rows[k];
+            row.clear();
+            for( Int j=0; j<width; ++j )
+            {
+                if( j != 0 )
+                    row += ' ';
+                FormatEntry( row, ABuf[iBeg+k+j*ldim] );
+            }
+            row += '\n';
+        }
+        for( Int k=0; k<b; ++k )
+            os.write( rows[k].data(), rows[k].size() );
+    }
+}
+
+// MatrixMarket
+// ============
+
+namespace mm_symmetry_wrapper {
+enum MatrixMarketSymmetry
+{
+    MM_GENERAL,
+    MM_SYMMETRIC,
+    MM_SKEW_SYMMETRIC,
+    MM_HERMITIAN
+};
+}
+using namespace mm_symmetry_wrapper;
+
+struct MatrixMarketHeader
+{
+    bool coordinate, complexField, pattern;
+    MatrixMarketSymmetry symmetry;
+    Int height, width, numEntries;
+    std::streamoff dataOffset;
+};
+
+inline std::string
+ToLower( std::string s )
+{
+    for( std::size_t k=0; k<s.size(); ++k )
+        s[k] = std::tolower( s[k] );
+    return s;
+}
+
+inline MatrixMarketHeader
+ReadMatrixMarketHeader( std::istream& file )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::ReadMatrixMarketHeader"))
+    std::string line;
+    std::getline( file, line );
+    std::istringstream banner( line );
+    std::string tag, object, format, field, symmetry;
+    banner >> tag >> object >> format >> field >> symmetry;
+    object = ToLower( object );
+    format = ToLower( format );
+    field = ToLower( field );
+    symmetry = ToLower( symmetry );
+    if( tag != "%%MatrixMarket" || object != "matrix" )
+        RuntimeError("Invalid MatrixMarket banner: ",line);
+
+    MatrixMarketHeader header;
+    if( format == "coordinate" )
+        header.coordinate = true;
+    else if( format == "array" )
+        header.coordinate = false;
+    else
+        RuntimeError("Unsupported MatrixMarket format: ",format);
+    if( field != "real" && field != "double" && field != "integer" &&
+        field != "complex" && field != "pattern" )
+        RuntimeError("Unsupported MatrixMarket field: ",field);
+    header.complexField = ( field == "complex" );
+    header.pattern = ( field == "pattern" );
+    if( header.pattern && !header.coordinate )
+        RuntimeError("Pattern matrices must be in coordinate format");
+    if( symmetry == "general" )
+        header.symmetry = MM_GENERAL;
+    else if( symmetry == "symmetric" )
+        header.symmetry = MM_SYMMETRIC;
+    else if( symmetry == "skew-symmetric" )
+        header.symmetry = MM_SKEW_SYMMETRIC;
+    else if( symmetry == "hermitian" )
+        header.symmetry = MM_HERMITIAN;
+    else
+        RuntimeError("Unsupported MatrixMarket symmetry: ",symmetry);
+
+    // Skip the comments and read the size line
+    while( std::getline( file, line ) )
+    {
+        const std::size_t first = line.find_first_not_of(" \t\r");
+        if( first == std::string::npos || line[first] == '%' )
+            continue;
+        std::istringstream sizes( line );
+        sizes >> header.height >> header.width;
+        const Int n = header.width;
+        if( header.coordinate )
+            sizes >> header.numEntries;
+        else if( header.symmetry == MM_GENERAL )
+            header.numEntries = header.height*n;
+        else if( header.symmetry == MM_SKEW_SYMMETRIC )
+            header.numEntries = (n*(n-1))/2;
+        else
+            header.numEntries = (n*(n+1))/2;
+        if( sizes.fail() || header.height < 0 || header.width < 0 ||
+            header.numEntries < 0 )
+            RuntimeError("Invalid MatrixMarket size line: ",line);
+        if( header.symmetry != MM_GENERAL && header.height != header.width )
+            RuntimeError("Symmetric MatrixMarket matrices must be square");
+        header.dataOffset = file.tellg();
+        return header;
+    }
+    RuntimeError("MatrixMarket file is missing its size line");
+    return header;
+}
+
+// The entries of a symmetric array are the columns of its lower triangle
+// (and the strict lower triangle if it is skew-symmetric)
+inline void
+ArrayIndex( const MatrixMarketHeader& header, Int k, Int& i, Int& j )
+{
+    if( header.symmetry == MM_GENERAL )
+    {
+        i = k % Max(header.height,Int(1));
+        j = k / Max(header.height,Int(1));
+        return;
+    }
+    const Int skew = ( header.symmetry == MM_SKEW_SYMMETRIC ? 1 : 0 );
+    j = 0;
+    while( j < header.width && k >= header.height-j-skew )
+    {
+        k -= header.height-j-skew;
+        ++j;
+    }
+    i = j + skew + k;
+}
+
+inline void
+NextArrayIndex( const MatrixMarketHeader& header, Int& i, Int& j )
+{
+    const Int skew = ( header.symmetry == MM_SKEW_SYMMETRIC ? 1 : 0 );
+    if( ++i == header.height )
+    {
+        ++j;
+        i = ( header.symmetry == MM_GENERAL ? 0 : j+skew );
+    }
+}
+
+// Parse the value of an entry and advance pos to the next row
+template<typename Real>
+inline bool
+ParseMatrixMarketValue
+( const char*& pos, const char* end, const MatrixMarketHeader& header,
+  Real& value )
+{
+    if( header.pattern )
+    {
+        pos = NextRow( pos, end, false );
+        value = 1;
+        return true;
+    }
+    if( header.complexField )
+    {
+        pos = NextRow( pos, end, false );
+        return false;
+    }
+    return ParseRow<Real>( pos, end, false, &value, 0, 1 ) == 1;
+}
+
+template<typename Real>
+inline bool
+ParseMatrixMarketValue
+( const char*& pos, const char* end, const MatrixMarketHeader& header,
+  Complex<Real>& value )
+{
+    if( header.pattern )
+    {
+        pos = NextRow( pos, end, false );
+        value = 1;
+        return true;
+    }
+    Real parts[2] = { 0, 0 };
+    const Int numParts = ( header.complexField ? 2 : 1 );
+    if( ParseRow<Real>( pos, end, false, parts, 1, 2 ) != numParts )
+        return false;
+    value = Complex<Real>(parts[0],parts[1]);
+    return true;
+}
+
+// Parse the entries in the nonempty rows of [beg,end) into the (zero-based)
+// row and column indices and values. The first row is entry number
+// firstEntry of the file. Returns false if any entry could not be parsed.
+template<typename T>
+inline bool
+ParseMatrixMarket
+( const char* beg, const char* end, const MatrixMarketHeader& header,
+  Int firstEntry,
+  std::vector<Int>& rows, std::vector<Int>& cols, std::vector<T>& values )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::ParseMatrixMarket"))
+    std::vector<const char*> splits;
+    std::vector<Int> offsets;
+    SplitRows( beg, end, false, splits, offsets );
+    const Int numChunks = splits.size()-1;
+    const Int numEntries = offsets[numChunks];
+    rows.resize( numEntries );
+    cols.resize( numEntries );
+    values.resize( numEntries );
+
+    bool valid = true;
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for reduction(&&:valid)
+#endif
+    for( Int c=0; c<numChunks; ++c )
+    {
+        const char* pos = splits[c];
+        const char* chunkEnd = splits[c+1];
+        Int k = offsets[c];
+        Int i=0, j=0;
+        if( !header.coordinate )
+            ArrayIndex( header, firstEntry+k, i, j );
+        while( pos != chunkEnd )
+        {
+            if( RowIsEmpty(pos,chunkEnd,false) )
+            {
+                pos = NextRow( pos, chunkEnd, false );
+                continue;
+            }
+            if( header.coordinate )
+            {
+                // Advance past the (one-based) indices
+                while( pos != chunkEnd && IsBlank(*pos) )
+                    ++pos;
+                Int indices[2];
+                for( Int t=0; t<2; ++t )
+                {
+                    double index;
+                    while( pos != chunkEnd && IsBlank(*pos) )
+                        ++pos;
+                    if( !ParseReal( pos, chunkEnd, index ) )
+                        index = 0;
+                    indices[t] = Int(index) - 1;
+                }
+                i = indices[0];
+                j = indices[1];
+            }
+            if( i < 0 || i >= header.height || j < 0 || j >= header.width )
+                valid = false;
+            rows[k] = i;
+            cols[k] = j;
+            if( !ParseMatrixMarketValue( pos, chunkEnd, header, values[k] ) )
+                valid = false;
+            if( !header.coordinate )
+                NextArrayIndex( header, i, j );
+            ++k;
+        }
+    }
+    return valid;
+}
+
+// The value of the (j,i) entry implied by the (i,j) entry of a symmetric,
+// skew-symmetric, or Hermitian matrix
+template<typename T>
+inline T
+MirrorValue( const MatrixMarketHeader& header, T value )
+{
+    if( header.symmetry == MM_SKEW_SYMMETRIC )
+        return -value;
+    else if( header.symmetry == MM_HERMITIAN )
+        return Conj(value);
+    else
+        return value;
+}
+
+inline void
+WriteMatrixMarketHeader
+( std::ostream& os, Int height, Int width, bool isComplex )
+{
+    os << "%%MatrixMarket matrix array " << (isComplex ? "complex" : "real")
+       << " general\n" << height << " " << width << "\n";
+}
+
+template<typename Real>
+inline void
+FormatMatrixMarketEntry( std::string& s, Real alpha )
+{ FormatReal( s, alpha ); }
+
+template<typename Real>
+inline void
+FormatMatrixMarketEntry( std::string& s, Complex<Real> alpha )
+{
+    FormatReal( s, alpha.real() );
+    s += ' ';
+    FormatReal( s, alpha.imag() );
+}
+
+// Write the entries of A in column-major order, one per line, formatting
+// batches of columns in parallel
+template<typename T>
+inline void
+FormatColumns( const Matrix<T>& A, std::ostream& os )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::FormatColumns"))
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const T* ABuf = A.LockedBuffer();
+    const Int ldim = A.LDim();
+    const Int batchSize = Max( (Int(1)<<20)/Max(height,Int(1)), Int(1) );
+    std::vector<std::string> columns( Min(batchSize,width) );
+    for( Int jBeg=0; jBeg<width; jBeg+=batchSize )
+    {
+        const Int b = Min(batchSize,width-jBeg);
+        PARALLEL_FOR
+        for( Int k=0; k<b; ++k )
+        {
+            std::string& column = columns[k];
+            column.clear();
+            for( Int i=0; i<height; ++i )
+            {
+                FormatMatrixMarketEntry( column, ABuf[i+(jBeg+k)*ldim] );
+                column += '\n';
+            }
+        }
+        for( Int k=0; k<b; ++k )
+            os.write( columns[k].data(), columns[k].size() );
+    }
+}
+
+// Distributed loading
+// ===================
+
+// Load the text of the rows of the file which begin within our portion of
+// the bytes following offset, so that each row is loaded by exactly one
+// process of comm. The returned text is null-terminated, and textOffset is
+// set to the position of its first character within the file.
+inline void
+LoadRows
+( mpi::Comm comm, const std::string filename, mpi::Offset offset,
+  bool semicolons, std::vector<char>& text, mpi::Offset& textOffset )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::LoadRows"))
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_RDONLY, file );
+    const mpi::Offset size = mpi::FileGetSize( file );
+    const mpi::Offset length = Max( size-offset, mpi::Offset(0) );
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+    const mpi::Offset rangeBeg = offset + (length*commRank)/commSize;
+    const mpi::Offset rangeEnd = offset + (length*(commRank+1))/commSize;
+
+    // Read one extra character in front of our range in order to determine
+    // whether or not a row begins at rangeBeg
+    const mpi::Offset readBeg =
+        ( rangeBeg > offset ? rangeBeg-1 : rangeBeg );
+    std::vector<char> buffer( rangeEnd-readBeg );
+    mpi::FileReadAtAll
+    ( file, readBeg, buffer.data(), buffer.size(), mpi::TypeMap<byte>() );
+
+    // Find the beginning of our first row
+    std::size_t first = 0;
+    if( rangeBeg > offset )
+    {
+        while( first < buffer.size() && !IsRowEnd(buffer[first],semicolons) )
+            ++first;
+        ++first;
+    }
+    const bool empty = ( first >= buffer.size() );
+
+    // Extend the buffer until it contains the end of our last row
+    const mpi::Offset blockSize = 1<<16;
+    mpi::Offset readEnd = rangeEnd;
+    int done = empty || readEnd == size || IsRowEnd(buffer.back(),semicolons);
+    while( !mpi::AllReduce( done, mpi::MIN, comm ) )
+    {
+        const mpi::Offset numRead =
+            ( done ? 0 : Min(blockSize,size-readEnd) );
+        const std::size_t oldSize = buffer.size();
+        buffer.resize( oldSize+numRead );
+        mpi::FileReadAtAll
+        ( file, readEnd, buffer.data()+oldSize, numRead,
+          mpi::TypeMap<byte>() );
+        readEnd += numRead;
+        for( std::size_t k=oldSize; k<buffer.size() && !done; ++k )
+        {
+            if( IsRowEnd(buffer[k],semicolons) )
+            {
+                buffer.resize( k+1 );
+                done = true;
+            }
+        }
+        if( readEnd == size )
+            done = true;
+    }
+    mpi::FileClose( file );
+
+    if( empty )
+        text.assign( 1, '\0' );
+    else
+    {
+        text.assign( buffer.begin()+first, buffer.end() );
+        text.push_back( '\0' );
+    }
+    textOffset = readBeg + first;
+}
+
+// Add (or, if accumulate is false, copy) the values into the entries of A
+// with the given global indices. The processes which own the entries of A
+// receive them in a single exchange.
+template<typename T,Dist U,Dist V>
+inline void
+ScatterEntries
+( DistMatrix<T,U,V>& A, const std::vector<Int>& rows,
+  const std::vector<Int>& cols, const std::vector<T>& values,
+  bool accumulate )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::ScatterEntries"))
+    mpi::Comm comm = A.DistComm();
+    const int commSize = mpi::CommSize( comm );
+    const Int numEntries = values.size();
+
+    std::vector<int> sendCounts( commSize, 0 ), owners( numEntries );
+    for( Int k=0; k<numEntries; ++k )
+    {
+        owners[k] = A.Owner( rows[k], cols[k] );
+        ++sendCounts[owners[k]];
+    }
+    std::vector<int> recvCounts( commSize );
+    mpi::AllToAll( sendCounts.data(), 1, recvCounts.data(), 1, comm );
+    std::vector<int> sendDispls( commSize ), recvDispls( commSize );
+    int totalSend=0, totalRecv=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendDispls[q] = totalSend;
+        recvDispls[q] = totalRecv;
+        totalSend += sendCounts[q];
+        totalRecv += recvCounts[q];
+    }
+
+    // Pack the indices as pairs and the values separately
+    std::vector<Int> sendIndices( 2*totalSend );
+    std::vector<T> sendValues( totalSend );
+    std::vector<int> offsets( sendDispls );
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const int s = offsets[owners[k]]++;
+        sendIndices[2*s] = rows[k];
+        sendIndices[2*s+1] = cols[k];
+        sendValues[s] = values[k];
+    }
+    std::vector<Int> recvIndices( 2*totalRecv );
+    std::vector<T> recvValues( totalRecv );
+    mpi::AllToAll
+    ( sendValues.data(), sendCounts.data(), sendDispls.data(),
+      recvValues.data(), recvCounts.data(), recvDispls.data(), comm );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendCounts[q] *= 2;
+        sendDispls[q] *= 2;
+        recvCounts[q] *= 2;
+        recvDispls[q] *= 2;
+    }
+    mpi::AllToAll
+    ( sendIndices.data(), sendCounts.data(), sendDispls.data(),
+      recvIndices.data(), recvCounts.data(), recvDispls.data(), comm );
+
+    const Int colShift = A.ColShift();
+    const Int rowShift = A.RowShift();
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    for( Int s=0; s<totalRecv; ++s )
+    {
+        const Int iLoc = (recvIndices[2*s]-colShift) / colStride;
+        const Int jLoc = (recvIndices[2*s+1]-rowShift) / rowStride;
+        if( accumulate )
+            A.UpdateLocal( iLoc, jLoc, recvValues[s] );
+        else
+            A.SetLocal( iLoc, jLoc, recvValues[s] );
+    }
+}
+
+// Copy the local matrices of the processes with redundant rank zero to the
+// rest of their redundant communicator
+template<typename T,Dist U,Dist V>
+inline void
+BroadcastRedundant( DistMatrix<T,U,V>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("ascii::BroadcastRedundant"))
+    if( !A.Participating() || A.RedundantSize() == 1 )
+        return;
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    std::vector<T> buffer( localHeight*localWidth );
+    const bool root = ( A.RedundantRank() == 0 );
+    if( root )
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            MemCopy
+            ( &buffer[jLoc*localHeight], A.LockedBuffer(0,jLoc),
+              localHeight );
+    mpi::Broadcast( buffer.data(), buffer.size(), 0, A.RedundantComm() );
+    if( !root )
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            MemCopy
+            ( A.Buffer(0,jLoc), &buffer[jLoc*localHeight], localHeight );
+}
+
+} // namespace ascii
+} // namespace elem
+
+#endif // ifndef ELEM_ASCII_HPP
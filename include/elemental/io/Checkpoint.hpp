@@ -0,0 +1,331 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_CHECKPOINT_HPP
+#define ELEM_CHECKPOINT_HPP
+
+#include ELEM_IO_DECL_INC
+#include ELEM_MPIIO_INC
+
+// A checkpoint is a single file, written in parallel with MPI-IO, which
+// consists of
+//
+//   1) a header of NUM_HEADER_ENTRIES Int's recording the datatype, the
+//      dimensions, the distribution, the alignments, and the grid shape,
+//   2) an arbitrary number of double-precision state variables (e.g., the
+//      iteration count and any scalars carried between iterations), and
+//   3) the column-major image of the matrix.
+//
+// Since the matrix is stored independently of its distribution, a checkpoint
+// may be reloaded onto any grid and into any distribution. The alignments are
+// only restored when the distribution and grid shape are unchanged.
+//
+// Only the processes which own the grid take part, so that checkpoints may be
+// taken from within computations on subgrids.
+//
+// A checkpoint is first written to a temporary file which is only renamed
+// over the previous checkpoint once it has been successfully closed, so that
+// a failure in the middle of a write leaves the last good checkpoint intact.
+
+namespace elem {
+namespace checkpoint {
+
+const Int MAGIC = 0x454c4350; // "ELCP"
+const Int VERSION = 1;
+const Int NUM_HEADER_ENTRIES = 12;
+
+template<typename T,Dist U,Dist V>
+inline void
+Write
+( const DistMatrix<T,U,V>& A, const std::string filename,
+  const std::vector<double>& state )
+{
+    DEBUG_ONLY(CallStackEntry cse("checkpoint::Write"))
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    mpi::Comm comm = g.OwningComm();
+    const bool root = ( mpi::CommRank(comm) == 0 );
+    const std::string tmpFilename = filename + ".tmp";
+    mpi::File file;
+    mpi::FileOpen
+    ( comm, tmpFilename, mpi::MODE_WRONLY|mpi::MODE_CREATE, file );
+
+    const Int numState = state.size();
+    const mpi::Offset headerBytes = NUM_HEADER_ENTRIES*sizeof(Int);
+    const mpi::Offset metaBytes = headerBytes + numState*sizeof(double);
+    const mpi::Offset numBytes =
+        metaBytes + mpi::Offset(A.Height())*A.Width()*sizeof(T);
+    mpi::FileSetSize( file, numBytes );
+
+    // Only the root of the viewing communicator writes the metadata
+    const Int header[NUM_HEADER_ENTRIES] =
+        { MAGIC, VERSION, Int(sizeof(T)), Int(IsComplex<T>::val),
+          A.Height(), A.Width(), Int(U), Int(V), A.ColAlign(), A.RowAlign(),
+          g.Height(), numState };
+    mpi::FileWriteAtAll
+    ( file, 0, header, (root ? NUM_HEADER_ENTRIES : 0), mpi::TypeMap<Int>() );
+    mpi::FileWriteAtAll
+    ( file, headerBytes, state.data(), (root ? numState : 0),
+      mpi::TypeMap<double>() );
+
+    mpi_io::Write( A, file, metaBytes );
+    mpi::FileClose( file );
+
+    // Replace the previous checkpoint once every process has closed the new one
+    mpi::Barrier( comm );
+    int renamed = 0;
+    if( root )
+        renamed = ( std::rename( tmpFilename.c_str(), filename.c_str() ) == 0 );
+    mpi::Broadcast( renamed, 0, comm );
+    if( !renamed )
+        RuntimeError("Could not rename ",tmpFilename," to ",filename);
+}
+
+template<typename T,Dist U,Dist V>
+inline void
+Read
+( DistMatrix<T,U,V>& A, const std::string filename,
+  std::vector<double>& state )
+{
+    DEBUG_ONLY(CallStackEntry cse("checkpoint::Read"))
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    mpi::File file;
+    mpi::FileOpen( g.OwningComm(), filename, mpi::MODE_RDONLY, file );
+
+    Int header[NUM_HEADER_ENTRIES];
+    const mpi::Offset headerBytes = NUM_HEADER_ENTRIES*sizeof(Int);
+    if( mpi::FileGetSize( file ) < headerBytes )
+    {
+        mpi::FileClose( file );
+        RuntimeError(filename," is too small to be a checkpoint");
+    }
+    mpi::FileReadAtAll
+    ( file, 0, header, NUM_HEADER_ENTRIES, mpi::TypeMap<Int>() );
+    if( header[0] != MAGIC || header[1] != VERSION ||
+        header[2] != Int(sizeof(T)) || header[3] != Int(IsComplex<T>::val) )
+    {
+        mpi::FileClose( file );
+        RuntimeError(filename," is not a compatible checkpoint");
+    }
+    const Int height = header[4];
+    const Int width = header[5];
+    const Int numState = header[11];
+    const mpi::Offset metaBytes = headerBytes + numState*sizeof(double);
+    const mpi::Offset numBytes = mpi::FileGetSize( file );
+    const mpi::Offset numBytesExp =
+        metaBytes + mpi::Offset(height)*width*sizeof(T);
+    if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+
+    state.resize( numState );
+    mpi::FileReadAtAll
+    ( file, headerBytes, state.data(), numState, mpi::TypeMap<double>() );
+
+    // Restore the alignments if the layout would be unchanged
+    const bool sameLayout =
+        header[6] == Int(U) && header[7] == Int(V) && header[10] == g.Height();
+    if( sameLayout && !A.Viewing() &&
+        !A.ColConstrained() && !A.RowConstrained() )
+    {
+        A.Empty();
+        A.Align( header[8], header[9] );
+    }
+    A.Resize( height, width );
+    mpi_io::Read( A, file, metaBytes );
+    mpi::FileClose( file );
+}
+
+// Return whether or not the file exists (collective over comm)
+inline bool
+Exists( const std::string filename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("checkpoint::Exists"))
+    int exists = 0;
+    if( mpi::CommRank(comm) == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        exists = file.is_open();
+    }
+    mpi::Broadcast( exists, 0, comm );
+    return exists;
+}
+
+// Remove the file (collective over comm)
+inline void
+Remove( const std::string filename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("checkpoint::Remove"))
+    mpi::Barrier( comm );
+    if( mpi::CommRank(comm) == 0 )
+        std::remove( filename.c_str() );
+    mpi::Barrier( comm );
+}
+
+// Hooks for iterative algorithms
+// ==============================
+
+// Pushes a checkpoint scope for the lifetime of the object
+class Scope
+{
+public:
+    Scope( std::string scope ) { PushCheckpointScope( scope ); }
+    ~Scope() { PopCheckpointScope(); }
+};
+
+inline bool
+Enabled()
+{ return CheckpointBasename() != ""; }
+
+// Form the filename of the checkpoint of the given name in the current scope
+inline std::string
+Filename( const std::string name )
+{ return CheckpointBasename() + CheckpointScope() + "-" + name + ".ckpt"; }
+
+// Checkpoints are due after every CheckpointFrequency() iterations
+inline bool
+Due( Int numIts )
+{ return Enabled() && numIts % CheckpointFrequency() == 0; }
+
+// Scrambles the bits of a 64-bit integer (the finalizer of SplitMix64)
+inline unsigned long long
+Mix( unsigned long long x )
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// A 64-bit checksum of the entries of A. Each entry is hashed together with
+// its global index and the hashes are summed modulo 2^64, so that the result
+// does not depend upon the grid or the alignments.
+template<typename F>
+inline unsigned long long
+Checksum( const DistMatrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("checkpoint::Checksum"))
+    typedef Base<F> Real;
+    const Int height = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Int colShift = A.ColShift();
+    const Int rowShift = A.RowShift();
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    unsigned long long localSum = 0;
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = rowShift + jLoc*rowStride;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = colShift + iLoc*colStride;
+            const F alpha = A.GetLocal(iLoc,jLoc);
+            const Real parts[2] = { RealPart(alpha), ImagPart(alpha) };
+            unsigned long long bits[2] = { 0, 0 };
+            std::memcpy( &bits[0], &parts[0], sizeof(Real) );
+            std::memcpy( &bits[1], &parts[1], sizeof(Real) );
+            const unsigned long long index = 
+                Mix( (unsigned long long)(i) + 
+                     (unsigned long long)(j)*(unsigned long long)(height) );
+            localSum += Mix( index ^ Mix( bits[0] ^ Mix( bits[1] ) ) );
+        }
+    }
+    return mpi::AllReduce( localSum, A.DistComm() );
+}
+
+// A summary of an input matrix, which is used to ensure that a checkpoint was
+// produced from the same input as the current call. The checksum is stored
+// as two 32-bit halves, which doubles represent exactly, so that it survives
+// the relative comparison in Load.
+template<typename F>
+inline std::vector<double>
+Fingerprint( const DistMatrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("checkpoint::Fingerprint"))
+    std::vector<double> fingerprint(4,0);
+    fingerprint[0] = A.Height();
+    fingerprint[1] = A.Width();
+    if( A.Grid().InGrid() )
+    {
+        const unsigned long long checksum = Checksum( A );
+        fingerprint[2] = checksum >> 32;
+        fingerprint[3] = checksum & 0xffffffffULL;
+    }
+    return fingerprint;
+}
+
+// Save the iterate A, along with the fingerprint of the input and the state
+template<typename F>
+inline void
+Save
+( const std::string name, const DistMatrix<F>& A,
+  const std::vector<double>& fingerprint, const std::vector<double>& state )
+{
+    DEBUG_ONLY(CallStackEntry cse("checkpoint::Save"))
+    std::vector<double> fullState( fingerprint );
+    fullState.insert( fullState.end(), state.begin(), state.end() );
+    Write( A, Filename(name), fullState );
+}
+
+// If restarting is enabled and a checkpoint of the given name was saved from
+// an input with a matching fingerprint, overwrite A and state with its
+// contents and return true. Otherwise, A and state are left unchanged.
+template<typename F>
+inline bool
+Load
+( const std::string name, DistMatrix<F>& A,
+  const std::vector<double>& fingerprint, std::vector<double>& state )
+{
+    DEBUG_ONLY(CallStackEntry cse("checkpoint::Load"))
+    if( !Enabled() || !RestartFromCheckpoint() )
+        return false;
+    const std::string filename = Filename( name );
+    if( !A.Grid().InGrid() || !Exists( filename, A.Grid().OwningComm() ) )
+        return false;
+
+    DistMatrix<F> B( A.Grid() );
+    std::vector<double> fullState;
+    Read( B, filename, fullState );
+    const Int numPrint = fingerprint.size();
+    if( Int(fullState.size()) < numPrint )
+        return false;
+    const double tol = 1e-10;
+    for( Int i=0; i<numPrint; ++i )
+        if( Abs(fullState[i]-fingerprint[i]) > tol*Abs(fingerprint[i]) )
+            return false;
+
+    A = B;
+    state.assign( fullState.begin()+numPrint, fullState.end() );
+    return true;
+}
+
+// Remove the checkpoint of the given name in the current scope, e.g., once
+// the iteration which produced it has converged
+template<typename F>
+inline void
+Discard( const std::string name, const DistMatrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("checkpoint::Discard"))
+    if( Enabled() && A.Grid().InGrid() )
+        Remove( Filename(name), A.Grid().OwningComm() );
+}
+
+} // namespace checkpoint
+} // namespace elem
+
+#endif // ifndef ELEM_CHECKPOINT_HPP
@@ -0,0 +1,234 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_COMPRESSED_HPP
+#define ELEM_COMPRESSED_HPP
+
+#ifdef HAVE_ZLIB
+# include <zlib.h>
+#endif
+
+// The BINARY_COMPRESSED format consists of
+//
+//   1) a header of NUM_HEADER_ENTRIES Int's recording the datatype, the
+//      dimensions, the storage scheme, the number of retained mantissa bits,
+//      and the number of columns per chunk,
+//   2) the number of stored bytes of each chunk (as unsigned long long's),
+//   3) the chunks themselves, each of which holds the stored portions of a
+//      contiguous set of columns.
+//
+// Before compression, the bytes of each chunk are transposed so that the
+// i'th bytes of every real entry are contiguous, as the sign/exponent bytes
+// of neighboring entries tend to be highly correlated. A chunk which did not
+// shrink (or was written without zlib) is stored raw. Chunks are encoded and
+// decoded in parallel when OpenMP is available.
+
+namespace elem {
+
+namespace compressed_storage_wrapper {
+enum CompressedStorage
+{
+    COMPRESSED_FULL,  // all entries are stored
+    COMPRESSED_LOWER, // only the lower trapezoid (including the diagonal)
+    COMPRESSED_UPPER  // only the upper trapezoid (including the diagonal)
+};
+}
+using namespace compressed_storage_wrapper;
+
+namespace compressed {
+
+const Int MAGIC = 0x454c435a; // "ELCZ"
+const Int VERSION = 1;
+const Int NUM_HEADER_ENTRIES = 9;
+
+// Aim for roughly a megabyte of raw data per chunk
+template<typename T>
+inline Int
+ChunkWidth( Int height )
+{ return Max( (Int(1)<<20)/Max(height*Int(sizeof(T)),Int(1)), Int(1) ); }
+
+// The range of rows of column j which are stored
+inline void
+StoredRows
+( CompressedStorage storage, Int height, Int j, Int& iBeg, Int& iEnd )
+{
+    iBeg = 0;
+    iEnd = height;
+    if( storage == COMPRESSED_LOWER )
+        iBeg = Min(j,height);
+    else if( storage == COMPRESSED_UPPER )
+        iEnd = Min(j+1,height);
+}
+
+template<typename T>
+inline std::size_t
+RawChunkSize
+( CompressedStorage storage, Int height, Int jBeg, Int jEnd )
+{
+    std::size_t numEntries = 0;
+    for( Int j=jBeg; j<jEnd; ++j )
+    {
+        Int iBeg, iEnd;
+        StoredRows( storage, height, j, iBeg, iEnd );
+        numEntries += iEnd-iBeg;
+    }
+    return numEntries*sizeof(T);
+}
+
+// Round the mantissas to the specified number of bits (zero means lossless)
+template<typename Real,typename UInt>
+inline void
+TruncateImpl
+( Real* buffer, std::size_t numEntries, Int numMantissaBits,
+  Int mantissaBits )
+{
+    if( mantissaBits <= 0 || mantissaBits >= numMantissaBits )
+        return;
+    const Int numDropped = numMantissaBits - mantissaBits;
+    const UInt half = UInt(1) << (numDropped-1);
+    const UInt mask = ~((UInt(1)<<numDropped)-1);
+    for( std::size_t k=0; k<numEntries; ++k )
+    {
+        if( !std::isfinite(buffer[k]) )
+            continue;
+        UInt bits;
+        std::memcpy( &bits, &buffer[k], sizeof(UInt) );
+        const UInt truncated = bits & mask;
+        bits = (bits+half) & mask;
+        std::memcpy( &buffer[k], &bits, sizeof(UInt) );
+        // Rounding up can carry into the exponent and overflow to infinity,
+        // so fall back to truncating towards zero near the largest value
+        if( !std::isfinite(buffer[k]) )
+            std::memcpy( &buffer[k], &truncated, sizeof(UInt) );
+    }
+}
+
+template<typename Real>
+inline void
+Truncate( Real* buffer, std::size_t numEntries, Int mantissaBits )
+{ }
+
+inline void
+Truncate( float* buffer, std::size_t numEntries, Int mantissaBits )
+{ TruncateImpl<float,unsigned>( buffer, numEntries, 23, mantissaBits ); }
+
+inline void
+Truncate( double* buffer, std::size_t numEntries, Int mantissaBits )
+{
+    TruncateImpl<double,unsigned long long>
+    ( buffer, numEntries, 52, mantissaBits );
+}
+
+// Transpose the bytes of numEntries entries of the given size
+inline void
+Shuffle
+( const byte* in, byte* out, std::size_t numEntries, std::size_t entrySize )
+{
+    for( std::size_t b=0; b<entrySize; ++b )
+        for( std::size_t k=0; k<numEntries; ++k )
+            out[b*numEntries+k] = in[k*entrySize+b];
+}
+
+inline void
+Unshuffle
+( const byte* in, byte* out, std::size_t numEntries, std::size_t entrySize )
+{
+    for( std::size_t b=0; b<entrySize; ++b )
+        for( std::size_t k=0; k<numEntries; ++k )
+            out[k*entrySize+b] = in[b*numEntries+k];
+}
+
+// Pack, truncate, shuffle, and compress columns [jBeg,jEnd) of the matrix
+// with the given buffer. Raw buffers are used since these routines are called
+// from within parallel regions.
+template<typename T>
+inline void
+EncodeChunk
+( Int height, const T* ABuf, Int ldim, CompressedStorage storage,
+  Int mantissaBits, Int jBeg, Int jEnd, std::vector<byte>& chunk )
+{
+    typedef Base<T> Real;
+    const std::size_t rawSize = RawChunkSize<T>( storage, height, jBeg, jEnd );
+    std::vector<byte> packed( rawSize ), shuffled( rawSize );
+    std::size_t offset = 0;
+    for( Int j=jBeg; j<jEnd; ++j )
+    {
+        Int iBeg, iEnd;
+        StoredRows( storage, height, j, iBeg, iEnd );
+        const std::size_t numBytes = (iEnd-iBeg)*sizeof(T);
+        if( numBytes != 0 )
+            std::memcpy( &packed[offset], &ABuf[iBeg+j*ldim], numBytes );
+        offset += numBytes;
+    }
+    const std::size_t numReals = rawSize/sizeof(Real);
+    Truncate( reinterpret_cast<Real*>(packed.data()), numReals, mantissaBits );
+    Shuffle( packed.data(), shuffled.data(), numReals, sizeof(Real) );
+
+#ifdef HAVE_ZLIB
+    uLongf compressedSize = compressBound( rawSize );
+    chunk.resize( compressedSize );
+    const int error =
+        compress2
+        ( chunk.data(), &compressedSize, shuffled.data(), rawSize,
+          Z_BEST_SPEED );
+    if( error == Z_OK && compressedSize < rawSize )
+    {
+        chunk.resize( compressedSize );
+        return;
+    }
+#endif
+    chunk.swap( shuffled );
+}
+
+// Decompress, unshuffle, and unpack a chunk into columns [jBeg,jEnd) of the
+// matrix with the given buffer. Returns false if the chunk was corrupted.
+template<typename T>
+inline bool
+DecodeChunk
+( const byte* chunk, std::size_t chunkSize, CompressedStorage storage,
+  Int jBeg, Int jEnd, Int height, T* ABuf, Int ldim )
+{
+    typedef Base<T> Real;
+    const std::size_t rawSize = RawChunkSize<T>( storage, height, jBeg, jEnd );
+    std::vector<byte> shuffled, packed( rawSize );
+    const byte* shuffledBuf = chunk;
+    if( chunkSize != rawSize )
+    {
+#ifdef HAVE_ZLIB
+        shuffled.resize( rawSize );
+        uLongf uncompressedSize = rawSize;
+        const int error =
+            uncompress( shuffled.data(), &uncompressedSize, chunk, chunkSize );
+        if( error != Z_OK || uncompressedSize != rawSize )
+            return false;
+        shuffledBuf = shuffled.data();
+#else
+        return false;
+#endif
+    }
+    const std::size_t numReals = rawSize/sizeof(Real);
+    Unshuffle( shuffledBuf, packed.data(), numReals, sizeof(Real) );
+
+    std::size_t offset = 0;
+    for( Int j=jBeg; j<jEnd; ++j )
+    {
+        Int iBeg, iEnd;
+        StoredRows( storage, height, j, iBeg, iEnd );
+        const std::size_t numBytes = (iEnd-iBeg)*sizeof(T);
+        if( numBytes != 0 )
+            std::memcpy( &ABuf[iBeg+j*ldim], &packed[offset], numBytes );
+        offset += numBytes;
+    }
+    return true;
+}
+
+} // namespace compressed
+} // namespace elem
+
+#endif // ifndef ELEM_COMPRESSED_HPP
@@ -0,0 +1,84 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_MPIIO_HPP
+#define ELEM_MPIIO_HPP
+
+// Collective reads and writes of the column-major image of a distributed
+// matrix. Each process sets a file view which selects exactly the entries of
+// its local matrix, so that every process reads (or writes) its own data
+// directly rather than funneling the entire matrix through a single process.
+
+namespace elem {
+namespace mpi_io {
+
+// Form the datatype describing the positions of our local entries within the
+// column-major file image of A, as well as the datatype describing their
+// positions within our local buffer. The returned value is the byte offset of
+// our first entry within the file image.
+template<typename T,Dist U,Dist V>
+inline mpi::Offset
+CreateTypes
+( const DistMatrix<T,U,V>& A, mpi::Datatype& fileType, mpi::Datatype& memType )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi_io::CreateTypes"))
+    const Int height = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const mpi::Datatype eType = mpi::TypeMap<T>();
+
+    // Each of our local columns is a strided subset of a column of A
+    mpi::Datatype colType;
+    const mpi::Aint rowStride = mpi::Aint(A.RowStride())*height*sizeof(T);
+    mpi::TypeVector( localHeight, 1, A.ColStride(), eType, colType );
+    mpi::TypeHVector( localWidth, 1, rowStride, colType, fileType );
+    mpi::TypeCommit( fileType );
+    mpi::TypeFree( colType );
+
+    mpi::TypeVector( localWidth, localHeight, A.LDim(), eType, memType );
+    mpi::TypeCommit( memType );
+
+    return (A.ColShift()+A.RowShift()*mpi::Offset(height))*sizeof(T);
+}
+
+// Read the column-major image of A beginning disp bytes into the file
+template<typename T,Dist U,Dist V>
+inline void
+Read( DistMatrix<T,U,V>& A, mpi::File file, mpi::Offset disp )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi_io::Read"))
+    mpi::Datatype fileType, memType;
+    const mpi::Offset offset = CreateTypes( A, fileType, memType );
+    mpi::FileSetView( file, disp+offset, mpi::TypeMap<T>(), fileType );
+    mpi::FileReadAll( file, A.Buffer(), 1, memType );
+    mpi::TypeFree( memType );
+    mpi::TypeFree( fileType );
+}
+
+// Write the column-major image of A beginning disp bytes into the file
+template<typename T,Dist U,Dist V>
+inline void
+Write( const DistMatrix<T,U,V>& A, mpi::File file, mpi::Offset disp )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi_io::Write"))
+    // Only a single copy of each entry should be written
+    const bool writer = A.Participating() && A.RedundantRank() == 0;
+
+    mpi::Datatype fileType, memType;
+    const mpi::Offset offset = CreateTypes( A, fileType, memType );
+    mpi::FileSetView( file, disp+offset, mpi::TypeMap<T>(), fileType );
+    mpi::FileWriteAll( file, A.LockedBuffer(), (writer ? 1 : 0), memType );
+    mpi::TypeFree( memType );
+    mpi::TypeFree( fileType );
+}
+
+} // namespace mpi_io
+} // namespace elem
+
+#endif // ifndef ELEM_MPIIO_HPP
@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_MAP_HPP
+#define ELEM_MAP_HPP
+
+#ifdef HAVE_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace elem {
+
+// A memory mapping of an entire file. Read-only mappings are shared through
+// the page cache, whereas copy-on-write mappings may be modified without
+// the modifications ever reaching the file. Pages are only read from disk
+// as they are touched.
+class MappedFile
+{
+    byte* buffer_;
+    std::size_t size_;
+    bool copyOnWrite_;
+public:
+    MappedFile() : buffer_(nullptr), size_(0), copyOnWrite_(false) { }
+    MappedFile( const std::string filename, bool copyOnWrite=false )
+    : buffer_(nullptr), size_(0), copyOnWrite_(false)
+    { Open( filename, copyOnWrite ); }
+    ~MappedFile() { Close(); }
+
+#ifndef SWIG
+    MappedFile( MappedFile&& file )
+    : buffer_(nullptr), size_(0), copyOnWrite_(false)
+    { ShallowSwap( file ); }
+    MappedFile& operator=( MappedFile&& file )
+    { ShallowSwap( file ); return *this; }
+    MappedFile( const MappedFile& ) = delete;
+    MappedFile& operator=( const MappedFile& ) = delete;
+#endif
+
+    void ShallowSwap( MappedFile& file )
+    {
+        std::swap( buffer_, file.buffer_ );
+        std::swap( size_, file.size_ );
+        std::swap( copyOnWrite_, file.copyOnWrite_ );
+    }
+
+    void Open( const std::string filename, bool copyOnWrite=false )
+    {
+        DEBUG_ONLY(CallStackEntry cse("MappedFile::Open"))
+        Close();
+#ifdef HAVE_MMAP
+        const int fd = open( filename.c_str(), O_RDONLY );
+        if( fd == -1 )
+            RuntimeError("Could not open ",filename);
+        struct stat fileStat;
+        if( fstat( fd, &fileStat ) == -1 )
+        {
+            close( fd );
+            RuntimeError("Could not query the size of ",filename);
+        }
+        const std::size_t size = fileStat.st_size;
+        // Zero-length mappings are not allowed
+        if( size != 0 )
+        {
+            const int prot = ( copyOnWrite ? PROT_READ|PROT_WRITE : PROT_READ );
+            const int flags = ( copyOnWrite ? MAP_PRIVATE : MAP_SHARED );
+            void* addr = mmap( 0, size, prot, flags, fd, 0 );
+            if( addr == MAP_FAILED )
+            {
+                close( fd );
+                RuntimeError("Could not map ",filename);
+            }
+            buffer_ = static_cast<byte*>(addr);
+        }
+        // The mapping remains valid after the descriptor is closed
+        close( fd );
+        size_ = size;
+        copyOnWrite_ = copyOnWrite;
+#else
+        LogicError("Memory-mapped files are not supported on this platform");
+#endif
+    }
+
+    void Close()
+    {
+#ifdef HAVE_MMAP
+        if( buffer_ != nullptr )
+            munmap( buffer_, size_ );
+#endif
+        buffer_ = nullptr;
+        size_ = 0;
+        copyOnWrite_ = false;
+    }
+
+    std::size_t Size() const { return size_; }
+    bool CopyOnWrite() const { return copyOnWrite_; }
+    const byte* LockedBuffer() const { return buffer_; }
+    byte* Buffer()
+    {
+        DEBUG_ONLY(
+            CallStackEntry cse("MappedFile::Buffer");
+            if( !copyOnWrite_ )
+                LogicError("Read-only mappings cannot be modified");
+        )
+        return buffer_;
+    }
+};
+
+namespace map {
+
+// Attach A to the column-major data in file beginning offset bytes in
+template<typename T>
+inline void
+Attach
+( Matrix<T>& A, MappedFile& file, std::size_t offset, Int height, Int width )
+{
+    DEBUG_ONLY(CallStackEntry cse("map::Attach"))
+    const std::size_t numBytes = file.Size();
+    const std::size_t numBytesExp =
+      offset + std::size_t(height)*width*sizeof(T);
+    if( numBytes != numBytesExp )
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+
+    const Int ldim = Max( height, 1 );
+    if( file.CopyOnWrite() )
+    {
+        T* buffer = reinterpret_cast<T*>(file.Buffer()+offset);
+        A.Attach( height, width, buffer, ldim );
+    }
+    else
+    {
+        const T* buffer =
+            reinterpret_cast<const T*>(file.LockedBuffer()+offset);
+        A.LockedAttach( height, width, buffer, ldim );
+    }
+}
+
+// Map a file in the BINARY format, which begins with the height and width,
+// and attach A to its contents. The file must outlive the use of A.
+template<typename T>
+inline void
+Binary
+( Matrix<T>& A, MappedFile& file, const std::string filename,
+  bool copyOnWrite=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("map::Binary"))
+    file.Open( filename, copyOnWrite );
+    const std::size_t metaBytes = 2*sizeof(Int);
+    if( file.Size() < metaBytes )
+        RuntimeError
+        ("Expected file to be at least ",metaBytes," bytes but found ",
+         file.Size());
+    Int meta[2];
+    MemCopy( meta, reinterpret_cast<const Int*>(file.LockedBuffer()), 2 );
+    Attach( A, file, metaBytes, meta[0], meta[1] );
+}
+
+// Map a file in the BINARY_FLAT format and attach A to its contents.
+// The file must outlive the use of A.
+template<typename T>
+inline void
+BinaryFlat
+( Matrix<T>& A, MappedFile& file, Int height, Int width,
+  const std::string filename, bool copyOnWrite=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("map::BinaryFlat"))
+    file.Open( filename, copyOnWrite );
+    Attach( A, file, 0, height, width );
+}
+
+} // namespace map
+} // namespace elem
+
+#endif // ifndef ELEM_MAP_HPP
@@ -10,29 +10,126 @@
 #ifndef ELEM_READ_HPP
 #define ELEM_READ_HPP
 
+#include ELEM_ZEROS_INC
+
 namespace elem {
 namespace read {
 
+namespace read_ascii {
+
+// Load the text of the entire file, followed by a null character
+inline void
+LoadText
+( std::ifstream& file, std::streamoff offset, std::vector<char>& text )
+{
+    const std::streamoff numBytes = FileSize( file );
+    text.resize( Max(numBytes-offset,std::streamoff(0))+1 );
+    file.seekg( offset );
+    file.read( text.data(), text.size()-1 );
+    text.back() = '\0';
+}
+
 template<typename T>
 inline void
-Ascii( Matrix<T>& A, const std::string filename )
+Dense( Matrix<T>& A, const std::string filename, bool matlab )
 {
-    DEBUG_ONLY(CallStackEntry cse("read::Ascii"))
-    std::ifstream file( filename.c_str() );
+    DEBUG_ONLY(CallStackEntry cse("read_ascii::Dense"))
+    std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
-    LogicError("Not yet written");
+
+    std::vector<char> text;
+    LoadText( file, ascii::DataOffset( file, matlab ), text );
+    const char* beg = text.data();
+    const char* end = beg + text.size()-1;
+    if( matlab )
+        end = std::find( beg, end, ']' );
+
+    const Int width = ascii::FirstRowWidth<T>( beg, end, matlab );
+    if( width < 0 || !ascii::ParseDense( beg, end, matlab, width, A ) )
+        RuntimeError("Could not parse ",filename);
 }
 
+} // namespace read_ascii
+
+// Each row of the matrix is stored on its own line, and any lines preceding
+// the first row (e.g., the title) are skipped
+template<typename T>
+inline void
+Ascii( Matrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::Ascii"))
+    read_ascii::Dense( A, filename, false );
+}
+
+// The rows of the matrix are separated by newlines and/or semicolons and
+// enclosed within the first pair of brackets
 template<typename T>
 inline void
 AsciiMatlab( Matrix<T>& A, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::AsciiMatlab"))
-    std::ifstream file( filename.c_str() );
+    read_ascii::Dense( A, filename, true );
+}
+
+// Both the array and coordinate formats are supported. Duplicate entries of
+// a coordinate file are summed, and the implicit entries of symmetric,
+// skew-symmetric, and Hermitian matrices are filled in.
+template<typename T>
+inline void
+MatrixMarket( Matrix<T>& A, const std::string filename )
+{
+    DEBUG_ONLY(CallStackEntry cse("read::MatrixMarket"))
+    std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
-    LogicError("Not yet written");
+
+    const ascii::MatrixMarketHeader header =
+        ascii::ReadMatrixMarketHeader( file );
+    if( header.complexField && !IsComplex<T>::val )
+        LogicError("Cannot read complex MatrixMarket data into a real matrix");
+    std::vector<char> text;
+    read_ascii::LoadText( file, header.dataOffset, text );
+
+    std::vector<Int> rows, cols;
+    std::vector<T> values;
+    const char* beg = text.data();
+    if( !ascii::ParseMatrixMarket
+         ( beg, beg+text.size()-1, header, 0, rows, cols, values ) )
+        RuntimeError("Could not parse ",filename);
+    const Int numEntries = values.size();
+    if( numEntries != header.numEntries )
+        RuntimeError
+        ("Expected ",header.numEntries," entries but found ",numEntries);
+
+    Zeros( A, header.height, header.width );
+    T* ABuf = A.Buffer();
+    const Int ldim = A.LDim();
+    const bool mirror = ( header.symmetry != ascii::MM_GENERAL );
+    if( header.coordinate )
+    {
+        for( Int k=0; k<numEntries; ++k )
+        {
+            const Int i = rows[k];
+            const Int j = cols[k];
+            ABuf[i+j*ldim] += values[k];
+            if( mirror && i != j )
+                ABuf[j+i*ldim] += ascii::MirrorValue( header, values[k] );
+        }
+    }
+    else
+    {
+        // Each entry of an array is stored exactly once
+        PARALLEL_FOR
+        for( Int k=0; k<numEntries; ++k )
+        {
+            const Int i = rows[k];
+            const Int j = cols[k];
+            ABuf[i+j*ldim] = values[k];
+            if( mirror && i != j )
+                ABuf[j+i*ldim] = ascii::MirrorValue( header, values[k] );
+        }
+    }
 }
 
 template<typename T>
@@ -45,8 +142,8 @@ Binary( Matrix<T>& A, const std::string filename )
         RuntimeError("Could not open ",filename);
 
     Int height, width;
-    file >> height;
-    file >> width;
+    file.read( (char*)&height, sizeof(Int) );
+    file.read( (char*)&width, sizeof(Int) );
     const Int numBytes = FileSize( file );
     const Int metaBytes = 2*sizeof(Int);
     const Int dataBytes = height*width*sizeof(T);
@@ -86,259 +183,393 @@ BinaryFlat( Matrix<T>& A, Int height, Int width, const std::string filename )
             file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
 }
 
-
-template<typename T,Dist U,Dist V>
+template<typename T>
 inline void
-Binary( DistMatrix<T,U,V>& A, const std::string filename )
+BinaryCompressed( Matrix<T>& A, const std::string filename )
 {
-    DEBUG_ONLY(CallStackEntry cse("read::Binary"))
+    DEBUG_ONLY(CallStackEntry cse("read::BinaryCompressed"))
     std::ifstream file( filename.c_str(), std::ios::binary );
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    Int height, width;
-    file >> height;
-    file >> width;
     const Int numBytes = FileSize( file );
-    const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
+    const Int headerBytes = compressed::NUM_HEADER_ENTRIES*sizeof(Int);
+    if( numBytes < headerBytes )
+        RuntimeError(filename," is too small to be a compressed matrix");
+    Int header[compressed::NUM_HEADER_ENTRIES];
+    file.read( (char*)header, headerBytes );
+    if( header[0] != compressed::MAGIC || header[1] != compressed::VERSION ||
+        header[2] != Int(sizeof(T)) || header[3] != Int(IsComplex<T>::val) )
+        RuntimeError(filename," is not a compatible compressed matrix");
+    const Int height = header[4];
+    const Int width = header[5];
+    const CompressedStorage storage = static_cast<CompressedStorage>(header[6]);
+    const Int nb = header[8];
+    if( height < 0 || width < 0 || nb < 1 )
+        RuntimeError("Invalid header in ",filename);
+    const Int numChunks = (width+nb-1)/nb;
+
+    // Read the remainder of the file and locate the chunks
+    const Int sizesBytes = numChunks*sizeof(unsigned long long);
+    if( numBytes < headerBytes+sizesBytes )
+        RuntimeError(filename," is truncated");
+    std::vector<unsigned long long> chunkSizes( numChunks );
+    file.read( (char*)chunkSizes.data(), sizesBytes );
+    std::vector<std::size_t> offsets( numChunks+1, 0 );
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        offsets[chunk+1] = offsets[chunk] + chunkSizes[chunk];
+    const Int numBytesExp = headerBytes + sizesBytes + offsets[numChunks];
     if( numBytes != numBytesExp )
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    std::vector<byte> data( offsets[numChunks] );
+    file.read( (char*)data.data(), data.size() );
 
     A.Resize( height, width );
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
-    const Int colShift = A.ColShift(); 
-    const Int rowShift = A.RowShift();
-    const Int colStride = A.ColStride();
-    const Int rowStride = A.RowStride();
-    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    if( storage != COMPRESSED_FULL )
+        Zero( A );
+    T* ABuf = A.Buffer();
+    const Int ldim = A.LDim();
+    const byte* dataBuf = data.data();
+    bool corrupt = false;
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for reduction(||:corrupt)
+#endif
+    for( Int chunk=0; chunk<numChunks; ++chunk )
     {
-        const Int j = rowShift + jLoc*rowStride;
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = colShift + iLoc*colStride;
-            const Int localIndex = i+j*height;
-            const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-        }
+        const Int jBeg = chunk*nb;
+        const Int jEnd = Min(jBeg+nb,width);
+        if( !compressed::DecodeChunk
+             ( &dataBuf[offsets[chunk]], chunkSizes[chunk], storage,
+               jBeg, jEnd, height, ABuf, ldim ) )
+            corrupt = true;
     }
-}
-
-template<typename T,Dist U,Dist V>
-inline void
-BinaryFlat
-( DistMatrix<T,U,V>& A, Int height, Int width, const std::string filename )
-{
-    DEBUG_ONLY(CallStackEntry cse("read::Binary"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
-
-    A.Resize( height, width );
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
-    const Int colShift = A.ColShift(); 
-    const Int rowShift = A.RowShift();
-    const Int colStride = A.ColStride();
-    const Int rowStride = A.RowStride();
-    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    if( corrupt )
     {
-        const Int j = rowShift + jLoc*rowStride;
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Int i = colShift + iLoc*colStride;
-            const Int localIndex = i+j*height;
-            const std::streamoff pos = localIndex*sizeof(T);
-            file.seekg( pos );
-            file.read( (char*)A.Buffer(iLoc,jLoc), sizeof(T) );
-        }
+#ifdef HAVE_ZLIB
+        RuntimeError("Could not decompress ",filename);
+#else
+        RuntimeError("zlib is required in order to read ",filename);
+#endif
     }
 }
 
-template<typename T,Dist V>
+// Each process reads its own entries with collective MPI-IO calls
+template<typename T,Dist U,Dist V>
 inline void
-Binary( DistMatrix<T,STAR,V>& A, const std::string filename )
+Binary( DistMatrix<T,U,V>& A, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::Binary"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    Int height, width;
-    file >> height;
-    file >> width;
-    const Int numBytes = FileSize( file );
-    const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
+    mpi::File file;
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, mpi::MODE_RDONLY, file );
+
+    Int meta[2];
+    mpi::FileReadAtAll( file, 0, meta, 2, mpi::TypeMap<Int>() );
+    const Int height = meta[0];
+    const Int width = meta[1];
+    const mpi::Offset numBytes = mpi::FileGetSize( file );
+    const mpi::Offset metaBytes = 2*sizeof(Int);
+    const mpi::Offset dataBytes = mpi::Offset(height)*width*sizeof(T);
+    const mpi::Offset numBytesExp = metaBytes + dataBytes;
     if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
 
     A.Resize( height, width );
-    const Int localWidth = A.LocalWidth();
-    const Int rowShift = A.RowShift();
-    const Int rowStride = A.RowStride();
-    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-    {
-        const Int j = rowShift + jLoc*rowStride;
-        const Int localIndex = j*height;
-        const std::streamoff pos = metaBytes + localIndex*sizeof(T);
-        file.seekg( pos );
-        file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-    }
+    mpi_io::Read( A, file, metaBytes );
+    mpi::FileClose( file );
 }
 
-template<typename T,Dist V>
+template<typename T,Dist U,Dist V>
 inline void
 BinaryFlat
-( DistMatrix<T,STAR,V>& A, Int height, Int width, const std::string filename )
+( DistMatrix<T,U,V>& A, Int height, Int width, const std::string filename )
 {
     DEBUG_ONLY(CallStackEntry cse("read::BinaryFlat"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    mpi::File file;
+    mpi::FileOpen( A.Grid().ViewingComm(), filename, mpi::MODE_RDONLY, file );
 
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
+    const mpi::Offset numBytes = mpi::FileGetSize( file );
+    const mpi::Offset numBytesExp = mpi::Offset(height)*width*sizeof(T);
     if( numBytes != numBytesExp )
+    {
+        mpi::FileClose( file );
         RuntimeError
         ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
 
     A.Resize( height, width );
-    const Int localWidth = A.LocalWidth();
-    const Int rowShift = A.RowShift();
-    const Int rowStride = A.RowStride();
-    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-    {
-        const Int j = rowShift + jLoc*rowStride;
-        const Int localIndex = j*height;
-        const std::streamoff pos = localIndex*sizeof(T);
-        file.seekg( pos );
-        file.read( (char*)A.Buffer(0,jLoc), height*sizeof(T) );
-    }
+    mpi_io::Read( A, file, 0 );
+    mpi::FileClose( file );
 }
 
-template<typename T>
+namespace read_ascii {
+
+// Each process of the distribution communicator of A (with redundant rank
+// zero) parses the rows of the file which begin within its portion of the
+// bytes and sends the resulting entries directly to their owners
+template<typename T,Dist U,Dist V>
 inline void
-Binary( DistMatrix<T,STAR,STAR>& A, const std::string filename )
+Dense( DistMatrix<T,U,V>& A, const std::string filename, bool matlab )
 {
-    DEBUG_ONLY(CallStackEntry cse("read::Binary"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
+    DEBUG_ONLY(CallStackEntry cse("read_ascii::Dense"))
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    const bool parser = A.Participating() && A.RedundantRank() == 0;
+    // The third entry is nonzero if the file could not be opened or parsed
+    Int dims[3] = { 0, 0, 0 };
+    std::vector<Int> rows, cols;
+    std::vector<T> values;
+    if( parser )
+    {
+        mpi::Comm comm = A.DistComm();
+        const int commRank = mpi::CommRank( comm );
+        const int commSize = mpi::CommSize( comm );
 
-    Int height, width;
-    file >> height;
-    file >> width;
-    const Int numBytes = FileSize( file );
-    const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+        // A negative offset signals that the file could not be opened
+        mpi::Offset offset = 0;
+        if( commRank == 0 )
+        {
+            std::ifstream file( filename.c_str(), std::ios::binary );
+            if( file.is_open() )
+                offset = ascii::DataOffset( file, matlab );
+            else
+                offset = -1;
+        }
+        mpi::Broadcast( offset, 0, comm );
+        if( offset < 0 )
+            dims[2] = 1;
+        else
+        {
+            std::vector<char> text;
+            mpi::Offset textOffset;
+            ascii::LoadRows( comm, filename, offset, matlab, text, textOffset );
+            const char* beg = text.data();
+            const char* end = beg + text.size()-1;
+
+            // A MATLAB matrix ends at the first closing bracket
+            if( matlab )
+            {
+                const char* bracket = std::find( beg, end, ']' );
+                mpi::Offset bracketOffset =
+                    ( bracket == end ? std::numeric_limits<mpi::Offset>::max()
+                                     : textOffset + (bracket-beg) );
+                bracketOffset = mpi::AllReduce( bracketOffset, mpi::MIN, comm );
+                if( bracketOffset < textOffset )
+                    end = beg;
+                else if( bracketOffset < textOffset+mpi::Offset(end-beg) )
+                    end = beg + (bracketOffset-textOffset);
+            }
+
+            // Agree upon the width, and the index of our first row
+            Matrix<T> B;
+            const Int width = ascii::FirstRowWidth<T>( beg, end, matlab );
+            const int valid =
+                width >= 0 && ascii::ParseDense( beg, end, matlab, width, B );
+            const Int localHeight = B.Height();
+            const Int maxWidth = mpi::AllReduce( width, mpi::MAX, comm );
+            const Int minWidth =
+                mpi::AllReduce
+                ( localHeight==0 ? maxWidth : width, mpi::MIN, comm );
+            if( !mpi::AllReduce( valid, mpi::MIN, comm ) ||
+                minWidth != maxWidth )
+                dims[2] = 2;
+            else
+            {
+                std::vector<Int> heights( commSize );
+                mpi::AllGather( &localHeight, 1, heights.data(), 1, comm );
+                Int rowOffset = 0;
+                for( int q=0; q<commRank; ++q )
+                    rowOffset += heights[q];
+                for( int q=0; q<commSize; ++q )
+                    dims[0] += heights[q];
+                dims[1] = maxWidth;
+
+                rows.resize( localHeight*maxWidth );
+                cols.resize( localHeight*maxWidth );
+                values.resize( localHeight*maxWidth );
+                for( Int j=0; j<B.Width(); ++j )
+                {
+                    for( Int i=0; i<localHeight; ++i )
+                    {
+                        rows[i+j*localHeight] = rowOffset + i;
+                        cols[i+j*localHeight] = j;
+                        values[i+j*localHeight] = B.Get(i,j);
+                    }
+                }
+            }
+        }
+    }
+    if( A.Participating() )
+        mpi::Broadcast( dims, 3, 0, A.RedundantComm() );
+    mpi::Broadcast( dims, 3, A.Root(), A.CrossComm() );
+    if( dims[2] == 1 )
+        RuntimeError("Could not open ",filename);
+    else if( dims[2] == 2 )
+        RuntimeError("Could not parse ",filename);
 
-    A.Resize( height, width );
-    if( A.Height() == A.LDim() )
-        file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-    else
-        for( Int j=0; j<width; ++j )
-            file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
+    A.Resize( dims[0], dims[1] );
+    if( parser )
+        ascii::ScatterEntries( A, rows, cols, values, false );
+    ascii::BroadcastRedundant( A );
 }
 
-template<typename T>
+} // namespace read_ascii
+
+template<typename T,Dist U,Dist V>
 inline void
-BinaryFlat
-( DistMatrix<T,STAR,STAR>& A, Int height, Int width, 
-  const std::string filename )
+Ascii( DistMatrix<T,U,V>& A, const std::string filename )
 {
-    DEBUG_ONLY(CallStackEntry cse("read::BinaryFlat"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
-
-    A.Resize( height, width );
-    if( A.Height() == A.LDim() )
-        file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-    else
-        for( Int j=0; j<width; ++j )
-            file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
+    DEBUG_ONLY(CallStackEntry cse("read::Ascii"))
+    read_ascii::Dense( A, filename, false );
 }
 
-template<typename T>
+template<typename T,Dist U,Dist V>
 inline void
-Binary( DistMatrix<T,CIRC,CIRC>& A, const std::string filename )
+AsciiMatlab( DistMatrix<T,U,V>& A, const std::string filename )
 {
-    DEBUG_ONLY(CallStackEntry cse("read::Binary"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    Int height, width;
-    file >> height;
-    file >> width;
-    const Int numBytes = FileSize( file );
-    const Int metaBytes = 2*sizeof(Int);
-    const Int dataBytes = height*width*sizeof(T);
-    const Int numBytesExp = metaBytes + dataBytes;
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
-
-    A.Resize( height, width );
-    if( A.CrossRank() == A.Root() )
-    {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
-        else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
-    }
+    DEBUG_ONLY(CallStackEntry cse("read::AsciiMatlab"))
+    read_ascii::Dense( A, filename, true );
 }
 
-template<typename T>
+template<typename T,Dist U,Dist V>
 inline void
-BinaryFlat
-( DistMatrix<T,CIRC,CIRC>& A, Int height, Int width, 
-  const std::string filename )
+MatrixMarket( DistMatrix<T,U,V>& A, const std::string filename )
 {
-    DEBUG_ONLY(CallStackEntry cse("read::Binary"))
-    std::ifstream file( filename.c_str(), std::ios::binary );
-    if( !file.is_open() )
-        RuntimeError("Could not open ",filename);
-
-    const Int numBytes = FileSize( file );
-    const Int numBytesExp = height*width*sizeof(T);
-    if( numBytes != numBytesExp )
-        RuntimeError
-        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
-
-    A.Resize( height, width );
-    if( A.CrossRank() == A.Root() )
+    DEBUG_ONLY(CallStackEntry cse("read::MatrixMarket"))
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    const bool parser = A.Participating() && A.RedundantRank() == 0;
+
+    // The header is parsed by a single process, which also reports whether
+    // it succeeded so that every process can fail together
+    mpi::Offset meta[9] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    std::string error;
+    if( parser && mpi::CommRank(A.DistComm()) == 0 )
     {
-        if( A.Height() == A.LDim() )
-            file.read( (char*)A.Buffer(), height*width*sizeof(T) );
+        std::ifstream file( filename.c_str(), std::ios::binary );
+        if( !file.is_open() )
+        {
+            error = "Could not open " + filename;
+            meta[8] = 1;
+        }
         else
-            for( Int j=0; j<width; ++j )
-                file.read( (char*)A.Buffer(0,j), height*sizeof(T) );
+        {
+            try
+            {
+                const ascii::MatrixMarketHeader header =
+                    ascii::ReadMatrixMarketHeader( file );
+                meta[0] = header.coordinate;
+                meta[1] = header.complexField;
+                meta[2] = header.pattern;
+                meta[3] = header.symmetry;
+                meta[4] = header.height;
+                meta[5] = header.width;
+                meta[6] = header.numEntries;
+                meta[7] = header.dataOffset;
+            }
+            catch( std::exception& e )
+            {
+                error = e.what();
+                meta[8] = 1;
+            }
+        }
     }
+    if( parser )
+        mpi::Broadcast( meta, 9, 0, A.DistComm() );
+    if( A.Participating() )
+        mpi::Broadcast( meta, 9, 0, A.RedundantComm() );
+    mpi::Broadcast( meta, 9, A.Root(), A.CrossComm() );
+    if( meta[8] != 0 )
+    {
+        if( error.empty() )
+            RuntimeError("Could not read the MatrixMarket header of ",filename);
+        else
+            RuntimeError(error);
+    }
+    ascii::MatrixMarketHeader header;
+    header.coordinate = meta[0];
+    header.complexField = meta[1];
+    header.pattern = meta[2];
+    header.symmetry = static_cast<ascii::MatrixMarketSymmetry>(meta[3]);
+    header.height = meta[4];
+    header.width = meta[5];
+    header.numEntries = meta[6];
+    header.dataOffset = meta[7];
+    if( header.complexField && !IsComplex<T>::val )
+        LogicError("Cannot read complex MatrixMarket data into a real matrix");
+
+    Zeros( A, header.height, header.width );
+    Int status[2] = { 0, 0 };
+    if( parser )
+    {
+        mpi::Comm comm = A.DistComm();
+        const int commRank = mpi::CommRank( comm );
+        const int commSize = mpi::CommSize( comm );
+        std::vector<char> text;
+        mpi::Offset textOffset;
+        ascii::LoadRows
+        ( comm, filename, header.dataOffset, false, text, textOffset );
+        const char* beg = text.data();
+        const char* end = beg + text.size()-1;
+
+        // Determine the index of our first entry before parsing
+        const Int numLocalEntries = ascii::CountRows( beg, end, false );
+        std::vector<Int> counts( commSize );
+        mpi::AllGather( &numLocalEntries, 1, counts.data(), 1, comm );
+        Int firstEntry=0, numEntries=0;
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q < commRank )
+                firstEntry += counts[q];
+            numEntries += counts[q];
+        }
+
+        std::vector<Int> rows, cols;
+        std::vector<T> values;
+        const int valid =
+            ascii::ParseMatrixMarket
+            ( beg, end, header, firstEntry, rows, cols, values );
+        // Every parser agrees on the status since it only depends upon
+        // reductions over all of them
+        status[1] = numEntries;
+        if( !mpi::AllReduce( valid, mpi::MIN, comm ) )
+            status[0] = 1;
+        else if( numEntries != header.numEntries )
+            status[0] = 2;
+        else
+        {
+            if( header.symmetry != ascii::MM_GENERAL )
+            {
+                const Int numParsed = values.size();
+                for( Int k=0; k<numParsed; ++k )
+                {
+                    if( rows[k] != cols[k] )
+                    {
+                        rows.push_back( cols[k] );
+                        cols.push_back( rows[k] );
+                        values.push_back
+                        ( ascii::MirrorValue( header, values[k] ) );
+                    }
+                }
+            }
+            ascii::ScatterEntries( A, rows, cols, values, header.coordinate );
+        }
+    }
+    if( A.Participating() )
+        mpi::Broadcast( status, 2, 0, A.RedundantComm() );
+    mpi::Broadcast( status, 2, A.Root(), A.CrossComm() );
+    if( status[0] == 1 )
+        RuntimeError("Could not parse ",filename);
+    else if( status[0] == 2 )
+        RuntimeError
+        ("Expected ",header.numEntries," entries but found ",status[1]);
+    ascii::BroadcastRedundant( A );
 }
 
 } // namespace read
@@ -362,6 +593,12 @@ Read( Matrix<T>& A, const std::string filename, FileFormat format=AUTO )
     case BINARY:
         read::Binary( A, filename );
         break;
+    case BINARY_COMPRESSED:
+        read::BinaryCompressed( A, filename );
+        break;
+    case MATRIX_MARKET:
+        read::MatrixMarket( A, filename );
+        break;
     default:
         LogicError("Format unsupported for reading");
     }
@@ -380,17 +617,25 @@ Read
     if( sequential )
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
-        if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
-            Read( A_CIRC_CIRC.Matrix(), filename, format );
+        Read( A_CIRC_CIRC, filename, format );
         A = A_CIRC_CIRC;
     }
     else
     {
         switch( format )
         {
+        case ASCII:
+            read::Ascii( A, filename );
+            break;
+        case ASCII_MATLAB:
+            read::AsciiMatlab( A, filename );
+            break;
         case BINARY:
             read::Binary( A, filename );
             break;
+        case MATRIX_MARKET:
+            read::MatrixMarket( A, filename );
+            break;
         default:
             LogicError("Unsupported distributed read format"); 
         }
@@ -408,8 +653,14 @@ Read
     DEBUG_ONLY(CallStackEntry cse("Read"))
     if( format == AUTO )
         format = DetectFormat( filename );
-    if( A.Grid().VCRank() == 0 )
-        Read( A.Matrix(), filename, format );
+    if( format == BINARY )
+        read::Binary( A, filename );
+    else
+    {
+        DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A.Grid() );
+        Read( A_CIRC_CIRC, filename, format );
+        A = A_CIRC_CIRC;
+    }
 }
 template<typename T>
 inline void
@@ -420,8 +671,17 @@ Read
     DEBUG_ONLY(CallStackEntry cse("Read"))
     if( format == AUTO )
         format = DetectFormat( filename );
-    if( A.CrossRank() == A.Root() )
-        Read( A.Matrix(), filename, format );
+    if( format == BINARY )
+        read::Binary( A, filename );
+    else if( A.CrossRank() == A.Root() )
+    {
+        // The local matrix of A cannot be resized directly
+        Matrix<T> B;
+        Read( B, filename, format );
+        A.CopyFromRoot( B );
+    }
+    else
+        A.CopyFromNonRoot();
 }
 
 } // namespace elem
@@ -22,6 +22,8 @@
 namespace elem {
 namespace write {
 
+// Each row is written on its own line with enough digits for the entries to
+// be recovered exactly, and batches of rows are formatted in parallel
 template<typename T>
 inline void
 Ascii( const Matrix<T>& A, std::string basename="matrix", std::string title="" )
@@ -32,8 +34,9 @@ Ascii( const Matrix<T>& A, std::string basename="matrix", std::string title="" )
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    file.setf( std::ios::scientific );
-    Print( A, title, file );
+    if( title != "" )
+        file << title << "\n";
+    ascii::FormatRows( A, file );
 }
 
 template<typename T>
@@ -52,12 +55,27 @@ AsciiMatlab
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    file.setf( std::ios::scientific );
     file << title << " = [\n";
-    Print( A, "", file );
+    ascii::FormatRows( A, file );
     file << "];\n";
 }
 
+// The matrix is written in the MatrixMarket array format
+template<typename T>
+inline void
+MatrixMarket( const Matrix<T>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::MatrixMarket"))
+    std::string filename = basename + "." + FileExtension(MATRIX_MARKET);
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    ascii::WriteMatrixMarketHeader
+    ( file, A.Height(), A.Width(), IsComplex<T>::val );
+    ascii::FormatColumns( A, file );
+}
+
 template<typename T>
 inline void
 BinaryFlat( const Matrix<T>& A, std::string basename="matrix" )
@@ -87,7 +105,8 @@ Binary( const Matrix<T>& A, std::string basename="matrix" )
     if( !file.is_open() )
         RuntimeError("Could not open ",filename);
 
-    file << A.Height() << A.Width();
+    const Int meta[2] = { A.Height(), A.Width() };
+    file.write( (char*)meta, 2*sizeof(Int) );
     if( A.Height() == A.LDim() )
         file.write( (char*)A.LockedBuffer(), A.Height()*A.Width()*sizeof(T) );
     else
@@ -95,6 +114,99 @@ Binary( const Matrix<T>& A, std::string basename="matrix" )
             file.write( (char*)A.LockedBuffer(0,j), A.Height()*sizeof(T) );
 }
 
+// Only the portion of A selected by storage is written, e.g., the lower
+// trapezoid of a Cholesky factor. If mantissaBits is positive, the real
+// mantissas are rounded to that many bits before compression.
+template<typename T>
+inline void
+BinaryCompressed
+( const Matrix<T>& A, std::string basename="matrix",
+  CompressedStorage storage=COMPRESSED_FULL, Int mantissaBits=0 )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::BinaryCompressed"))
+    std::string filename = basename + "." + FileExtension(BINARY_COMPRESSED);
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int nb = compressed::ChunkWidth<T>( height );
+    const Int numChunks = (width+nb-1)/nb;
+
+    const T* ABuf = A.LockedBuffer();
+    const Int ldim = A.LDim();
+    std::vector<std::vector<byte>> chunks( numChunks );
+    PARALLEL_FOR
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int jBeg = chunk*nb;
+        const Int jEnd = Min(jBeg+nb,width);
+        compressed::EncodeChunk
+        ( height, ABuf, ldim, storage, mantissaBits, jBeg, jEnd,
+          chunks[chunk] );
+    }
+
+    const Int header[compressed::NUM_HEADER_ENTRIES] =
+        { compressed::MAGIC, compressed::VERSION, Int(sizeof(T)),
+          Int(IsComplex<T>::val), height, width, Int(storage), mantissaBits,
+          nb };
+    file.write( (char*)header, compressed::NUM_HEADER_ENTRIES*sizeof(Int) );
+    std::vector<unsigned long long> chunkSizes( numChunks );
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        chunkSizes[chunk] = chunks[chunk].size();
+    file.write
+    ( (char*)chunkSizes.data(), numChunks*sizeof(unsigned long long) );
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+        file.write( (char*)chunks[chunk].data(), chunks[chunk].size() );
+    if( !file.good() )
+        RuntimeError("Could not write ",filename);
+}
+
+// Each process writes its own entries with collective MPI-IO calls
+template<typename T,Dist U,Dist V>
+inline void
+BinaryFlat( const DistMatrix<T,U,V>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::BinaryFlat"))
+    std::string filename = basename + "." + FileExtension(BINARY_FLAT);
+    mpi::File file;
+    mpi::FileOpen
+    ( A.Grid().ViewingComm(), filename, mpi::MODE_WRONLY|mpi::MODE_CREATE,
+      file );
+
+    // Truncate any previous contents of the file
+    const mpi::Offset numBytes = mpi::Offset(A.Height())*A.Width()*sizeof(T);
+    mpi::FileSetSize( file, numBytes );
+    mpi_io::Write( A, file, 0 );
+    mpi::FileClose( file );
+}
+
+template<typename T,Dist U,Dist V>
+inline void
+Binary( const DistMatrix<T,U,V>& A, std::string basename="matrix" )
+{
+    DEBUG_ONLY(CallStackEntry cse("write::Binary"))
+    std::string filename = basename + "." + FileExtension(BINARY);
+    mpi::Comm comm = A.Grid().ViewingComm();
+    mpi::File file;
+    mpi::FileOpen( comm, filename, mpi::MODE_WRONLY|mpi::MODE_CREATE, file );
+
+    // Truncate any previous contents of the file
+    const mpi::Offset metaBytes = 2*sizeof(Int);
+    const mpi::Offset numBytes =
+        metaBytes + mpi::Offset(A.Height())*A.Width()*sizeof(T);
+    mpi::FileSetSize( file, numBytes );
+
+    // Only the root of the viewing communicator writes the metadata
+    const Int meta[2] = { A.Height(), A.Width() };
+    const int numMeta = ( mpi::CommRank(comm) == 0 ? 2 : 0 );
+    mpi::FileWriteAtAll( file, 0, meta, numMeta, mpi::TypeMap<Int>() );
+
+    mpi_io::Write( A, file, metaBytes );
+    mpi::FileClose( file );
+}
+
 #ifdef HAVE_QT5
 inline void
 SaveQImage
@@ -242,6 +354,8 @@ Write
     case ASCII_MATLAB: write::AsciiMatlab( A, basename, title ); break;
     case BINARY:       write::Binary( A, basename );             break;
     case BINARY_FLAT:  write::BinaryFlat( A, basename );         break;
+    case BINARY_COMPRESSED: write::BinaryCompressed( A, basename ); break;
+    case MATRIX_MARKET:     write::MatrixMarket( A, basename );     break;
     case BMP:
     case JPG:
     case JPEG:
@@ -262,9 +376,17 @@ Write
   FileFormat format=BINARY, std::string title="" )
 {
     DEBUG_ONLY(CallStackEntry cse("Write"))
-    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
-    if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
-        Write( A_CIRC_CIRC.LockedMatrix(), basename, format, title );
+    // The binary formats are written in parallel rather than gathered
+    if( format == BINARY )
+        write::Binary( A, basename );
+    else if( format == BINARY_FLAT )
+        write::BinaryFlat( A, basename );
+    else
+    {
+        DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
+        if( A_CIRC_CIRC.CrossRank() == A_CIRC_CIRC.Root() )
+            Write( A_CIRC_CIRC.LockedMatrix(), basename, format, title );
+    }
 }
 
 #ifndef SWIG
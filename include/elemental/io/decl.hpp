@@ -21,6 +21,8 @@ enum FileFormat
     ASCII_MATLAB,
     BINARY,
     BINARY_FLAT,
+    BINARY_COMPRESSED,
+    MATRIX_MARKET,
     BMP,
     JPG,
     JPEG,
@@ -86,6 +88,21 @@ void SetColorMap( ColorMap colorMap );
 ColorMap GetColorMap();
 void SetNumDiscreteColors( Int numChunks );
 Int NumDiscreteColors();
+
+// Checkpointing of long-running iterations, which is disabled while the
+// basename is empty. Checkpoints are written every 'frequency' iterations
+// and, if requested, iterations resume from any matching checkpoint.
+void SetCheckpointBasename( std::string basename );
+std::string CheckpointBasename();
+void SetCheckpointFrequency( Int frequency );
+Int CheckpointFrequency();
+void SetRestartFromCheckpoint( bool restart );
+bool RestartFromCheckpoint();
+
+// Scopes distinguish the checkpoints of nested calls, e.g., within recursions
+void PushCheckpointScope( std::string scope );
+void PopCheckpointScope();
+std::string CheckpointScope();
 #ifdef HAVE_QT5
 QRgb SampleColorMap( double value, double minVal, double maxVal );
 #endif 
@@ -10,9 +10,13 @@
 #ifndef ELEM_IO_IMPL_HPP
 #define ELEM_IO_IMPL_HPP
 
+#include "./Ascii.hpp"
 #include "./Display.hpp"
 // TODO: Distribution plot
 #include "./Print.hpp"
+#include "./Compressed.hpp"
+#include "./Map.hpp"
+#include "./MPIIO.hpp"
 #include "./Read.hpp"
 #include "./Spy.hpp"
 #include "./Write.hpp"
@@ -38,17 +42,19 @@ inline std::string FileExtension( FileFormat format )
 {
     switch( format )
     {
-    case ASCII:            return "txt";  break;
-    case ASCII_MATLAB:     return "m";    break;
-    case BINARY:           return "bin";  break;
-    case BINARY_FLAT:      return "dat";  break;
-    case BMP:              return "bmp";  break;
-    case JPG:              return "jpg";  break;
-    case JPEG:             return "jpeg"; break;
-    case PNG:              return "png";  break;
-    case PPM:              return "ppm";  break;
-    case XBM:              return "xbm";  break;
-    case XPM:              return "xpm";  break;
+    case ASCII:             return "txt";  break;
+    case ASCII_MATLAB:      return "m";    break;
+    case BINARY:            return "bin";  break;
+    case BINARY_FLAT:       return "dat";  break;
+    case BINARY_COMPRESSED: return "cbin"; break;
+    case MATRIX_MARKET:     return "mtx";  break;
+    case BMP:               return "bmp";  break;
+    case JPG:               return "jpg";  break;
+    case JPEG:              return "jpeg"; break;
+    case PNG:               return "png";  break;
+    case PPM:               return "ppm";  break;
+    case XBM:               return "xbm";  break;
+    case XPM:               return "xpm";  break;
     default: LogicError("Format not found"); return "N/A"; break;
     }
 }
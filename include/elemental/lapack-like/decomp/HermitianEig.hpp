@@ -14,6 +14,8 @@
 #include ELEM_HERMITIANTRIDIAGEIG_INC
 
 // NOTE: HermitianEig declarations are in lapack-like/decomp/decl.hpp
+#include "./HermitianEig/LOBPCG.hpp"
 #include "./HermitianEig/SDC.hpp"
+#include "./HermitianEig/SpectrumSlicing.hpp"
 
 #endif // ifndef ELEM_HERMITIANEIG_HPP
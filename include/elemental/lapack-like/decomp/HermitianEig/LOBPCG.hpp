@@ -0,0 +1,581 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_HERMITIANEIG_LOBPCG_HPP
+#define ELEM_HERMITIANEIG_LOBPCG_HPP
+
+#include ELEM_AXPY_INC
+#include ELEM_GEMM_INC
+#include ELEM_HEMM_INC
+#include ELEM_ZEROS_INC
+#include ELEM_GAUSSIAN_INC
+
+// A Locally Optimal Block Preconditioned Conjugate Gradient (LOBPCG) method
+// for computing a few extremal eigenpairs of a Hermitian operator. See
+//
+//   A.V. Knyazev, "Toward the optimal preconditioned eigensolver: Locally
+//   Optimal Block Preconditioned Conjugate Gradient method", SIAM J. Sci.
+//   Comput., Vol. 23, No. 2, pp. 517--541, 2001
+//
+// for the original algorithm. The basis for each Rayleigh-Ritz step is
+// orthonormalized with the SVQB procedure from
+//
+//   A. Stathopoulos and K. Wu, "A block orthogonalization procedure with
+//   constant synchronization requirements", SIAM J. Sci. Comput., Vol. 23,
+//   No. 6, pp. 2165--2182, 2002
+//
+// which drops (nearly) linearly dependent search directions rather than
+// breaking down, and converged Ritz vectors are soft-locked in the sense that
+// their residuals are no longer added to the search space.
+//
+// The operator is only accessed through products with blocks of vectors, so
+// a user-defined functor with the signature
+//
+//     void operator()( const DistMatrix<F>& X, DistMatrix<F>& Y ) const
+//
+// (or the analogous Matrix<F> signature) may be passed in place of an
+// explicit matrix. Y is resized to the dimensions of X before each call.
+
+namespace elem {
+namespace herm_eig {
+
+namespace lobpcg {
+
+template<typename F>
+inline Matrix<F>&
+Local( Matrix<F>& A )
+{ return A; }
+
+template<typename F>
+inline const Matrix<F>&
+Local( const Matrix<F>& A )
+{ return A; }
+
+template<typename F>
+inline Matrix<F>&
+Local( DistMatrix<F,VC,STAR>& A )
+{ return A.Matrix(); }
+
+template<typename F>
+inline const Matrix<F>&
+Local( const DistMatrix<F,VC,STAR>& A )
+{ return A.LockedMatrix(); }
+
+template<typename F>
+inline void
+Conform( Matrix<F>& B, const Matrix<F>& A )
+{ }
+
+template<typename F>
+inline void
+Conform( DistMatrix<F,VC,STAR>& B, const DistMatrix<F,VC,STAR>& A )
+{
+    B.SetGrid( A.Grid() );
+    B.AlignWith( A );
+}
+
+template<typename F,typename T>
+inline void
+SumOverCols( const Matrix<F>& A, T* buf, Int count )
+{ }
+
+template<typename F,typename T>
+inline void
+SumOverCols( const DistMatrix<F,VC,STAR>& A, T* buf, Int count )
+{ mpi::AllReduce( buf, count, mpi::SUM, A.ColComm() ); }
+
+// G := S^H T
+template<typename F,class Block>
+inline void
+InnerProducts( const Block& S, const Block& T, Matrix<F>& G )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::InnerProducts"))
+    Zeros( G, S.Width(), T.Width() );
+    if( S.Width() == 0 || T.Width() == 0 )
+        return;
+    if( Local(S).Height() != 0 )
+        Gemm( ADJOINT, NORMAL, F(1), Local(S), Local(T), F(0), G );
+    SumOverCols( S, G.Buffer(), G.Height()*G.Width() );
+}
+
+// Y := S C
+template<typename F,class Block>
+inline void
+Combine( const Block& S, const Matrix<F>& C, Block& Y )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::Combine"))
+    Conform( Y, S );
+    Zeros( Y, S.Height(), C.Width() );
+    if( Local(S).Height() != 0 && S.Width() != 0 && C.Width() != 0 )
+        Gemm( NORMAL, NORMAL, F(1), Local(S), C, F(0), Local(Y) );
+}
+
+template<typename F,class Block>
+inline void
+ColumnNorms( const Block& X, Matrix<Base<F>>& norms )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::ColumnNorms"))
+    typedef Base<F> Real;
+    const Matrix<F>& XLoc = Local(X);
+    const Int mLocal = XLoc.Height();
+    const Int n = XLoc.Width();
+    Zeros( norms, n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        const Real alpha = blas::Nrm2( mLocal, XLoc.LockedBuffer(0,j), 1 );
+        norms.Set( j, 0, alpha*alpha );
+    }
+    SumOverCols( X, norms.Buffer(), n );
+    for( Int j=0; j<n; ++j )
+        norms.Set( j, 0, Sqrt(norms.Get(j,0)) );
+}
+
+// B := A(:,inds)
+template<typename F,class Block>
+inline void
+GetColumns( const Block& A, const std::vector<Int>& inds, Block& B )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::GetColumns"))
+    Conform( B, A );
+    Zeros( B, A.Height(), inds.size() );
+    const Matrix<F>& ALoc = Local(A);
+    Matrix<F>& BLoc = Local(B);
+    const Int mLocal = ALoc.Height();
+    for( Int j=0; j<Int(inds.size()); ++j )
+        MemCopy( BLoc.Buffer(0,j), ALoc.LockedBuffer(0,inds[j]), mLocal );
+}
+
+// S := [A, B, C]
+template<typename F,class Block>
+inline void
+Concatenate( const Block& A, const Block& B, const Block& C, Block& S )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::Concatenate"))
+    const Int nA = A.Width();
+    const Int nB = B.Width();
+    const Int nC = C.Width();
+    Conform( S, A );
+    Zeros( S, A.Height(), nA+nB+nC );
+    const Matrix<F>& ALoc = Local(A);
+    const Matrix<F>& BLoc = Local(B);
+    const Matrix<F>& CLoc = Local(C);
+    Matrix<F>& SLoc = Local(S);
+    const Int mLocal = SLoc.Height();
+    for( Int j=0; j<nA; ++j )
+        MemCopy( SLoc.Buffer(0,j), ALoc.LockedBuffer(0,j), mLocal );
+    for( Int j=0; j<nB; ++j )
+        MemCopy( SLoc.Buffer(0,nA+j), BLoc.LockedBuffer(0,j), mLocal );
+    for( Int j=0; j<nC; ++j )
+        MemCopy( SLoc.Buffer(0,nA+nB+j), CLoc.LockedBuffer(0,j), mLocal );
+}
+
+// Y := Y - X (X^H Y) and, if requested, AY := AY - AX (X^H Y)
+template<typename F,class Block>
+inline void
+Project
+( const Block& X, const Block& AX, Block& Y, Block& AY, bool trackA )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::Project"))
+    Matrix<F> H;
+    InnerProducts( X, Y, H );
+    if( X.Width() == 0 || Y.Width() == 0 || Local(Y).Height() == 0 )
+        return;
+    Gemm( NORMAL, NORMAL, F(-1), Local(X), H, F(1), Local(Y) );
+    if( trackA )
+        Gemm( NORMAL, NORMAL, F(-1), Local(AX), H, F(1), Local(AY) );
+}
+
+// Orthonormalize the columns of V using SVQB, discarding the directions
+// whose Gram eigenvalues are below dropTol relative to the largest, and
+// optionally apply the same transformation to AV. The new width is returned.
+template<typename F,class Block>
+inline Int
+SVQB( Block& V, Block& AV, Base<F> dropTol, bool trackA )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::SVQB"))
+    typedef Base<F> Real;
+    const Int m = V.Width();
+    if( m == 0 )
+        return 0;
+
+    // Form the diagonally-scaled Gram matrix, D^{-1/2} V^H V D^{-1/2}
+    Matrix<F> G;
+    InnerProducts( V, V, G );
+    Matrix<Real> d( m, 1 );
+    for( Int j=0; j<m; ++j )
+    {
+        const Real delta = RealPart(G.Get(j,j));
+        d.Set( j, 0, ( delta > Real(0) ? Real(1)/Sqrt(delta) : Real(0) ) );
+    }
+    for( Int j=0; j<m; ++j )
+        for( Int i=0; i<m; ++i )
+            G.Set( i, j, G.Get(i,j)*d.Get(i,0)*d.Get(j,0) );
+
+    Matrix<Real> lambda;
+    Matrix<F> Z;
+    HermitianEig( LOWER, G, lambda, Z, DESCENDING );
+    const Real lambdaMax = lambda.Get(0,0);
+    Int r = 0;
+    while( r < m && lambdaMax > Real(0) &&
+           lambda.Get(r,0) > dropTol*lambdaMax )
+        ++r;
+
+    // T := D^{-1/2} Z(:,0:r) Lambda(0:r)^{-1/2}
+    Matrix<F> T( m, r );
+    for( Int j=0; j<r; ++j )
+    {
+        const Real scale = Real(1)/Sqrt(lambda.Get(j,0));
+        for( Int i=0; i<m; ++i )
+            T.Set( i, j, Z.Get(i,j)*(d.Get(i,0)*scale) );
+    }
+    Block VNew;
+    Combine( V, T, VNew );
+    V = VNew;
+    if( trackA )
+    {
+        Combine( AV, T, VNew );
+        AV = VNew;
+    }
+    return r;
+}
+
+// Solve the projected eigenvalue problem S^H (A S) C = C Theta, where S has
+// orthonormal columns, and return the k wanted Ritz values and the
+// corresponding columns of C
+template<typename F,class Block>
+inline void
+RayleighRitz
+( const Block& S, const Block& AS, Int k, bool largest,
+  Matrix<Base<F>>& w, Matrix<F>& C )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::RayleighRitz"))
+    typedef Base<F> Real;
+    const Int s = S.Width();
+    Matrix<F> G;
+    InnerProducts( S, AS, G );
+    // Explicitly symmetrize to remove the rounding errors in S^H (A S)
+    for( Int j=0; j<s; ++j )
+    {
+        G.Set( j, j, RealPart(G.Get(j,j)) );
+        for( Int i=j+1; i<s; ++i )
+        {
+            const F avg = (G.Get(i,j)+Conj(G.Get(j,i)))/Real(2);
+            G.Set( i, j, avg );
+            G.Set( j, i, Conj(avg) );
+        }
+    }
+
+    Matrix<Real> theta;
+    Matrix<F> Z;
+    HermitianEig( LOWER, G, theta, Z, ( largest ? DESCENDING : ASCENDING ) );
+    auto thetaWanted = LockedView( theta, 0, 0, k, 1 );
+    auto ZWanted = LockedView( Z, 0, 0, s, k );
+    w = thetaWanted;
+    C = ZWanted;
+}
+
+template<typename F,class Block,class Operator>
+inline void
+Apply( const Operator& applyA, const Block& X, Block& AX )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::Apply"))
+    Conform( AX, X );
+    Zeros( AX, X.Height(), X.Width() );
+    applyA( X, AX );
+}
+
+template<typename F,class Block,class Operator>
+inline Int
+Iterate
+( const Operator& applyA, Block& X, Matrix<Base<F>>& w,
+  bool largest, Int maxIts, Base<F> tol, bool print )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::lobpcg::Iterate"))
+    typedef Base<F> Real;
+    const Int n = X.Height();
+    const Int k = X.Width();
+    const Real eps = lapack::MachineEpsilon<Real>();
+    if( tol == Real(0) )
+        tol = Sqrt(eps);
+    const Real dropTol = 10*(3*k)*eps;
+
+    Block AX, W, AW, P, AP, S, AS, XNew, AXNew, PNew, APNew;
+    Conform( AX, X ); Conform( W, X ); Conform( AW, X );
+    Conform( P, X ); Conform( AP, X ); Conform( S, X ); Conform( AS, X );
+    Conform( XNew, X ); Conform( AXNew, X );
+    Conform( PNew, X ); Conform( APNew, X );
+    Zeros( P, n, 0 );
+    Zeros( AP, n, 0 );
+
+    // Orthonormalize the initial guess, replacing any (nearly) dependent
+    // directions with random ones
+    Int r = SVQB<F>( X, AX, dropTol, false );
+    for( Int attempt=0; r<k; ++attempt )
+    {
+        if( attempt == 10 )
+            RuntimeError("Could not form an orthonormal initial guess");
+        Gaussian( W, n, k-r );
+        Project<F>( X, AX, W, AW, false );
+        Project<F>( X, AX, W, AW, false );
+        SVQB<F>( W, AW, dropTol, false );
+        Concatenate<F>( X, W, P, S );
+        X = S;
+        r = SVQB<F>( X, AX, dropTol, false );
+    }
+    Apply<F>( applyA, X, AX );
+    Matrix<F> C;
+    RayleighRitz( X, AX, k, largest, w, C );
+    Combine( X, C, XNew );
+    Combine( AX, C, AXNew );
+    X = XNew;
+    AX = AXNew;
+
+    Matrix<Real> norms;
+    std::vector<Int> active;
+    bool freshAX = true;
+    Int numIts=0;
+    for( ; numIts<maxIts; ++numIts )
+    {
+        // W := A X - X diag(w)
+        W = AX;
+        for( Int j=0; j<k; ++j )
+        {
+            auto xj = LockedView( Local(X), 0, j, Local(X).Height(), 1 );
+            auto wj = View( Local(W), 0, j, Local(W).Height(), 1 );
+            Axpy( -F(w.Get(j,0)), xj, wj );
+        }
+        ColumnNorms<F>( W, norms );
+        Real scale = 0;
+        for( Int j=0; j<k; ++j )
+            scale = std::max( scale, Abs(w.Get(j,0)) );
+        if( scale == Real(0) )
+            scale = 1;
+
+        // Soft-lock the converged Ritz vectors
+        active.resize( 0 );
+        Real maxRelNorm = 0;
+        for( Int j=0; j<k; ++j )
+        {
+            const Real relNorm = norms.Get(j,0) / scale;
+            maxRelNorm = std::max( maxRelNorm, relNorm );
+            if( relNorm > tol )
+                active.push_back( j );
+        }
+        if( print )
+            std::cout << "LOBPCG iteration " << numIts << ": "
+                      << k-Int(active.size()) << " of " << k
+                      << " converged, max relative residual=" << maxRelNorm
+                      << std::endl;
+        if( active.size() == 0 )
+        {
+            if( freshAX )
+                break;
+            // The residuals were computed with an implicitly updated A X,
+            // so refresh it and restart the conjugate directions before
+            // declaring convergence
+            Apply<F>( applyA, X, AX );
+            Zeros( P, n, 0 );
+            Zeros( AP, n, 0 );
+            freshAX = true;
+            continue;
+        }
+
+        // Form an orthonormal basis for the active residuals which is
+        // orthogonal to both X and P
+        GetColumns<F>( W, active, S );
+        W = S;
+        for( Int pass=0; pass<2; ++pass )
+        {
+            Project<F>( X, AX, W, AW, false );
+            Project<F>( P, AP, W, AW, false );
+            SVQB<F>( W, AW, dropTol, false );
+        }
+        if( W.Width() == 0 )
+        {
+            if( P.Width() == 0 )
+            {
+                if( print )
+                    std::cout << "LOBPCG stagnated" << std::endl;
+                break;
+            }
+            // Restart without the conjugate directions
+            Zeros( P, n, 0 );
+            Zeros( AP, n, 0 );
+            continue;
+        }
+        Apply<F>( applyA, W, AW );
+        freshAX = false;
+
+        // Rayleigh-Ritz over span{X,W,P}
+        Concatenate<F>( X, W, P, S );
+        Concatenate<F>( AX, AW, AP, AS );
+        RayleighRitz( S, AS, k, largest, w, C );
+        Combine( S, C, XNew );
+        Combine( AS, C, AXNew );
+
+        // P := [W,P] C(k:end,:), which is orthogonal to the old X, but must
+        // be explicitly orthonormalized against the new X
+        const Int s = S.Width();
+        auto CBot = LockedView( C, k, 0, s-k, k );
+        auto SRight = LockedView( Local(S), 0, k, Local(S).Height(), s-k );
+        auto ASRight = LockedView( Local(AS), 0, k, Local(AS).Height(), s-k );
+        Zeros( PNew, n, k );
+        Zeros( APNew, n, k );
+        if( Local(S).Height() != 0 )
+        {
+            Gemm( NORMAL, NORMAL, F(1), SRight, CBot, F(0), Local(PNew) );
+            Gemm( NORMAL, NORMAL, F(1), ASRight, CBot, F(0), Local(APNew) );
+        }
+        X = XNew;
+        AX = AXNew;
+        for( Int pass=0; pass<2; ++pass )
+        {
+            Project<F>( X, AX, PNew, APNew, true );
+            SVQB<F>( PNew, APNew, dropTol, true );
+        }
+        P = PNew;
+        AP = APNew;
+    }
+    return numIts;
+}
+
+template<typename F,class Operator>
+class DistOperator
+{
+public:
+    DistOperator( const Operator& applyA ) : applyA_(applyA) { }
+
+    void operator()
+    ( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,VC,STAR>& Y ) const
+    {
+        DistMatrix<F> X_MC_MR( X ), Y_MC_MR( X.Grid() );
+        Zeros( Y_MC_MR, X.Height(), X.Width() );
+        applyA_( X_MC_MR, Y_MC_MR );
+        Y = Y_MC_MR;
+    }
+
+private:
+    const Operator& applyA_;
+};
+
+template<typename F>
+class HermitianOperator
+{
+public:
+    HermitianOperator( UpperOrLower uplo, const Matrix<F>& A )
+    : uplo_(uplo), A_(A) { }
+
+    void operator()( const Matrix<F>& X, Matrix<F>& Y ) const
+    { Hemm( LEFT, uplo_, F(1), A_, X, F(0), Y ); }
+
+private:
+    UpperOrLower uplo_;
+    const Matrix<F>& A_;
+};
+
+template<typename F>
+class DistHermitianOperator
+{
+public:
+    DistHermitianOperator( UpperOrLower uplo, const DistMatrix<F>& A )
+    : uplo_(uplo), A_(A) { }
+
+    void operator()( const DistMatrix<F>& X, DistMatrix<F>& Y ) const
+    { Hemm( LEFT, uplo_, F(1), A_, X, F(0), Y ); }
+
+private:
+    UpperOrLower uplo_;
+    const DistMatrix<F>& A_;
+};
+
+} // namespace lobpcg
+
+// Compute the k smallest (or largest) eigenpairs of the n x n Hermitian
+// operator applied by applyA. If X is n x k upon entry, it is used as the
+// initial guess. A relative residual tolerance of zero selects sqrt(eps).
+// The number of iterations is returned.
+template<typename F,class Operator>
+inline Int
+LOBPCG
+( const Operator& applyA, Int n, Int k, Matrix<BASE(F)>& w, Matrix<F>& X,
+  bool largest=false, Int maxIts=500, BASE(F) tol=0, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::LOBPCG"))
+    if( k < 1 || k > n )
+        LogicError("Invalid number of requested eigenpairs");
+    if( X.Height() != n || X.Width() != k )
+        Gaussian( X, n, k );
+    return lobpcg::Iterate<F>( applyA, X, w, largest, maxIts, tol, progress );
+}
+
+template<typename F,class Operator>
+inline Int
+LOBPCG
+( const Operator& applyA, Int n, Int k,
+  DistMatrix<BASE(F),VR,STAR>& w, DistMatrix<F>& X,
+  bool largest=false, Int maxIts=500, BASE(F) tol=0, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::LOBPCG"))
+    typedef Base<F> Real;
+    if( k < 1 || k > n )
+        LogicError("Invalid number of requested eigenpairs");
+    const Grid& g = X.Grid();
+    if( X.Height() != n || X.Width() != k )
+        Gaussian( X, n, k );
+
+    DistMatrix<F,VC,STAR> X_VC_STAR( X );
+    Matrix<Real> wLoc;
+    lobpcg::DistOperator<F,Operator> distApplyA( applyA );
+    const Int numIts = lobpcg::Iterate<F>
+    ( distApplyA, X_VC_STAR, wLoc, largest, maxIts, tol,
+      progress && g.Rank()==0 );
+    X = X_VC_STAR;
+
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR( k, 1, g );
+    w_STAR_STAR.Matrix() = wLoc;
+    w = w_STAR_STAR;
+    return numIts;
+}
+
+template<typename F>
+inline Int
+LOBPCG
+( UpperOrLower uplo, const Matrix<F>& A, Int k,
+  Matrix<BASE(F)>& w, Matrix<F>& X,
+  bool largest=false, Int maxIts=500, BASE(F) tol=0, bool progress=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_eig::LOBPCG");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    lobpcg::HermitianOperator<F> applyA( uplo, A );
+    return LOBPCG( applyA, A.Height(), k, w, X, largest, maxIts, tol, progress );
+}
+
+template<typename F>
+inline Int
+LOBPCG
+( UpperOrLower uplo, const DistMatrix<F>& A, Int k,
+  DistMatrix<BASE(F),VR,STAR>& w, DistMatrix<F>& X,
+  bool largest=false, Int maxIts=500, BASE(F) tol=0, bool progress=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_eig::LOBPCG");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    lobpcg::DistHermitianOperator<F> applyA( uplo, A );
+    return LOBPCG( applyA, A.Height(), k, w, X, largest, maxIts, tol, progress );
+}
+
+} // namespace herm_eig
+} // namespace elem
+
+#endif // ifndef ELEM_HERMITIANEIG_LOBPCG_HPP
@@ -16,6 +16,7 @@
 
 #include ELEM_QR_INC
 #include ELEM_POLAR_QDWH_INC
+#include ELEM_POLAR_ZOLOTAREV_INC
 #include ELEM_SCHUR_INC
 
 #include ELEM_MEDIAN_INC
@@ -37,16 +38,22 @@ using elem::schur::PullSubproblems;
 // TODO: Exploit symmetry in A := Q^H A Q. Routine for A := X^H A X?
 
 // G should be a rational function of A. If returnQ=true, G will be set to
-// the computed unitary matrix upon exit.
+// the computed unitary matrix upon exit. If zolotarev=true, the sign of G is
+// computed with the Zolotarev-based iteration rather than QDWH.
 template<typename F>
 inline ValueInt<BASE(F)>
-QDWHDivide( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, bool returnQ=false )
+QDWHDivide
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, 
+  polar::QDWHWorkspace<F>& work, bool returnQ=false, bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::QDWHDivide"))
 
     // G := sgn(G)
     // G := 1/2 ( G + I )
-    herm_polar::QDWH( uplo, G ); 
+    if( zolotarev )
+        herm_polar::Zolotarev( uplo, G );
+    else
+        herm_polar::QDWH( uplo, G, work );
     UpdateDiagonal( G, F(1) );
     Scale( F(1)/F(2), G );
 
@@ -80,13 +87,28 @@ QDWHDivide( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, bool returnQ=false )
 template<typename F>
 inline ValueInt<BASE(F)>
 QDWHDivide
-( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& G, bool returnQ=false )
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, bool returnQ=false,
+  bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::QDWHDivide"))
+    polar::QDWHWorkspace<F> work;
+    return QDWHDivide( uplo, A, G, work, returnQ, zolotarev );
+}
+
+template<typename F>
+inline ValueInt<BASE(F)>
+QDWHDivide
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& G, 
+  polar::DistQDWHWorkspace<F>& work, bool returnQ=false, bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::QDWHDivide"))
 
     // G := sgn(G)
     // G := 1/2 ( G + I )
-    herm_polar::QDWH( uplo, G ); 
+    if( zolotarev )
+        herm_polar::Zolotarev( uplo, G );
+    else
+        herm_polar::QDWH( uplo, G, work );
     UpdateDiagonal( G, F(1) );
     Scale( F(1)/F(2), G );
 
@@ -118,11 +140,23 @@ QDWHDivide
     return part;
 }
 
+template<typename F>
+inline ValueInt<BASE(F)>
+QDWHDivide
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& G, bool returnQ=false,
+  bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::QDWHDivide"))
+    polar::DistQDWHWorkspace<F> work( A.Grid() );
+    return QDWHDivide( uplo, A, G, work, returnQ, zolotarev );
+}
+
 template<typename F>
 inline ValueInt<BASE(F)>
 RandomizedSignDivide
 ( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, 
-  bool returnQ=false, Int maxIts=1, BASE(F) relTol=0 )
+  polar::QDWHWorkspace<F>& work, 
+  bool returnQ=false, Int maxIts=1, BASE(F) relTol=0, bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::RandomizedSignDivide"))
 
@@ -136,7 +170,10 @@ RandomizedSignDivide
     // S := sgn(G)
     // S := 1/2 ( S + I )
     auto S( G );
-    herm_polar::QDWH( uplo, S ); 
+    if( zolotarev )
+        herm_polar::Zolotarev( uplo, S );
+    else
+        herm_polar::QDWH( uplo, S, work );
     UpdateDiagonal( S, F(1) );
     Scale( F(1)/F(2), S );
 
@@ -179,11 +216,24 @@ RandomizedSignDivide
     return part;
 }
 
+template<typename F>
+inline ValueInt<BASE(F)>
+RandomizedSignDivide
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& G, 
+  bool returnQ=false, Int maxIts=1, BASE(F) relTol=0, bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::RandomizedSignDivide"))
+    polar::QDWHWorkspace<F> work;
+    return RandomizedSignDivide
+           ( uplo, A, G, work, returnQ, maxIts, relTol, zolotarev );
+}
+
 template<typename F>
 inline ValueInt<BASE(F)>
 RandomizedSignDivide
 ( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& G, 
-  bool returnQ=false, Int maxIts=1, BASE(F) relTol=0 )
+  polar::DistQDWHWorkspace<F>& work, 
+  bool returnQ=false, Int maxIts=1, BASE(F) relTol=0, bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::RandomizedSignDivide"))
 
@@ -198,7 +248,10 @@ RandomizedSignDivide
     // S := sgn(G)
     // S := 1/2 ( S + I )
     auto S( G );
-    herm_polar::QDWH( uplo, S ); 
+    if( zolotarev )
+        herm_polar::Zolotarev( uplo, S );
+    else
+        herm_polar::QDWH( uplo, S, work );
     UpdateDiagonal( S, F(1) );
     Scale( F(1)/F(2), S );
 
@@ -242,11 +295,24 @@ RandomizedSignDivide
     return part;
 }
 
+template<typename F>
+inline ValueInt<BASE(F)>
+RandomizedSignDivide
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& G, 
+  bool returnQ=false, Int maxIts=1, BASE(F) relTol=0, bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::RandomizedSignDivide"))
+    polar::DistQDWHWorkspace<F> work( A.Grid() );
+    return RandomizedSignDivide
+           ( uplo, A, G, work, returnQ, maxIts, relTol, zolotarev );
+}
+
 template<typename F>
 inline ValueInt<BASE(F)>
 SpectralDivide
-( UpperOrLower uplo, Matrix<F>& A, 
-  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0 )
+( UpperOrLower uplo, Matrix<F>& A, polar::QDWHWorkspace<F>& work,
+  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::SpectralDivide"))
 
@@ -273,7 +339,8 @@ SpectralDivide
         UpdateDiagonal( G, F(shift) );
 
         //part = SignDivide( uplo, A, G );
-        part = RandomizedSignDivide( uplo, A, G, false, maxInnerIts, relTol );
+        part = RandomizedSignDivide
+        ( uplo, A, G, work, false, maxInnerIts, relTol, zolotarev );
 
         ++it;
         if( part.value <= relTol )
@@ -289,11 +356,26 @@ SpectralDivide
     return part;
 }
 
+template<typename F>
+inline ValueInt<BASE(F)>
+SpectralDivide
+( UpperOrLower uplo, Matrix<F>& A, 
+  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::SpectralDivide"))
+    polar::QDWHWorkspace<F> work;
+    return SpectralDivide
+           ( uplo, A, work, maxInnerIts, maxOuterIts, relTol, zolotarev );
+}
+
 template<typename F>
 inline ValueInt<BASE(F)>
 SpectralDivide
 ( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& Q, 
-  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0 )
+  polar::QDWHWorkspace<F>& work,
+  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::SpectralDivide"))
 
@@ -320,7 +402,8 @@ SpectralDivide
         UpdateDiagonal( Q, F(shift) );
 
         //part = SignDivide( uplo, A, Q, true );
-        part = RandomizedSignDivide( uplo, A, Q, true, maxInnerIts, relTol );
+        part = RandomizedSignDivide
+        ( uplo, A, Q, work, true, maxInnerIts, relTol, zolotarev );
 
         ++it;
         if( part.value <= relTol )
@@ -339,8 +422,22 @@ SpectralDivide
 template<typename F>
 inline ValueInt<BASE(F)>
 SpectralDivide
-( UpperOrLower uplo, DistMatrix<F>& A, 
-  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0 )
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& Q, 
+  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::SpectralDivide"))
+    polar::QDWHWorkspace<F> work;
+    return SpectralDivide
+           ( uplo, A, Q, work, maxInnerIts, maxOuterIts, relTol, zolotarev );
+}
+
+template<typename F>
+inline ValueInt<BASE(F)>
+SpectralDivide
+( UpperOrLower uplo, DistMatrix<F>& A, polar::DistQDWHWorkspace<F>& work,
+  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::SpectralDivide"))
 
@@ -368,7 +465,8 @@ SpectralDivide
         UpdateDiagonal( G, F(shift) );
 
         //part = SignDivide( uplo, A, G );
-        part = RandomizedSignDivide( uplo, A, G, false, maxInnerIts, relTol );
+        part = RandomizedSignDivide
+        ( uplo, A, G, work, false, maxInnerIts, relTol, zolotarev );
 
         ++it;
         if( part.value <= relTol )
@@ -384,11 +482,26 @@ SpectralDivide
     return part;
 }
 
+template<typename F>
+inline ValueInt<BASE(F)>
+SpectralDivide
+( UpperOrLower uplo, DistMatrix<F>& A, 
+  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::SpectralDivide"))
+    polar::DistQDWHWorkspace<F> work( A.Grid() );
+    return SpectralDivide
+           ( uplo, A, work, maxInnerIts, maxOuterIts, relTol, zolotarev );
+}
+
 template<typename F>
 inline ValueInt<BASE(F)>
 SpectralDivide
 ( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& Q, 
-  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0 )
+  polar::DistQDWHWorkspace<F>& work,
+  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::SpectralDivide"))
 
@@ -416,7 +529,8 @@ SpectralDivide
         UpdateDiagonal( Q, F(shift) );
 
         //part = SignDivide( uplo, A, Q, true );
-        part = RandomizedSignDivide( uplo, A, Q, true, maxInnerIts, relTol );
+        part = RandomizedSignDivide
+        ( uplo, A, Q, work, true, maxInnerIts, relTol, zolotarev );
 
         ++it;
         if( part.value <= relTol )
@@ -432,12 +546,26 @@ SpectralDivide
     return part;
 }
 
+template<typename F>
+inline ValueInt<BASE(F)>
+SpectralDivide
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& Q, 
+  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::SpectralDivide"))
+    polar::DistQDWHWorkspace<F> work( A.Grid() );
+    return SpectralDivide
+           ( uplo, A, Q, work, maxInnerIts, maxOuterIts, relTol, zolotarev );
+}
+
 template<typename F>
 inline void
 SDC
-( UpperOrLower uplo, Matrix<F>& A, Matrix<BASE(F)>& w, Int cutoff=256, 
-  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
-  bool progress=false )
+( UpperOrLower uplo, Matrix<F>& A, Matrix<BASE(F)>& w, 
+  polar::QDWHWorkspace<F>& work, 
+  Int cutoff=256, Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool progress=false, bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::SDC"))
 
@@ -451,8 +579,9 @@ SDC
     }
 
     // Perform this level's split
-    const auto part = 
-        SpectralDivide( uplo, A, maxInnerIts, maxOuterIts, relTol );
+    const auto part =
+        SpectralDivide
+        ( uplo, A, work, maxInnerIts, maxOuterIts, relTol, zolotarev );
     Matrix<F> ATL, ATR,
               ABL, ABR;
     PartitionDownDiagonal
@@ -462,16 +591,35 @@ SDC
     PartitionDown( w, wT, wB, part.index );
 
     // Recurse on the two subproblems
-    SDC( uplo, ATL, wT, cutoff, maxInnerIts, maxOuterIts, relTol, progress );
-    SDC( uplo, ABR, wB, cutoff, maxInnerIts, maxOuterIts, relTol, progress );
+    SDC
+    ( uplo, ATL, wT, work, cutoff, maxInnerIts, maxOuterIts, relTol, progress,
+      zolotarev );
+    SDC
+    ( uplo, ABR, wB, work, cutoff, maxInnerIts, maxOuterIts, relTol, progress,
+      zolotarev );
+}
+
+template<typename F>
+inline void
+SDC
+( UpperOrLower uplo, Matrix<F>& A, Matrix<BASE(F)>& w, Int cutoff=256, 
+  Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool progress=false, bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::SDC"))
+    polar::QDWHWorkspace<F> work;
+    SDC
+    ( uplo, A, w, work, cutoff, maxInnerIts, maxOuterIts, relTol, progress,
+      zolotarev );
 }
 
 template<typename F>
 inline void
 SDC
 ( UpperOrLower uplo, Matrix<F>& A, Matrix<BASE(F)>& w, Matrix<F>& Q, 
+  polar::QDWHWorkspace<F>& work, 
   Int cutoff=256, Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
-  bool progress=false )
+  bool progress=false, bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::SDC"))
 
@@ -486,8 +634,9 @@ SDC
     }
 
     // Perform this level's split
-    const auto part = 
-        SpectralDivide( uplo, A, Q, maxInnerIts, maxOuterIts, relTol );
+    const auto part =
+        SpectralDivide
+        ( uplo, A, Q, work, maxInnerIts, maxOuterIts, relTol, zolotarev );
     Matrix<F> ATL, ATR,
               ABL, ABR;
     PartitionDownDiagonal
@@ -500,22 +649,41 @@ SDC
 
     // Recurse on the top-left quadrant and update eigenvectors
     Matrix<F> Z;
-    SDC( uplo, ATL, wT, Z, cutoff, maxInnerIts, maxOuterIts, relTol, progress );
+    SDC
+    ( uplo, ATL, wT, Z, work, cutoff, maxInnerIts, maxOuterIts, relTol, 
+      progress, zolotarev );
     auto G( QL );
     Gemm( NORMAL, NORMAL, F(1), G, Z, QL );
 
     // Recurse on the bottom-right quadrant and update eigenvectors
-    SDC( uplo, ABR, wB, Z, cutoff, maxInnerIts, maxOuterIts, relTol, progress );
+    SDC
+    ( uplo, ABR, wB, Z, work, cutoff, maxInnerIts, maxOuterIts, relTol, 
+      progress, zolotarev );
     G = QR;
     Gemm( NORMAL, NORMAL, F(1), G, Z, QR );
 }
 
+template<typename F>
+inline void
+SDC
+( UpperOrLower uplo, Matrix<F>& A, Matrix<BASE(F)>& w, Matrix<F>& Q, 
+  Int cutoff=256, Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool progress=false, bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::SDC"))
+    polar::QDWHWorkspace<F> work;
+    SDC
+    ( uplo, A, w, Q, work, cutoff, maxInnerIts, maxOuterIts, relTol, progress,
+      zolotarev );
+}
+
 template<typename F>
 inline void
 SDC
 ( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& w, 
+  polar::DistQDWHWorkspace<F>& work, 
   Int cutoff=256, Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
-  bool progress=false )
+  bool progress=false, bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::SDC"))
 
@@ -535,8 +703,9 @@ SDC
     }
 
     // Perform this level's split
-    const auto part = 
-        SpectralDivide( uplo, A, maxInnerIts, maxOuterIts, relTol );
+    const auto part =
+        SpectralDivide
+        ( uplo, A, work, maxInnerIts, maxOuterIts, relTol, zolotarev );
     DistMatrix<F> ATL(g), ATR(g),
                   ABL(g), ABR(g);
     PartitionDownDiagonal
@@ -549,24 +718,41 @@ SDC
     DistMatrix<F> ATLSub, ABRSub;
     DistMatrix<Real,VR,STAR> wTSub, wBSub;
     PushSubproblems( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, progress );
-    if( ATL.Participating() )
+    if( ATLSub.Participating() )
         SDC
-        ( uplo, ATLSub, wTSub, cutoff, maxInnerIts, maxOuterIts, relTol, 
-          progress );
-    if( ABR.Participating() )
+        ( uplo, ATLSub, wTSub, work, cutoff, maxInnerIts, maxOuterIts, relTol,
+          progress, zolotarev );
+    if( ABRSub.Participating() )
         SDC
-        ( uplo, ABRSub, wBSub, cutoff, maxInnerIts, maxOuterIts, relTol, 
-          progress );
+        ( uplo, ABRSub, wBSub, work, cutoff, maxInnerIts, maxOuterIts, relTol,
+          progress, zolotarev );
+    // Move the workspace back before the subgrids are freed
+    work.SetGrid( g );
     PullSubproblems( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub );
 }
 
+template<typename F>
+inline void
+SDC
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& w, 
+  Int cutoff=256, Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool progress=false, bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::SDC"))
+    polar::DistQDWHWorkspace<F> work( A.Grid() );
+    SDC
+    ( uplo, A, w, work, cutoff, maxInnerIts, maxOuterIts, relTol, progress,
+      zolotarev );
+}
+
 template<typename F>
 inline void
 SDC
 ( UpperOrLower uplo, 
   DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& w, DistMatrix<F>& Q, 
+  polar::DistQDWHWorkspace<F>& work, 
   Int cutoff=256, Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
-  bool progress=false )
+  bool progress=false, bool zolotarev=false )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_eig::SDC"))
 
@@ -587,8 +773,9 @@ SDC
     }
 
     // Perform this level's split
-    const auto part = 
-        SpectralDivide( uplo, A, Q, maxInnerIts, maxOuterIts, relTol );
+    const auto part =
+        SpectralDivide
+        ( uplo, A, Q, work, maxInnerIts, maxOuterIts, relTol, zolotarev );
     DistMatrix<F> ATL(g), ATR(g),
                   ABL(g), ABR(g);
     PartitionDownDiagonal
@@ -605,13 +792,14 @@ SDC
     PushSubproblems
     ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ZTSub, ZBSub, progress );
     if( ATLSub.Participating() )
-        SDC( uplo, ATLSub, wTSub, ZTSub, 
-             cutoff, maxInnerIts, maxOuterIts, relTol, progress );
+        SDC( uplo, ATLSub, wTSub, ZTSub, work,
+             cutoff, maxInnerIts, maxOuterIts, relTol, progress, zolotarev );
     if( ABRSub.Participating() )
-        SDC( uplo, ABRSub, wBSub, ZBSub, 
-             cutoff, maxInnerIts, maxOuterIts, relTol, progress );
+        SDC( uplo, ABRSub, wBSub, ZBSub, work,
+             cutoff, maxInnerIts, maxOuterIts, relTol, progress, zolotarev );
 
-    // Pull the results back to this grid
+    // Pull the results (and the workspace) back to this grid
+    work.SetGrid( g );
     DistMatrix<F> ZT(g), ZB(g);
     PullSubproblems
     ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ZT, ZB, ZTSub, ZBSub );
@@ -623,6 +811,21 @@ SDC
     Gemm( NORMAL, NORMAL, F(1), G, ZB, QR );
 }
 
+template<typename F>
+inline void
+SDC
+( UpperOrLower uplo, 
+  DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& w, DistMatrix<F>& Q, 
+  Int cutoff=256, Int maxInnerIts=1, Int maxOuterIts=10, BASE(F) relTol=0,
+  bool progress=false, bool zolotarev=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::SDC"))
+    polar::DistQDWHWorkspace<F> work( A.Grid() );
+    SDC
+    ( uplo, A, w, Q, work, cutoff, maxInnerIts, maxOuterIts, relTol, progress,
+      zolotarev );
+}
+
 } // namespace herm_eig
 } // namespace elem
 
@@ -0,0 +1,380 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_HERMITIANEIG_SPECTRUMSLICING_HPP
+#define ELEM_HERMITIANEIG_SPECTRUMSLICING_HPP
+
+#include ELEM_MAKEHERMITIAN_INC
+#include ELEM_UPDATEDIAGONAL_INC
+#include ELEM_LDL_INC
+#include ELEM_ONENORM_INC
+#include ELEM_TEAMS_INC
+
+// Spectrum slicing: the process grid is split into a number of teams, the
+// real line is cut into as many slices, each containing (roughly) the same
+// number of eigenvalues, and each team independently computes the eigenpairs
+// within its slice. The cuts are found by a multisection search where, in
+// each round, every team computes the inertia of A - sigma I for a different
+// shift sigma using a pivoted LDL^H factorization.
+//
+// Since every team works with the full matrix, the total amount of work grows
+// with the number of slices, but each team runs on a grid small enough for
+// the (notoriously communication-bound) tridiagonalization to remain
+// efficient, and the only communication between teams is the initial
+// redistribution of A and the final reassembly of the eigenvectors.
+
+namespace elem {
+namespace herm_eig {
+
+namespace slice {
+
+// Return the number of eigenvalues of A which are less than or equal to sigma
+template<typename F>
+inline Int
+NumAtMost( UpperOrLower uplo, const DistMatrix<F>& A, BASE(F) sigma )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::slice::NumAtMost"))
+    DistMatrix<F> B( A );
+    if( uplo == UPPER )
+        MakeHermitian( UPPER, B );
+    UpdateDiagonal( B, F(-sigma) );
+    const auto inertia = HermitianInertia( LOWER, B );
+    return inertia.numNegative + inertia.numZero;
+}
+
+// Find numTeams-1 cuts within (lower,upper] which split the eigenvalues into
+// numTeams slices with (roughly) equal counts. Each team holds a copy of the
+// matrix in ASub. Upon return, cuts is of length numTeams+1 and counts[t]
+// is the number of eigenvalues less than or equal to cuts[t].
+template<typename F>
+inline void
+FindCuts
+( UpperOrLower uplo, const DistMatrix<F>& ASub, Int myTeam, Int numTeams,
+  const Grid& grid, BASE(F) lower, BASE(F) upper, Int lowerCount,
+  Int upperCount, std::vector<BASE(F)>& cuts, std::vector<Int>& counts,
+  Int maxRounds=20, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::slice::FindCuts"))
+    typedef Base<F> Real;
+    const Int numCuts = numTeams-1;
+    const Int numEigs = upperCount - lowerCount;
+    const Int slack = numEigs / (10*numTeams);
+    const bool teamRoot = ( ASub.Grid().Rank() == 0 );
+
+    std::vector<Int> targets(numCuts);
+    std::vector<Real> lowers(numCuts,lower), uppers(numCuts,upper);
+    std::vector<Int> lowerCounts(numCuts,lowerCount),
+                     upperCounts(numCuts,upperCount);
+    std::vector<bool> found(numCuts,false);
+    for( Int i=0; i<numCuts; ++i )
+        targets[i] = lowerCount + ((i+1)*numEigs)/numTeams;
+
+    std::vector<Real> shifts(numTeams);
+    std::vector<Int> shiftCounts(numTeams);
+    for( Int round=0; round<maxRounds; ++round )
+    {
+        // Assign a shift within each unresolved bracket to a team. The
+        // shift is found by interpolating the eigenvalue counts at the ends
+        // of the bracket, but it is kept away from the ends so that the
+        // bracket shrinks by at least a constant factor each round
+        Int numShifts = 0;
+        for( Int i=0; i<numCuts; ++i )
+        {
+            if( found[i] )
+                continue;
+            const Real width = uppers[i] - lowers[i];
+            Real theta = Real(1)/Real(2);
+            if( upperCounts[i] > lowerCounts[i] )
+                theta = Real(targets[i]-lowerCounts[i]) /
+                        Real(upperCounts[i]-lowerCounts[i]);
+            theta = Max( Min( theta, Real(9)/Real(10) ), Real(1)/Real(10) );
+            shifts[numShifts++] = lowers[i] + theta*width;
+        }
+        if( numShifts == 0 )
+            break;
+
+        for( Int t=0; t<numTeams; ++t )
+            shiftCounts[t] = 0;
+        if( myTeam < numShifts )
+        {
+            const Int count = NumAtMost( uplo, ASub, shifts[myTeam] );
+            if( teamRoot )
+                shiftCounts[myTeam] = count;
+        }
+        mpi::AllReduce( shiftCounts.data(), numTeams, mpi::SUM, grid.Comm() );
+
+        // Every inertia count tightens the bracket of every cut
+        for( Int s=0; s<numShifts; ++s )
+        {
+            const Real sigma = shifts[s];
+            const Int count = shiftCounts[s];
+            for( Int i=0; i<numCuts; ++i )
+            {
+                if( found[i] )
+                    continue;
+                if( count <= targets[i] && sigma > lowers[i] )
+                {
+                    lowers[i] = sigma;
+                    lowerCounts[i] = count;
+                }
+                if( count >= targets[i] && sigma < uppers[i] )
+                {
+                    uppers[i] = sigma;
+                    upperCounts[i] = count;
+                }
+                if( Abs(count-targets[i]) <= slack )
+                {
+                    lowers[i] = uppers[i] = sigma;
+                    lowerCounts[i] = upperCounts[i] = count;
+                    found[i] = true;
+                }
+            }
+        }
+        if( progress && grid.Rank() == 0 )
+        {
+            Int numFound = 0;
+            for( Int i=0; i<numCuts; ++i )
+                if( found[i] )
+                    ++numFound;
+            std::cout << "Round " << round << ": " << numFound << " of "
+                      << numCuts << " cuts found" << std::endl;
+        }
+    }
+
+    cuts.resize( numTeams+1 );
+    counts.resize( numTeams+1 );
+    cuts[0] = lower;
+    counts[0] = lowerCount;
+    for( Int i=0; i<numCuts; ++i )
+    {
+        if( found[i] ||
+            targets[i]-lowerCounts[i] <= upperCounts[i]-targets[i] )
+        {
+            cuts[i+1] = lowers[i];
+            counts[i+1] = lowerCounts[i];
+        }
+        else
+        {
+            cuts[i+1] = uppers[i];
+            counts[i+1] = upperCounts[i];
+        }
+    }
+    cuts[numTeams] = upper;
+    counts[numTeams] = upperCount;
+
+    // The brackets were tightened independently, so enforce monotonicity
+    for( Int i=1; i<=numTeams; ++i )
+    {
+        if( cuts[i] < cuts[i-1] )
+        {
+            cuts[i] = cuts[i-1];
+            counts[i] = counts[i-1];
+        }
+    }
+}
+
+template<typename F>
+inline void
+Solve
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& w,
+  DistMatrix<F>& Z, BASE(F) lower, BASE(F) upper, bool window,
+  Int numSlices, Int maxRounds, bool progress )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_eig::slice::Solve"))
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int p = g.Size();
+    if( numSlices <= 0 )
+        numSlices = Max( Int(Sqrt(Real(p))), Int(1) );
+    numSlices = Min( numSlices, p );
+
+    // Push a copy of A to each team
+    std::vector<const Grid*> teamGrids;
+    SplitIntoTeams( numSlices, g, teamGrids, progress );
+    const Int myTeam = TeamOf( g.Rank(), numSlices, p );
+    const Grid& myTeamGrid = *teamGrids[myTeam];
+    DistMatrix<F> APush( myTeamGrid );
+    for( Int t=0; t<numSlices; ++t )
+    {
+        if( t == myTeam )
+            APush = A;
+        else
+        {
+            DistMatrix<F> ATmp( *teamGrids[t] );
+            ATmp = A;
+        }
+    }
+
+    // The viewing communicator of each team grid spans the entire original
+    // grid, and routines such as HermitianTridiag create subgrids over the
+    // viewing communicator, so each team performs its work on a grid which 
+    // is only viewed by the team itself
+    mpi::Comm teamComm;
+    mpi::CommSplit( g.Comm(), myTeam, g.Rank(), teamComm );
+    const Grid teamGrid( teamComm, myTeamGrid.Height() );
+    mpi::CommFree( teamComm );
+    DistMatrix<F> ASub( teamGrid );
+    ASub = APush;
+    APush.Empty();
+    const bool teamRoot = ( teamGrid.Rank() == 0 );
+
+    // Count the eigenvalues at the ends of the window
+    Int lowerCount=0, upperCount=n;
+    if( window )
+    {
+        std::vector<Int> endCounts(2,0);
+        const Int lowerTeam = 0;
+        const Int upperTeam = ( numSlices > 1 ? 1 : 0 );
+        if( myTeam == lowerTeam )
+        {
+            const Int count = NumAtMost( uplo, ASub, lower );
+            if( teamRoot )
+                endCounts[0] = count;
+        }
+        if( myTeam == upperTeam )
+        {
+            const Int count = NumAtMost( uplo, ASub, upper );
+            if( teamRoot )
+                endCounts[1] = count;
+        }
+        mpi::AllReduce( endCounts.data(), 2, mpi::SUM, g.Comm() );
+        lowerCount = endCounts[0];
+        upperCount = endCounts[1];
+    }
+
+    std::vector<Real> cuts;
+    std::vector<Int> counts;
+    FindCuts
+    ( uplo, ASub, myTeam, numSlices, g, lower, upper, lowerCount, upperCount,
+      cuts, counts, maxRounds, progress );
+    if( progress && g.Rank() == 0 )
+        for( Int t=0; t<numSlices; ++t )
+            std::cout << "Slice " << t << ": (" << cuts[t] << ","
+                      << cuts[t+1] << "] with " << counts[t+1]-counts[t]
+                      << " eigenvalues" << std::endl;
+
+    // Solve each slice on its team
+    DistMatrix<Real,VR,STAR> wSub( teamGrid );
+    DistMatrix<F> ZSub( teamGrid );
+    HermitianEig
+    ( uplo, ASub, wSub, ZSub, cuts[myTeam], cuts[myTeam+1], ASCENDING );
+    ASub.Empty();
+
+    // The inertia counts are only used to balance the slices; the number of
+    // computed eigenpairs in each slice is what is used for reassembly
+    std::vector<Int> widths(numSlices,0), offsets(numSlices+1,0);
+    if( teamRoot )
+        widths[myTeam] = ZSub.Width();
+    mpi::AllReduce( widths.data(), numSlices, mpi::SUM, g.Comm() );
+    for( Int t=0; t<numSlices; ++t )
+        offsets[t+1] = offsets[t] + widths[t];
+    const Int k = offsets[numSlices];
+
+    // Gather the eigenvalues
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR( k, 1, g );
+    MakeZeros( w_STAR_STAR );
+    {
+        DistMatrix<Real,STAR,STAR> wSub_STAR_STAR( wSub );
+        if( teamRoot )
+            MemCopy
+            ( w_STAR_STAR.Buffer(offsets[myTeam],0),
+              wSub_STAR_STAR.LockedBuffer(), widths[myTeam] );
+    }
+    mpi::AllReduce( w_STAR_STAR.Buffer(), k, mpi::SUM, g.Comm() );
+    w = w_STAR_STAR;
+
+    // Pull the eigenvectors back to the original grid
+    DistMatrix<F> ZPull( myTeamGrid );
+    ZPull = ZSub;
+    ZSub.Empty();
+    Z.Resize( n, k );
+    for( Int t=0; t<numSlices; ++t )
+    {
+        DistMatrix<F> Zt( g );
+        if( t == myTeam )
+        {
+            ZPull.MakeConsistent();
+            Zt = ZPull;
+        }
+        else
+        {
+            DistMatrix<F> ZTmp( *teamGrids[t] );
+            ZTmp.MakeConsistent();
+            Zt = ZTmp;
+        }
+        auto ZSlice = View( Z, 0, offsets[t], n, widths[t] );
+        ZSlice = Zt;
+    }
+    ZPull.Empty();
+    wSub.Empty();
+    FreeTeamGrids( teamGrids );
+}
+
+} // namespace slice
+
+// Compute the full eigenvalue decomposition of a Hermitian matrix by
+// splitting its spectrum into numSlices pieces which are solved on disjoint
+// subsets of the process grid. If numSlices=0, roughly sqrt(p) slices are
+// used. Each round of the search for the slice endpoints requires one
+// pivoted LDL^H factorization per team.
+template<typename F>
+inline void
+SpectrumSlicing
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& w,
+  DistMatrix<F>& Z, Int numSlices=0, Int maxRounds=20, bool progress=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_eig::SpectrumSlicing");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    typedef Base<F> Real;
+    if( numSlices == 1 || A.Grid().Size() == 1 )
+    {
+        HermitianEig( uplo, A, w, Z, ASCENDING );
+        return;
+    }
+    // The one-norm bounds the spectral radius, so pad it to obtain an
+    // interval whose interior contains the entire spectrum
+    Real bound = 2*HermitianOneNorm( uplo, A );
+    if( bound == Real(0) )
+        bound = 1;
+    slice::Solve
+    ( uplo, A, w, Z, -bound, bound, false, numSlices, maxRounds, progress );
+}
+
+// Compute the eigenpairs with eigenvalues in the window (lower,upper]
+template<typename F>
+inline void
+SpectrumSlicing
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& w,
+  DistMatrix<F>& Z, BASE(F) lower, BASE(F) upper,
+  Int numSlices=0, Int maxRounds=20, bool progress=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_eig::SpectrumSlicing");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+        if( lower >= upper )
+            LogicError("Invalid window");
+    )
+    if( numSlices == 1 || A.Grid().Size() == 1 )
+    {
+        HermitianEig( uplo, A, w, Z, lower, upper, ASCENDING );
+        return;
+    }
+    slice::Solve
+    ( uplo, A, w, Z, lower, upper, true, numSlices, maxRounds, progress );
+}
+
+} // namespace herm_eig
+} // namespace elem
+
+#endif // ifndef ELEM_HERMITIANEIG_SPECTRUMSLICING_HPP
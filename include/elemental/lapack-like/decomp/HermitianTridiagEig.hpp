@@ -11,6 +11,8 @@
 #define ELEM_HERMITIANTRIDIAGEIG_HPP
 
 #include ELEM_HERMITIANTRIDIAGEIG_SORT_INC
+#include ELEM_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_INC
+#include ELEM_HERMITIANTRIDIAGEIG_SINGLEPRECISION_INC
 
 // NOTE: eReal and ZReal could be packed into their complex counterparts
 
@@ -499,12 +501,25 @@ HermitianTridiagEig
 ( const DistMatrix<BASE(F),U1,V1  >& d,
   const DistMatrix<F,      U2,V2  >& e,
         DistMatrix<BASE(F),U3,STAR>& w, 
-        DistMatrix<F,      U4,V4  >& Z, SortType sort )
+        DistMatrix<F,      U4,V4  >& Z, SortType sort, 
+  HermitianTridiagEigAlg alg=HERMITIAN_TRIDIAG_EIG_MRRR )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianTridiagEig"))
-    DistMatrix<F,STAR,U3> Z_STAR_U3( Z );
-    HermitianTridiagEig( d, e, w, Z_STAR_U3, sort );
-    Z = Z_STAR_U3;
+    if( alg == HERMITIAN_TRIDIAG_EIG_DC )
+    {
+        // The divide and conquer eigenvalues are returned in ascending order
+        DistMatrix<F,VC,STAR> Z_VC_STAR( Z.Grid() );
+        herm_tridiag_eig::DivideAndConquer( d, e, w, Z_VC_STAR );
+        if( sort == DESCENDING )
+            herm_eig::Sort( w, Z_VC_STAR, sort );
+        Z = Z_VC_STAR;
+    }
+    else
+    {
+        DistMatrix<F,STAR,U3> Z_STAR_U3( Z );
+        HermitianTridiagEig( d, e, w, Z_STAR_U3, sort );
+        Z = Z_STAR_U3;
+    }
 }
 
 // Return an index range of eigenpairs
@@ -0,0 +1,447 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_HPP
+#define ELEM_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_HPP
+
+#include ELEM_DECOMP_DECL_INC
+#include ELEM_GEMM_INC
+#include ELEM_ZEROS_INC
+
+// This is a distributed-memory version of Cuppen's divide and conquer
+// algorithm for the symmetric tridiagonal eigenvalue problem, following the
+// structure of LAPACK's {s,d}stedc: the tridiagonal matrix is recursively torn
+// into two halves with a rank-one modification, the subproblems are solved
+// independently, and the eigenpairs of each rank-one modification are
+// computed via the secular equation. Deflation follows {s,d}laed2, and the
+// eigenvectors of the secular equation are computed with the Gu/Eisenstat
+// (Loewner) approach from {s,d}laed3 in order to maintain orthogonality.
+//
+// The eigenvectors are stored in a [VC,* ] distribution so that the
+// deflating Givens rotations and the gathering of the rank-one update vector
+// are purely local, while the eigenvectors of each merge are backtransformed
+// with [MC,MR] distributed Gemm's which exploit the block structure of the
+// columns of the eigenvector matrices of the two subproblems.
+
+namespace elem {
+namespace herm_tridiag_eig {
+
+namespace dc {
+
+// Solve a small subproblem redundantly and store our rows of its eigenvectors
+template<typename Real>
+inline void
+Leaf
+( Int n, const Real* d, const Real* e, Real* w, DistMatrix<Real,VC,STAR>& Z )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::dc::Leaf"))
+    std::vector<Real> dCopy( d, d+n ), eCopy( n, 0 ), ZLeaf( n*n );
+    MemCopy( eCopy.data(), e, n-1 );
+    lapack::SymmetricTridiagEig
+    ( 'V', 'A', n, dCopy.data(), eCopy.data(), 0, 0, 0, 0, Real(0),
+      w, ZLeaf.data(), n );
+
+    const Int localHeight = Z.LocalHeight();
+    const Int colShift = Z.ColShift();
+    const Int colStride = Z.ColStride();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = colShift + iLoc*colStride;
+        for( Int j=0; j<n; ++j )
+            Z.SetLocal( iLoc, j, ZLeaf[i+j*n] );
+    }
+}
+
+// Given the eigenpairs of the two halves, (w(0:n1-1),Z(0:n1-1,0:n1-1)) and
+// (w(n1:n-1),Z(n1:n-1,n1:n-1)), of a tridiagonal matrix which was torn apart
+// by the off-diagonal entry beta, compute the eigenpairs of the full matrix
+template<typename Real>
+inline void
+Merge( Int n1, Real beta, Real* w, DistMatrix<Real,VC,STAR>& Z )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::dc::Merge"))
+    const Grid& g = Z.Grid();
+    const Int n = Z.Height();
+    const Int n2 = n - n1;
+    const Int localHeight = Z.LocalHeight();
+    const Int colShift = Z.ColShift();
+    const Int colStride = Z.ColStride();
+    const Int ldZ = Z.LDim();
+    Real* ZBuf = Z.Buffer();
+
+    // Form the rank-one update vector from the last row of the top
+    // eigenvectors and the first row of the bottom eigenvectors
+    const Real sgn = ( beta >= Real(0) ? Real(1) : Real(-1) );
+    Real rho = Abs(beta);
+    std::vector<Real> z( n, 0 );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = colShift + iLoc*colStride;
+        if( i == n1-1 )
+            for( Int j=0; j<n1; ++j )
+                z[j] = ZBuf[iLoc+j*ldZ];
+        else if( i == n1 )
+            for( Int j=n1; j<n; ++j )
+                z[j] = sgn*ZBuf[iLoc+j*ldZ];
+    }
+    mpi::AllReduce( z.data(), n, mpi::SUM, Z.DistComm() );
+    const Real zNorm = blas::Nrm2( n, z.data(), 1 );
+    blas::Scal( n, 1/zNorm, z.data(), 1 );
+    rho *= zNorm*zNorm;
+
+    // Sort the diagonal of the rank-one modification and keep track of
+    // whether each column is nonzero in the top half (1), the bottom half (3),
+    // or, after deflation rotations, both (2)
+    std::vector<ValueInt<Real>> pairs( n );
+    for( Int j=0; j<n; ++j )
+    {
+        pairs[j].value = w[j];
+        pairs[j].index = j;
+    }
+    std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
+    std::vector<Real> D( n ), zSort( n );
+    std::vector<Int> col( n ), type( n );
+    Real dMax=0, zMax=0;
+    for( Int t=0; t<n; ++t )
+    {
+        col[t] = pairs[t].index;
+        D[t] = pairs[t].value;
+        zSort[t] = z[col[t]];
+        type[t] = ( col[t] < n1 ? 1 : 3 );
+        dMax = Max( dMax, Abs(D[t]) );
+        zMax = Max( zMax, Abs(zSort[t]) );
+    }
+
+    // Deflate the components of z which are negligible as well as pairs of
+    // nearly identical diagonal entries
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real tol = 8*eps*Max(dMax,zMax);
+    std::vector<Int> nondeflated, deflated;
+    Int pj = -1;
+    for( Int t=0; t<n; ++t )
+    {
+        if( rho*Abs(zSort[t]) <= tol )
+        {
+            deflated.push_back( t );
+            continue;
+        }
+        if( pj < 0 )
+        {
+            pj = t;
+            continue;
+        }
+        Real s = zSort[pj];
+        Real c = zSort[t];
+        const Real tau = lapack::SafeNorm( c, s );
+        const Real gap = D[t] - D[pj];
+        c /= tau;
+        s = -s/tau;
+        if( Abs(gap*c*s) <= tol )
+        {
+            zSort[t] = tau;
+            zSort[pj] = 0;
+            if( type[pj] != type[t] )
+                type[t] = 2;
+            if( localHeight > 0 )
+                blas::Rot
+                ( localHeight, &ZBuf[col[pj]*ldZ], 1, &ZBuf[col[t]*ldZ], 1,
+                  c, s );
+            const Real dPJ = D[pj]*c*c + D[t]*s*s;
+            D[t] = D[pj]*s*s + D[t]*c*c;
+            D[pj] = dPJ;
+            deflated.push_back( pj );
+        }
+        else
+            nondeflated.push_back( pj );
+        pj = t;
+    }
+    if( pj >= 0 )
+        nondeflated.push_back( pj );
+    const Int k = nondeflated.size();
+
+    std::vector<Real> lambda( k, 0 );
+    DistMatrix<Real,VC,STAR> ZMerge( g );
+    ZMerge.AlignWith( Z );
+    ZMerge.Resize( n, k );
+    if( k > 0 )
+    {
+        std::vector<Real> dSec( k ), zSec( k );
+        for( Int q=0; q<k; ++q )
+        {
+            dSec[q] = D[nondeflated[q]];
+            zSec[q] = zSort[nondeflated[q]];
+        }
+
+        // Solve the secular equation for our columns of its eigenvectors
+        // and accumulate our contribution to the Loewner products
+        DistMatrix<Real,STAR,VR> S( k, k, g );
+        const Int SLocalWidth = S.LocalWidth();
+        const Int SRowShift = S.RowShift();
+        const Int SRowStride = S.RowStride();
+        std::vector<Real> zProd( k, 1 );
+        for( Int qLoc=0; qLoc<SLocalWidth; ++qLoc )
+        {
+            const Int q = SRowShift + qLoc*SRowStride;
+            Real* delta = S.Buffer(0,qLoc);
+            if( k == 1 )
+            {
+                lambda[q] = dSec[0] + rho*zSec[0]*zSec[0];
+                delta[0] = 1;
+                continue;
+            }
+            lambda[q] = lapack::SecularEigenvalue
+              ( k, q, dSec.data(), zSec.data(), rho, delta );
+            if( k > 2 )
+                for( Int i=0; i<k; ++i )
+                    zProd[i] *=
+                      ( i==q ? delta[i] : delta[i]/(dSec[i]-dSec[q]) );
+        }
+        mpi::AllReduce( lambda.data(), k, mpi::SUM, S.DistComm() );
+
+        // For k=2, the secular solver directly returns the eigenvectors
+        if( k > 2 )
+        {
+            mpi::AllReduce( zProd.data(), k, mpi::PROD, S.DistComm() );
+            for( Int i=0; i<k; ++i )
+            {
+                const Real zHat = Sqrt(-zProd[i]);
+                zProd[i] = ( zSec[i] >= Real(0) ? zHat : -zHat );
+            }
+            for( Int qLoc=0; qLoc<SLocalWidth; ++qLoc )
+            {
+                Real* delta = S.Buffer(0,qLoc);
+                for( Int i=0; i<k; ++i )
+                    delta[i] = zProd[i] / delta[i];
+                const Real deltaNorm = blas::Nrm2( k, delta, 1 );
+                blas::Scal( k, 1/deltaNorm, delta, 1 );
+            }
+        }
+
+        // Group the nondeflated columns by their nonzero structure
+        std::vector<Int> order;
+        Int kTop=0, kMixed=0;
+        for( Int colType=1; colType<=3; ++colType )
+        {
+            for( Int q=0; q<k; ++q )
+                if( type[nondeflated[q]] == colType )
+                    order.push_back( q );
+            if( colType == 1 )
+                kTop = order.size();
+            else if( colType == 2 )
+                kMixed = order.size() - kTop;
+        }
+        const Int kBottom = k - kTop - kMixed;
+        DistMatrix<Real,VC,STAR> QGroup( g );
+        QGroup.AlignWith( Z );
+        QGroup.Resize( n, k );
+        for( Int q=0; q<k; ++q )
+            MemCopy
+            ( QGroup.Buffer(0,q),
+              &ZBuf[col[nondeflated[order[q]]]*ldZ], localHeight );
+        DistMatrix<Real,STAR,VR> SGroup( g );
+        SGroup.AlignWith( S );
+        SGroup.Resize( k, k );
+        for( Int qLoc=0; qLoc<SLocalWidth; ++qLoc )
+            for( Int q=0; q<k; ++q )
+                SGroup.SetLocal( q, qLoc, S.GetLocal(order[q],qLoc) );
+
+        // Backtransform the top and bottom halves separately so that the
+        // zero blocks of the grouped eigenvectors are skipped
+        DistMatrix<Real> Q_MC_MR( QGroup ), S_MC_MR( SGroup ), ZNew( g );
+        Zeros( ZNew, n, k );
+        if( kTop+kMixed > 0 )
+        {
+            auto ZNewT = View( ZNew, 0, 0, n1, k );
+            Gemm
+            ( NORMAL, NORMAL,
+              Real(1), LockedView( Q_MC_MR, 0, 0, n1, kTop+kMixed ),
+                       LockedView( S_MC_MR, 0, 0, kTop+kMixed, k ),
+              Real(0), ZNewT );
+        }
+        if( kMixed+kBottom > 0 )
+        {
+            auto ZNewB = View( ZNew, n1, 0, n2, k );
+            Gemm
+            ( NORMAL, NORMAL,
+              Real(1), LockedView( Q_MC_MR, n1, kTop, n2, kMixed+kBottom ),
+                       LockedView( S_MC_MR, kTop, 0, kMixed+kBottom, k ),
+              Real(0), ZNewB );
+        }
+        ZMerge = ZNew;
+    }
+
+    // Merge the deflated and nondeflated eigenpairs into ascending order
+    std::vector<ValueInt<Real>> merged;
+    merged.reserve( n );
+    for( Int q=0; q<k; ++q )
+    {
+        ValueInt<Real> pair;
+        pair.value = lambda[q];
+        pair.index = q;
+        merged.push_back( pair );
+    }
+    for( Int t : deflated )
+    {
+        ValueInt<Real> pair;
+        pair.value = D[t];
+        pair.index = k+t;
+        merged.push_back( pair );
+    }
+    std::sort( merged.begin(), merged.end(), ValueInt<Real>::Lesser );
+    Matrix<Real> ZLoc( localHeight, n );
+    for( Int j=0; j<n; ++j )
+    {
+        const Int source = merged[j].index;
+        const Real* sourceCol =
+          ( source < k ? ZMerge.LockedBuffer(0,source)
+                       : &ZBuf[col[source-k]*ldZ] );
+        MemCopy( ZLoc.Buffer(0,j), sourceCol, localHeight );
+        w[j] = merged[j].value;
+    }
+    for( Int j=0; j<n; ++j )
+        MemCopy( &ZBuf[j*ldZ], ZLoc.LockedBuffer(0,j), localHeight );
+}
+
+template<typename Real>
+inline void
+Recurse
+( Int n, Real* d, const Real* e, Real* w, DistMatrix<Real,VC,STAR>& Z,
+  Int cutoff )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::dc::Recurse"))
+    if( n <= cutoff )
+    {
+        Leaf( n, d, e, w, Z );
+        return;
+    }
+
+    // Tear the tridiagonal matrix into two halves with a rank-one update
+    const Int n1 = n/2;
+    const Int n2 = n - n1;
+    const Real beta = e[n1-1];
+    d[n1-1] -= Abs(beta);
+    d[n1  ] -= Abs(beta);
+
+    auto ZTL = View( Z, 0,  0,  n1, n1 );
+    auto ZBR = View( Z, n1, n1, n2, n2 );
+    Recurse( n1, d,    e,    w,    ZTL, cutoff );
+    Recurse( n2, d+n1, e+n1, w+n1, ZBR, cutoff );
+    Merge( n1, beta, w, Z );
+}
+
+} // namespace dc
+
+// Compute the full set of eigenpairs of the real symmetric tridiagonal matrix
+// with diagonal d and subdiagonal e. The eigenvalues are redundantly stored in
+// w in ascending order.
+template<typename Real>
+inline void
+DivideAndConquer
+( Int n, const Real* d, const Real* e, Real* w, DistMatrix<Real,VC,STAR>& Z,
+  Int cutoff=64 )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_tridiag_eig::DivideAndConquer");
+        if( cutoff < 1 )
+            LogicError("Cutoff must be positive");
+    )
+    Zeros( Z, n, n );
+    if( n == 0 )
+        return;
+
+    // Scale the matrix so that its largest entry has unit magnitude
+    Real scale = 0;
+    for( Int j=0; j<n; ++j )
+        scale = Max( scale, Abs(d[j]) );
+    for( Int j=0; j<n-1; ++j )
+        scale = Max( scale, Abs(e[j]) );
+    if( scale == Real(0) )
+        scale = 1;
+    std::vector<Real> dScaled( n ), eScaled( Max(n-1,1) );
+    for( Int j=0; j<n; ++j )
+        dScaled[j] = d[j]/scale;
+    for( Int j=0; j<n-1; ++j )
+        eScaled[j] = e[j]/scale;
+
+    dc::Recurse( n, dScaled.data(), eScaled.data(), w, Z, cutoff );
+    for( Int j=0; j<n; ++j )
+        w[j] *= scale;
+}
+
+template<typename Real,Dist U1,Dist V1,Dist U2,Dist V2,Dist U3>
+inline void
+DivideAndConquer
+( const DistMatrix<Real,U1,V1  >& d,
+  const DistMatrix<Real,U2,V2  >& e,
+        DistMatrix<Real,U3,STAR>& w,
+        DistMatrix<Real,VC,STAR>& Z, Int cutoff=64 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::DivideAndConquer"))
+    const Int n = d.Height();
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d ), e_STAR_STAR( e );
+    std::vector<Real> wVector( n );
+    DivideAndConquer
+    ( n, d_STAR_STAR.LockedBuffer(), e_STAR_STAR.LockedBuffer(),
+      wVector.data(), Z, cutoff );
+
+    w.Resize( n, 1 );
+    const Int colShift = w.ColShift();
+    const Int colStride = w.ColStride();
+    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
+        w.SetLocal( iLoc, 0, wVector[colShift+iLoc*colStride] );
+}
+
+template<typename Real,Dist U1,Dist V1,Dist U2,Dist V2,Dist U3>
+inline void
+DivideAndConquer
+( const DistMatrix<Real,         U1,V1  >& d,
+  const DistMatrix<Complex<Real>,U2,V2  >& e,
+        DistMatrix<Real,         U3,STAR>& w,
+        DistMatrix<Complex<Real>,VC,STAR>& Z, Int cutoff=64 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::DivideAndConquer"))
+    typedef Complex<Real> C;
+    const Int n = d.Height();
+    const Grid& g = d.Grid();
+
+    // Reduce to a real symmetric tridiagonal matrix with a diagonal unitary
+    // similarity transformation
+    DistMatrix<C,STAR,STAR> e_STAR_STAR( e );
+    DistMatrix<Real,STAR,STAR> eReal( Max(n-1,0), 1, g );
+    std::vector<C> y( n );
+    if( n > 0 )
+        y[0] = 1;
+    for( Int j=0; j<n-1; ++j )
+    {
+        const C psi = e_STAR_STAR.GetLocal(j,0);
+        const Real psiAbs = Abs(psi);
+        if( psiAbs == Real(0) )
+            y[j+1] = 1;
+        else
+            y[j+1] = Polar(Real(1),Arg(psi*y[j]));
+        eReal.SetLocal( j, 0, psiAbs );
+    }
+
+    DistMatrix<Real,VC,STAR> ZReal( g );
+    DivideAndConquer( d, eReal, w, ZReal, cutoff );
+
+    Z.AlignWith( ZReal );
+    Z.Resize( n, n );
+    const Int colShift = Z.ColShift();
+    const Int colStride = Z.ColStride();
+    for( Int j=0; j<n; ++j )
+        for( Int iLoc=0; iLoc<Z.LocalHeight(); ++iLoc )
+            Z.SetLocal
+            ( iLoc, j, y[colShift+iLoc*colStride]*ZReal.GetLocal(iLoc,j) );
+}
+
+} // namespace herm_tridiag_eig
+} // namespace elem
+
+#endif // ifndef ELEM_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_HPP
@@ -0,0 +1,221 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_HERMITIANTRIDIAGEIG_SINGLEPRECISION_HPP
+#define ELEM_HERMITIANTRIDIAGEIG_SINGLEPRECISION_HPP
+
+#include ELEM_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_INC
+
+// PMRRR only supports double-precision, so these routines provide the same
+// interface as the PMRRR bridge in core/imports/pmrrr.hpp for single-precision
+// tridiagonal matrices. Each process is assigned the same number of
+// eigenpairs as PMRRR would assign, i.e., Length(k,rank,p), so that the
+// callers may treat the results identically.
+//
+// Eigenvalues are computed by having each process find a contiguous subset
+// of the eigenvalues with LAPACK. When the entire spectrum is requested, the
+// eigenvectors are computed with the distributed divide and conquer algorithm
+// in order to guarantee numerical orthogonality between the eigenvectors
+// owned by different processes. A subset of the eigenpairs is instead
+// computed redundantly by every process with LAPACK's MRRR (sstevr), which
+// only requires O(n k) work for k eigenpairs, so that all of the eigenvectors
+// still come from a single, orthogonal, computation.
+
+namespace elem {
+namespace herm_tridiag_eig {
+
+namespace single_prec {
+
+// Return the number of eigenvalues less than sigma using Sturm sequences
+inline int
+NumLessThan( int n, const float* d, const float* e, float sigma )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_tridiag_eig::single_prec::NumLessThan")
+    )
+    const float safeMin = lapack::MachineSafeMin<float>();
+    int numLess = 0;
+    float q = 1;
+    for( int j=0; j<n; ++j )
+    {
+        q = d[j] - sigma - ( j==0 ? 0 : e[j-1]*e[j-1]/q );
+        if( Abs(q) < safeMin )
+            q = -safeMin;
+        if( q < 0 )
+            ++numLess;
+    }
+    return numLess;
+}
+
+// Compute our contiguous portion of the eigenvalues with indices in [il,iu]
+inline Info
+Eigenvalues
+( int n, const float* d, const float* e, float* w, mpi::Comm comm,
+  int il, int iu )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_tridiag_eig::single_prec::Eigenvalues")
+    )
+    const int k = Max(iu-il+1,0);
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+    int offset = 0;
+    for( int q=0; q<commRank; ++q )
+        offset += Length( k, q, commSize );
+    const int kLocal = Length( k, commRank, commSize );
+
+    Info info;
+    info.numLocalEigenvalues = kLocal;
+    info.numGlobalEigenvalues = k;
+    info.firstLocalEigenvalue = il + offset;
+    if( kLocal > 0 )
+    {
+        std::vector<float> dCopy( d, d+n ), eCopy( n, 0 );
+        MemCopy( eCopy.data(), e, n-1 );
+        const int ilLocal = il + offset;
+        const int iuLocal = ilLocal + kLocal - 1;
+        lapack::SymmetricTridiagEig
+        ( 'N', 'I', n, dCopy.data(), eCopy.data(), 0, 0,
+          ilLocal+1, iuLocal+1, 0, w, 0, 1 );
+    }
+    return info;
+}
+
+// Compute the eigenpairs with indices in [il,iu] and keep those with indices
+// il, il+p, il+2p, ... offset by our rank
+inline Info
+Eigenpairs
+( int n, const float* d, const float* e, float* w, float* Z, int ldz,
+  mpi::Comm comm, int il, int iu )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("herm_tridiag_eig::single_prec::Eigenpairs")
+    )
+    const int k = Max(iu-il+1,0);
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+    const int kLocal = Length( k, commRank, commSize );
+
+    if( k < n )
+    {
+        // Every process computes the same subset of the eigenpairs
+        std::vector<float> dCopy( d, d+n ), eCopy( n, 0 ), wSub( n ),
+                           ZSub( n*k );
+        MemCopy( eCopy.data(), e, n-1 );
+        if( k > 0 )
+            lapack::SymmetricTridiagEig
+            ( 'V', 'I', n, dCopy.data(), eCopy.data(), 0, 0, il+1, iu+1, 0,
+              wSub.data(), ZSub.data(), n );
+        for( int jLoc=0; jLoc<kLocal; ++jLoc )
+        {
+            const int j = commRank + jLoc*commSize;
+            w[jLoc] = wSub[j];
+            MemCopy( &Z[jLoc*ldz], &ZSub[j*n], n );
+        }
+    }
+    else
+    {
+        // The VC rank of each process in a grid over comm is its rank in comm
+        const Grid g( comm );
+        std::vector<float> wAll( n );
+        DistMatrix<float,VC,STAR> Z_VC_STAR( g );
+        DivideAndConquer( n, d, e, wAll.data(), Z_VC_STAR );
+        DistMatrix<float,STAR,VC> Z_STAR_VC( Z_VC_STAR );
+        Z_VC_STAR.Empty();
+        for( int jLoc=0; jLoc<kLocal; ++jLoc )
+        {
+            w[jLoc] = wAll[commRank+jLoc*commSize];
+            MemCopy( &Z[jLoc*ldz], Z_STAR_VC.LockedBuffer(0,jLoc), n );
+        }
+    }
+
+    Info info;
+    info.numLocalEigenvalues = kLocal;
+    info.numGlobalEigenvalues = k;
+    info.firstLocalEigenvalue = il + commRank;
+    return info;
+}
+
+} // namespace single_prec
+
+// Return the number of eigenvalues in the given range, (lowerBound,upperBound]
+inline Estimate
+EigEstimate
+( int n, float* d, float* e, float* w, mpi::Comm comm,
+  float lowerBound, float upperBound )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::EigEstimate"))
+    const int il = single_prec::NumLessThan( n, d, e, lowerBound );
+    const int iu = single_prec::NumLessThan( n, d, e, upperBound ) - 1;
+    Estimate estimate;
+    estimate.numGlobalEigenvalues = Max(iu-il+1,0);
+    estimate.numLocalEigenvalues =
+      Length
+      ( estimate.numGlobalEigenvalues, mpi::CommRank(comm),
+        mpi::CommSize(comm) );
+    return estimate;
+}
+
+// Compute all of the eigenvalues
+inline Info
+Eig( int n, float* d, float* e, float* w, mpi::Comm comm )
+{ return single_prec::Eigenvalues( n, d, e, w, comm, 0, n-1 ); }
+
+// Compute all of the eigenpairs
+inline Info
+Eig( int n, float* d, float* e, float* w, float* Z, int ldz, mpi::Comm comm )
+{ return single_prec::Eigenpairs( n, d, e, w, Z, ldz, comm, 0, n-1 ); }
+
+// Compute all of the eigenvalues in (lowerBound,upperBound]
+inline Info
+Eig
+( int n, float* d, float* e, float* w, mpi::Comm comm,
+  float lowerBound, float upperBound )
+{
+    const int il = single_prec::NumLessThan( n, d, e, lowerBound );
+    const int iu = single_prec::NumLessThan( n, d, e, upperBound ) - 1;
+    return single_prec::Eigenvalues( n, d, e, w, comm, il, iu );
+}
+
+// Compute all of the eigenpairs with eigenvalues in (lowerBound,upperBound]
+inline Info
+Eig
+( int n, float* d, float* e, float* w, float* Z, int ldz, mpi::Comm comm,
+  float lowerBound, float upperBound )
+{
+    const int il = single_prec::NumLessThan( n, d, e, lowerBound );
+    const int iu = single_prec::NumLessThan( n, d, e, upperBound ) - 1;
+    return single_prec::Eigenpairs( n, d, e, w, Z, ldz, comm, il, iu );
+}
+
+// Compute all of the eigenvalues with indices in [lowerBound,upperBound]
+inline Info
+Eig
+( int n, float* d, float* e, float* w, mpi::Comm comm,
+  int lowerBound, int upperBound )
+{
+    return single_prec::Eigenvalues
+           ( n, d, e, w, comm, lowerBound, upperBound );
+}
+
+// Compute all of the eigenpairs with ordered eigenvalue indices in
+// [lowerBound,upperBound]
+inline Info
+Eig
+( int n, float* d, float* e, float* w, float* Z, int ldz, mpi::Comm comm,
+  int lowerBound, int upperBound )
+{
+    return single_prec::Eigenpairs
+           ( n, d, e, w, Z, ldz, comm, lowerBound, upperBound );
+}
+
+} // namespace herm_tridiag_eig
+} // namespace elem
+
+#endif // ifndef ELEM_HERMITIANTRIDIAGEIG_SINGLEPRECISION_HPP
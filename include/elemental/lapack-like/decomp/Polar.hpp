@@ -10,62 +10,133 @@
 #ifndef ELEM_POLAR_HPP
 #define ELEM_POLAR_HPP
 
+#include ELEM_MAKEHERMITIAN_INC
 #include ELEM_SIGN_INC
 
 #include "./Polar/QDWH.hpp"
 #include "./Polar/SVD.hpp"
+#include "./Polar/Zolotarev.hpp"
 
 namespace elem {
 
 // Compute the polar decomposition of A, A = Q P, where Q is unitary and P is 
-// Hermitian positive semi-definite. On exit, A is overwritten with Q.
+// Hermitian positive semi-definite. On exit, A is overwritten with Q. The
+// iterative algorithms, QDWH and Zolotarev, only require dense linear algebra
+// (QR and Cholesky factorizations) and are often faster than an SVD.
 
 template<typename F>
 inline void
-Polar( Matrix<F>& A, Matrix<F>& P )
+Polar( Matrix<F>& A, Matrix<F>& P, PolarAlg alg=POLAR_SVD )
 {
     DEBUG_ONLY(CallStackEntry cse("Polar"))
-    polar::SVD( A, P );
+    switch( alg )
+    {
+    case POLAR_QDWH:
+        polar::QDWH( A, P );
+        break;
+    case POLAR_ZOLOTAREV:
+        polar::Zolotarev( A, P );
+        break;
+    default:
+        polar::SVD( A, P );
+    }
 }
 
 template<typename F>
 inline void
-Polar( DistMatrix<F>& A, DistMatrix<F>& P )
+Polar( DistMatrix<F>& A, DistMatrix<F>& P, PolarAlg alg=POLAR_SVD )
 {
     DEBUG_ONLY(CallStackEntry cse("Polar"))
-    polar::SVD( A, P );
+    switch( alg )
+    {
+    case POLAR_QDWH:
+        polar::QDWH( A, P );
+        break;
+    case POLAR_ZOLOTAREV:
+        polar::Zolotarev( A, P );
+        break;
+    default:
+        polar::SVD( A, P );
+    }
 }
 
 template<typename F>
 inline void
-HermitianPolar( UpperOrLower uplo, Matrix<F>& A )
+HermitianPolar( UpperOrLower uplo, Matrix<F>& A, PolarAlg alg=POLAR_SVD )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianPolar"))
-    HermitianSign( uplo, A );
+    switch( alg )
+    {
+    case POLAR_QDWH:
+        herm_polar::QDWH( uplo, A );
+        break;
+    case POLAR_ZOLOTAREV:
+        herm_polar::Zolotarev( uplo, A );
+        break;
+    default:
+        HermitianSign( uplo, A );
+    }
 }
 
 template<typename F>
 inline void
-HermitianPolar( UpperOrLower uplo, DistMatrix<F>& A )
+HermitianPolar( UpperOrLower uplo, DistMatrix<F>& A, PolarAlg alg=POLAR_SVD )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianPolar"))
-    HermitianSign( uplo, A );
+    switch( alg )
+    {
+    case POLAR_QDWH:
+        herm_polar::QDWH( uplo, A );
+        break;
+    case POLAR_ZOLOTAREV:
+        herm_polar::Zolotarev( uplo, A );
+        break;
+    default:
+        HermitianSign( uplo, A );
+    }
 }
 
 template<typename F>
 inline void
-HermitianPolar( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& P )
+HermitianPolar
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& P, PolarAlg alg=POLAR_SVD )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianPolar"))
-    HermitianSign( uplo, A, P );
+    switch( alg )
+    {
+    case POLAR_QDWH:
+        herm_polar::QDWH( uplo, A, P );
+        MakeHermitian( uplo, P );
+        break;
+    case POLAR_ZOLOTAREV:
+        herm_polar::Zolotarev( uplo, A, P );
+        MakeHermitian( uplo, P );
+        break;
+    default:
+        HermitianSign( uplo, A, P );
+    }
 }
 
 template<typename F>
 inline void
-HermitianPolar( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& P )
+HermitianPolar
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& P,
+  PolarAlg alg=POLAR_SVD )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianPolar"))
-    HermitianSign( uplo, A, P );
+    switch( alg )
+    {
+    case POLAR_QDWH:
+        herm_polar::QDWH( uplo, A, P );
+        MakeHermitian( uplo, P );
+        break;
+    case POLAR_ZOLOTAREV:
+        herm_polar::Zolotarev( uplo, A, P );
+        MakeHermitian( uplo, P );
+        break;
+    default:
+        HermitianSign( uplo, A, P );
+    }
 }
 
 } // namespace elem
@@ -26,6 +26,8 @@
 
 #include ELEM_IDENTITY_INC
 
+#include ELEM_CHECKPOINT_INC
+
 namespace elem {
 
 // Based on Yuji Nakatsukasa's implementation of a QR-based dynamically 
@@ -34,16 +36,48 @@ namespace elem {
 // available here:
 //     http://www.mathworks.com/matlabcentral/fileexchange/36830
 //
-// No support for row-sorting yet.
+// No support for row-sorting yet. Unless column pivoting is requested, the
+// QR decompositions of [sqrt(c) A; I] avoid operating on the known zeros of
+// the identity block (see qr::StackedIdentity).
 //
 // The careful calculation of the coefficients is due to a suggestion from
 // Gregorio Quintana Orti.
 
 namespace polar {
 
+// Storage for the QDWH iteration (and its initial estimate of the smallest
+// singular value) which may be reused across calls, e.g., by each spectral
+// divide of a divide and conquer eigensolver
 template<typename F>
-inline Int 
-QDWHInner( Matrix<F>& A, BASE(F) sMinUpper, bool colPiv=false, Int maxIts=20 )
+struct QDWHWorkspace
+{
+    Matrix<F> ALast, ATemp, C, Q;
+};
+
+template<typename F>
+struct DistQDWHWorkspace
+{
+    DistMatrix<F> ALast, ATemp, C, Q;
+
+    DistQDWHWorkspace( const Grid& g=DefaultGrid() )
+    : ALast(g), ATemp(g), C(g), Q(g)
+    { }
+
+    // Switching grids discards any existing storage
+    void SetGrid( const Grid& g )
+    {
+        ALast.SetGrid( g );
+        ATemp.SetGrid( g );
+        C.SetGrid( g );
+        Q.SetGrid( g );
+    }
+};
+
+template<typename F>
+inline Int
+QDWHInner
+( Matrix<F>& A, BASE(F) sMinUpper, QDWHWorkspace<F>& work,
+  bool colPiv=false, Int maxIts=20 )
 {
     DEBUG_ONLY(CallStackEntry cse("polar::QDWHInner"))
     typedef Base<F> Real;
@@ -60,8 +94,11 @@ QDWHInner( Matrix<F>& A, BASE(F) sMinUpper, bool colPiv=false, Int maxIts=20 )
     Real L = sMinUpper / Sqrt(Real(n));
 
     Real frobNormADiff;
-    Matrix<F> ALast, ATemp, C;
-    Matrix<F> Q( m+n, n );
+    Matrix<F>& ALast = work.ALast;
+    Matrix<F>& ATemp = work.ATemp;
+    Matrix<F>& C = work.C;
+    Matrix<F>& Q = work.Q;
+    Q.Resize( m+n, n );
     Matrix<F> QT, QB;
     PartitionDown( Q, QT, QB, m );
     Int numIts=0;
@@ -87,8 +124,8 @@ QDWHInner( Matrix<F>& A, BASE(F) sMinUpper, bool colPiv=false, Int maxIts=20 )
         const Real a = (sqd + Sqrt(arg)/Real(2)).real();
         const Real b = (a-1)*(a-1)/4;
         const Real c = a+b-1;
-        const Cpx alpha = a-b/c;
-        const Cpx beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         L = L*(a+b*L2)/(1+c*L2);
 
@@ -100,7 +137,10 @@ QDWHInner( Matrix<F>& A, BASE(F) sMinUpper, bool colPiv=false, Int maxIts=20 )
             QT = A;
             Scale( Sqrt(c), QT );
             MakeIdentity( QB );
-            qr::Explicit( Q, colPiv );
+            if( colPiv )
+                qr::Explicit( Q, colPiv );
+            else
+                qr::ExplicitStackedIdentity( Q );
             Gemm( NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
         }
         else
@@ -128,8 +168,18 @@ QDWHInner( Matrix<F>& A, BASE(F) sMinUpper, bool colPiv=false, Int maxIts=20 )
 }
 
 template<typename F>
-inline Int 
-QDWH( Matrix<F>& A, bool colPiv=false, Int maxIts=20 )
+inline Int
+QDWHInner( Matrix<F>& A, BASE(F) sMinUpper, bool colPiv=false, Int maxIts=20 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::QDWHInner"))
+    QDWHWorkspace<F> work;
+    return QDWHInner( A, sMinUpper, work, colPiv, maxIts );
+}
+
+template<typename F>
+inline Int
+QDWH
+( Matrix<F>& A, QDWHWorkspace<F>& work, bool colPiv=false, Int maxIts=20 )
 {
     DEBUG_ONLY(CallStackEntry cse("polar::QDWH"))
     typedef Base<F> Real;
@@ -141,7 +191,8 @@ QDWH( Matrix<F>& A, bool colPiv=false, Int maxIts=20 )
     // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
     // to 1-Norm Pseudospectra".
     Real sMinUpper;
-    Matrix<F> Y( A );
+    Matrix<F>& Y = work.ATemp;
+    Y = A;
     if( A.Height() > A.Width() )
     {
         QR( Y );
@@ -162,7 +213,16 @@ QDWH( Matrix<F>& A, bool colPiv=false, Int maxIts=20 )
         } catch( SingularMatrixException& e ) { sMinUpper = 0; }
     } 
 
-    return QDWHInner( A, sMinUpper, colPiv, maxIts );
+    return QDWHInner( A, sMinUpper, work, colPiv, maxIts );
+}
+
+template<typename F>
+inline Int
+QDWH( Matrix<F>& A, bool colPiv=false, Int maxIts=20 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::QDWH"))
+    QDWHWorkspace<F> work;
+    return QDWH( A, work, colPiv, maxIts );
 }
 
 template<typename F>
@@ -179,9 +239,10 @@ QDWH( Matrix<F>& A, Matrix<F>& P, bool colPiv=false, Int maxIts=20 )
 }
 
 template<typename F>
-inline Int 
+inline Int
 QDWHInner
-( DistMatrix<F>& A, BASE(F) sMinUpper, bool colPiv=false, Int maxIts=20 )
+( DistMatrix<F>& A, BASE(F) sMinUpper, DistQDWHWorkspace<F>& work,
+  bool colPiv=false, Int maxIts=20 )
 {
     DEBUG_ONLY(CallStackEntry cse("polar::QDWHInner"))
     typedef Base<F> Real;
@@ -199,11 +260,30 @@ QDWHInner
     Real L = sMinUpper / Sqrt(Real(n));
 
     Real frobNormADiff;
-    DistMatrix<F> ALast(g), ATemp(g), C(g);
-    DistMatrix<F> Q( m+n, n, g );
+    work.SetGrid( g );
+    DistMatrix<F>& ALast = work.ALast;
+    DistMatrix<F>& ATemp = work.ATemp;
+    DistMatrix<F>& C = work.C;
+    DistMatrix<F>& Q = work.Q;
+    Q.Resize( m+n, n );
     DistMatrix<F> QT(g), QB(g);
     PartitionDown( Q, QT, QB, m );
     Int numIts=0;
+    bool converged=false;
+
+    // Resume from a checkpointed iterate if possible
+    std::vector<double> fingerprint, state;
+    if( checkpoint::Enabled() )
+    {
+        fingerprint = checkpoint::Fingerprint( A );
+        fingerprint.push_back( sMinUpper );
+        if( checkpoint::Load( "qdwh", A, fingerprint, state ) )
+        {
+            numIts = state[0];
+            L = state[1];
+        }
+    }
+
     while( numIts < maxIts )
     {
         ALast = A;
@@ -226,8 +306,8 @@ QDWHInner
         const Real a = (sqd + Sqrt(arg)/Real(2)).real();
         const Real b = (a-1)*(a-1)/4;
         const Real c = a+b-1;
-        const Cpx alpha = a-b/c;
-        const Cpx beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         L = L*(a+b*L2)/(1+c*L2);
 
@@ -239,7 +319,10 @@ QDWHInner
             QT = A;
             Scale( Sqrt(c), QT );
             MakeIdentity( QB );
-            qr::Explicit( Q, colPiv );
+            if( colPiv )
+                qr::Explicit( Q, colPiv );
+            else
+                qr::ExplicitStackedIdentity( Q );
             Gemm( NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
         }
         else
@@ -258,17 +341,41 @@ QDWHInner
         }
 
         ++numIts;
+        if( checkpoint::Due(numIts) )
+        {
+            state.resize( 2 );
+            state[0] = numIts;
+            state[1] = L;
+            checkpoint::Save( "qdwh", A, fingerprint, state );
+        }
         Axpy( F(-1), A, ALast );
         frobNormADiff = FrobeniusNorm( ALast );
         if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
+        {
+            converged = true;
             break;
+        }
     }
+    if( converged )
+        checkpoint::Discard( "qdwh", A );
     return numIts;
 }
 
 template<typename F>
-inline Int 
-QDWH( DistMatrix<F>& A, bool colPiv=false, Int maxIts=20 )
+inline Int
+QDWHInner
+( DistMatrix<F>& A, BASE(F) sMinUpper, bool colPiv=false, Int maxIts=20 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::QDWHInner"))
+    DistQDWHWorkspace<F> work( A.Grid() );
+    return QDWHInner( A, sMinUpper, work, colPiv, maxIts );
+}
+
+template<typename F>
+inline Int
+QDWH
+( DistMatrix<F>& A, DistQDWHWorkspace<F>& work, bool colPiv=false,
+  Int maxIts=20 )
 {
     DEBUG_ONLY(CallStackEntry cse("polar::QDWH"))
     typedef Base<F> Real;
@@ -280,7 +387,9 @@ QDWH( DistMatrix<F>& A, bool colPiv=false, Int maxIts=20 )
     // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
     // to 1-Norm Pseudospectra".
     Real sMinUpper;
-    DistMatrix<F> Y( A );
+    work.SetGrid( A.Grid() );
+    DistMatrix<F>& Y = work.ATemp;
+    Y = A;
     if( A.Height() > A.Width() )
     {
         QR( Y );
@@ -301,7 +410,16 @@ QDWH( DistMatrix<F>& A, bool colPiv=false, Int maxIts=20 )
         } catch( SingularMatrixException& e ) { sMinUpper = 0; }
     }
 
-    return QDWHInner( A, sMinUpper, colPiv, maxIts );
+    return QDWHInner( A, sMinUpper, work, colPiv, maxIts );
+}
+
+template<typename F>
+inline Int
+QDWH( DistMatrix<F>& A, bool colPiv=false, Int maxIts=20 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::QDWH"))
+    DistQDWHWorkspace<F> work( A.Grid() );
+    return QDWH( A, work, colPiv, maxIts );
 }
 
 template<typename F>
@@ -321,11 +439,14 @@ QDWH( DistMatrix<F>& A, DistMatrix<F>& P, bool colPiv=false, Int maxIts=20 )
 
 namespace herm_polar {
 
+using polar::QDWHWorkspace;
+using polar::DistQDWHWorkspace;
+
 template<typename F>
 inline int
 QDWHInner
-( UpperOrLower uplo, Matrix<F>& A, BASE(F) sMinUpper, 
-  bool colPiv=false, Int maxIts=20 )
+( UpperOrLower uplo, Matrix<F>& A, BASE(F) sMinUpper,
+  QDWHWorkspace<F>& work, bool colPiv=false, Int maxIts=20 )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_polar::QDWH"))
     if( A.Height() != A.Width() )
@@ -342,8 +463,11 @@ QDWHInner
     Real L = sMinUpper / Sqrt(Real(n));
 
     Real frobNormADiff;
-    Matrix<F> ALast, ATemp, C;
-    Matrix<F> Q( 2*n, n );
+    Matrix<F>& ALast = work.ALast;
+    Matrix<F>& ATemp = work.ATemp;
+    Matrix<F>& C = work.C;
+    Matrix<F>& Q = work.Q;
+    Q.Resize( 2*n, n );
     Matrix<F> QT, QB;
     PartitionDown( Q, QT, QB, n );
     Int numIts=0;
@@ -369,8 +493,8 @@ QDWHInner
         const Real a = (sqd + Sqrt(arg)/Real(2)).real();
         const Real b = (a-1)*(a-1)/4;
         const Real c = a+b-1;
-        const Cpx alpha = a-b/c;
-        const Cpx beta = b/c;
+        const Real alpha = a-b/c;
+        const Real beta = b/c;
 
         L = L*(a+b*L2)/(1+c*L2);
 
@@ -383,8 +507,12 @@ QDWHInner
             QT = A;
             Scale( Sqrt(c), QT );
             MakeIdentity( QB );
-            qr::Explicit( Q, colPiv );
-            Trrk( uplo, NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
+            if( colPiv )
+                qr::Explicit( Q, colPiv );
+            else
+                qr::ExplicitStackedIdentity( Q );
+            Trrk
+            ( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
         }
         else
         {
@@ -418,8 +546,21 @@ QDWHInner
 }
 
 template<typename F>
-inline Int 
-QDWH( UpperOrLower uplo, Matrix<F>& A, bool colPiv=false, Int maxIts=20 )
+inline int
+QDWHInner
+( UpperOrLower uplo, Matrix<F>& A, BASE(F) sMinUpper,
+  bool colPiv=false, Int maxIts=20 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::QDWH"))
+    QDWHWorkspace<F> work;
+    return QDWHInner( uplo, A, sMinUpper, work, colPiv, maxIts );
+}
+
+template<typename F>
+inline Int
+QDWH
+( UpperOrLower uplo, Matrix<F>& A, QDWHWorkspace<F>& work,
+  bool colPiv=false, Int maxIts=20 )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_polar::QDWH"))
     typedef Base<F> Real;
@@ -432,14 +573,24 @@ QDWH( UpperOrLower uplo, Matrix<F>& A, bool colPiv=false, Int maxIts=20 )
     // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
     // to 1-Norm Pseudospectra".
     Real sMinUpper;
-    Matrix<F> Y( A );
+    Matrix<F>& Y = work.ATemp;
+    Y = A;
     try
     {
         Inverse( Y );
         sMinUpper = Real(1) / OneNorm( Y );
     } catch( SingularMatrixException& e ) { sMinUpper = 0; }
 
-    return QDWHInner( uplo, A, sMinUpper, colPiv, maxIts );
+    return QDWHInner( uplo, A, sMinUpper, work, colPiv, maxIts );
+}
+
+template<typename F>
+inline Int
+QDWH( UpperOrLower uplo, Matrix<F>& A, bool colPiv=false, Int maxIts=20 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::QDWH"))
+    QDWHWorkspace<F> work;
+    return QDWH( uplo, A, work, colPiv, maxIts );
 }
 
 template<typename F>
@@ -461,8 +612,8 @@ QDWH
 template<typename F>
 inline int
 QDWHInner
-( UpperOrLower uplo, DistMatrix<F>& A, BASE(F) sMinUpper, 
-  bool colPiv=false, Int maxIts=20 )
+( UpperOrLower uplo, DistMatrix<F>& A, BASE(F) sMinUpper,
+  DistQDWHWorkspace<F>& work, bool colPiv=false, Int maxIts=20 )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_polar::QDWH"))
     if( A.Height() != A.Width() )
@@ -480,11 +631,30 @@ QDWHInner
     Real L = sMinUpper / Sqrt(Real(n));
 
     Real frobNormADiff;
-    DistMatrix<F> ALast(g), ATemp(g), C(g);
-    DistMatrix<F> Q( 2*n, n, g );
+    work.SetGrid( g );
+    DistMatrix<F>& ALast = work.ALast;
+    DistMatrix<F>& ATemp = work.ATemp;
+    DistMatrix<F>& C = work.C;
+    DistMatrix<F>& Q = work.Q;
+    Q.Resize( 2*n, n );
     DistMatrix<F> QT(g), QB(g);
     PartitionDown( Q, QT, QB, n );
     Int numIts=0;
+    bool converged=false;
+
+    // Resume from a checkpointed iterate if possible
+    std::vector<double> fingerprint, state;
+    if( checkpoint::Enabled() )
+    {
+        fingerprint = checkpoint::Fingerprint( A );
+        fingerprint.push_back( sMinUpper );
+        if( checkpoint::Load( "qdwh", A, fingerprint, state ) )
+        {
+            numIts = state[0];
+            L = state[1];
+        }
+    }
+
     while( numIts < maxIts )
     {
         ALast = A;
@@ -507,8 +677,8 @@ QDWHInner
         const Real a = (sqd + Sqrt(arg)/Real(2)).real();
         const Real b = (a-1)*(a-1)/4;
         const Real c = a+b-1;
-        const Cpx alpha = a-b/c;
-        const Cpx beta = b/c;
+        const Real alpha = a-b/c;
+        const Real beta = b/c;
 
         L = L*(a+b*L2)/(1+c*L2);
 
@@ -521,8 +691,12 @@ QDWHInner
             QT = A;
             Scale( Sqrt(c), QT );
             MakeIdentity( QB );
-            qr::Explicit( Q, colPiv );
-            Trrk( uplo, NORMAL, ADJOINT, alpha/Sqrt(c), QT, QB, beta, A );
+            if( colPiv )
+                qr::Explicit( Q, colPiv );
+            else
+                qr::ExplicitStackedIdentity( Q );
+            Trrk
+            ( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
         }
         else
         {
@@ -544,18 +718,43 @@ QDWHInner
         }
 
         ++numIts;
+        if( checkpoint::Due(numIts) )
+        {
+            state.resize( 2 );
+            state[0] = numIts;
+            state[1] = L;
+            checkpoint::Save( "qdwh", A, fingerprint, state );
+        }
         Axpy( F(-1), A, ALast );
         frobNormADiff = HermitianFrobeniusNorm( uplo, ALast );
         if( frobNormADiff <= cubeRootTol && Abs(1-L) <= tol )
+        {
+            converged = true;
             break;
+        }
     }
+    if( converged )
+        checkpoint::Discard( "qdwh", A );
     MakeHermitian( uplo, A );
     return numIts;
 }
 
 template<typename F>
-inline Int 
-QDWH( UpperOrLower uplo, DistMatrix<F>& A, bool colPiv=false, Int maxIts=20 )
+inline int
+QDWHInner
+( UpperOrLower uplo, DistMatrix<F>& A, BASE(F) sMinUpper,
+  bool colPiv=false, Int maxIts=20 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::QDWH"))
+    DistQDWHWorkspace<F> work( A.Grid() );
+    return QDWHInner( uplo, A, sMinUpper, work, colPiv, maxIts );
+}
+
+template<typename F>
+inline Int
+QDWH
+( UpperOrLower uplo, DistMatrix<F>& A, DistQDWHWorkspace<F>& work,
+  bool colPiv=false, Int maxIts=20 )
 {
     DEBUG_ONLY(CallStackEntry cse("herm_polar::QDWH"))
     typedef Base<F> Real;
@@ -568,14 +767,26 @@ QDWH( UpperOrLower uplo, DistMatrix<F>& A, bool colPiv=false, Int maxIts=20 )
     // from "A Block Algorithm for Matrix 1-Norm Estimation, with an Application
     // to 1-Norm Pseudospectra".
     Real sMinUpper;
-    DistMatrix<F> Y( A );
-    try 
-    {   
+    work.SetGrid( A.Grid() );
+    DistMatrix<F>& Y = work.ATemp;
+    Y = A;
+    try
+    {
         Inverse( Y );
         sMinUpper = Real(1) / OneNorm( Y );
     } catch( SingularMatrixException& e ) { sMinUpper = 0; }
 
-    return QDWHInner( uplo, A, sMinUpper, colPiv, maxIts );
+    return QDWHInner( uplo, A, sMinUpper, work, colPiv, maxIts );
+}
+
+template<typename F>
+inline Int
+QDWH
+( UpperOrLower uplo, DistMatrix<F>& A, bool colPiv=false, Int maxIts=20 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::QDWH"))
+    DistQDWHWorkspace<F> work( A.Grid() );
+    return QDWH( uplo, A, work, colPiv, maxIts );
 }
 
 template<typename F>
@@ -0,0 +1,831 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_POLAR_ZOLOTAREV_HPP
+#define ELEM_POLAR_ZOLOTAREV_HPP
+
+#include ELEM_AXPY_INC
+#include ELEM_MAKEHERMITIAN_INC
+#include ELEM_SCALE_INC
+#include ELEM_GEMM_INC
+#include ELEM_HERK_INC
+#include ELEM_TRSM_INC
+
+#include ELEM_CHOLESKY_INC
+#include ELEM_QR_INC
+#include ELEM_TRIANGULARINVERSE_INC
+#include ELEM_GENERALINVERSE_INC
+#include ELEM_HPDINVERSE_INC
+#include ELEM_ONENORM_INC
+#include ELEM_TWONORMESTIMATE_INC
+#include ELEM_TEAMS_INC
+
+#include ELEM_IDENTITY_INC
+#include ELEM_ZEROS_INC
+
+namespace elem {
+
+// Zolotarev-based polar decomposition (Zolo-PD), as described in
+//
+//     Y. Nakatsukasa and R.W. Freund, "Computing fundamental matrix
+//     decompositions accurately via the matrix sign function in two
+//     iterations: The power of Zolotarev's functions", SIAM Review, 2016.
+//
+// Each iteration applies the best (type (2r+1,2r)) rational approximation
+// of the sign function on [l,1], which, in partial fraction form, is
+//
+//     X := M ( X + sum_{j=1}^r a_j X (X^H X + c_{2j-1} I)^{-1} ).
+//
+// Two iterations with r = 8 suffice for any matrix with a condition number
+// of at most 1/eps in double-precision, and the r terms of each iteration
+// are independent, so, in the distributed case, they are spread over
+// numTeams subgrids and only the (elementwise) sum is communicated.
+// As in QDWH, the terms with small shifts use the QR decomposition of the
+// stacked matrix [X/sqrt(c); I], and the rest use the Cholesky factor of
+// X^H X + c I. In the Hermitian case, each term is itself Hermitian, and so
+// only one triangle of each term is formed.
+
+namespace polar {
+namespace zolo {
+
+// The complete elliptic integral of the first kind, K(k), expressed in terms
+// of the complementary modulus, k' = sqrt(1-k^2), through the
+// arithmetic-geometric mean K(k) = pi / (2 AGM(1,k'))
+template<typename Real>
+inline Real
+EllipticK( Real kPrime )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::EllipticK"))
+    const Real eps = lapack::MachineEpsilon<Real>();
+    Real a=1, b=kPrime;
+    for( Int it=0; it<64 && Abs(a-b) > 4*eps*a; ++it )
+    {
+        const Real aNext = (a+b)/2;
+        b = Sqrt(a*b);
+        a = aNext;
+    }
+    return Real(M_PI)/(2*a);
+}
+
+// The Jacobi elliptic functions sn(u,k) and cn(u,k), for the modulus
+// k = sqrt(1-k'^2), via the descending Landen (AGM) transformation
+// (see Abramowitz and Stegun, 16.4)
+template<typename Real>
+inline void
+JacobiElliptic( Real u, Real kPrime, Real& sn, Real& cn )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::JacobiElliptic"))
+    const Real eps = lapack::MachineEpsilon<Real>();
+    std::vector<Real> a(1,Real(1)), c(1,Sqrt((1-kPrime)*(1+kPrime)));
+    Real b = kPrime;
+    while( Abs(c.back()) > 4*eps*a.back() && a.size() < 64 )
+    {
+        const Real aLast = a.back();
+        a.push_back( (aLast+b)/2 );
+        c.push_back( (aLast-b)/2 );
+        b = Sqrt(aLast*b);
+    }
+    const Int N = a.size()-1;
+    Real phi = Pow(Real(2),Real(N))*a[N]*u;
+    for( Int n=N; n>0; --n )
+        phi = (phi + Asin(c[n]/a[n]*Sin(phi)))/2;
+    sn = Sin(phi);
+    cn = Cos(phi);
+}
+
+// The shifts, c_1 < ... < c_{2r}, and the partial fraction weights, a_j, of
+// Zolotarev's function of type (2r+1,2r) on [ell,1], i.e.,
+//
+//     Z(x) = x prod_{j=1}^r (x^2 + c_{2j}) / (x^2 + c_{2j-1})
+//          = x ( 1 + sum_{j=1}^r a_j / (x^2 + c_{2j-1}) ),
+//
+// where c_i = ell^2 sn^2(u_i;ell') / cn^2(u_i;ell'), with
+// u_i = i K(ell') / (2r+1). Since cn(u;ell') is tiny for u near K(ell')
+// when ell is small, the shifts with u_i > K(ell')/2 are instead computed
+// as cn^2(v_i;ell') / sn^2(v_i;ell'), with v_i = K(ell') - u_i.
+template<typename Real>
+inline void
+Coefficients
+( Int r, Real ell, std::vector<Real>& c, std::vector<Real>& a )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::Coefficients"))
+    const Real K = EllipticK( ell );
+    c.resize( 2*r );
+    for( Int i=1; i<=2*r; ++i )
+    {
+        Real sn, cn;
+        if( 2*i <= 2*r+1 )
+        {
+            JacobiElliptic( Real(i)*K/Real(2*r+1), ell, sn, cn );
+            c[i-1] = ell*ell*(sn*sn)/(cn*cn);
+        }
+        else
+        {
+            JacobiElliptic( Real(2*r+1-i)*K/Real(2*r+1), ell, sn, cn );
+            c[i-1] = (cn*cn)/(sn*sn);
+        }
+    }
+
+    a.resize( r );
+    for( Int j=0; j<r; ++j )
+    {
+        Real num=1, denom=1;
+        for( Int k=0; k<r; ++k )
+        {
+            num *= c[2*j]-c[2*k+1];
+            if( k != j )
+                denom *= c[2*j]-c[2*k];
+        }
+        a[j] = -num/denom;
+    }
+}
+
+template<typename Real>
+inline Real
+Evaluate( Real x, const std::vector<Real>& c )
+{
+    const Int r = c.size()/2;
+    const Real x2 = x*x;
+    Real z = x;
+    for( Int j=0; j<r; ++j )
+        z *= (x2+c[2*j+1])/(x2+c[2*j]);
+    return z;
+}
+
+// Return the minimum and maximum of Z(x) over [ell,1]. Z equioscillates on
+// [ell,1], so its extrema are located by sampling on a logarithmic grid and
+// refining the best sample with a golden-section search.
+template<typename Real>
+inline void
+Bounds
+( Real ell, const std::vector<Real>& c, Real& zMin, Real& zMax )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::Bounds"))
+    const Int r = c.size()/2;
+    const Int numSamples = 64*(2*r+1);
+    const Real logEll = Log(ell);
+    std::vector<Real> x(numSamples), z(numSamples);
+    Int iMin=0, iMax=0;
+    for( Int i=0; i<numSamples; ++i )
+    {
+        x[i] = ( i == numSamples-1 ? Real(1) :
+                 Exp(logEll*Real(numSamples-1-i)/Real(numSamples-1)) );
+        z[i] = Evaluate( x[i], c );
+        if( z[i] < z[iMin] )
+            iMin = i;
+        if( z[i] > z[iMax] )
+            iMax = i;
+    }
+
+    const Real ratio = (Sqrt(Real(5))-1)/2;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        const Int i = ( pass == 0 ? iMin : iMax );
+        const Real sign = ( pass == 0 ? Real(1) : Real(-1) );
+        Real lo = x[Max(i-1,Int(0))], hi = x[Min(i+1,numSamples-1)];
+        Real best = sign*z[i];
+        for( Int it=0; it<100 && hi-lo > 4*lapack::MachineEpsilon<Real>()*hi;
+             ++it )
+        {
+            const Real x1 = hi - ratio*(hi-lo);
+            const Real x2 = lo + ratio*(hi-lo);
+            const Real z1 = sign*Evaluate( x1, c );
+            const Real z2 = sign*Evaluate( x2, c );
+            best = Min(best,Min(z1,z2));
+            if( z1 < z2 )
+                hi = x2;
+            else
+                lo = x1;
+        }
+        if( pass == 0 )
+            zMin = best;
+        else
+            zMax = -best;
+    }
+}
+
+// The lower bound on the singular values after an iteration with r terms
+// which scales by 1/max Z(x)
+template<typename Real>
+inline Real
+NextBound( Int r, Real ell )
+{
+    std::vector<Real> c, a;
+    Coefficients( r, ell, c, a );
+    Real zMin, zMax;
+    Bounds( ell, c, zMin, zMax );
+    return Min(zMin/zMax,Real(1));
+}
+
+// The smallest number of terms (at most eight) for which a single iteration
+// converges, or, failing that, for which two iterations converge
+template<typename Real>
+inline Int
+NumTerms( Real ell, Real tol )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::NumTerms"))
+    const Int maxTerms = 8;
+    std::vector<Real> ellNext(maxTerms+1);
+    for( Int r=1; r<=maxTerms; ++r )
+    {
+        ellNext[r] = NextBound( r, ell );
+        if( 1-ellNext[r] <= tol )
+            return r;
+    }
+    for( Int r=1; r<=maxTerms; ++r )
+        if( 1-NextBound( r, ellNext[r] ) <= tol )
+            return r;
+    return maxTerms;
+}
+
+// T := X (X^H X + c I)^{-1}, where the singular values of X lie in [ell,1]
+template<typename F>
+inline void
+Term( const Matrix<F>& X, BASE(F) c, BASE(F) ell, Matrix<F>& T )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::Term"))
+    const Int m = X.Height();
+    const Int n = X.Width();
+    if( (1+c)/(ell*ell+c) > 100 )
+    {
+        // [X/sqrt(c); I] = [Q1; Q2] R implies that T = Q1 Q2^H / sqrt(c)
+        Matrix<F> Q( m+n, n ), QT, QB;
+        PartitionDown( Q, QT, QB, m );
+        QT = X;
+        Scale( F(1)/Sqrt(c), QT );
+        MakeIdentity( QB );
+        qr::ExplicitStackedIdentity( Q );
+        Gemm( NORMAL, ADJOINT, F(1)/Sqrt(c), QT, QB, T );
+    }
+    else
+    {
+        Matrix<F> C;
+        Identity( C, n, n );
+        Herk( LOWER, ADJOINT, F(1), X, F(c), C );
+        Cholesky( LOWER, C );
+        T = X;
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, T );
+        Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, T );
+    }
+}
+
+template<typename F>
+inline void
+Term( const DistMatrix<F>& X, BASE(F) c, BASE(F) ell, DistMatrix<F>& T )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::Term"))
+    const Grid& g = X.Grid();
+    const Int m = X.Height();
+    const Int n = X.Width();
+    if( (1+c)/(ell*ell+c) > 100 )
+    {
+        DistMatrix<F> Q( m+n, n, g ), QT(g), QB(g);
+        PartitionDown( Q, QT, QB, m );
+        QT = X;
+        Scale( F(1)/Sqrt(c), QT );
+        MakeIdentity( QB );
+        qr::ExplicitStackedIdentity( Q );
+        Gemm( NORMAL, ADJOINT, F(1)/Sqrt(c), QT, QB, T );
+    }
+    else
+    {
+        DistMatrix<F> C(g);
+        Identity( C, n, n );
+        Herk( LOWER, ADJOINT, F(1), X, F(c), C );
+        Cholesky( LOWER, C );
+        T = X;
+        Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), C, T );
+        Trsm( RIGHT, LOWER, NORMAL, NON_UNIT, F(1), C, T );
+    }
+}
+
+// S := X + sum_{j=first,first+stride,...} a_j X (X^H X + c_{2j-1} I)^{-1}
+template<typename F,class MatrixType>
+inline void
+PartialSum
+( const MatrixType& X, const std::vector<BASE(F)>& c,
+  const std::vector<BASE(F)>& a, BASE(F) ell, Int first, Int stride,
+  MatrixType& S )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::PartialSum"))
+    const Int r = a.size();
+    MatrixType T( S );
+    for( Int j=first; j<r; j+=stride )
+    {
+        Term( X, c[2*j], ell, T );
+        Axpy( F(a[j]), T, S );
+    }
+}
+
+// The uplo triangle of S := S + alpha X (X^2 + c I)^{-1}, where X is a
+// (fully-populated) Hermitian matrix with singular values in [ell,1]
+template<typename F>
+inline void
+HermitianTerm
+( UpperOrLower uplo, const Matrix<F>& X, BASE(F) c, BASE(F) ell,
+  BASE(F) alpha, Matrix<F>& S )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::HermitianTerm"))
+    const Int n = X.Height();
+    if( (1+c)/(ell*ell+c) > 100 )
+    {
+        Matrix<F> Q( 2*n, n ), QT, QB;
+        PartitionDown( Q, QT, QB, n );
+        QT = X;
+        Scale( F(1)/Sqrt(c), QT );
+        MakeIdentity( QB );
+        qr::ExplicitStackedIdentity( Q );
+        Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(1), S );
+    }
+    else
+    {
+        // X commutes with inv(X^2 + c I), which is well-conditioned here
+        Matrix<F> G;
+        Identity( G, n, n );
+        Herk( LOWER, ADJOINT, F(1), X, F(c), G );
+        HPDInverse( LOWER, G );
+        MakeHermitian( LOWER, G );
+        Trrk( uplo, NORMAL, NORMAL, F(alpha), X, G, F(1), S );
+    }
+}
+
+template<typename F>
+inline void
+HermitianTerm
+( UpperOrLower uplo, const DistMatrix<F>& X, BASE(F) c, BASE(F) ell,
+  BASE(F) alpha, DistMatrix<F>& S )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::HermitianTerm"))
+    const Grid& g = X.Grid();
+    const Int n = X.Height();
+    if( (1+c)/(ell*ell+c) > 100 )
+    {
+        DistMatrix<F> Q( 2*n, n, g ), QT(g), QB(g);
+        PartitionDown( Q, QT, QB, n );
+        QT = X;
+        Scale( F(1)/Sqrt(c), QT );
+        MakeIdentity( QB );
+        qr::ExplicitStackedIdentity( Q );
+        Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(1), S );
+    }
+    else
+    {
+        DistMatrix<F> G(g);
+        Identity( G, n, n );
+        Herk( LOWER, ADJOINT, F(1), X, F(c), G );
+        HPDInverse( LOWER, G );
+        MakeHermitian( LOWER, G );
+        Trrk( uplo, NORMAL, NORMAL, F(alpha), X, G, F(1), S );
+    }
+}
+
+// The uplo triangle of S := S + sum_{j=first,first+stride,...} a_j (...)
+template<typename F,class MatrixType>
+inline void
+HermitianPartialSum
+( UpperOrLower uplo, const MatrixType& X, const std::vector<BASE(F)>& c,
+  const std::vector<BASE(F)>& a, BASE(F) ell, Int first, Int stride,
+  MatrixType& S )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::HermitianPartialSum"))
+    const Int r = a.size();
+    for( Int j=first; j<r; j+=stride )
+        HermitianTerm( uplo, X, c[2*j], ell, a[j], S );
+}
+
+// Each of the given number of teams calls sum( ASub, first, stride, SSub ),
+// which should add the terms first, first+stride, ... into SSub, with a copy
+// of A and SSub = 0 on its own subgrid, where first is the index of the team
+// and stride is the number of teams. The partial sums are then added into S.
+template<typename F,class SumFunctor>
+inline void
+TeamSum
+( const DistMatrix<F>& A, Int teams, SumFunctor sum, DistMatrix<F>& S )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::TeamSum"))
+    const Grid& g = A.Grid();
+    const Int p = g.Size();
+    if( teams == 1 )
+    {
+        sum( A, 0, 1, S );
+        return;
+    }
+
+    // Push a copy of the iterate to each team
+    std::vector<const Grid*> teamGrids;
+    SplitIntoTeams( teams, g, teamGrids );
+    const Int myTeam = TeamOf( g.Rank(), teams, p );
+    const Grid& myTeamGrid = *teamGrids[myTeam];
+    DistMatrix<F> APush( myTeamGrid );
+    for( Int t=0; t<teams; ++t )
+    {
+        if( t == myTeam )
+            APush = A;
+        else
+        {
+            DistMatrix<F> ATmp( *teamGrids[t] );
+            ATmp = A;
+        }
+    }
+
+    // Each team sums its share of the terms on a grid which is only
+    // viewed by the team itself (see herm_eig::slice::Solve)
+    mpi::Comm teamComm;
+    mpi::CommSplit( g.Comm(), myTeam, g.Rank(), teamComm );
+    const Grid teamGrid( teamComm, myTeamGrid.Height() );
+    mpi::CommFree( teamComm );
+    DistMatrix<F> ASub( teamGrid ), SSub( teamGrid );
+    ASub = APush;
+    APush.Empty();
+    Zeros( SSub, A.Height(), A.Width() );
+    sum( ASub, myTeam, teams, SSub );
+    ASub.Empty();
+
+    // Pull the partial sums back to the original grid
+    DistMatrix<F> SPull( myTeamGrid );
+    SPull = SSub;
+    SSub.Empty();
+    for( Int t=0; t<teams; ++t )
+    {
+        DistMatrix<F> St( g );
+        if( t == myTeam )
+        {
+            SPull.MakeConsistent();
+            St = SPull;
+        }
+        else
+        {
+            DistMatrix<F> STmp( *teamGrids[t] );
+            STmp.MakeConsistent();
+            St = STmp;
+        }
+        Axpy( F(1), St, S );
+    }
+    SPull.Empty();
+    FreeTeamGrids( teamGrids );
+}
+
+// An upper bound on the smallest singular value of A, whose two-norm is
+// assumed to be at most one
+template<typename F>
+inline BASE(F)
+SMinUpper( const Matrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::SMinUpper"))
+    typedef Base<F> Real;
+    Matrix<F> Y( A );
+    try
+    {
+        if( A.Height() > A.Width() )
+        {
+            QR( Y );
+            Y.Resize( A.Width(), A.Width() );
+            MakeTriangular( UPPER, Y );
+            TriangularInverse( UPPER, NON_UNIT, Y );
+        }
+        else
+            Inverse( Y );
+        return Real(1) / OneNorm( Y );
+    } catch( SingularMatrixException& e ) { return Real(0); }
+}
+
+template<typename F>
+inline BASE(F)
+SMinUpper( const DistMatrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::zolo::SMinUpper"))
+    typedef Base<F> Real;
+    DistMatrix<F> Y( A );
+    try
+    {
+        if( A.Height() > A.Width() )
+        {
+            QR( Y );
+            Y.Resize( A.Width(), A.Width() );
+            MakeTriangular( UPPER, Y );
+            TriangularInverse( UPPER, NON_UNIT, Y );
+        }
+        else
+            Inverse( Y );
+        return Real(1) / OneNorm( Y );
+    } catch( SingularMatrixException& e ) { return Real(0); }
+}
+
+} // namespace zolo
+
+template<typename F>
+inline Int
+ZolotarevInner
+( Matrix<F>& A, BASE(F) sMinUpper, Int numTerms=0, Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::ZolotarevInner"))
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+        LogicError("Height cannot be less than width");
+
+    // The computed bounds on Z are only accurate to a few multiples of eps
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real tol = 20*eps;
+    Real ell = Max( sMinUpper / Sqrt(Real(n)), eps );
+
+    std::vector<Real> c, a;
+    Matrix<F> S;
+    Int numIts=0;
+    while( numIts < maxIts && 1-ell > tol )
+    {
+        const Int r = ( numTerms > 0 ? numTerms : zolo::NumTerms(ell,tol) );
+        zolo::Coefficients( r, ell, c, a );
+        Real zMin, zMax;
+        zolo::Bounds( ell, c, zMin, zMax );
+        const Real ellNext = Min(zMin/zMax,Real(1));
+        const bool last = ( 1-ellNext <= tol );
+
+        S = A;
+        zolo::PartialSum<F>( A, c, a, ell, 0, 1, S );
+        A = S;
+        Scale( F( last ? 2/(zMin+zMax) : 1/zMax ), A );
+
+        ell = ( last ? Real(1) : ellNext );
+        ++numIts;
+    }
+    return numIts;
+}
+
+// In addition to the standard arguments, numTeams determines the number of
+// subgrids which the terms of each iteration are spread over (by default,
+// the minimum of the number of terms and the number of processes)
+template<typename F>
+inline Int
+ZolotarevInner
+( DistMatrix<F>& A, BASE(F) sMinUpper, Int numTerms=0, Int numTeams=0,
+  Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::ZolotarevInner"))
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int p = g.Size();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m < n )
+        LogicError("Height cannot be less than width");
+
+    // The computed bounds on Z are only accurate to a few multiples of eps
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real tol = 20*eps;
+    Real ell = Max( sMinUpper / Sqrt(Real(n)), eps );
+
+    std::vector<Real> c, a;
+    DistMatrix<F> S(g);
+    Int numIts=0;
+    while( numIts < maxIts && 1-ell > tol )
+    {
+        const Int r = ( numTerms > 0 ? numTerms : zolo::NumTerms(ell,tol) );
+        zolo::Coefficients( r, ell, c, a );
+        Real zMin, zMax;
+        zolo::Bounds( ell, c, zMin, zMax );
+        const Real ellNext = Min(zMin/zMax,Real(1));
+        const bool last = ( 1-ellNext <= tol );
+
+        const Int teams = Min( numTeams > 0 ? numTeams : r, Min(r,p) );
+        S = A;
+        zolo::TeamSum
+        ( A, teams,
+          [&]( const DistMatrix<F>& ASub, Int first, Int stride,
+               DistMatrix<F>& SSub )
+          { zolo::PartialSum<F>( ASub, c, a, ell, first, stride, SSub ); },
+          S );
+        A = S;
+        Scale( F( last ? 2/(zMin+zMax) : 1/zMax ), A );
+
+        ell = ( last ? Real(1) : ellNext );
+        ++numIts;
+    }
+    return numIts;
+}
+
+template<typename F>
+inline Int
+Zolotarev( Matrix<F>& A, Int numTerms=0, Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::Zolotarev"))
+    typedef Base<F> Real;
+    const Real twoEst = TwoNormEstimate( A );
+    Scale( F(1)/twoEst, A );
+    const Real sMinUpper = zolo::SMinUpper( A );
+    return ZolotarevInner( A, sMinUpper, numTerms, maxIts );
+}
+
+template<typename F>
+inline Int
+Zolotarev
+( Matrix<F>& A, Matrix<F>& P, Int numTerms=0, Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::Zolotarev"))
+    Matrix<F> ACopy( A );
+    const Int numIts = Zolotarev( A, numTerms, maxIts );
+    Zeros( P, A.Width(), A.Width() );
+    Gemm( ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
+    MakeHermitian( LOWER, P );
+    return numIts;
+}
+
+template<typename F>
+inline Int
+Zolotarev
+( DistMatrix<F>& A, Int numTerms=0, Int numTeams=0, Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::Zolotarev"))
+    typedef Base<F> Real;
+    const Real twoEst = TwoNormEstimate( A );
+    Scale( F(1)/twoEst, A );
+    const Real sMinUpper = zolo::SMinUpper( A );
+    return ZolotarevInner( A, sMinUpper, numTerms, numTeams, maxIts );
+}
+
+template<typename F>
+inline Int
+Zolotarev
+( DistMatrix<F>& A, DistMatrix<F>& P, Int numTerms=0, Int numTeams=0,
+  Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("polar::Zolotarev"))
+    DistMatrix<F> ACopy( A );
+    const Int numIts = Zolotarev( A, numTerms, numTeams, maxIts );
+    Zeros( P, A.Width(), A.Width() );
+    Gemm( ADJOINT, NORMAL, F(1), A, ACopy, F(0), P );
+    MakeHermitian( LOWER, P );
+    return numIts;
+}
+
+} // namespace polar
+
+namespace herm_polar {
+
+// The polar factor of a Hermitian matrix is its (Hermitian) sign, and each
+// iterate, as well as each term of each iteration, is Hermitian, so only the
+// uplo triangle of the terms is accumulated
+template<typename F>
+inline Int
+ZolotarevInner
+( UpperOrLower uplo, Matrix<F>& A, BASE(F) sMinUpper, Int numTerms=0,
+  Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::ZolotarevInner"))
+    typedef Base<F> Real;
+    if( A.Height() != A.Width() )
+        LogicError("Height must be same as width");
+    const Int n = A.Height();
+
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real tol = 20*eps;
+    Real ell = Max( sMinUpper / Sqrt(Real(n)), eps );
+
+    std::vector<Real> c, a;
+    Int numIts=0;
+    MakeHermitian( uplo, A );
+    while( numIts < maxIts && 1-ell > tol )
+    {
+        const Int r =
+            ( numTerms > 0 ? numTerms : polar::zolo::NumTerms(ell,tol) );
+        polar::zolo::Coefficients( r, ell, c, a );
+        Real zMin, zMax;
+        polar::zolo::Bounds( ell, c, zMin, zMax );
+        const Real ellNext = Min(zMin/zMax,Real(1));
+        const bool last = ( 1-ellNext <= tol );
+
+        Matrix<F> S( A );
+        polar::zolo::HermitianPartialSum<F>( uplo, A, c, a, ell, 0, 1, S );
+        A = S;
+        MakeHermitian( uplo, A );
+        Scale( F( last ? 2/(zMin+zMax) : 1/zMax ), A );
+
+        ell = ( last ? Real(1) : ellNext );
+        ++numIts;
+    }
+    return numIts;
+}
+
+template<typename F>
+inline Int
+ZolotarevInner
+( UpperOrLower uplo, DistMatrix<F>& A, BASE(F) sMinUpper, Int numTerms=0,
+  Int numTeams=0, Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::ZolotarevInner"))
+    typedef Base<F> Real;
+    if( A.Height() != A.Width() )
+        LogicError("Height must be same as width");
+    const Grid& g = A.Grid();
+    const Int p = g.Size();
+    const Int n = A.Height();
+
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real tol = 20*eps;
+    Real ell = Max( sMinUpper / Sqrt(Real(n)), eps );
+
+    std::vector<Real> c, a;
+    DistMatrix<F> S(g);
+    Int numIts=0;
+    MakeHermitian( uplo, A );
+    while( numIts < maxIts && 1-ell > tol )
+    {
+        const Int r =
+            ( numTerms > 0 ? numTerms : polar::zolo::NumTerms(ell,tol) );
+        polar::zolo::Coefficients( r, ell, c, a );
+        Real zMin, zMax;
+        polar::zolo::Bounds( ell, c, zMin, zMax );
+        const Real ellNext = Min(zMin/zMax,Real(1));
+        const bool last = ( 1-ellNext <= tol );
+
+        const Int teams = Min( numTeams > 0 ? numTeams : r, Min(r,p) );
+        S = A;
+        polar::zolo::TeamSum
+        ( A, teams,
+          [&]( const DistMatrix<F>& ASub, Int first, Int stride,
+               DistMatrix<F>& SSub )
+          {
+              polar::zolo::HermitianPartialSum<F>
+              ( uplo, ASub, c, a, ell, first, stride, SSub );
+          }, S );
+        A = S;
+        MakeHermitian( uplo, A );
+        Scale( F( last ? 2/(zMin+zMax) : 1/zMax ), A );
+
+        ell = ( last ? Real(1) : ellNext );
+        ++numIts;
+    }
+    return numIts;
+}
+
+template<typename F>
+inline Int
+Zolotarev
+( UpperOrLower uplo, Matrix<F>& A, Int numTerms=0, Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::Zolotarev"))
+    typedef Base<F> Real;
+    MakeHermitian( uplo, A );
+    const Real twoEst = TwoNormEstimate( A );
+    Scale( F(1)/twoEst, A );
+    const Real sMinUpper = polar::zolo::SMinUpper( A );
+    return ZolotarevInner( uplo, A, sMinUpper, numTerms, maxIts );
+}
+
+template<typename F>
+inline Int
+Zolotarev
+( UpperOrLower uplo, Matrix<F>& A, Matrix<F>& P,
+  Int numTerms=0, Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::Zolotarev"))
+    Matrix<F> ACopy( A );
+    MakeHermitian( uplo, ACopy );
+    const Int numIts = Zolotarev( uplo, A, numTerms, maxIts );
+    Zeros( P, A.Height(), A.Height() );
+    Trrk( uplo, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    return numIts;
+}
+
+template<typename F>
+inline Int
+Zolotarev
+( UpperOrLower uplo, DistMatrix<F>& A, Int numTerms=0, Int numTeams=0,
+  Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::Zolotarev"))
+    typedef Base<F> Real;
+    MakeHermitian( uplo, A );
+    const Real twoEst = TwoNormEstimate( A );
+    Scale( F(1)/twoEst, A );
+    const Real sMinUpper = polar::zolo::SMinUpper( A );
+    return ZolotarevInner( uplo, A, sMinUpper, numTerms, numTeams, maxIts );
+}
+
+template<typename F>
+inline Int
+Zolotarev
+( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<F>& P,
+  Int numTerms=0, Int numTeams=0, Int maxIts=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_polar::Zolotarev"))
+    DistMatrix<F> ACopy( A );
+    MakeHermitian( uplo, ACopy );
+    const Int numIts = Zolotarev( uplo, A, numTerms, numTeams, maxIts );
+    Zeros( P, A.Height(), A.Height() );
+    Trrk( uplo, NORMAL, NORMAL, F(1), A, ACopy, F(0), P );
+    return numIts;
+}
+
+} // namespace herm_polar
+
+} // namespace elem
+
+#endif // ifndef ELEM_POLAR_ZOLOTAREV_HPP
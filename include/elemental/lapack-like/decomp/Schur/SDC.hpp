@@ -22,6 +22,8 @@
 
 #include ELEM_HAAR_INC
 
+#include ELEM_CHECKPOINT_INC
+
 // See Z. Bai, J. Demmel, J. Dongarra, A. Petitet, H. Robinson, and K. Stanley's
 // "The spectral decomposition of nonsymmetric matrices on distributed memory
 // parallel computers". Currently available at:
@@ -46,7 +48,7 @@ ComputePartition( Matrix<F>& A )
         ValueInt<Real> part;
         part.value = -1;
         part.index = -1;
-        return;
+        return part;
     }
 
     // Compute the sets of row and column sums
@@ -145,12 +147,13 @@ ComputePartition( DistMatrix<F>& A )
 }
 
 // G should be a rational function of A. If returnQ=true, G will be set to
-// the computed unitary matrix upon exit.
+// the computed unitary matrix upon exit. The Newton workspace may be reused
+// across calls.
 template<typename F>
 inline ValueInt<BASE(F)>
 SignDivide
-( Matrix<F>& A, Matrix<F>& G, bool returnQ=false, BASE(F) signTol=0, 
-  bool progress=false )
+( Matrix<F>& A, Matrix<F>& G, sign::NewtonWorkspace<F>& work,
+  bool returnQ=false, BASE(F) signTol=0, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("schur::SignDivide"))
 
@@ -160,7 +163,8 @@ SignDivide
     const Int maxSignIts = 100; 
     const Base<F> power=1;
     const Int numSteps = 
-        sign::Newton( G, scaling, maxSignIts, signTol, power, progress );
+        sign::Newton
+        ( G, work, scaling, maxSignIts, signTol, power, progress );
     if( progress )
         std::cout << "Newton converged in " << numSteps << " iterations"
                   << std::endl;
@@ -196,8 +200,19 @@ SignDivide
 template<typename F>
 inline ValueInt<BASE(F)>
 SignDivide
-( DistMatrix<F>& A, DistMatrix<F>& G, bool returnQ=false, BASE(F) signTol=0, 
+( Matrix<F>& A, Matrix<F>& G, bool returnQ=false, BASE(F) signTol=0,
   bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SignDivide"))
+    sign::NewtonWorkspace<F> work;
+    return SignDivide( A, G, work, returnQ, signTol, progress );
+}
+
+template<typename F>
+inline ValueInt<BASE(F)>
+SignDivide
+( DistMatrix<F>& A, DistMatrix<F>& G, sign::DistNewtonWorkspace<F>& work,
+  bool returnQ=false, BASE(F) signTol=0, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("schur::SignDivide"))
     const Grid& g = A.Grid();
@@ -208,7 +223,8 @@ SignDivide
     const Int maxSignIts = 100; 
     const Base<F> power=1;
     const Int numSteps = 
-        sign::Newton( G, scaling, maxSignIts, signTol, power, progress );
+        sign::Newton
+        ( G, work, scaling, maxSignIts, signTol, power, progress );
     if( progress && g.Rank() == 0 )
         std::cout << "Newton converged in " << numSteps << " iterations"
                   << std::endl;
@@ -241,11 +257,22 @@ SignDivide
     return part;
 }
 
+template<typename F>
+inline ValueInt<BASE(F)>
+SignDivide
+( DistMatrix<F>& A, DistMatrix<F>& G, bool returnQ=false, BASE(F) signTol=0,
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SignDivide"))
+    sign::DistNewtonWorkspace<F> work( A.Grid() );
+    return SignDivide( A, G, work, returnQ, signTol, progress );
+}
+
 template<typename F>
 inline ValueInt<BASE(F)>
 RandomizedSignDivide
-( Matrix<F>& A, Matrix<F>& G, 
-  bool returnQ=false, Int maxIts=2, BASE(F) signTol=0, BASE(F) relTol=0, 
+( Matrix<F>& A, Matrix<F>& G, sign::NewtonWorkspace<F>& work,
+  bool returnQ=false, Int maxIts=2, BASE(F) signTol=0, BASE(F) relTol=0,
   bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("schur::RandomizedSignDivide"))
@@ -262,7 +289,8 @@ RandomizedSignDivide
     const Int maxSignIts = 100; 
     const Base<F> power=1;
     const Int numSteps = 
-        sign::Newton( S, scaling, maxSignIts, signTol, power, progress );
+        sign::Newton
+        ( S, work, scaling, maxSignIts, signTol, power, progress );
     if( progress )
         std::cout << "Newton converged in " << numSteps << " iterations"
                   << std::endl;
@@ -311,8 +339,21 @@ RandomizedSignDivide
 template<typename F>
 inline ValueInt<BASE(F)>
 RandomizedSignDivide
-( DistMatrix<F>& A, DistMatrix<F>& G, 
-  bool returnQ=false, Int maxIts=2, BASE(F) signTol=0, BASE(F) relTol=0, 
+( Matrix<F>& A, Matrix<F>& G,
+  bool returnQ=false, Int maxIts=2, BASE(F) signTol=0, BASE(F) relTol=0,
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::RandomizedSignDivide"))
+    sign::NewtonWorkspace<F> work;
+    return RandomizedSignDivide
+           ( A, G, work, returnQ, maxIts, signTol, relTol, progress );
+}
+
+template<typename F>
+inline ValueInt<BASE(F)>
+RandomizedSignDivide
+( DistMatrix<F>& A, DistMatrix<F>& G, sign::DistNewtonWorkspace<F>& work,
+  bool returnQ=false, Int maxIts=2, BASE(F) signTol=0, BASE(F) relTol=0,
   bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("schur::RandomizedSignDivide"))
@@ -330,7 +371,8 @@ RandomizedSignDivide
     const Int maxSignIts = 100; 
     const Base<F> power=1;
     const Int numSteps = 
-        sign::Newton( S, scaling, maxSignIts, signTol, power, progress );
+        sign::Newton
+        ( S, work, scaling, maxSignIts, signTol, power, progress );
     if( progress && g.Rank() == 0 )
         std::cout << "Newton converged in " << numSteps << " iterations"
                   << std::endl;
@@ -377,11 +419,26 @@ RandomizedSignDivide
     return part;
 }
 
+template<typename F>
+inline ValueInt<BASE(F)>
+RandomizedSignDivide
+( DistMatrix<F>& A, DistMatrix<F>& G,
+  bool returnQ=false, Int maxIts=2, BASE(F) signTol=0, BASE(F) relTol=0,
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::RandomizedSignDivide"))
+    sign::DistNewtonWorkspace<F> work( A.Grid() );
+    return RandomizedSignDivide
+           ( A, G, work, returnQ, maxIts, signTol, relTol, progress );
+}
+
 template<typename Real>
 inline ValueInt<Real>
 SpectralDivide
-( Matrix<Real>& A, Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, 
-  Real relTol=0, Real spreadFactor=1e-6, bool random=true, bool progress=false )
+( Matrix<Real>& A,
+  sign::NewtonWorkspace<Real>& work,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
     const Int n = A.Height();
@@ -414,9 +471,10 @@ SpectralDivide
         {
             if( random )
                 part = RandomizedSignDivide
-                       ( A, G, false, maxInnerIts, signTol, relTol, progress );
+                       ( A, G, work, false, maxInnerIts, signTol, relTol,
+                         progress );
             else
-                part = SignDivide( A, G, false, signTol, progress );
+                part = SignDivide( A, G, work, false, signTol, progress );
 
             if( part.value <= relTol )
             {
@@ -450,7 +508,22 @@ SpectralDivide
 template<typename Real>
 inline ValueInt<Real>
 SpectralDivide
-( Matrix<Complex<Real> >& A, 
+( Matrix<Real>& A,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
+    sign::NewtonWorkspace<Real> work;
+    return SpectralDivide
+           ( A, work, maxInnerIts, maxOuterIts, signTol, relTol,
+             spreadFactor, random, progress );
+}
+
+template<typename Real>
+inline ValueInt<Real>
+SpectralDivide
+( Matrix<Complex<Real> >& A,
+  sign::NewtonWorkspace<Complex<Real> >& work,
   Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
   Real spreadFactor=1e-6, bool random=true, bool progress=false )
 {
@@ -490,9 +563,10 @@ SpectralDivide
         {
             if( random )
                 part = RandomizedSignDivide
-                       ( A, G, false, maxInnerIts, signTol, relTol, progress );
+                       ( A, G, work, false, maxInnerIts, signTol, relTol,
+                         progress );
             else
-                part = SignDivide( A, G, false, signTol, progress );
+                part = SignDivide( A, G, work, false, signTol, progress );
             if( part.value <= relTol )
             {
                 if( progress )
@@ -525,7 +599,22 @@ SpectralDivide
 template<typename Real>
 inline ValueInt<Real>
 SpectralDivide
-( Matrix<Real>& A, Matrix<Real>& Q, 
+( Matrix<Complex<Real> >& A,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
+    sign::NewtonWorkspace<Complex<Real> > work;
+    return SpectralDivide
+           ( A, work, maxInnerIts, maxOuterIts, signTol, relTol,
+             spreadFactor, random, progress );
+}
+
+template<typename Real>
+inline ValueInt<Real>
+SpectralDivide
+( Matrix<Real>& A, Matrix<Real>& Q,
+  sign::NewtonWorkspace<Real>& work,
   Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
   Real spreadFactor=1e-6, bool random=true, bool progress=false )
 {
@@ -560,9 +649,10 @@ SpectralDivide
         {
             if( random )
                 part = RandomizedSignDivide
-                       ( A, Q, true, maxInnerIts, signTol, relTol, progress );
+                       ( A, Q, work, true, maxInnerIts, signTol, relTol,
+                         progress );
             else
-                part = SignDivide( A, Q, true, signTol, progress );
+                part = SignDivide( A, Q, work, true, signTol, progress );
             if( part.value <= relTol )
             {
                 if( progress )
@@ -595,7 +685,22 @@ SpectralDivide
 template<typename Real>
 inline ValueInt<Real>
 SpectralDivide
-( Matrix<Complex<Real> >& A, Matrix<Complex<Real> >& Q, 
+( Matrix<Real>& A, Matrix<Real>& Q,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
+    sign::NewtonWorkspace<Real> work;
+    return SpectralDivide
+           ( A, Q, work, maxInnerIts, maxOuterIts, signTol, relTol,
+             spreadFactor, random, progress );
+}
+
+template<typename Real>
+inline ValueInt<Real>
+SpectralDivide
+( Matrix<Complex<Real> >& A, Matrix<Complex<Real> >& Q,
+  sign::NewtonWorkspace<Complex<Real> >& work,
   Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
   Real spreadFactor=1e-6, bool random=true, bool progress=false )
 {
@@ -635,9 +740,10 @@ SpectralDivide
         {
             if( random )
                 part = RandomizedSignDivide
-                       ( A, Q, true, maxInnerIts, signTol, relTol, progress );
+                       ( A, Q, work, true, maxInnerIts, signTol, relTol,
+                         progress );
             else
-                part = SignDivide( A, Q, true, signTol, progress );
+                part = SignDivide( A, Q, work, true, signTol, progress );
             if( part.value <= relTol )
             {
                 if( progress )
@@ -670,8 +776,24 @@ SpectralDivide
 template<typename Real>
 inline ValueInt<Real>
 SpectralDivide
-( DistMatrix<Real>& A, Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, 
-  Real relTol=0, Real spreadFactor=1e-6, bool random=true, bool progress=false )
+( Matrix<Complex<Real> >& A, Matrix<Complex<Real> >& Q,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
+    sign::NewtonWorkspace<Complex<Real> > work;
+    return SpectralDivide
+           ( A, Q, work, maxInnerIts, maxOuterIts, signTol, relTol,
+             spreadFactor, random, progress );
+}
+
+template<typename Real>
+inline ValueInt<Real>
+SpectralDivide
+( DistMatrix<Real>& A,
+  sign::DistNewtonWorkspace<Real>& work,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
     const Int n = A.Height();
@@ -706,9 +828,10 @@ SpectralDivide
         {
             if( random )
                 part = RandomizedSignDivide
-                       ( A, G, false, maxInnerIts, signTol, relTol, progress );
+                       ( A, G, work, false, maxInnerIts, signTol, relTol,
+                         progress );
             else
-                part = SignDivide( A, G, false, signTol, progress );
+                part = SignDivide( A, G, work, false, signTol, progress );
             if( part.value <= relTol )
             {
                 if( progress && g.Rank() == 0 )
@@ -741,7 +864,22 @@ SpectralDivide
 template<typename Real>
 inline ValueInt<Real>
 SpectralDivide
-( DistMatrix<Complex<Real> >& A, 
+( DistMatrix<Real>& A,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
+    sign::DistNewtonWorkspace<Real> work( A.Grid() );
+    return SpectralDivide
+           ( A, work, maxInnerIts, maxOuterIts, signTol, relTol,
+             spreadFactor, random, progress );
+}
+
+template<typename Real>
+inline ValueInt<Real>
+SpectralDivide
+( DistMatrix<Complex<Real> >& A,
+  sign::DistNewtonWorkspace<Complex<Real> >& work,
   Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
   Real spreadFactor=1e-6, bool random=true, bool progress=false )
 {
@@ -784,9 +922,10 @@ SpectralDivide
         {
             if( random )
                 part = RandomizedSignDivide
-                       ( A, G, false, maxInnerIts, signTol, relTol, progress );
+                       ( A, G, work, false, maxInnerIts, signTol, relTol,
+                         progress );
             else
-                part = SignDivide( A, G, false, signTol, progress );
+                part = SignDivide( A, G, work, false, signTol, progress );
             if( part.value <= relTol )
             {
                 if( progress && g.Rank() == 0 )
@@ -819,7 +958,22 @@ SpectralDivide
 template<typename Real>
 inline ValueInt<Real>
 SpectralDivide
-( DistMatrix<Real>& A, DistMatrix<Real>& Q, 
+( DistMatrix<Complex<Real> >& A,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
+    sign::DistNewtonWorkspace<Complex<Real> > work( A.Grid() );
+    return SpectralDivide
+           ( A, work, maxInnerIts, maxOuterIts, signTol, relTol,
+             spreadFactor, random, progress );
+}
+
+template<typename Real>
+inline ValueInt<Real>
+SpectralDivide
+( DistMatrix<Real>& A, DistMatrix<Real>& Q,
+  sign::DistNewtonWorkspace<Real>& work,
   Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
   Real spreadFactor=1e-6, bool random=true, bool progress=false )
 {
@@ -857,9 +1011,10 @@ SpectralDivide
         {
             if( random )
                 part = RandomizedSignDivide
-                       ( A, Q, true, maxInnerIts, signTol, relTol, progress );
+                       ( A, Q, work, true, maxInnerIts, signTol, relTol,
+                         progress );
             else
-                part = SignDivide( A, Q, true, signTol, progress );
+                part = SignDivide( A, Q, work, true, signTol, progress );
             if( part.value <= relTol )
             {
                 if( progress && g.Rank() == 0 )
@@ -889,10 +1044,25 @@ SpectralDivide
     return part;
 }
 
+template<typename Real>
+inline ValueInt<Real>
+SpectralDivide
+( DistMatrix<Real>& A, DistMatrix<Real>& Q,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
+    sign::DistNewtonWorkspace<Real> work( A.Grid() );
+    return SpectralDivide
+           ( A, Q, work, maxInnerIts, maxOuterIts, signTol, relTol,
+             spreadFactor, random, progress );
+}
+
 template<typename Real>
 inline ValueInt<Real>
 SpectralDivide
 ( DistMatrix<Complex<Real> >& A, DistMatrix<Complex<Real> >& Q,
+  sign::DistNewtonWorkspace<Complex<Real> >& work,
   Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
   Real spreadFactor=1e-6, bool random=true, bool progress=false )
 {
@@ -935,9 +1105,10 @@ SpectralDivide
         {
             if( random )
                 part = RandomizedSignDivide
-                       ( A, Q, true, maxInnerIts, signTol, relTol, progress );
+                       ( A, Q, work, true, maxInnerIts, signTol, relTol,
+                         progress );
             else
-                part = SignDivide( A, Q, true, signTol, progress );
+                part = SignDivide( A, Q, work, true, signTol, progress );
             if( part.value <= relTol )
             {
                 if( progress && g.Rank() == 0 )
@@ -967,10 +1138,25 @@ SpectralDivide
     return part;
 }
 
+template<typename Real>
+inline ValueInt<Real>
+SpectralDivide
+( DistMatrix<Complex<Real> >& A, DistMatrix<Complex<Real> >& Q,
+  Int maxInnerIts=2, Int maxOuterIts=10, Real signTol=0, Real relTol=0, 
+  Real spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SpectralDivide"))
+    sign::DistNewtonWorkspace<Complex<Real> > work( A.Grid() );
+    return SpectralDivide
+           ( A, Q, work, maxInnerIts, maxOuterIts, signTol, relTol,
+             spreadFactor, random, progress );
+}
+
 template<typename F>
 inline void
 SDC
-( Matrix<F>& A, Matrix<Complex<BASE(F)>>& w, Int cutoff=256, 
+( Matrix<F>& A, Matrix<Complex<BASE(F)>>& w, sign::NewtonWorkspace<F>& work,
+  Int cutoff=256, 
   Int maxInnerIts=2, Int maxOuterIts=10, BASE(F) signTol=0, BASE(F) relTol=0, 
   BASE(F) spreadFactor=1e-6, bool random=true, bool progress=false )
 {
@@ -991,8 +1177,8 @@ SDC
         std::cout << "Splitting " << n << " x " << n << " matrix" << std::endl;
     const auto part = 
         SpectralDivide
-        ( A, maxInnerIts, maxOuterIts, signTol, relTol, spreadFactor, random,
-          progress );
+        ( A, work, maxInnerIts, maxOuterIts, signTol, relTol, spreadFactor,
+          random, progress );
     Matrix<F> ATL, ATR,
               ABL, ABR;
     PartitionDownDiagonal
@@ -1006,20 +1192,35 @@ SDC
         std::cout << "Recursing on " << ATL.Height() << " x " << ATL.Width() 
                   << " left subproblem" << std::endl;
     SDC
-    ( ATL, wT, cutoff, maxInnerIts, maxOuterIts, signTol, relTol, spreadFactor,
-      random, progress );
+    ( ATL, wT, work, cutoff, maxInnerIts, maxOuterIts, signTol, relTol,
+      spreadFactor, random, progress );
     if( progress )
         std::cout << "Recursing on " << ABR.Height() << " x " << ABR.Width() 
                   << " right subproblem" << std::endl;
     SDC
-    ( ABR, wB, cutoff, maxInnerIts, maxOuterIts, signTol, relTol, spreadFactor, 
-      random, progress );
+    ( ABR, wB, work, cutoff, maxInnerIts, maxOuterIts, signTol, relTol,
+      spreadFactor, random, progress );
+}
+
+template<typename F>
+inline void
+SDC
+( Matrix<F>& A, Matrix<Complex<BASE(F)>>& w, Int cutoff=256, 
+  Int maxInnerIts=2, Int maxOuterIts=10, BASE(F) signTol=0, BASE(F) relTol=0, 
+  BASE(F) spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SDC"))
+    sign::NewtonWorkspace<F> work;
+    SDC
+    ( A, w, work, cutoff, maxInnerIts, maxOuterIts, signTol, relTol, 
+      spreadFactor, random, progress );
 }
 
 template<typename F>
 inline void
 SDC
 ( Matrix<F>& A, Matrix<Complex<BASE(F)>>& w, Matrix<F>& Q, 
+  sign::NewtonWorkspace<F>& work,
   bool formATR=true, Int cutoff=256, Int maxInnerIts=2, Int maxOuterIts=10, 
   BASE(F) signTol=0, BASE(F) relTol=0, BASE(F) spreadFactor=1e-6, 
   bool random=true, bool progress=false )
@@ -1042,8 +1243,8 @@ SDC
         std::cout << "Splitting " << n << " x " << n << " matrix" << std::endl;
     const auto part = 
         SpectralDivide
-        ( A, Q, maxInnerIts, maxOuterIts, signTol, relTol, spreadFactor, random,
-          progress );
+        ( A, Q, work, maxInnerIts, maxOuterIts, signTol, relTol, spreadFactor,
+          random, progress );
     Matrix<F> ATL, ATR,
               ABL, ABR;
     PartitionDownDiagonal
@@ -1060,8 +1261,8 @@ SDC
                   << " left subproblem" << std::endl;
     Matrix<F> Z;
     SDC
-    ( ATL, wT, Z, formATR, cutoff, maxInnerIts, maxOuterIts, signTol, relTol, 
-      spreadFactor, random, progress );
+    ( ATL, wT, Z, work, formATR, cutoff, maxInnerIts, maxOuterIts, signTol,
+      relTol, spreadFactor, random, progress );
     if( progress )
         std::cout << "Left subproblem update" << std::endl;
     auto G( QL );
@@ -1074,8 +1275,8 @@ SDC
         std::cout << "Recursing on " << ABR.Height() << " x " << ABR.Width() 
                   << " right subproblem" << std::endl;
     SDC
-    ( ABR, wB, Z, formATR, cutoff, maxInnerIts, maxOuterIts, signTol, relTol, 
-      spreadFactor, random, progress );
+    ( ABR, wB, Z, work, formATR, cutoff, maxInnerIts, maxOuterIts, signTol,
+      relTol, spreadFactor, random, progress );
     if( progress )
         std::cout << "Right subproblem update" << std::endl;
     if( formATR )
@@ -1084,6 +1285,21 @@ SDC
     Gemm( NORMAL, NORMAL, F(1), G, Z, QR );
 }
 
+template<typename F>
+inline void
+SDC
+( Matrix<F>& A, Matrix<Complex<BASE(F)>>& w, Matrix<F>& Q, 
+  bool formATR=true, Int cutoff=256, Int maxInnerIts=2, Int maxOuterIts=10, 
+  BASE(F) signTol=0, BASE(F) relTol=0, BASE(F) spreadFactor=1e-6, 
+  bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SDC"))
+    sign::NewtonWorkspace<F> work;
+    SDC
+    ( A, w, Q, work, formATR, cutoff, maxInnerIts, maxOuterIts, signTol, relTol,
+      spreadFactor, random, progress );
+}
+
 // This routine no longer attempts to evenly assign work/process between two
 // teams since it was found to lead to horrendously non-square process grids
 // in practice, even when the original number of processes was a large power
@@ -1233,7 +1449,8 @@ inline void PullSubproblems
 template<typename F>
 inline void
 SDC
-( DistMatrix<F>& A, DistMatrix<Complex<BASE(F)>>& w, Int cutoff=256, 
+( DistMatrix<F>& A, DistMatrix<Complex<BASE(F)>,VR,STAR>& w,
+  sign::DistNewtonWorkspace<F>& work, Int cutoff=256, 
   Int maxInnerIts=2, Int maxOuterIts=10, BASE(F) signTol=0, BASE(F) relTol=0, 
   BASE(F) spreadFactor=1e-6, bool random=true, bool progress=false )
 {
@@ -1265,10 +1482,28 @@ SDC
     // Perform this level's split
     if( progress && g.Rank() == 0 )
         std::cout << "Splitting " << n << " x " << n << " matrix" << std::endl;
-    const auto part = 
-        SpectralDivide
-        ( A, maxInnerIts, maxOuterIts, signTol, relTol, spreadFactor, 
-          random, progress );
+    ValueInt<BASE(F)> part;
+    std::vector<double> fingerprint, state;
+    if( checkpoint::Enabled() )
+        fingerprint = checkpoint::Fingerprint( A );
+    if( checkpoint::Load( "sdc", A, fingerprint, state ) )
+    {
+        part.value = state[0];
+        part.index = state[1];
+    }
+    else
+    {
+        part = SpectralDivide
+               ( A, work, maxInnerIts, maxOuterIts, signTol, relTol,
+                 spreadFactor, random, progress );
+        if( checkpoint::Enabled() )
+        {
+            state.resize( 2 );
+            state[0] = part.value;
+            state[1] = part.index;
+            checkpoint::Save( "sdc", A, fingerprint, state );
+        }
+    }
     DistMatrix<F> ATL(g), ATR(g),
                   ABL(g), ABR(g);
     PartitionDownDiagonal
@@ -1283,16 +1518,41 @@ SDC
     DistMatrix<Complex<BASE(F)>,VR,STAR> wTSub, wBSub;
     PushSubproblems( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, progress );
     if( ATLSub.Participating() )
+    {
+        checkpoint::Scope scope("L");
         SDC
-        ( ATLSub, wTSub, cutoff, maxInnerIts, maxOuterIts, signTol, relTol, 
-          spreadFactor, random, progress );
+        ( ATLSub, wTSub, work, cutoff, maxInnerIts, maxOuterIts, signTol,
+          relTol, spreadFactor, random, progress );
+    }
     if( ABRSub.Participating() )
+    {
+        checkpoint::Scope scope("R");
         SDC
-        ( ABRSub, wBSub, cutoff, maxInnerIts, maxOuterIts, signTol, relTol, 
-          spreadFactor, random, progress );
+        ( ABRSub, wBSub, work, cutoff, maxInnerIts, maxOuterIts, signTol,
+          relTol, spreadFactor, random, progress );
+    }
+    // Move the workspace back before the subgrids are freed
+    work.SetGrid( g );
     if( progress && g.Rank() == 0 )
         std::cout << "Pulling subproblems" << std::endl;
     PullSubproblems( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, progress );
+
+    // This level's split is no longer needed once the recursion has finished
+    checkpoint::Discard( "sdc", A );
+}
+
+template<typename F>
+inline void
+SDC
+( DistMatrix<F>& A, DistMatrix<Complex<BASE(F)>,VR,STAR>& w, Int cutoff=256,
+  Int maxInnerIts=2, Int maxOuterIts=10, BASE(F) signTol=0, BASE(F) relTol=0, 
+  BASE(F) spreadFactor=1e-6, bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SDC"))
+    sign::DistNewtonWorkspace<F> work( A.Grid() );
+    SDC
+    ( A, w, work, cutoff, maxInnerIts, maxOuterIts, signTol, relTol, 
+      spreadFactor, random, progress );
 }
 
 template<typename F,typename EigType>
@@ -1413,6 +1673,7 @@ template<typename F>
 inline void
 SDC
 ( DistMatrix<F>& A, DistMatrix<Complex<BASE(F)>,VR,STAR>& w, DistMatrix<F>& Q, 
+  sign::DistNewtonWorkspace<F>& work,
   bool formATR=true, Int cutoff=256, Int maxInnerIts=2, Int maxOuterIts=10, 
   BASE(F) signTol=0, BASE(F) relTol=0, BASE(F) spreadFactor=1e-6, 
   bool random=true, bool progress=false )
@@ -1451,10 +1712,32 @@ SDC
     if( progress && g.Rank() == 0 )
         std::cout << "Splitting " << n << " x " << n << " matrix" << std::endl;
     const Real infNorm = InfinityNorm( A );
-    const auto part = 
-        SpectralDivide
-        ( A, Q, maxInnerIts, maxOuterIts, signTol, relTol, spreadFactor, 
-          random, progress );
+    ValueInt<Real> part;
+    std::vector<double> fingerprint, state;
+    if( checkpoint::Enabled() )
+        fingerprint = checkpoint::Fingerprint( A );
+    // The Schur vectors are saved before the matrix so that they are valid
+    // whenever the checkpointed matrix is
+    if( checkpoint::Load( "sdc-Q", Q, fingerprint, state ) &&
+        checkpoint::Load( "sdc", A, fingerprint, state ) )
+    {
+        part.value = state[0];
+        part.index = state[1];
+    }
+    else
+    {
+        part = SpectralDivide
+               ( A, Q, work, maxInnerIts, maxOuterIts, signTol, relTol,
+                 spreadFactor, random, progress );
+        if( checkpoint::Enabled() )
+        {
+            state.resize( 2 );
+            state[0] = part.value;
+            state[1] = part.index;
+            checkpoint::Save( "sdc-Q", Q, fingerprint, state );
+            checkpoint::Save( "sdc", A, fingerprint, state );
+        }
+    }
     DistMatrix<F> ATL(g), ATR(g),
                   ABL(g), ABR(g);
     PartitionDownDiagonal
@@ -1473,15 +1756,23 @@ SDC
     PushSubproblems
     ( ATL, ABR, ATLSub, ABRSub, wT, wB, wTSub, wBSub, ZTSub, ZBSub, progress );
     if( ATLSub.Participating() )
+    {
+        checkpoint::Scope scope("L");
         SDC
-        ( ATLSub, wTSub, ZTSub, formATR, cutoff, maxInnerIts, maxOuterIts, 
+        ( ATLSub, wTSub, ZTSub, work, formATR, cutoff, maxInnerIts, maxOuterIts,
           signTol, relTol, spreadFactor, random, progress );
+    }
     if( ABRSub.Participating() )
+    {
+        checkpoint::Scope scope("R");
         SDC
-        ( ABRSub, wBSub, ZBSub, formATR, cutoff, maxInnerIts, maxOuterIts, 
+        ( ABRSub, wBSub, ZBSub, work, formATR, cutoff, maxInnerIts, maxOuterIts,
           signTol, relTol, spreadFactor, random, progress );
+    }
     
-    // Ensure that the results are back on this level's grid
+    // Ensure that the results are back on this level's grid (including the
+    // workspace, before the subgrids are freed)
+    work.SetGrid( g );
     if( progress && g.Rank() == 0 )
         std::cout << "Pulling subproblems" << std::endl;
     DistMatrix<F> ZT(g), ZB(g);
@@ -1505,6 +1796,25 @@ SDC
         Gemm( ADJOINT, NORMAL, F(1), ZT, ATR, G );
         Gemm( NORMAL, NORMAL, F(1), G, ZB, ATR ); 
     }
+
+    // This level's split is no longer needed once the recursion has finished
+    checkpoint::Discard( "sdc", A );
+    checkpoint::Discard( "sdc-Q", Q );
+}
+
+template<typename F>
+inline void
+SDC
+( DistMatrix<F>& A, DistMatrix<Complex<BASE(F)>,VR,STAR>& w, DistMatrix<F>& Q, 
+  bool formATR=true, Int cutoff=256, Int maxInnerIts=2, Int maxOuterIts=10, 
+  BASE(F) signTol=0, BASE(F) relTol=0, BASE(F) spreadFactor=1e-6, 
+  bool random=true, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::SDC"))
+    sign::DistNewtonWorkspace<F> work( A.Grid() );
+    SDC
+    ( A, w, Q, work, formATR, cutoff, maxInnerIts, maxOuterIts, signTol, relTol,
+      spreadFactor, random, progress );
 }
 
 } // namespace schur
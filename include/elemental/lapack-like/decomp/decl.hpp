@@ -24,6 +24,25 @@ enum HermitianGenDefiniteEigType
 }
 using namespace hermitian_gen_definite_eig_type_wrapper;
 
+namespace hermitian_tridiag_eig_alg_wrapper {
+enum HermitianTridiagEigAlg
+{
+    HERMITIAN_TRIDIAG_EIG_MRRR, // Multiple Relatively Robust Representations
+    HERMITIAN_TRIDIAG_EIG_DC    // Cuppen's divide and conquer
+};
+}
+using namespace hermitian_tridiag_eig_alg_wrapper;
+
+namespace polar_alg_wrapper {
+enum PolarAlg
+{
+    POLAR_SVD,      // Via an SVD (or, if Hermitian, an eigendecomposition)
+    POLAR_QDWH,     // QR-based dynamically weighted Halley iteration
+    POLAR_ZOLOTAREV // Zolotarev's rational approximation of the sign
+};
+}
+using namespace polar_alg_wrapper;
+
 // Compute the eigenvalues of a Hermitian matrix
 template<typename F>
 void HermitianEig
@@ -51,7 +70,8 @@ template<typename F>
 void HermitianEig
 ( UpperOrLower uplo, 
   DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& w, DistMatrix<F>& paddedZ,
-  SortType sort=UNSORTED );
+  SortType sort=UNSORTED, 
+  HermitianTridiagEigAlg alg=HERMITIAN_TRIDIAG_EIG_MRRR );
 
 // Compute the eigenvalues of a Hermitian matrix within a selected range
 template<typename F>
@@ -15,6 +15,7 @@
 #include "./QR/Cholesky.hpp"
 #include "./QR/Householder.hpp"
 #include "./QR/Explicit.hpp"
+#include "./QR/StackedIdentity.hpp"
 #include "./QR/TS.hpp"
 
 namespace elem {
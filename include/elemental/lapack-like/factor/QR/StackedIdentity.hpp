@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_QR_STACKEDIDENTITY_HPP
+#define ELEM_QR_STACKEDIDENTITY_HPP
+
+#include ELEM_ZEROS_INC
+#include ELEM_SETDIAGONAL_INC
+
+#include "./ApplyQ.hpp"
+#include "./PanelHouseholder.hpp"
+
+namespace elem {
+namespace qr {
+
+// Householder QR of an (m+n) x n matrix of the form
+//
+//     A = [ X ]
+//         [ I ],
+//
+// where X is m x n and I is the n x n identity. The Householder vector for
+// column j is only nonzero within rows j through m+j (the bottom block fills
+// in above its diagonal, but stays zero below it), so each block of
+// reflectors, and its application, can be restricted to the rows
+// [k,m+k+nb), rather than [k,m+n), which avoids operating on the known
+// zeros of the identity. The output has the same format as qr::Householder,
+// and so the factorization can be applied with qr::ApplyQ.
+
+template<typename F>
+inline void
+StackedIdentity( Matrix<F>& A, Matrix<F>& t )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::StackedIdentity");
+        if( A.Height() < A.Width() )
+            LogicError("A must be at least as tall as it is wide");
+    )
+    const Int n = A.Width();
+    const Int m = A.Height() - n;
+    t.Resize( n, 1 );
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto AB1 = ViewRange( A, k, k,    m+k+nb, k+nb );
+        auto AB2 = ViewRange( A, k, k+nb, m+k+nb, n    );
+        auto t1 = View( t, k, 0, nb, 1 );
+
+        PanelHouseholder( AB1, t1 );
+        ApplyQ( LEFT, ADJOINT, AB1, t1, AB2 );
+    }
+}
+
+template<typename F>
+inline void
+StackedIdentity( DistMatrix<F>& A, DistMatrix<F,MD,STAR>& t )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("qr::StackedIdentity");
+        if( A.Grid() != t.Grid() )
+            LogicError("{A,t} must be distributed over the same grid");
+        if( A.Height() < A.Width() )
+            LogicError("A must be at least as tall as it is wide");
+    )
+    t.SetRoot( A.DiagonalRoot() );
+    t.AlignCols( A.DiagonalAlign() );
+
+    const Int n = A.Width();
+    const Int m = A.Height() - n;
+    t.Resize( n, 1 );
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto AB1 = ViewRange( A, k, k,    m+k+nb, k+nb );
+        auto AB2 = ViewRange( A, k, k+nb, m+k+nb, n    );
+        auto t1 = View( t, k, 0, nb, 1 );
+
+        PanelHouseholder( AB1, t1 );
+        ApplyQ( LEFT, ADJOINT, AB1, t1, AB2 );
+    }
+}
+
+// Overwrite A = [X; I] with the first n columns of the unitary factor of its
+// QR decomposition. The blocks of reflectors are accumulated in reverse
+// order, and, since the first k columns of the partially accumulated Q are
+// still those of the identity when block k is reached, only the trailing
+// columns within rows [k,m+k+nb) need to be updated.
+
+template<typename F>
+inline void
+ExplicitStackedIdentity( Matrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::ExplicitStackedIdentity"))
+    Matrix<F> t;
+    StackedIdentity( A, t );
+
+    const Int n = A.Width();
+    const Int m = A.Height() - n;
+    const Int bsize = Blocksize();
+    const Int firstBlocksize = ( n % bsize == 0 ? bsize : n % bsize );
+    Matrix<F> HPan;
+    for( Int k=n-firstBlocksize; k>=0; k-=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto A1 = ViewRange( A, 0, k, m+k+nb, k+nb );
+        auto AB1 = ViewRange( A, k, k, m+k+nb, k+nb );
+        auto AB = ViewRange( A, k, k, m+k+nb, n );
+        auto t1 = View( t, k, 0, nb, 1 );
+
+        HPan = AB1;
+        MakeZeros( A1 );
+        SetDiagonal( AB1, F(1) );
+        ApplyQ( LEFT, NORMAL, HPan, t1, AB );
+    }
+}
+
+template<typename F>
+inline void
+ExplicitStackedIdentity( DistMatrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::ExplicitStackedIdentity"))
+    const Grid& g = A.Grid();
+    DistMatrix<F,MD,STAR> t(g);
+    StackedIdentity( A, t );
+
+    const Int n = A.Width();
+    const Int m = A.Height() - n;
+    const Int bsize = Blocksize();
+    const Int firstBlocksize = ( n % bsize == 0 ? bsize : n % bsize );
+    for( Int k=n-firstBlocksize; k>=0; k-=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        auto A1 = ViewRange( A, 0, k, m+k+nb, k+nb );
+        auto AB1 = ViewRange( A, k, k, m+k+nb, k+nb );
+        auto AB = ViewRange( A, k, k, m+k+nb, n );
+        auto t1 = View( t, k, 0, nb, 1 );
+
+        // Keep the copy of the reflectors aligned with t1
+        DistMatrix<F> HPan(g);
+        HPan.AlignWith( AB1 );
+        HPan = AB1;
+        MakeZeros( A1 );
+        SetDiagonal( AB1, F(1) );
+        ApplyQ( LEFT, NORMAL, HPan, t1, AB );
+    }
+}
+
+} // namespace qr
+} // namespace elem
+
+#endif // ifndef ELEM_QR_STACKEDIDENTITY_HPP
@@ -21,6 +21,8 @@
 
 #include ELEM_HERMITIANFROMEVD_INC
 
+#include ELEM_CHECKPOINT_INC
+
 // See Chapter 5 of Nicholas J. Higham's "Functions of Matrices: Theory and
 // Computation", which is currently available at:
 // http://www.siam.org/books/ot104/OT104HighamChapter5.pdf
@@ -28,17 +30,45 @@
 namespace elem {
 namespace sign {
 
+// Storage for the Newton iteration which may be reused across calls (e.g.,
+// by each outer iteration of a spectral divide), so that, once it has been
+// sized, the iterates and pivot vectors are not reallocated
+template<typename F>
+struct NewtonWorkspace
+{
+    Matrix<F> XNew;
+    Matrix<Int> p;
+};
+
+template<typename F>
+struct DistNewtonWorkspace
+{
+    DistMatrix<F> XNew;
+    DistMatrix<Int,VC,STAR> p;
+
+    DistNewtonWorkspace( const Grid& g=DefaultGrid() )
+    : XNew(g), p(g)
+    { }
+
+    // Switching grids discards any existing storage
+    void SetGrid( const Grid& g )
+    {
+        XNew.SetGrid( g );
+        p.SetGrid( g );
+    }
+};
+
 template<typename F>
 inline void
 NewtonStep
-( const Matrix<F>& X, Matrix<F>& XNew, SignScaling scaling=SIGN_SCALE_FROB )
+( const Matrix<F>& X, Matrix<F>& XNew, Matrix<Int>& p,
+  SignScaling scaling=SIGN_SCALE_FROB )
 {
     DEBUG_ONLY(CallStackEntry cse("sign::NewtonStep"))
     typedef Base<F> Real;
 
     // Calculate mu while forming XNew := inv(X)
     Real mu;
-    Matrix<Int> p;
     XNew = X;
     LU( XNew, p );
     if( scaling == SIGN_SCALE_DET )
@@ -62,7 +92,17 @@ NewtonStep
 template<typename F>
 inline void
 NewtonStep
-( const DistMatrix<F>& X, DistMatrix<F>& XNew, 
+( const Matrix<F>& X, Matrix<F>& XNew, SignScaling scaling=SIGN_SCALE_FROB )
+{
+    DEBUG_ONLY(CallStackEntry cse("sign::NewtonStep"))
+    Matrix<Int> p;
+    NewtonStep( X, XNew, p, scaling );
+}
+
+template<typename F>
+inline void
+NewtonStep
+( const DistMatrix<F>& X, DistMatrix<F>& XNew, DistMatrix<Int,VC,STAR>& p,
   SignScaling scaling=SIGN_SCALE_FROB )
 {
     DEBUG_ONLY(CallStackEntry cse("sign::NewtonStep"))
@@ -70,7 +110,6 @@ NewtonStep
 
     // Calculate mu while forming B := inv(X)
     Real mu;
-    DistMatrix<Int,VC,STAR> p( X.Grid() );
     XNew = X;
     LU( XNew, p );
     if( scaling == SIGN_SCALE_DET )
@@ -91,6 +130,17 @@ NewtonStep
     Axpy( halfMu, X, XNew );
 }
 
+template<typename F>
+inline void
+NewtonStep
+( const DistMatrix<F>& X, DistMatrix<F>& XNew,
+  SignScaling scaling=SIGN_SCALE_FROB )
+{
+    DEBUG_ONLY(CallStackEntry cse("sign::NewtonStep"))
+    DistMatrix<Int,VC,STAR> p( X.Grid() );
+    NewtonStep( X, XNew, p, scaling );
+}
+
 template<typename F>
 inline void
 NewtonSchulzStep( const Matrix<F>& X, Matrix<F>& XTmp, Matrix<F>& XNew )
@@ -130,8 +180,8 @@ NewtonSchulzStep
 template<typename F>
 inline Int
 Newton
-( Matrix<F>& A, SignScaling scaling=SIGN_SCALE_FROB, Int maxIts=100, 
-  BASE(F) tol=0, BASE(F) p=1, bool progress=false )
+( Matrix<F>& A, NewtonWorkspace<F>& work, SignScaling scaling=SIGN_SCALE_FROB,
+  Int maxIts=100, BASE(F) tol=0, BASE(F) p=1, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("sign::Newton"))
     typedef Base<F> Real;
@@ -139,12 +189,11 @@ Newton
         tol = A.Height()*lapack::MachineEpsilon<Real>();
 
     Int numIts=0;
-    Matrix<F> B;
-    Matrix<F> *X=&A, *XNew=&B;
+    Matrix<F> *X=&A, *XNew=&work.XNew;
     while( numIts < maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, scaling );
+        NewtonStep( *X, *XNew, work.p, scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -170,8 +219,20 @@ Newton
 template<typename F>
 inline Int
 Newton
-( DistMatrix<F>& A, SignScaling scaling=SIGN_SCALE_FROB,
-  Int maxIts=100, BASE(F) tol=0, BASE(F) p=1, bool progress=false )
+( Matrix<F>& A, SignScaling scaling=SIGN_SCALE_FROB, Int maxIts=100,
+  BASE(F) tol=0, BASE(F) p=1, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("sign::Newton"))
+    NewtonWorkspace<F> work;
+    return Newton( A, work, scaling, maxIts, tol, p, progress );
+}
+
+template<typename F>
+inline Int
+Newton
+( DistMatrix<F>& A, DistNewtonWorkspace<F>& work,
+  SignScaling scaling=SIGN_SCALE_FROB, Int maxIts=100, BASE(F) tol=0,
+  BASE(F) p=1, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("sign::Newton"))
     typedef Base<F> Real;
@@ -179,12 +240,23 @@ Newton
         tol = A.Height()*lapack::MachineEpsilon<Real>();
 
     Int numIts=0;
-    DistMatrix<F> B( A.Grid() );
-    DistMatrix<F> *X=&A, *XNew=&B;
+    bool converged=false;
+    work.SetGrid( A.Grid() );
+    DistMatrix<F> *X=&A, *XNew=&work.XNew;
+
+    // Resume from a checkpointed iterate if possible
+    std::vector<double> fingerprint, state;
+    if( checkpoint::Enabled() )
+    {
+        fingerprint = checkpoint::Fingerprint( A );
+        if( checkpoint::Load( "sign", A, fingerprint, state ) )
+            numIts = state[0];
+    }
+
     while( numIts < maxIts )
     {
         // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, scaling );
+        NewtonStep( *X, *XNew, work.p, scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
@@ -194,19 +266,38 @@ Newton
         // Ensure that X holds the current iterate and break if possible
         ++numIts;
         std::swap( X, XNew );
+        if( checkpoint::Due(numIts) )
+            checkpoint::Save
+            ( "sign", *X, fingerprint, std::vector<double>(1,numIts) );
         if( progress && A.Grid().Rank() == 0 )
             std::cout << "after " << numIts << " Newton iter's: "
                       << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
                       << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol=" 
                       << tol << std::endl;
         if( oneDiff/oneNew <= Pow(oneNew,p)*tol )
+        {
+            converged = true;
             break;
+        }
     }
     if( X != &A )
         A = *X;
+    if( converged )
+        checkpoint::Discard( "sign", A );
     return numIts;
 }
 
+template<typename F>
+inline Int
+Newton
+( DistMatrix<F>& A, SignScaling scaling=SIGN_SCALE_FROB,
+  Int maxIts=100, BASE(F) tol=0, BASE(F) p=1, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("sign::Newton"))
+    DistNewtonWorkspace<F> work( A.Grid() );
+    return Newton( A, work, scaling, maxIts, tol, p, progress );
+}
+
 // TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
 
 } // namespace sign
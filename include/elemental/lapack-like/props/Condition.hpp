@@ -10,6 +10,7 @@
 #ifndef ELEM_CONDITION_HPP
 #define ELEM_CONDITION_HPP
 
+#include "./Condition/Estimate.hpp"
 #include "./Condition/Frobenius.hpp"
 #include "./Condition/Infinity.hpp"
 #include "./Condition/Max.hpp"
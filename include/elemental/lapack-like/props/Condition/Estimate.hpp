@@ -0,0 +1,453 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_CONDITION_ESTIMATE_HPP
+#define ELEM_CONDITION_ESTIMATE_HPP
+
+#include ELEM_SCALE_INC
+#include ELEM_ZERO_INC
+
+#include ELEM_CHOLESKY_INC
+#include ELEM_LU_INC
+#include ELEM_INFINITYNORM_INC
+#include ELEM_ONENORM_INC
+
+// Estimates of ||inv(A)||_1 and ||inv(A)||_oo which only require a few solves
+// against an existing LU or Cholesky factorization, rather than the explicit
+// formation of inv(A). The block 1-norm estimator of Higham and Tisseur,
+// "A block algorithm for matrix 1-norm estimation, with an application to
+// 1-norm pseudospectra", is used: each iteration applies inv(A) and inv(A)^H
+// to a block of 'numCols' vectors, so that, in the distributed case, the
+// latency of the triangular solves is amortized over the whole block. The
+// n x numCols iterates are stored redundantly on every process.
+
+namespace elem {
+
+namespace internal {
+
+template<typename F>
+inline bool
+ColumnsParallel( const Matrix<F>& S, Int j, const Matrix<F>& T, Int k )
+{
+    const Int n = S.Height();
+    const F* SCol = S.LockedBuffer(0,j);
+    const F* TCol = T.LockedBuffer(0,k);
+    F dot = 0;
+    for( Int i=0; i<n; ++i )
+        dot += SCol[i]*TCol[i];
+    return Abs(dot) == Base<F>(n);
+}
+
+// Returns an estimate of ||B||_1, where apply(X) overwrites X with B X and
+// applyAdj(X) overwrites X with B^H X
+template<typename F,class Apply,class ApplyAdj>
+inline BASE(F)
+OneNormEstimate
+( Int n, Int numCols, Apply apply, ApplyAdj applyAdj, Int maxIts=5 )
+{
+    DEBUG_ONLY(CallStackEntry cse("internal::OneNormEstimate"))
+    typedef Base<F> Real;
+    if( n == 0 )
+        return 0;
+    const Int t = Min( Max(numCols,Int(1)), n );
+    const bool real = !IsComplex<F>::val;
+
+    // The same stream is generated on every process so that the redundant
+    // iterates remain consistent
+    std::mt19937 gen( 1 );
+    auto randomSigns = [&]( Matrix<F>& S, Int j )
+    {
+        F* SCol = S.Buffer(0,j);
+        for( Int i=0; i<n; ++i )
+            SCol[i] = ( gen() & 1 ? F(1) : F(-1) );
+    };
+
+    // X := [ones(n,1), random signs] / n, with no two columns parallel
+    Matrix<F> X( n, t ), Y, S( n, t ), SOld( n, t );
+    for( Int i=0; i<n; ++i )
+        S.Set( i, 0, F(1) );
+    for( Int j=1; j<t; ++j )
+    {
+        Int numTries = 0;
+        bool parallel;
+        do
+        {
+            randomSigns( S, j );
+            parallel = false;
+            for( Int k=0; k<j; ++k )
+                parallel = parallel || ColumnsParallel( S, j, S, k );
+        } while( parallel && ++numTries < n );
+    }
+    X = S;
+    Scale( F(1)/F(n), X );
+
+    std::vector<bool> visited( n, false );
+    std::vector<Int> ind( n );
+    std::vector<Real> h( n );
+    Real est=0, estOld=0;
+    Int indBest=0;
+    for( Int k=1; ; ++k )
+    {
+        Y = X;
+        apply( Y );
+
+        Int jBest = 0;
+        est = 0;
+        for( Int j=0; j<t; ++j )
+        {
+            const F* YCol = Y.LockedBuffer(0,j);
+            Real colNorm = 0;
+            for( Int i=0; i<n; ++i )
+                colNorm += Abs(YCol[i]);
+            if( colNorm > est )
+            {
+                est = colNorm;
+                jBest = j;
+            }
+        }
+        if( k >= 2 && (est > estOld || k == 2) )
+            indBest = ind[jBest];
+        if( k >= 2 && est <= estOld )
+        {
+            est = estOld;
+            break;
+        }
+        estOld = est;
+        if( k > maxIts )
+            break;
+
+        // S := sign(Y)
+        SOld = S;
+        for( Int j=0; j<t; ++j )
+        {
+            const F* YCol = Y.LockedBuffer(0,j);
+            F* SCol = S.Buffer(0,j);
+            for( Int i=0; i<n; ++i )
+            {
+                const Real alpha = Abs(YCol[i]);
+                if( real )
+                    SCol[i] = ( RealPart(YCol[i]) >= 0 ? F(1) : F(-1) );
+                else
+                    SCol[i] = ( alpha == Real(0) ? F(1) : YCol[i]/alpha );
+            }
+        }
+        if( real )
+        {
+            // Stop if every column of S is parallel to a column of SOld
+            bool allParallel = true;
+            for( Int j=0; j<t; ++j )
+            {
+                bool parallel = false;
+                for( Int l=0; l<t; ++l )
+                    parallel = parallel || ColumnsParallel( S, j, SOld, l );
+                allParallel = allParallel && parallel;
+            }
+            if( k > 1 && allParallel )
+                break;
+
+            // Resample the columns parallel to an earlier column or to SOld
+            for( Int j=1; j<t; ++j )
+            {
+                Int numTries = 0;
+                while( numTries++ < n )
+                {
+                    bool parallel = false;
+                    for( Int l=0; l<j; ++l )
+                        parallel = parallel || ColumnsParallel( S, j, S, l );
+                    for( Int l=0; l<t; ++l )
+                        parallel = parallel || ColumnsParallel( S, j, SOld, l );
+                    if( !parallel )
+                        break;
+                    randomSigns( S, j );
+                }
+            }
+        }
+
+        // h_i := || (B^H S)(i,:) ||_oo
+        Matrix<F> Z( S );
+        applyAdj( Z );
+        Real hMax = 0;
+        for( Int i=0; i<n; ++i )
+        {
+            h[i] = 0;
+            for( Int j=0; j<t; ++j )
+                h[i] = Max( h[i], Abs(Z.Get(i,j)) );
+            hMax = Max( hMax, h[i] );
+            ind[i] = i;
+        }
+        if( k >= 2 && hMax == h[indBest] )
+            break;
+        std::stable_sort
+        ( ind.begin(), ind.end(),
+          [&]( Int i0, Int i1 ) { return h[i0] > h[i1]; } );
+
+        // Move on to the (up to) t most promising unit vectors not yet used
+        if( t > 1 )
+        {
+            bool allVisited = true;
+            for( Int j=0; j<t; ++j )
+                allVisited = allVisited && visited[ind[j]];
+            if( allVisited )
+                break;
+            Int numFresh = 0;
+            for( Int l=0; l<n && numFresh<t; ++l )
+                if( !visited[ind[l]] )
+                    ind[numFresh++] = ind[l];
+            if( numFresh < t )
+                break;
+        }
+        Zero( X );
+        for( Int j=0; j<t; ++j )
+        {
+            X.Set( ind[j], j, F(1) );
+            visited[ind[j]] = true;
+        }
+    }
+
+    // Guard against pathological cases with the alternating-sign vector of
+    // Higham's "FORTRAN codes for estimating the one-norm of a real or complex
+    // matrix, with applications to condition estimation"
+    if( n > 1 )
+    {
+        Matrix<F> x( n, 1 );
+        for( Int i=0; i<n; ++i )
+        {
+            const Real sign = ( i % 2 == 0 ? Real(1) : Real(-1) );
+            x.Set( i, 0, sign*(1+Real(i)/Real(n-1)) );
+        }
+        apply( x );
+        Real xNorm = 0;
+        for( Int i=0; i<n; ++i )
+            xNorm += Abs(x.Get(i,0));
+        est = Max( est, 2*xNorm/(3*n) );
+    }
+    return est;
+}
+
+// Applies a distributed operator to a block held redundantly on each process
+template<typename F,class Apply>
+inline void
+ApplyToRedundant( const Grid& g, Matrix<F>& X, Apply apply )
+{
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( X.Height(), X.Width(), g );
+    X_STAR_STAR.Matrix() = X;
+    DistMatrix<F> XDist( X_STAR_STAR );
+    apply( XDist );
+    X_STAR_STAR = XDist;
+    X = X_STAR_STAR.LockedMatrix();
+}
+
+template<typename F,class Apply,class ApplyAdj>
+inline BASE(F)
+DistOneNormEstimate
+( const Grid& g, Int n, Int numCols, Apply apply, ApplyAdj applyAdj )
+{
+    return OneNormEstimate<F>
+    ( n, numCols,
+      [&]( Matrix<F>& X ) { ApplyToRedundant( g, X, apply ); },
+      [&]( Matrix<F>& X ) { ApplyToRedundant( g, X, applyAdj ); } );
+}
+
+} // namespace internal
+
+namespace lu {
+
+// Estimates of ||inv(A)||_1 given the LU factorization of A
+
+template<typename F>
+inline BASE(F)
+InverseOneNormEstimate( const Matrix<F>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::InverseOneNormEstimate"))
+    return internal::OneNormEstimate<F>
+    ( A.Height(), numCols,
+      [&]( Matrix<F>& X ) { SolveAfter( NORMAL, A, X ); },
+      [&]( Matrix<F>& X ) { SolveAfter( ADJOINT, A, X ); } );
+}
+
+template<typename F>
+inline BASE(F)
+InverseOneNormEstimate
+( const Matrix<F>& A, const Matrix<Int>& p, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::InverseOneNormEstimate"))
+    return internal::OneNormEstimate<F>
+    ( A.Height(), numCols,
+      [&]( Matrix<F>& X ) { SolveAfter( NORMAL, A, p, X ); },
+      [&]( Matrix<F>& X ) { SolveAfter( ADJOINT, A, p, X ); } );
+}
+
+template<typename F>
+inline BASE(F)
+InverseOneNormEstimate( const DistMatrix<F>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::InverseOneNormEstimate"))
+    return internal::DistOneNormEstimate<F>
+    ( A.Grid(), A.Height(), numCols,
+      [&]( DistMatrix<F>& X ) { SolveAfter( NORMAL, A, X ); },
+      [&]( DistMatrix<F>& X ) { SolveAfter( ADJOINT, A, X ); } );
+}
+
+template<typename F>
+inline BASE(F)
+InverseOneNormEstimate
+( const DistMatrix<F>& A, const DistMatrix<Int,VC,STAR>& p, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::InverseOneNormEstimate"))
+    return internal::DistOneNormEstimate<F>
+    ( A.Grid(), A.Height(), numCols,
+      [&]( DistMatrix<F>& X ) { SolveAfter( NORMAL, A, p, X ); },
+      [&]( DistMatrix<F>& X ) { SolveAfter( ADJOINT, A, p, X ); } );
+}
+
+// Estimates of ||inv(A)||_oo = ||inv(A)^H||_1 given the LU factorization of A
+
+template<typename F>
+inline BASE(F)
+InverseInfinityNormEstimate( const Matrix<F>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::InverseInfinityNormEstimate"))
+    return internal::OneNormEstimate<F>
+    ( A.Height(), numCols,
+      [&]( Matrix<F>& X ) { SolveAfter( ADJOINT, A, X ); },
+      [&]( Matrix<F>& X ) { SolveAfter( NORMAL, A, X ); } );
+}
+
+template<typename F>
+inline BASE(F)
+InverseInfinityNormEstimate
+( const Matrix<F>& A, const Matrix<Int>& p, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::InverseInfinityNormEstimate"))
+    return internal::OneNormEstimate<F>
+    ( A.Height(), numCols,
+      [&]( Matrix<F>& X ) { SolveAfter( ADJOINT, A, p, X ); },
+      [&]( Matrix<F>& X ) { SolveAfter( NORMAL, A, p, X ); } );
+}
+
+template<typename F>
+inline BASE(F)
+InverseInfinityNormEstimate( const DistMatrix<F>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::InverseInfinityNormEstimate"))
+    return internal::DistOneNormEstimate<F>
+    ( A.Grid(), A.Height(), numCols,
+      [&]( DistMatrix<F>& X ) { SolveAfter( ADJOINT, A, X ); },
+      [&]( DistMatrix<F>& X ) { SolveAfter( NORMAL, A, X ); } );
+}
+
+template<typename F>
+inline BASE(F)
+InverseInfinityNormEstimate
+( const DistMatrix<F>& A, const DistMatrix<Int,VC,STAR>& p, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::InverseInfinityNormEstimate"))
+    return internal::DistOneNormEstimate<F>
+    ( A.Grid(), A.Height(), numCols,
+      [&]( DistMatrix<F>& X ) { SolveAfter( ADJOINT, A, p, X ); },
+      [&]( DistMatrix<F>& X ) { SolveAfter( NORMAL, A, p, X ); } );
+}
+
+} // namespace lu
+
+namespace cholesky {
+
+// An estimate of ||inv(A)||_1 = ||inv(A)||_oo given the Cholesky factor of
+// the Hermitian positive-definite matrix A
+
+template<typename F>
+inline BASE(F)
+InverseOneNormEstimate( UpperOrLower uplo, const Matrix<F>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::InverseOneNormEstimate"))
+    auto applyInv = [&]( Matrix<F>& X ) { SolveAfter( uplo, NORMAL, A, X ); };
+    return internal::OneNormEstimate<F>
+    ( A.Height(), numCols, applyInv, applyInv );
+}
+
+template<typename F>
+inline BASE(F)
+InverseOneNormEstimate
+( UpperOrLower uplo, const DistMatrix<F>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::InverseOneNormEstimate"))
+    auto applyInv =
+      [&]( DistMatrix<F>& X ) { SolveAfter( uplo, NORMAL, A, X ); };
+    return internal::DistOneNormEstimate<F>
+    ( A.Grid(), A.Height(), numCols, applyInv, applyInv );
+}
+
+} // namespace cholesky
+
+// Estimates of the one and infinity condition numbers from a single LU
+// factorization with partial pivoting (rather than an explicit inverse)
+
+template<typename F>
+inline BASE(F)
+OneConditionEstimate( const Matrix<F>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("OneConditionEstimate"))
+    typedef Base<F> Real;
+    const Real oneNorm = OneNorm( A );
+    Matrix<F> B( A );
+    Matrix<Int> p;
+    try { LU( B, p ); }
+    catch( SingularMatrixException& e )
+    { return std::numeric_limits<Real>::infinity(); }
+    return oneNorm*lu::InverseOneNormEstimate( B, p, numCols );
+}
+
+template<typename F,Dist U,Dist V>
+inline BASE(F)
+OneConditionEstimate( const DistMatrix<F,U,V>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("OneConditionEstimate"))
+    typedef Base<F> Real;
+    const Real oneNorm = OneNorm( A );
+    DistMatrix<F> B( A );
+    DistMatrix<Int,VC,STAR> p( A.Grid() );
+    try { LU( B, p ); }
+    catch( SingularMatrixException& e )
+    { return std::numeric_limits<Real>::infinity(); }
+    return oneNorm*lu::InverseOneNormEstimate( B, p, numCols );
+}
+
+template<typename F>
+inline BASE(F)
+InfinityConditionEstimate( const Matrix<F>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("InfinityConditionEstimate"))
+    typedef Base<F> Real;
+    const Real infNorm = InfinityNorm( A );
+    Matrix<F> B( A );
+    Matrix<Int> p;
+    try { LU( B, p ); }
+    catch( SingularMatrixException& e )
+    { return std::numeric_limits<Real>::infinity(); }
+    return infNorm*lu::InverseInfinityNormEstimate( B, p, numCols );
+}
+
+template<typename F,Dist U,Dist V>
+inline BASE(F)
+InfinityConditionEstimate( const DistMatrix<F,U,V>& A, Int numCols=2 )
+{
+    DEBUG_ONLY(CallStackEntry cse("InfinityConditionEstimate"))
+    typedef Base<F> Real;
+    const Real infNorm = InfinityNorm( A );
+    DistMatrix<F> B( A );
+    DistMatrix<Int,VC,STAR> p( A.Grid() );
+    try { LU( B, p ); }
+    catch( SingularMatrixException& e )
+    { return std::numeric_limits<Real>::infinity(); }
+    return infNorm*lu::InverseInfinityNormEstimate( B, p, numCols );
+}
+
+} // namespace elem
+
+#endif // ifndef ELEM_CONDITION_ESTIMATE_HPP
@@ -10,6 +10,8 @@
 #ifndef ELEM_NORM_ENTRYWISE_HPP
 #define ELEM_NORM_ENTRYWISE_HPP
 
+#include ELEM_ENTRYWISEREDUCE_INC
+
 namespace elem {
 
 template<typename F> 
@@ -18,13 +20,10 @@ EntrywiseNorm( const Matrix<F>& A, BASE(F) p )
 {
     DEBUG_ONLY(CallStackEntry cse("EntrywiseNorm"))
     // TODO: Make this more numerically stable
-    typedef Base<F> R;
-    R sum = 0;
-    const Int width = A.Width();
-    const Int height = A.Height();
-    for( Int j=0; j<width; ++j )
-        for( Int i=0; i<height; ++i )
-            sum += Pow( Abs(A.Get(i,j)), p );
+    typedef Base<F> Real;
+    const Real sum = EntrywiseReduce
+    ( A, Real(0), [p]( F alpha ) { return Pow(Abs(alpha),p); },
+      SumReduction<Real>() );
     return Pow( sum, 1/p );
 }
 
@@ -38,38 +37,9 @@ HermitianEntrywiseNorm
         LogicError("Hermitian matrices must be square.");
 
     // TODO: make this more numerically stable
-    typedef Base<F> R;
-    R sum = 0;
-    const Int height = A.Height();
-    const Int width = A.Width();
-    if( uplo == UPPER )
-    {
-        for( Int j=0; j<width; ++j )
-        {
-            for( Int i=0; i<j; ++i )
-            {
-                const R term = Pow( Abs(A.Get(i,j)), p );
-                if( i ==j )
-                    sum += term;
-                else
-                    sum += 2*term;
-            }
-        }
-    }
-    else
-    {
-        for( Int j=0; j<width; ++j )
-        {
-            for( Int i=j+1; i<height; ++i )
-            {
-                const R term = Pow( Abs(A.Get(i,j)), p );
-                if( i ==j )
-                    sum += term;
-                else
-                    sum += 2*term;
-            }
-        }
-    }
+    // The strictly triangular entries are counted twice
+    const BASE(F) sum = HermitianEntrywiseSum
+    ( uplo, A, [p]( F alpha ) { return Pow(Abs(alpha),p); } );
     return Pow( sum, 1/p );
 }
 
@@ -88,20 +58,10 @@ EntrywiseNorm( const DistMatrix<F,U,V>& A, BASE(F) p )
 {
     DEBUG_ONLY(CallStackEntry cse("EntrywiseNorm"))
     typedef Base<F> Real;
-    Real norm;
-    if( A.Participating() )
-    {
-        Real localSum = 0;
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                localSum += Pow( Abs(A.GetLocal(iLoc,jLoc)), p ); 
-        const Real sum = mpi::AllReduce( localSum, A.DistComm() );
-        norm = Pow( sum, 1/p );
-    }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
-    return norm;
+    const Real sum = EntrywiseReduce
+    ( A, Real(0), [p]( F alpha ) { return Pow(Abs(alpha),p); },
+      SumReduction<Real>() );
+    return Pow( sum, 1/p );
 }
 
 template<typename F>
@@ -112,51 +72,8 @@ HermitianEntrywiseNorm( UpperOrLower uplo, const DistMatrix<F>& A, BASE(F) p )
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square.");
 
-    const Int r = A.Grid().Height();
-    const Int c = A.Grid().Width();
-    const Int colShift = A.ColShift();
-    const Int rowShift = A.RowShift();
-
-    typedef Base<F> R;
-    R localSum = 0;
-    const Int localWidth = A.LocalWidth();
-    if( uplo == UPPER )
-    {
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            Int j = rowShift + jLoc*c;
-            Int numUpperRows = Length(j+1,colShift,r);
-            for( Int iLoc=0; iLoc<numUpperRows; ++iLoc )
-            {
-                Int i = colShift + iLoc*r;
-                const R term = Pow( Abs(A.GetLocal(iLoc,jLoc)), p );
-                if( i ==j )
-                    localSum += term;
-                else
-                    localSum += 2*term;
-            }
-        }
-    }
-    else
-    {
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            Int j = rowShift + jLoc*c;
-            Int numStrictlyUpperRows = Length(j,colShift,r);
-            for( Int iLoc=numStrictlyUpperRows;
-                 iLoc<A.LocalHeight(); ++iLoc )
-            {
-                Int i = colShift + iLoc*r;
-                const R term = Pow( Abs(A.GetLocal(iLoc,jLoc)), p );
-                if( i ==j )
-                    localSum += term;
-                else
-                    localSum += 2*term;
-            }
-        }
-    }
-
-    const R sum = mpi::AllReduce( localSum, A.Grid().VCComm() );
+    const BASE(F) sum = HermitianEntrywiseSum
+    ( uplo, A, [p]( F alpha ) { return Pow(Abs(alpha),p); } );
     return Pow( sum, 1/p );
 }
 
@@ -10,6 +10,8 @@
 #ifndef ELEM_NORM_ENTRYWISEONE_HPP
 #define ELEM_NORM_ENTRYWISEONE_HPP
 
+#include ELEM_ENTRYWISEREDUCE_INC
+
 namespace elem {
 
 template<typename F> 
@@ -17,14 +19,9 @@ inline BASE(F)
 EntrywiseOneNorm( const Matrix<F>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("EntrywiseOneNorm"))
-    typedef Base<F> R;
-    R norm = 0;
-    const Int width = A.Width();
-    const Int height = A.Height();
-    for( Int j=0; j<width; ++j )
-        for( Int i=0; i<height; ++i )
-            norm += Abs(A.Get(i,j));
-    return norm;
+    typedef Base<F> Real;
+    return EntrywiseReduce
+    ( A, Real(0), []( F alpha ) { return Abs(alpha); }, SumReduction<Real>() );
 }
 
 template<typename F>
@@ -35,39 +32,9 @@ HermitianEntrywiseOneNorm( UpperOrLower uplo, const Matrix<F>& A )
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square.");
 
-    typedef Base<F> R;
-    R norm = 0;
-    const Int height = A.Height();
-    const Int width = A.Width();
-    if( uplo == UPPER )
-    {
-        for( Int j=0; j<width; ++j )
-        {
-            for( Int i=0; i<j; ++i )
-            {
-                const R alpha = Abs(A.Get(i,j));
-                if( i ==j )
-                    norm += alpha;
-                else
-                    norm += 2*alpha;
-            }
-        }
-    }
-    else
-    {
-        for( Int j=0; j<width; ++j )
-        {
-            for( Int i=j+1; i<height; ++i )
-            {
-                const R alpha = Abs(A.Get(i,j));
-                if( i ==j )
-                    norm += alpha;
-                else
-                    norm += 2*alpha;
-            }
-        }
-    }
-    return norm;
+    // The strictly triangular entries are counted twice
+    return HermitianEntrywiseSum
+    ( uplo, A, []( F alpha ) { return Abs(alpha); } );
 }
 
 template<typename F>
@@ -84,19 +51,8 @@ EntrywiseOneNorm( const DistMatrix<F,U,V>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("EntrywiseOneNorm"))
     typedef Base<F> Real;
-    Real norm;
-    if( A.Participating() )
-    {
-        Real localSum = 0;
-        const Int localHeight = A.LocalHeight();
-        const Int localWidth = A.LocalWidth();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                localSum += Abs(A.GetLocal(iLoc,jLoc)); 
-        norm = mpi::AllReduce( localSum, A.DistComm() );
-    }
-    mpi::Broadcast( norm, A.Root(), A.CrossComm() );
-    return norm;
+    return EntrywiseReduce
+    ( A, Real(0), []( F alpha ) { return Abs(alpha); }, SumReduction<Real>() );
 }
 
 template<typename F>
@@ -107,51 +63,8 @@ HermitianEntrywiseOneNorm( UpperOrLower uplo, const DistMatrix<F>& A )
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square.");
 
-    const Int r = A.Grid().Height();
-    const Int c = A.Grid().Width();
-    const Int colShift = A.ColShift();
-    const Int rowShift = A.RowShift();
-
-    typedef Base<F> R;
-    R localSum = 0;
-    const Int localWidth = A.LocalWidth();
-    if( uplo == UPPER )
-    {
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            Int j = rowShift + jLoc*c;
-            Int numUpperRows = Length(j+1,colShift,r);
-            for( Int iLoc=0; iLoc<numUpperRows; ++iLoc )
-            {
-                Int i = colShift + iLoc*r;
-                const R alpha = Abs(A.GetLocal(iLoc,jLoc));
-                if( i ==j )
-                    localSum += alpha;
-                else
-                    localSum += 2*alpha;
-            }
-        }
-    }
-    else
-    {
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            Int j = rowShift + jLoc*c;
-            Int numStrictlyUpperRows = Length(j,colShift,r);
-            for( Int iLoc=numStrictlyUpperRows;
-                 iLoc<A.LocalHeight(); ++iLoc )
-            {
-                Int i = colShift + iLoc*r;
-                const R alpha = Abs(A.GetLocal(iLoc,jLoc));
-                if( i ==j )
-                    localSum += alpha;
-                else
-                    localSum += 2*alpha;
-            }
-        }
-    }
-
-    return mpi::AllReduce( localSum, A.Grid().VCComm() );
+    return HermitianEntrywiseSum
+    ( uplo, A, []( F alpha ) { return Abs(alpha); } );
 }
 
 template<typename F,Dist U,Dist V>
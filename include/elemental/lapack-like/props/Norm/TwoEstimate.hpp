@@ -10,235 +10,233 @@
 #ifndef ELEM_NORM_TWOESTIMATE_HPP
 #define ELEM_NORM_TWOESTIMATE_HPP
 
-#include ELEM_GEMV_INC
-#include ELEM_SYMV_INC
-#include ELEM_HEMV_INC
+#include ELEM_CONJUGATE_INC
+#include ELEM_GEMM_INC
+#include ELEM_SYMM_INC
+#include ELEM_HEMM_INC
 
-#include ELEM_FROBENIUSNORM_INC
+#include ELEM_QR_INC
 
 #include ELEM_GAUSSIAN_INC
 
+// Block power iteration: rather than redistributing a single vector per
+// matrix-vector product, each product with A (or A^H) is performed with a
+// block of 'blockSize' vectors, which both amortizes the communication and
+// accelerates convergence when the largest singular values are clustered.
+
 namespace elem {
 
+namespace internal {
+
+// The two-norm of the small, square R factor (computed directly with LAPACK
+// since the SVD header depends upon this one through the polar decomposition)
 template<typename F>
 inline BASE(F)
-TwoNormEstimate( const Matrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000 )
+SmallTwoNorm( const Matrix<F>& R )
+{
+    const Int k = R.Height();
+    Matrix<F> RCopy( R );
+    Matrix<BASE(F)> s( k, 1 );
+    lapack::SVD( k, k, RCopy.Buffer(), RCopy.LDim(), s.Buffer() );
+    return s.Get(0,0);
+}
+
+template<typename F>
+inline BASE(F)
+SmallTwoNorm( const DistMatrix<F>& R )
+{
+    DistMatrix<F,STAR,STAR> R_STAR_STAR( R );
+    return SmallTwoNorm( R_STAR_STAR.LockedMatrix() );
+}
+
+// With the columns of Y orthonormal, form X := orth(A Y) and [Y,R] := qr(A^H X)
+// so that ||R||_2 = ||A^H X||_2 converges to ||A||_2 from below
+template<typename F,class MatType,class ApplyA,class ApplyAAdj>
+inline BASE(F)
+BlockPowerTwoNormEstimate
+( MatType& X, MatType& Y, MatType& R,
+  ApplyA applyA, ApplyAAdj applyAAdj, Int maxDim, BASE(F) tol, Int maxIts )
 {
-    DEBUG_ONLY(CallStackEntry cse("TwoNormEstimate"))
     typedef Base<F> Real;
-    const Int m = A.Height();
-    const Int n = A.Width();
+    qr::Explicit( Y );
 
-    Matrix<F> x, y;
-    Gaussian( y, n, 1 );
-    
     Int numIts=0;
     Real estimate=0, lastEst;
     do
     {
         lastEst = estimate;
-        Gemv( NORMAL, F(1), A, y, x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, m, 1 );    
-            xNorm = FrobeniusNorm( x );
-        }
-        Scale( Real(1)/xNorm, x );
-        Gemv( ADJOINT, F(1), A, x, y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*Max(m,n) );
-
-    if( Abs(estimate-lastEst) > tol*Max(m,n) )
+        applyA( Y, X );
+        qr::Explicit( X );
+        applyAAdj( X, Y );
+        qr::Explicit( Y, R );
+        estimate = SmallTwoNorm( R );
+    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*maxDim );
+
+    if( Abs(estimate-lastEst) > tol*maxDim )
         RuntimeError("Two-norm estimate did not converge in time");
 
     return estimate;
 }
 
+} // namespace internal
+
 template<typename F>
 inline BASE(F)
-TwoNormEstimate( const DistMatrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000 )
+TwoNormEstimate
+( const Matrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000, Int blockSize=4 )
 {
     DEBUG_ONLY(CallStackEntry cse("TwoNormEstimate"))
-    typedef Base<F> Real;
-    const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
+    const Int k = Min( Max(blockSize,Int(1)), Min(m,n) );
+    if( k == 0 )
+        return 0;
+
+    Matrix<F> X, Y, R;
+    Gaussian( Y, n, k );
+    return internal::BlockPowerTwoNormEstimate<F>
+    ( X, Y, R,
+      [&]( const Matrix<F>& V, Matrix<F>& W )
+      { Gemm( NORMAL, NORMAL, F(1), A, V, W ); },
+      [&]( const Matrix<F>& V, Matrix<F>& W )
+      { Gemm( ADJOINT, NORMAL, F(1), A, V, W ); },
+      Max(m,n), tol, maxIts );
+}
 
-    DistMatrix<F> x(g), y(g);
-    Gaussian( y, n, 1 );
-    
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
-    {
-        lastEst = estimate;
-        Gemv( NORMAL, F(1), A, y, x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, m, 1 );    
-            xNorm = FrobeniusNorm( x );
-        }
-        Scale( Real(1)/xNorm, x );
-        Gemv( ADJOINT, F(1), A, x, y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*Max(m,n) );
-
-    if( Abs(estimate-lastEst) > tol*Max(m,n) )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+template<typename F>
+inline BASE(F)
+TwoNormEstimate
+( const DistMatrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000, Int blockSize=4 )
+{
+    DEBUG_ONLY(CallStackEntry cse("TwoNormEstimate"))
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int k = Min( Max(blockSize,Int(1)), Min(m,n) );
+    if( k == 0 )
+        return 0;
+
+    DistMatrix<F> X(g), Y(g), R(g);
+    Gaussian( Y, n, k );
+    return internal::BlockPowerTwoNormEstimate<F>
+    ( X, Y, R,
+      [&]( const DistMatrix<F>& V, DistMatrix<F>& W )
+      { Gemm( NORMAL, NORMAL, F(1), A, V, W ); },
+      [&]( const DistMatrix<F>& V, DistMatrix<F>& W )
+      { Gemm( ADJOINT, NORMAL, F(1), A, V, W ); },
+      Max(m,n), tol, maxIts );
 }
 
 template<typename F>
 inline BASE(F)
 HermitianTwoNormEstimate
-( UpperOrLower uplo, const Matrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000 )
+( UpperOrLower uplo, const Matrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000,
+  Int blockSize=4 )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianTwoNormEstimate"))
-    typedef Base<F> Real;
     const Int n = A.Height();
+    const Int k = Min( Max(blockSize,Int(1)), n );
+    if( k == 0 )
+        return 0;
 
-    Matrix<F> x, y;
-    Zeros( x, n, 1 );
-    Gaussian( y, n, 1 );
-    
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
+    Matrix<F> X, Y, R;
+    Gaussian( Y, n, k );
+    auto applyA = [&]( const Matrix<F>& V, Matrix<F>& W )
     {
-        lastEst = estimate;
-        Hemv( uplo, F(1), A, y, F(0), x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, n, 1 );    
-            xNorm = FrobeniusNorm( x );
-        }
-        Scale( Real(1)/xNorm, x );
-        Hemv( uplo, F(1), A, x, F(0), y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*n );
-
-    if( Abs(estimate-lastEst) > tol*n )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+        Zeros( W, n, V.Width() );
+        Hemm( LEFT, uplo, F(1), A, V, F(0), W );
+    };
+    return internal::BlockPowerTwoNormEstimate<F>
+    ( X, Y, R, applyA, applyA, n, tol, maxIts );
 }
 
 template<typename F>
 inline BASE(F)
 HermitianTwoNormEstimate
-( UpperOrLower uplo, const DistMatrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000 )
+( UpperOrLower uplo, const DistMatrix<F>& A, BASE(F) tol=1e-6,
+  Int maxIts=1000, Int blockSize=4 )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianTwoNormEstimate"))
-    typedef Base<F> Real;
     const Grid& g = A.Grid();
     const Int n = A.Height();
+    const Int k = Min( Max(blockSize,Int(1)), n );
+    if( k == 0 )
+        return 0;
 
-    DistMatrix<F> x(g), y(g);
-    Zeros( x, n, 1 );
-    Gaussian( y, n, 1 );
-    
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
+    DistMatrix<F> X(g), Y(g), R(g);
+    Gaussian( Y, n, k );
+    auto applyA = [&]( const DistMatrix<F>& V, DistMatrix<F>& W )
     {
-        lastEst = estimate;
-        Hemv( uplo, F(1), A, y, F(0), x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, n, 1 );    
-            xNorm = FrobeniusNorm( x );
-        }
-        Scale( Real(1)/xNorm, x );
-        Hemv( uplo, F(1), A, x, F(0), y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*n );
-
-    if( Abs(estimate-lastEst) > tol*n )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+        Zeros( W, n, V.Width() );
+        Hemm( LEFT, uplo, F(1), A, V, F(0), W );
+    };
+    return internal::BlockPowerTwoNormEstimate<F>
+    ( X, Y, R, applyA, applyA, n, tol, maxIts );
 }
 
+// Since A^H = conj(A) when A is symmetric, A^H V = conj(A conj(V))
+
 template<typename F>
 inline BASE(F)
 SymmetricTwoNormEstimate
-( UpperOrLower uplo, const Matrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000 )
+( UpperOrLower uplo, const Matrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000,
+  Int blockSize=4 )
 {
     DEBUG_ONLY(CallStackEntry cse("SymmetricTwoNormEstimate"))
-    typedef Base<F> Real;
     const Int n = A.Height();
-
-    Matrix<F> x, y;
-    Zeros( x, n, 1 );
-    Gaussian( y, n, 1 );
-    
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
-    {
-        lastEst = estimate;
-        Symv( uplo, F(1), A, y, F(0), x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, n, 1 );    
-            xNorm = FrobeniusNorm( x );
-        }
-        Scale( Real(1)/xNorm, x );
-        Conjugate( x );
-        Symv( uplo, F(1), A, x, F(0), y );
-        Conjugate( y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*n );
-
-    if( Abs(estimate-lastEst) > tol*n )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+    const Int k = Min( Max(blockSize,Int(1)), n );
+    if( k == 0 )
+        return 0;
+
+    Matrix<F> X, Y, R, VConj;
+    Gaussian( Y, n, k );
+    return internal::BlockPowerTwoNormEstimate<F>
+    ( X, Y, R,
+      [&]( const Matrix<F>& V, Matrix<F>& W )
+      {
+          Zeros( W, n, V.Width() );
+          Symm( LEFT, uplo, F(1), A, V, F(0), W );
+      },
+      [&]( const Matrix<F>& V, Matrix<F>& W )
+      {
+          Conjugate( V, VConj );
+          Zeros( W, n, V.Width() );
+          Symm( LEFT, uplo, F(1), A, VConj, F(0), W );
+          Conjugate( W );
+      },
+      n, tol, maxIts );
 }
 
 template<typename F>
 inline BASE(F)
 SymmetricTwoNormEstimate
-( UpperOrLower uplo, const DistMatrix<F>& A, BASE(F) tol=1e-6, Int maxIts=1000 )
+( UpperOrLower uplo, const DistMatrix<F>& A, BASE(F) tol=1e-6,
+  Int maxIts=1000, Int blockSize=4 )
 {
     DEBUG_ONLY(CallStackEntry cse("SymmetricTwoNormEstimate"))
-    typedef Base<F> Real;
     const Grid& g = A.Grid();
     const Int n = A.Height();
-
-    DistMatrix<F> x(g), y(g);
-    Zeros( x, n, 1 );
-    Gaussian( y, n, 1 );
-    
-    Int numIts=0;
-    Real estimate=0, lastEst;
-    do
-    {
-        lastEst = estimate;
-        Symv( uplo, F(1), A, y, F(0), x );
-        Real xNorm = FrobeniusNorm( x );
-        if( xNorm == Real(0) )
-        {
-            Gaussian( x, n, 1 );    
-            xNorm = FrobeniusNorm( x );
-        }
-        Scale( Real(1)/xNorm, x );
-        Conjugate( x );
-        Symv( uplo, F(1), A, x, F(0), y );
-        Conjugate( y );
-        estimate = FrobeniusNorm( y );
-    } while( ++numIts < maxIts && Abs(estimate-lastEst) > tol*n );
-
-    if( Abs(estimate-lastEst) > tol*n )
-        RuntimeError("Two-norm estimate did not converge in time");
-
-    return estimate;
+    const Int k = Min( Max(blockSize,Int(1)), n );
+    if( k == 0 )
+        return 0;
+
+    DistMatrix<F> X(g), Y(g), R(g), VConj(g);
+    Gaussian( Y, n, k );
+    return internal::BlockPowerTwoNormEstimate<F>
+    ( X, Y, R,
+      [&]( const DistMatrix<F>& V, DistMatrix<F>& W )
+      {
+          Zeros( W, n, V.Width() );
+          Symm( LEFT, uplo, F(1), A, V, F(0), W );
+      },
+      [&]( const DistMatrix<F>& V, DistMatrix<F>& W )
+      {
+          Conjugate( V, VConj );
+          Zeros( W, n, V.Width() );
+          Symm( LEFT, uplo, F(1), A, VConj, F(0), W );
+          Conjugate( W );
+      },
+      n, tol, maxIts );
 }
 
 } // namespace elem
@@ -10,6 +10,8 @@
 #ifndef ELEM_NORM_ZERO_HPP
 #define ELEM_NORM_ZERO_HPP
 
+#include ELEM_ENTRYWISEREDUCE_INC
+
 // The number of nonzeros in a matrix isn't really a norm...but it's useful
 
 namespace elem {
@@ -19,14 +21,9 @@ inline Int
 ZeroNorm( const Matrix<F>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("ZeroNorm"))
-    Int numNonzeros = 0;
-    const Int height = A.Height();
-    const Int width = A.Width();
-    for( Int j=0; j<width; ++j )
-        for( Int i=0; i<height; ++i )
-            if( Abs(A.Get(i,j)) > 0 )
-                ++numNonzeros;
-    return numNonzeros;
+    return EntrywiseReduce
+    ( A, Int(0), []( F alpha ) { return Int(Abs(alpha) > Base<F>(0)); },
+      SumReduction<Int>() );
 }
 
 template<typename F,Dist U,Dist V>
@@ -34,14 +31,9 @@ inline Int
 ZeroNorm( const DistMatrix<F,U,V>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("ZeroNorm"))
-    Int numNonzeros;
-    if( A.Participating() )
-    {
-        const Int numLocalNonzeros = ZeroNorm( A.LockedMatrix() );
-        numNonzeros = mpi::AllReduce( numLocalNonzeros, A.DistComm() );
-    }
-    mpi::Broadcast( numNonzeros, A.Root(), A.CrossComm() );
-    return numNonzeros;
+    return EntrywiseReduce
+    ( A, Int(0), []( F alpha ) { return Int(Abs(alpha) > Base<F>(0)); },
+      SumReduction<Int>() );
 }
 
 } // namespace elem
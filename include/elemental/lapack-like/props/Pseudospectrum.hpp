@@ -16,11 +16,14 @@
 #include ELEM_TWONORMESTIMATE_INC
 #include ELEM_HESSENBERG_INC
 #include ELEM_SCHUR_INC
+#include ELEM_MAKETRAPEZOIDAL_INC
+#include ELEM_TEAMS_INC
 
 #include "./Pseudospectrum/Power.hpp"
 #include "./Pseudospectrum/Lanczos.hpp"
 #include "./Pseudospectrum/KrylovSpectral.hpp"
 #include "./Pseudospectrum/Analytic.hpp"
+#include "./Pseudospectrum/Adaptive.hpp"
 
 namespace elem {
 
@@ -48,6 +51,190 @@ NumericallyNormal( const DistMatrix<F>& U, Base<F> tol )
     return offDiagFrob <= tol*diagFrob;
 }
 
+// Overwrites A with its Schur factor, which is upper triangular for complex
+// matrices and upper quasi-triangular for real matrices (so that complex
+// arithmetic is not needed until the shifts are applied)
+template<typename F>
+inline void
+SchurFactor( Matrix<F>& A )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::SchurFactor"))
+    Matrix<Complex<Base<F>>> w;
+    const bool fullTriangle = true;
+    schur::QR( A, w, fullTriangle );
+    MakeTrapezoidal( UPPER, A, ( IsComplex<F>::val ? 0 : -1 ) );
+}
+
+// The triangular drivers only reference the upper triangle of U, whereas the
+// nonzeros of the first subdiagonal of a real quasi-triangular matrix denote
+// its 2x2 diagonal blocks. Unless U is already upper triangular, UTri becomes
+// a copy of U with its strictly lower triangle zeroed.
+template<typename F>
+inline void
+UpperTriangle( const Matrix<F>& U, Matrix<F>& UTri )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::UpperTriangle"))
+    if( IsComplex<F>::val || MaxNorm(U.GetDiagonal(-1)) == Base<F>(0) )
+        LockedView( UTri, U );
+    else
+    {
+        UTri = U;
+        MakeTrapezoidal( UPPER, UTri );
+    }
+}
+
+template<typename F>
+inline void
+UpperTriangle( const DistMatrix<F>& U, DistMatrix<F>& UTri )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::UpperTriangle"))
+    if( IsComplex<F>::val || MaxNorm(U.GetDiagonal(-1)) == Base<F>(0) )
+        LockedView( UTri, U );
+    else
+    {
+        UTri = U;
+        MakeTrapezoidal( UPPER, UTri );
+    }
+}
+
+// Since the pseudospectrum of a real matrix is symmetric with respect to the
+// real axis, any row of a lattice which is the reflection of a previous row
+// need not be computed. On exit, 'uniqueRows' lists the rows which must be
+// computed, and row y of the lattice is a copy of row uniqueRows[rowMap[y]].
+template<typename Real>
+inline void
+ConjugateRows
+( bool symmetric, Complex<Real> corner, Real yStep, Int ySize,
+  std::vector<Int>& uniqueRows, std::vector<Int>& rowMap )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::ConjugateRows"))
+    // Row y has imaginary part corner.imag() + y yStep, and so it is the
+    // reflection of row mirrorSum - y
+    Int mirrorSum = -1;
+    if( symmetric && ySize > 1 && yStep != Real(0) )
+    {
+        const Real ratio = -2*corner.imag()/yStep;
+        if( ratio >= Real(0) )
+        {
+            const Int rounded = Int(ratio+Real(1)/Real(2));
+            const Real tol = Sqrt(lapack::MachineEpsilon<Real>());
+            if( Abs(ratio-rounded) <= tol*Max(Real(1),ratio) )
+                mirrorSum = rounded;
+        }
+    }
+    uniqueRows.resize( 0 );
+    rowMap.resize( ySize );
+    for( Int y=0; y<ySize; ++y )
+    {
+        const Int mirror = mirrorSum - y;
+        if( mirror >= 0 && mirror < y )
+            rowMap[y] = rowMap[mirror];
+        else
+        {
+            rowMap[y] = uniqueRows.size();
+            uniqueRows.push_back( y );
+        }
+    }
+}
+
+// The shift with index j = x*numRows + k is corner + (x*xStep,y*yStep),
+// where y = rows[k]
+template<typename Real>
+inline void
+LatticeShifts
+( Complex<Real> corner, Real xStep, Real yStep, Int xSize,
+  const std::vector<Int>& rows, Matrix<Complex<Real> >& shifts )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::LatticeShifts"))
+    typedef Complex<Real> C;
+    const Int numRows = rows.size();
+    shifts.Resize( xSize*numRows, 1 );
+    for( Int j=0; j<xSize*numRows; ++j )
+    {
+        const Int x = j / numRows;
+        const Int y = rows[j % numRows];
+        shifts.Set( j, 0, corner+C(x*xStep,y*yStep) );
+    }
+}
+
+template<typename Real>
+inline void
+LatticeShifts
+( Complex<Real> corner, Real xStep, Real yStep, Int xSize,
+  const std::vector<Int>& rows, DistMatrix<Complex<Real>,VR,STAR>& shifts )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::LatticeShifts"))
+    typedef Complex<Real> C;
+    const Int numRows = rows.size();
+    shifts.Resize( xSize*numRows, 1 );
+    const Int numLocShifts = shifts.LocalHeight();
+    for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
+    {
+        const Int j = shifts.ColShift() + jLoc*shifts.ColStride();
+        const Int x = j / numRows;
+        const Int y = rows[j % numRows];
+        shifts.SetLocal( jLoc, 0, corner+C(x*xStep,y*yStep) );
+    }
+}
+
+// Expands the results for the unique rows of a lattice into the results for
+// every row, ordered as j = x*ySize + y
+template<typename Real>
+inline void
+ExpandRows
+( Int xSize, const std::vector<Int>& rowMap,
+  Matrix<Real>& invNorms, Matrix<Int>& itCounts )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::ExpandRows"))
+    const Int ySize = rowMap.size();
+    const Int numRows = invNorms.Height() / Max(xSize,Int(1));
+    if( numRows == ySize )
+        return;
+
+    Matrix<Real> invNormsFull( xSize*ySize, 1 );
+    Matrix<Int> itCountsFull( xSize*ySize, 1 );
+    for( Int j=0; j<xSize*ySize; ++j )
+    {
+        const Int x = j / ySize;
+        const Int y = j % ySize;
+        const Int source = x*numRows + rowMap[y];
+        invNormsFull.Set( j, 0, invNorms.Get(source,0) );
+        itCountsFull.Set( j, 0, itCounts.Get(source,0) );
+    }
+    invNorms = invNormsFull;
+    itCounts = itCountsFull;
+}
+
+template<typename Real>
+inline void
+ExpandRows
+( Int xSize, const std::vector<Int>& rowMap,
+  DistMatrix<Real,VR,STAR>& invNorms, DistMatrix<Int,VR,STAR>& itCounts )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::ExpandRows"))
+    const Int ySize = rowMap.size();
+    const Int numRows = invNorms.Height() / Max(xSize,Int(1));
+    if( numRows == ySize )
+        return;
+
+    DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNorms );
+    DistMatrix<Int, STAR,STAR> itCounts_STAR_STAR( itCounts );
+    invNorms.Resize( xSize*ySize, 1 );
+    itCounts.Empty();
+    itCounts.AlignWith( invNorms );
+    itCounts.Resize( xSize*ySize, 1 );
+    const Int numLocShifts = invNorms.LocalHeight();
+    for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
+    {
+        const Int j = invNorms.ColShift() + jLoc*invNorms.ColStride();
+        const Int x = j / ySize;
+        const Int y = j % ySize;
+        const Int source = x*numRows + rowMap[y];
+        invNorms.SetLocal( jLoc, 0, invNorms_STAR_STAR.GetLocal(source,0) );
+        itCounts.SetLocal( jLoc, 0, itCounts_STAR_STAR.GetLocal(source,0) );
+    }
+}
+
 template<typename T>
 inline void
 ReshapeIntoGrids
@@ -102,29 +289,32 @@ ReshapeIntoGrids
 
 } // namespace pspec
 
+// The QuasiTriangularPseudospectrum routines treat U as upper quasi-triangular
+// (e.g., a real Schur factor), where each nonzero entry of the first
+// subdiagonal of a real U marks a 2x2 diagonal block. For complex U, they
+// are equivalent to the TriangularPseudospectrum routines defined below,
+// which, as usual, only reference the upper triangle of U.
+//
+// The columns of X should contain initial guesses for the dominant right
+// singular vectors of inv(U - shift I) for each shift. On exit, they will
+// contain the final iterates of the power or Krylov-spectral methods, but
+// they are left untouched by single-vector Lanczos and when the inverse
+// norms are computed analytically.
+
 template<typename F>
 inline Matrix<Int>
-TriangularPseudospectrum
+QuasiTriangularPseudospectrum
 ( const Matrix<F>& U, const Matrix<Complex<BASE(F)> >& shifts, 
-  Matrix<BASE(F)>& invNorms, bool lanczos=true, Int krylovSize=10, 
-  bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
-  bool progress=false )
+  Matrix<BASE(F)>& invNorms, Matrix<Complex<BASE(F)> >& X,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true,
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
-    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
-    Matrix<C> UCpx;
-    if( IsComplex<F>::val )
-        UCpx = LockedView( U );
-    else
-    {
-        const Int n = U.Height();
-        UCpx.Resize( n, n );
-        for( Int j=0; j<n; ++j )
-            for( Int i=0; i<n; ++i )
-                UCpx.Set( i, j, U.Get(i,j) );
-    }
+    // Real matrices are assumed to be upper quasi-triangular and are solved
+    // against without promoting them to complex matrices
 
     // Check if the off-diagonal is sufficiently small; if so, compute the 
     // pseudospectrum analytically from the eigenvalues. This also takes care
@@ -132,11 +322,12 @@ TriangularPseudospectrum
     // matrix, which, after shifting, can lead to the zero matrix, which would 
     // cause problems for the Lanczos convergence criteria.
     Matrix<Int> itCounts;
-    if( pspec::NumericallyNormal( UCpx, tol ) )
+    if( pspec::NumericallyNormal( U, tol ) )
     {
         if( progress )
             std::cout << "Matrix was numerically normal" << std::endl;
-        auto w = UCpx.GetDiagonal();
+        Matrix<C> w;
+        pspec::TriangEig( U, w );
         pspec::Analytic( w, shifts, invNorms );
         Zeros( itCounts, shifts.Height(), 1 );        
         return itCounts;
@@ -147,44 +338,52 @@ TriangularPseudospectrum
         if( krylovSize > 1 )
             itCounts =
                pspec::TriangularKrylovSpectral
-               ( UCpx, shifts, invNorms, krylovSize, reorthog, deflate, maxIts, 
+               ( U, shifts, invNorms, X, krylovSize, reorthog, deflate, maxIts,
                  tol, progress );
         else
             itCounts = 
                pspec::TriangularLanczos
-               ( UCpx, shifts, invNorms, deflate, maxIts, tol, progress );
+               ( U, shifts, invNorms, X, deflate, maxIts, tol, progress );
     }
     else
         itCounts =
            pspec::TriangularPower
-           ( UCpx, shifts, invNorms, deflate, maxIts, tol, progress );
+           ( U, shifts, invNorms, X, deflate, maxIts, tol, progress );
 
     return itCounts;
 }
 
 template<typename F>
 inline Matrix<Int>
-HessenbergPseudospectrum
-( const Matrix<F>& H, const Matrix<Complex<BASE(F)> >& shifts, 
+QuasiTriangularPseudospectrum
+( const Matrix<F>& U, const Matrix<Complex<BASE(F)> >& shifts, 
   Matrix<BASE(F)>& invNorms, bool lanczos=true, Int krylovSize=10, 
   bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
   bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
+    typedef Base<F> Real;
+    Matrix<Complex<Real> > X;
+    Gaussian( X, U.Height(), shifts.Height() );
+    return QuasiTriangularPseudospectrum
+    ( U, shifts, invNorms, X, lanczos, krylovSize, reorthog, deflate, maxIts,
+      tol, progress );
+}
+
+template<typename F>
+inline Matrix<Int>
+HessenbergPseudospectrum
+( const Matrix<F>& H, const Matrix<Complex<BASE(F)> >& shifts, 
+  Matrix<BASE(F)>& invNorms, Matrix<Complex<BASE(F)> >& X,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true,
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("HessenbergPseudospectrum"))
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
     Matrix<C> HCpx;
-    if( IsComplex<F>::val )
-        HCpx = LockedView( H );
-    else
-    {
-        const Int n = H.Height();
-        HCpx.Resize( n, n );
-        for( Int j=0; j<n; ++j )
-            for( Int i=0; i<n; ++i )
-                HCpx.Set( i, j, H.Get(i,j) );
-    }
+    pspec::ComplexView( H, HCpx );
 
     // TODO: Check if the subdiagonal is numerically zero, and, if so, revert to
     //       TriangularPseudospectrum?
@@ -194,48 +393,53 @@ HessenbergPseudospectrum
         if( krylovSize > 1 )
             itCounts =
                pspec::HessenbergKrylovSpectral
-               ( HCpx, shifts, invNorms, krylovSize, reorthog, deflate, maxIts, 
-                 tol, progress );
+               ( HCpx, shifts, invNorms, X, krylovSize, reorthog, deflate,
+                 maxIts, tol, progress );
         else
             itCounts = 
                pspec::HessenbergLanczos
-               ( HCpx, shifts, invNorms, deflate, maxIts, tol, progress );
+               ( HCpx, shifts, invNorms, X, deflate, maxIts, tol, progress );
     }
     else
         itCounts =
            pspec::HessenbergPower
-           ( HCpx, shifts, invNorms, deflate, maxIts, tol, progress );
+           ( HCpx, shifts, invNorms, X, deflate, maxIts, tol, progress );
 
     return itCounts;
 }
 
 template<typename F>
-inline DistMatrix<Int,VR,STAR>
-TriangularPseudospectrum
-( const DistMatrix<F>& U, const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
-  DistMatrix<BASE(F),VR,STAR>& invNorms, bool lanczos=true, Int krylovSize=10, 
+inline Matrix<Int>
+HessenbergPseudospectrum
+( const Matrix<F>& H, const Matrix<Complex<BASE(F)> >& shifts, 
+  Matrix<BASE(F)>& invNorms, bool lanczos=true, Int krylovSize=10, 
   bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
   bool progress=false )
 {
-    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    DEBUG_ONLY(CallStackEntry cse("HessenbergPseudospectrum"))
     typedef Base<F> Real;
-    typedef Complex<Real> C;
+    Matrix<Complex<Real> > X;
+    Gaussian( X, H.Height(), shifts.Height() );
+    return HessenbergPseudospectrum
+    ( H, shifts, invNorms, X, lanczos, krylovSize, reorthog, deflate, maxIts,
+      tol, progress );
+}
 
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+QuasiTriangularPseudospectrum
+( const DistMatrix<F>& U, const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+  DistMatrix<BASE(F),VR,STAR>& invNorms, DistMatrix<Complex<BASE(F)> >& X,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true,
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
     const Grid& g = U.Grid();
-    DistMatrix<C> UCpx(g);
-    if( IsComplex<F>::val )
-        UCpx = LockedView( U );
-    else
-    {
-        UCpx.AlignWith( U );
-        const Int n = U.Height();
-        UCpx.Resize( n, n );
-        const Int mLocal = U.LocalHeight();
-        const Int nLocal = U.LocalWidth();
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-                UCpx.SetLocal( iLoc, jLoc, U.GetLocal(iLoc,jLoc) );
-    }
+
+    // Real matrices are assumed to be upper quasi-triangular and are solved
+    // against without promoting them to complex matrices
 
     // Check if the off-diagonal is sufficiently small; if so, compute the 
     // pseudospectrum analytically from the eigenvalues. This also takes care
@@ -243,12 +447,12 @@ TriangularPseudospectrum
     // matrix, which, after shifting, can lead to the zero matrix, which would 
     // cause problems for the Lanczos convergence criteria.
     DistMatrix<Int,VR,STAR> itCounts(g);
-    if( pspec::NumericallyNormal( UCpx, tol ) )
+    if( pspec::NumericallyNormal( U, tol ) )
     {
         if( progress && U.Grid().Rank() == 0 )
             std::cout << "Matrix was numerically normal" << std::endl;
-        auto w = UCpx.GetDiagonal();
-        DistMatrix<C,STAR,STAR> w_STAR_STAR( w );
+        DistMatrix<C,STAR,STAR> w_STAR_STAR(g);
+        pspec::TriangEig( U, w_STAR_STAR );
         pspec::Analytic( w_STAR_STAR, shifts, invNorms );
         itCounts.AlignWith( shifts );
         Zeros( itCounts, shifts.Height(), 1 );
@@ -260,28 +464,45 @@ TriangularPseudospectrum
         if( krylovSize > 1 )
             itCounts =
                pspec::TriangularKrylovSpectral
-               ( UCpx, shifts, invNorms, krylovSize, reorthog, deflate, maxIts, 
+               ( U, shifts, invNorms, X, krylovSize, reorthog, deflate, maxIts,
                  tol, progress );
         else
             itCounts = 
                pspec::TriangularLanczos
-               ( UCpx, shifts, invNorms, deflate, maxIts, tol, progress );
+               ( U, shifts, invNorms, X, deflate, maxIts, tol, progress );
     }
     else
         itCounts =
            pspec::TriangularPower
-           ( UCpx, shifts, invNorms, deflate, maxIts, tol, progress );
+           ( U, shifts, invNorms, X, deflate, maxIts, tol, progress );
 
     return itCounts;
 }
 
 template<typename F>
 inline DistMatrix<Int,VR,STAR>
-HessenbergPseudospectrum
-( const DistMatrix<F>& H, const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+QuasiTriangularPseudospectrum
+( const DistMatrix<F>& U, const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
   DistMatrix<BASE(F),VR,STAR>& invNorms, bool lanczos=true, Int krylovSize=10, 
   bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
   bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
+    typedef Base<F> Real;
+    DistMatrix<Complex<Real> > X( U.Grid() );
+    Gaussian( X, U.Height(), shifts.Height() );
+    return QuasiTriangularPseudospectrum
+    ( U, shifts, invNorms, X, lanczos, krylovSize, reorthog, deflate, maxIts,
+      tol, progress );
+}
+
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+HessenbergPseudospectrum
+( const DistMatrix<F>& H, const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+  DistMatrix<BASE(F),VR,STAR>& invNorms, DistMatrix<Complex<BASE(F)> >& X,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true,
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("HessenbergPseudospectrum"))
     typedef Base<F> Real;
@@ -289,19 +510,7 @@ HessenbergPseudospectrum
 
     const Grid& g = H.Grid();
     DistMatrix<C> HCpx(g);
-    if( IsComplex<F>::val )
-        HCpx = LockedView( H );
-    else
-    {
-        HCpx.AlignWith( H );
-        const Int n = H.Height();
-        HCpx.Resize( n, n );
-        const Int mLocal = H.LocalHeight();
-        const Int nLocal = H.LocalWidth();
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-                HCpx.SetLocal( iLoc, jLoc, H.GetLocal(iLoc,jLoc) );
-    }
+    pspec::ComplexView( H, HCpx );
 
     // TODO: Check if the subdiagonal is sufficiently small, and, if so, revert
     //       to TriangularPseudospectrum
@@ -311,21 +520,238 @@ HessenbergPseudospectrum
         if( krylovSize > 1 )
             itCounts =
                pspec::HessenbergKrylovSpectral
-               ( HCpx, shifts, invNorms, krylovSize, reorthog, deflate, maxIts, 
-                 tol, progress );
+               ( HCpx, shifts, invNorms, X, krylovSize, reorthog, deflate,
+                 maxIts, tol, progress );
         else
             itCounts = 
                pspec::HessenbergLanczos
-               ( HCpx, shifts, invNorms, deflate, maxIts, tol, progress );
+               ( HCpx, shifts, invNorms, X, deflate, maxIts, tol, progress );
     }
     else
         itCounts =
            pspec::HessenbergPower
-           ( HCpx, shifts, invNorms, deflate, maxIts, tol, progress );
+           ( HCpx, shifts, invNorms, X, deflate, maxIts, tol, progress );
 
     return itCounts;
 }
 
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+HessenbergPseudospectrum
+( const DistMatrix<F>& H, const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+  DistMatrix<BASE(F),VR,STAR>& invNorms, bool lanczos=true, Int krylovSize=10, 
+  bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("HessenbergPseudospectrum"))
+    typedef Base<F> Real;
+    DistMatrix<Complex<Real> > X( H.Grid() );
+    Gaussian( X, H.Height(), shifts.Height() );
+    return HessenbergPseudospectrum
+    ( H, shifts, invNorms, X, lanczos, krylovSize, reorthog, deflate, maxIts,
+      tol, progress );
+}
+
+namespace pspec {
+
+// Task farming over subgrids: for moderate n, spreading a single copy of the
+// Schur (or Hessenberg) factor over the entire grid leaves each process with
+// little work per shift relative to the communication. Instead, the grid is
+// split into numSubgrids teams of contiguous ranks, each of which receives a
+// copy of the factor and repeatedly claims the next chunk of shifts until
+// none remain. When MPI-3 one-sided communication is available, the chunks
+// are handed out dynamically by a shared counter on the first process;
+// otherwise they are dealt out to the subgrids in a round-robin fashion.
+//
+// NOTE: The first process also works on chunks, and, unless the MPI
+//       implementation provides asynchronous progress (e.g., via
+//       MPICH_ASYNC_PROGRESS=1), claims on the counter may only complete
+//       once it makes an MPI call. The communication within a subgrid of
+//       more than one process usually suffices, and the first process
+//       additionally drives progress between each of its chunks.
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+Farm
+( bool hessenberg, const DistMatrix<F>& A,
+  const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+  DistMatrix<BASE(F),VR,STAR>& invNorms, Int numSubgrids, Int chunkSize,
+  bool lanczos, Int krylovSize, bool reorthog, bool deflate, Int maxIts,
+  BASE(F) tol, bool progress )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::Farm"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Grid& g = A.Grid();
+    const Int p = g.Size();
+    const Int numShifts = shifts.Height();
+    if( numSubgrids <= 0 )
+        numSubgrids = Max( Int(Sqrt(Real(p))), Int(1) );
+    numSubgrids = Min( numSubgrids, p );
+    if( chunkSize <= 0 )
+        chunkSize = Max( numShifts/(4*numSubgrids), Int(1) );
+    const Int numChunks = (numShifts+chunkSize-1) / chunkSize;
+
+    // Every subgrid needs its own copy of A, so each of the copies is pushed
+    // over a grid viewed by all processes and then pulled onto a grid which
+    // is only viewed by the members of the subgrid
+    std::vector<const Grid*> pushGrids;
+    SplitIntoTeams( numSubgrids, g, pushGrids );
+    const Int mySubgrid = TeamOf( g.Rank(), numSubgrids, p );
+    const Grid& myPushGrid = *pushGrids[mySubgrid];
+    DistMatrix<F> APush( myPushGrid );
+    for( Int s=0; s<numSubgrids; ++s )
+    {
+        if( s == mySubgrid )
+            APush = A;
+        else
+        {
+            DistMatrix<F> ATmp( *pushGrids[s] );
+            ATmp = A;
+        }
+    }
+    mpi::Comm subComm;
+    mpi::CommSplit( g.Comm(), mySubgrid, g.Rank(), subComm );
+    const Grid subGrid( subComm, myPushGrid.Height() );
+    mpi::CommFree( subComm );
+    DistMatrix<F> ASub( subGrid );
+    ASub = APush;
+    APush.Empty();
+    FreeTeamGrids( pushGrids );
+    if( progress && g.Rank() == 0 )
+        std::cout << "Farming " << numChunks << " chunks of " << chunkSize
+                  << " shifts over " << numSubgrids << " subgrids"
+                  << std::endl;
+
+    // The Hessenberg drivers work with complex matrices, so only promote once,
+    // and only the upper triangle of a triangular matrix is referenced
+    DistMatrix<C> HSub( subGrid );
+    if( hessenberg )
+        ComplexView( ASub, HSub );
+    else
+        MakeTrapezoidal( UPPER, ASub );
+
+    DistMatrix<C,STAR,STAR> shifts_STAR_STAR( shifts );
+    std::vector<Real> invNormsBuf( numShifts, 0 );
+    std::vector<Int> itCountsBuf( numShifts, 0 );
+#ifdef HAVE_MPI3_RMA
+    Int counter = 0;
+    mpi::Window window;
+    mpi::WindowCreate
+    ( &counter, ( g.Rank()==0 ? sizeof(Int) : 0 ), sizeof(Int), g.Comm(),
+      window );
+    mpi::WindowLockAll( window );
+#endif
+    const bool subRoot = ( subGrid.Rank() == 0 );
+    Int chunk = mySubgrid - numSubgrids;
+    while( true )
+    {
+#ifdef HAVE_MPI3_RMA
+        if( subRoot )
+            chunk = mpi::FetchAndAdd( Int(1), 0, 0, window );
+        mpi::Broadcast( chunk, 0, subGrid.Comm() );
+#else
+        chunk += numSubgrids;
+#endif
+        if( chunk >= numChunks )
+            break;
+        const Int first = chunk*chunkSize;
+        const Int size = Min( chunkSize, numShifts-first );
+        DistMatrix<C,VR,STAR> shiftsSub( size, 1, subGrid );
+        const Int localSize = shiftsSub.LocalHeight();
+        for( Int iLoc=0; iLoc<localSize; ++iLoc )
+        {
+            const Int i = shiftsSub.ColShift()+iLoc*shiftsSub.ColStride();
+            shiftsSub.SetLocal
+            ( iLoc, 0, shifts_STAR_STAR.GetLocal(first+i,0) );
+        }
+
+        DistMatrix<Real,VR,STAR> invNormsSub( subGrid );
+        DistMatrix<Int,VR,STAR> itCountsSub( subGrid );
+        if( hessenberg )
+            itCountsSub =
+               HessenbergPseudospectrum
+               ( HSub, shiftsSub, invNormsSub, lanczos, krylovSize, reorthog,
+                 deflate, maxIts, tol );
+        else
+            itCountsSub =
+               QuasiTriangularPseudospectrum
+               ( ASub, shiftsSub, invNormsSub, lanczos, krylovSize, reorthog,
+                 deflate, maxIts, tol );
+
+        // Each entry of the chunk is owned by exactly one member of the
+        // subgrid, so the buffers can later be combined by a summation
+        for( Int iLoc=0; iLoc<localSize; ++iLoc )
+        {
+            const Int i = invNormsSub.ColShift()+iLoc*invNormsSub.ColStride();
+            invNormsBuf[first+i] = invNormsSub.GetLocal(iLoc,0);
+            itCountsBuf[first+i] = itCountsSub.GetLocal(iLoc,0);
+        }
+        if( progress && g.Rank() == 0 )
+            std::cout << "Subgrid 0 finished chunk " << chunk << std::endl;
+#ifdef HAVE_MPI3_RMA
+        if( g.Rank() == 0 )
+            mpi::WindowFlushAll( window );
+#endif
+    }
+#ifdef HAVE_MPI3_RMA
+    mpi::WindowUnlockAll( window );
+    mpi::WindowFree( window );
+#endif
+
+    mpi::AllReduce( invNormsBuf.data(), numShifts, g.Comm() );
+    mpi::AllReduce( itCountsBuf.data(), numShifts, g.Comm() );
+    invNorms.SetGrid( g );
+    invNorms.AlignWith( shifts );
+    invNorms.Resize( numShifts, 1 );
+    DistMatrix<Int,VR,STAR> itCounts( g );
+    itCounts.AlignWith( shifts );
+    itCounts.Resize( numShifts, 1 );
+    const Int localHeight = invNorms.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = invNorms.ColShift() + iLoc*invNorms.ColStride();
+        invNorms.SetLocal( iLoc, 0, invNormsBuf[i] );
+        itCounts.SetLocal( iLoc, 0, itCountsBuf[i] );
+    }
+    return itCounts;
+}
+
+} // namespace pspec
+
+// The following variants replicate the triangular (or Hessenberg) factor onto
+// numSubgrids subgrids, which then share the shifts (see pspec::Farm). If
+// numSubgrids is nonpositive, roughly the square-root of the number of
+// processes is used, and, if chunkSize is nonpositive, each subgrid will
+// claim roughly four chunks.
+
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+SubgridTriangularPseudospectrum
+( const DistMatrix<F>& U, const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+  DistMatrix<BASE(F),VR,STAR>& invNorms, Int numSubgrids=0, Int chunkSize=0,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true,
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("SubgridTriangularPseudospectrum"))
+    return pspec::Farm
+           ( false, U, shifts, invNorms, numSubgrids, chunkSize, lanczos,
+             krylovSize, reorthog, deflate, maxIts, tol, progress );
+}
+
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+SubgridHessenbergPseudospectrum
+( const DistMatrix<F>& H, const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+  DistMatrix<BASE(F),VR,STAR>& invNorms, Int numSubgrids=0, Int chunkSize=0,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true,
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("SubgridHessenbergPseudospectrum"))
+    return pspec::Farm
+           ( true, H, shifts, invNorms, numSubgrids, chunkSize, lanczos,
+             krylovSize, reorthog, deflate, maxIts, tol, progress );
+}
+
 namespace pspec {
 
 template<typename F>
@@ -337,19 +763,10 @@ Triangular
   bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::Triangular"))
-    typedef Base<F> Real;
-    typedef Complex<Real> C;
-
-    const Int n = A.Height();
-    Matrix<C> U( n, n );
-    for( Int j=0; j<n; ++j )
-        for( Int i=0; i<n; ++i )
-            U.Set( i, j, A.Get(i,j) );
-
-    Matrix<C> w;
-    schur::QR( U, w );
+    Matrix<F> U( A );
+    SchurFactor( U );
 
-    return TriangularPseudospectrum
+    return QuasiTriangularPseudospectrum
            ( U, shifts, invNorms, lanczos, krylovSize, reorthog, deflate, 
              maxIts, tol, progress );
 }
@@ -420,7 +837,7 @@ Triangular
       spreadFactor, random, progress );
     X.Empty();
 
-    return TriangularPseudospectrum
+    return QuasiTriangularPseudospectrum
            ( U, shifts, invNorms, lanczos, krylovSize, reorthog, deflate, 
              maxIts, tol, progress );
 }
@@ -498,36 +915,35 @@ Pseudospectrum
 
 template<typename F>
 inline Matrix<Int>
-TriangularPseudospectrum
+QuasiTriangularPseudospectrum
 ( const Matrix<F>& U, Matrix<BASE(F)>& invNormMap, 
   Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth,
   Int xSize, Int ySize, bool lanczos=true, Int krylovSize=10, 
   bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
   bool progress=false )
 {
-    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
     const Real xStep = xWidth/(xSize-1);
     const Real yStep = yWidth/(ySize-1);
     const C corner = center - C(xWidth/2,yWidth/2);
-    Matrix<C> shifts( xSize*ySize, 1, U.Grid() );
-    for( Int j=0; j<xSize*ySize; ++j )
-    {
-        const Int x = j / ySize;
-        const Int y = j % ySize;
-        shifts.Set( j, 0, corner+C(x*xStep,y*yStep) );
-    }
+    std::vector<Int> uniqueRows, rowMap;
+    pspec::ConjugateRows
+    ( !IsComplex<F>::val, corner, yStep, ySize, uniqueRows, rowMap );
+    Matrix<C> shifts;
+    pspec::LatticeShifts( corner, xStep, yStep, xSize, uniqueRows, shifts );
 
     // Form the vector of invNorms
     Matrix<Real> invNorms;
     auto itCounts = 
-        TriangularPseudospectrum
+        QuasiTriangularPseudospectrum
         ( U, shifts, invNorms, lanczos, krylovSize, reorthog, deflate, maxIts, 
           tol, progress );
 
-    // Rearrange the vectors into grids
+    // Fill in the reflected rows and rearrange the vectors into grids
+    pspec::ExpandRows( xSize, rowMap, invNorms, itCounts );
     Matrix<Int> itCountMap; 
     pspec::ReshapeIntoGrids
     ( xSize, ySize, invNorms, itCounts, invNormMap, itCountMap );
@@ -550,13 +966,11 @@ HessenbergPseudospectrum
     const Real xStep = xWidth/(xSize-1);
     const Real yStep = yWidth/(ySize-1);
     const C corner = center - C(xWidth/2,yWidth/2);
-    Matrix<C> shifts( xSize*ySize, 1, H.Grid() );
-    for( Int j=0; j<xSize*ySize; ++j )
-    {
-        const Int x = j / ySize;
-        const Int y = j % ySize;
-        shifts.Set( j, 0, corner+C(x*xStep,y*yStep) );
-    }
+    std::vector<Int> uniqueRows, rowMap;
+    pspec::ConjugateRows
+    ( !IsComplex<F>::val, corner, yStep, ySize, uniqueRows, rowMap );
+    Matrix<C> shifts;
+    pspec::LatticeShifts( corner, xStep, yStep, xSize, uniqueRows, shifts );
 
     // Form the vector of invNorms
     Matrix<Real> invNorms;
@@ -565,7 +979,8 @@ HessenbergPseudospectrum
         ( H, shifts, invNorms, lanczos, krylovSize, reorthog, deflate, maxIts, 
           tol, progress );
 
-    // Rearrange the vectors into grids
+    // Fill in the reflected rows and rearrange the vectors into grids
+    pspec::ExpandRows( xSize, rowMap, invNorms, itCounts );
     Matrix<Int> itCountMap; 
     pspec::ReshapeIntoGrids
     ( xSize, ySize, invNorms, itCounts, invNormMap, itCountMap );
@@ -574,13 +989,13 @@ HessenbergPseudospectrum
 
 template<typename F>
 inline DistMatrix<Int>
-TriangularPseudospectrum
+QuasiTriangularPseudospectrum
 ( const DistMatrix<F>& U, DistMatrix<BASE(F)>& invNormMap, 
   Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth, Int xSize, Int ySize,
   bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true, 
   Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
-    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
     typedef Base<F> Real;
     typedef Complex<Real> C;
     const Grid& g = U.Grid();
@@ -588,24 +1003,21 @@ TriangularPseudospectrum
     const Real xStep = xWidth/(xSize-1);
     const Real yStep = yWidth/(ySize-1);
     const C corner = center - C(xWidth/2,yWidth/2);
-    DistMatrix<C,VR,STAR> shifts( xSize*ySize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
-    {
-        const Int j = shifts.ColShift() + jLoc*shifts.ColStride();
-        const Int x = j / ySize;
-        const Int y = j % ySize;
-        shifts.SetLocal( jLoc, 0, corner+C(x*xStep,y*yStep) );
-    }
+    std::vector<Int> uniqueRows, rowMap;
+    pspec::ConjugateRows
+    ( !IsComplex<F>::val, corner, yStep, ySize, uniqueRows, rowMap );
+    DistMatrix<C,VR,STAR> shifts(g);
+    pspec::LatticeShifts( corner, xStep, yStep, xSize, uniqueRows, shifts );
 
     // Form the vector of invNorms
     DistMatrix<Real,VR,STAR> invNorms(g);
     auto itCounts = 
-        TriangularPseudospectrum
+        QuasiTriangularPseudospectrum
         ( U, shifts, invNorms, lanczos, krylovSize, reorthog, deflate, maxIts, 
           tol, progress );
 
-    // Rearrange the vectors into grids
+    // Fill in the reflected rows and rearrange the vectors into grids
+    pspec::ExpandRows( xSize, rowMap, invNorms, itCounts );
     DistMatrix<Int> itCountMap(g); 
     pspec::ReshapeIntoGrids
     ( xSize, ySize, invNorms, itCounts, invNormMap, itCountMap );
@@ -628,15 +1040,11 @@ HessenbergPseudospectrum
     const Real xStep = xWidth/(xSize-1);
     const Real yStep = yWidth/(ySize-1);
     const C corner = center - C(xWidth/2,yWidth/2);
-    DistMatrix<C,VR,STAR> shifts( xSize*ySize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
-    {
-        const Int j = shifts.ColShift() + jLoc*shifts.ColStride();
-        const Int x = j / ySize;
-        const Int y = j % ySize;
-        shifts.SetLocal( jLoc, 0, corner+C(x*xStep,y*yStep) );
-    }
+    std::vector<Int> uniqueRows, rowMap;
+    pspec::ConjugateRows
+    ( !IsComplex<F>::val, corner, yStep, ySize, uniqueRows, rowMap );
+    DistMatrix<C,VR,STAR> shifts(g);
+    pspec::LatticeShifts( corner, xStep, yStep, xSize, uniqueRows, shifts );
 
     // Form the vector of invNorms
     DistMatrix<Real,VR,STAR> invNorms(g);
@@ -645,7 +1053,8 @@ HessenbergPseudospectrum
         ( H, shifts, invNorms, lanczos, krylovSize, reorthog, deflate, maxIts, 
           tol, progress );
 
-    // Rearrange the vectors into grids
+    // Fill in the reflected rows and rearrange the vectors into grids
+    pspec::ExpandRows( xSize, rowMap, invNorms, itCounts );
     DistMatrix<Int> itCountMap(g); 
     pspec::ReshapeIntoGrids
     ( xSize, ySize, invNorms, itCounts, invNormMap, itCountMap );
@@ -668,13 +1077,11 @@ Pseudospectrum
     const Real xStep = xWidth/(xSize-1);
     const Real yStep = yWidth/(ySize-1);
     const C corner = center - C(xWidth/2,yWidth/2);
-    Matrix<C> shifts( xSize*ySize, 1, A.Grid() );
-    for( Int j=0; j<xSize*ySize; ++j )
-    {
-        const Int x = j / ySize;
-        const Int y = j % ySize;
-        shifts.Set( j, 0, corner+C(x*xStep,y*yStep) );
-    }
+    std::vector<Int> uniqueRows, rowMap;
+    pspec::ConjugateRows
+    ( !IsComplex<F>::val, corner, yStep, ySize, uniqueRows, rowMap );
+    Matrix<C> shifts;
+    pspec::LatticeShifts( corner, xStep, yStep, xSize, uniqueRows, shifts );
 
     // Form the vector of invNorms
     Matrix<Real> invNorms;
@@ -683,7 +1090,8 @@ Pseudospectrum
         ( A, shifts, invNorms, schur, lanczos, krylovSize, reorthog, deflate, 
           maxIts, tol, progress );
 
-    // Rearrange the vectors into grids
+    // Fill in the reflected rows and rearrange the vectors into grids
+    pspec::ExpandRows( xSize, rowMap, invNorms, itCounts );
     Matrix<Int> itCountMap; 
     pspec::ReshapeIntoGrids
     ( xSize, ySize, invNorms, itCounts, invNormMap, itCountMap );
@@ -706,15 +1114,11 @@ Pseudospectrum
     const Real xStep = xWidth/(xSize-1);
     const Real yStep = yWidth/(ySize-1);
     const C corner = center - C(xWidth/2,yWidth/2);
-    DistMatrix<C,VR,STAR> shifts( xSize*ySize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
-    {
-        const Int j = shifts.ColShift() + jLoc*shifts.ColStride();
-        const Int x = j / ySize;
-        const Int y = j % ySize;
-        shifts.SetLocal( jLoc, 0, corner+C(x*xStep,y*yStep) );
-    }
+    std::vector<Int> uniqueRows, rowMap;
+    pspec::ConjugateRows
+    ( !IsComplex<F>::val, corner, yStep, ySize, uniqueRows, rowMap );
+    DistMatrix<C,VR,STAR> shifts(g);
+    pspec::LatticeShifts( corner, xStep, yStep, xSize, uniqueRows, shifts );
 
     // Form the vector of invNorms
     DistMatrix<Real,VR,STAR> invNorms(g);
@@ -723,7 +1127,8 @@ Pseudospectrum
         ( A, shifts, invNorms, schur, lanczos, krylovSize, reorthog, deflate, 
           maxIts, tol, progress );
 
-    // Rearrange the vectors into grids
+    // Fill in the reflected rows and rearrange the vectors into grids
+    pspec::ExpandRows( xSize, rowMap, invNorms, itCounts );
     DistMatrix<Int> itCountMap(g); 
     pspec::ReshapeIntoGrids
     ( xSize, ySize, invNorms, itCounts, invNormMap, itCountMap );
@@ -732,17 +1137,288 @@ Pseudospectrum
 
 template<typename F>
 inline Matrix<Int>
-TriangularPseudospectrum
+QuasiTriangularPseudospectrum
+( const Matrix<F>& U, Matrix<BASE(F)>& invNormMap,
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth,
+  Int xSize, Int ySize, const std::vector<BASE(F)>& contours,
+  Int numRefinements=3, bool lanczos=true, Int krylovSize=10,
+  bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6,
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+
+    const Real xStep = xWidth/(xSize-1);
+    const Real yStep = yWidth/(ySize-1);
+    const C corner = center - C(xWidth/2,yWidth/2);
+    const bool normal = pspec::NumericallyNormal( U, tol );
+    pspec::ShiftBatch<Matrix<F> > batch
+    ( U, false, normal, corner, xStep, yStep, xSize, ySize, lanczos,
+      krylovSize, reorthog, deflate, maxIts, tol, progress );
+
+    Matrix<Int> itCountMap;
+    pspec::AdaptiveGrid
+    ( batch, xSize, ySize, contours, numRefinements, invNormMap, itCountMap,
+      progress );
+    return itCountMap;
+}
+
+template<typename F>
+inline Matrix<Int>
+HessenbergPseudospectrum
+( const Matrix<F>& H, Matrix<BASE(F)>& invNormMap,
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth,
+  Int xSize, Int ySize, const std::vector<BASE(F)>& contours,
+  Int numRefinements=3, bool lanczos=true, Int krylovSize=10,
+  bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6,
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("HessenbergPseudospectrum"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+
+    const Int n = H.Height();
+    Matrix<C> HCpx( n, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<n; ++i )
+            HCpx.Set( i, j, H.Get(i,j) );
+
+    const Real xStep = xWidth/(xSize-1);
+    const Real yStep = yWidth/(ySize-1);
+    const C corner = center - C(xWidth/2,yWidth/2);
+    pspec::ShiftBatch<Matrix<C> > batch
+    ( HCpx, true, false, corner, xStep, yStep, xSize, ySize, lanczos,
+      krylovSize, reorthog, deflate, maxIts, tol, progress );
+
+    Matrix<Int> itCountMap;
+    pspec::AdaptiveGrid
+    ( batch, xSize, ySize, contours, numRefinements, invNormMap, itCountMap,
+      progress );
+    return itCountMap;
+}
+
+namespace pspec {
+
+// The refinement is performed redundantly on every process, and so the
+// redundant maps are simply distributed at the end
+template<typename Real>
+inline void
+DistributeMaps
+( const Matrix<Real>& invNormMapRed, const Matrix<Int>& itCountMapRed,
+  DistMatrix<Real>& invNormMap, DistMatrix<Int>& itCountMap, const Grid& g )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::DistributeMaps"))
+    const Int height = invNormMapRed.Height();
+    const Int width = invNormMapRed.Width();
+    invNormMap.SetGrid( g );
+    itCountMap.SetGrid( g );
+    invNormMap.Resize( height, width );
+    itCountMap.AlignWith( invNormMap );
+    itCountMap.Resize( height, width );
+    const Int mLocal = invNormMap.LocalHeight();
+    const Int nLocal = invNormMap.LocalWidth();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Int j = invNormMap.RowShift() + jLoc*invNormMap.RowStride();
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+        {
+            const Int i = invNormMap.ColShift() + iLoc*invNormMap.ColStride();
+            invNormMap.SetLocal( iLoc, jLoc, invNormMapRed.Get(i,j) );
+            itCountMap.SetLocal( iLoc, jLoc, itCountMapRed.Get(i,j) );
+        }
+    }
+}
+
+} // namespace pspec
+
+template<typename F>
+inline DistMatrix<Int>
+QuasiTriangularPseudospectrum
+( const DistMatrix<F>& U, DistMatrix<BASE(F)>& invNormMap,
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth, Int xSize, Int ySize,
+  const std::vector<BASE(F)>& contours, Int numRefinements=3,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true,
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Grid& g = U.Grid();
+
+    const Real xStep = xWidth/(xSize-1);
+    const Real yStep = yWidth/(ySize-1);
+    const C corner = center - C(xWidth/2,yWidth/2);
+    const bool normal = pspec::NumericallyNormal( U, tol );
+    pspec::ShiftBatch<DistMatrix<F> > batch
+    ( U, false, normal, corner, xStep, yStep, xSize, ySize, lanczos,
+      krylovSize, reorthog, deflate, maxIts, tol, progress );
+
+    Matrix<Real> invNormMapRed;
+    Matrix<Int> itCountMapRed;
+    pspec::AdaptiveGrid
+    ( batch, xSize, ySize, contours, numRefinements, invNormMapRed,
+      itCountMapRed, progress );
+
+    DistMatrix<Int> itCountMap(g);
+    pspec::DistributeMaps
+    ( invNormMapRed, itCountMapRed, invNormMap, itCountMap, g );
+    return itCountMap;
+}
+
+template<typename F>
+inline DistMatrix<Int>
+HessenbergPseudospectrum
+( const DistMatrix<F>& H, DistMatrix<BASE(F)>& invNormMap,
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth, Int xSize, Int ySize,
+  const std::vector<BASE(F)>& contours, Int numRefinements=3,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true,
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("HessenbergPseudospectrum"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+    const Grid& g = H.Grid();
+
+    DistMatrix<C> HCpx(g);
+    HCpx.AlignWith( H );
+    const Int n = H.Height();
+    HCpx.Resize( n, n );
+    const Int mLocal = H.LocalHeight();
+    const Int nLocal = H.LocalWidth();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            HCpx.SetLocal( iLoc, jLoc, H.GetLocal(iLoc,jLoc) );
+
+    const Real xStep = xWidth/(xSize-1);
+    const Real yStep = yWidth/(ySize-1);
+    const C corner = center - C(xWidth/2,yWidth/2);
+    pspec::ShiftBatch<DistMatrix<C> > batch
+    ( HCpx, true, false, corner, xStep, yStep, xSize, ySize, lanczos,
+      krylovSize, reorthog, deflate, maxIts, tol, progress );
+
+    Matrix<Real> invNormMapRed;
+    Matrix<Int> itCountMapRed;
+    pspec::AdaptiveGrid
+    ( batch, xSize, ySize, contours, numRefinements, invNormMapRed,
+      itCountMapRed, progress );
+
+    DistMatrix<Int> itCountMap(g);
+    pspec::DistributeMaps
+    ( invNormMapRed, itCountMapRed, invNormMap, itCountMap, g );
+    return itCountMap;
+}
+
+template<typename F>
+inline Matrix<Int>
+Pseudospectrum
+( const Matrix<F>& A, Matrix<BASE(F)>& invNormMap,
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth,
+  Int xSize, Int ySize, const std::vector<BASE(F)>& contours,
+  Int numRefinements=3, bool schur=true, bool lanczos=true,
+  Int krylovSize=10, bool reorthog=true, bool deflate=true, Int maxIts=1000,
+  BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("Pseudospectrum"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+
+    if( schur )
+    {
+        Matrix<F> U( A );
+        pspec::SchurFactor( U );
+        return QuasiTriangularPseudospectrum
+               ( U, invNormMap, center, xWidth, yWidth, xSize, ySize,
+                 contours, numRefinements, lanczos, krylovSize, reorthog,
+                 deflate, maxIts, tol, progress );
+    }
+    else
+    {
+        const Int n = A.Height();
+        Matrix<C> B( n, n );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                B.Set( i, j, A.Get(i,j) );
+        Hessenberg( UPPER, B );
+        return HessenbergPseudospectrum
+               ( B, invNormMap, center, xWidth, yWidth, xSize, ySize,
+                 contours, numRefinements, lanczos, krylovSize, reorthog,
+                 deflate, maxIts, tol, progress );
+    }
+}
+
+template<typename F>
+inline DistMatrix<Int>
+Pseudospectrum
+( const DistMatrix<F>& A, DistMatrix<BASE(F)>& invNormMap,
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth, Int xSize, Int ySize,
+  const std::vector<BASE(F)>& contours, Int numRefinements=3,
+  bool schur=false, bool lanczos=true, Int krylovSize=10, bool reorthog=true,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("Pseudospectrum"))
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+
+    const Grid& g = A.Grid();
+    DistMatrix<C> B(g);
+    B.AlignWith( A );
+    const Int n = A.Height();
+    B.Resize( n, n );
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            B.SetLocal( iLoc, jLoc, A.GetLocal(iLoc,jLoc) );
+
+    if( schur )
+    {
+        // We don't actually need the Schur vectors, but SDC requires their
+        // computation in order to form the full triangular factor
+        DistMatrix<C> X(g);
+        DistMatrix<C,VR,STAR> w(g);
+        const bool formATR = true;
+        const Int cutoff = 256;
+        const Int maxInnerIts = 2;
+        const Int maxOuterIts = 10;
+        const Base<F> signTol=tol/10;
+        const Base<F> relTol=tol/10;
+        const Base<F> spreadFactor=1e-6;
+        const bool random=true;
+        schur::SDC
+        ( B, w, X, formATR, cutoff, maxInnerIts, maxOuterIts, signTol, relTol,
+          spreadFactor, random, progress );
+        X.Empty();
+
+        return QuasiTriangularPseudospectrum
+               ( B, invNormMap, center, xWidth, yWidth, xSize, ySize,
+                 contours, numRefinements, lanczos, krylovSize, reorthog,
+                 deflate, maxIts, tol, progress );
+    }
+    else
+    {
+        Hessenberg( UPPER, B );
+        return HessenbergPseudospectrum
+               ( B, invNormMap, center, xWidth, yWidth, xSize, ySize,
+                 contours, numRefinements, lanczos, krylovSize, reorthog,
+                 deflate, maxIts, tol, progress );
+    }
+}
+
+template<typename F>
+inline Matrix<Int>
+QuasiTriangularPseudospectrum
 ( const Matrix<F>& U, Matrix<BASE(F)>& invNormMap, 
   Complex<BASE(F)> center,
   Int xSize, Int ySize, bool lanczos=true, Int krylovSize=10, 
   bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
   bool progress=false )
 {
-    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
 
-    auto diag = U.GetDiagonal();
-    const Base<F> radius = MaxNorm( diag );
+    Matrix<Complex<Base<F>>> w;
+    pspec::TriangEig( U, w );
+    const Base<F> radius = MaxNorm( w );
     const Base<F> oneNorm = OneNorm( U );
 
     // Essentially three cases are handled here:
@@ -773,7 +1449,7 @@ TriangularPseudospectrum
                       << " based on the one norm, " << oneNorm << std::endl;
     }
 
-    return TriangularPseudospectrum
+    return QuasiTriangularPseudospectrum
            ( U, invNormMap, center, width, width, xSize, ySize, 
              lanczos, krylovSize, reorthog, deflate, maxIts, tol, progress );
 }
@@ -815,15 +1491,16 @@ HessenbergPseudospectrum
 
 template<typename F>
 inline DistMatrix<Int>
-TriangularPseudospectrum
+QuasiTriangularPseudospectrum
 ( const DistMatrix<F>& U, DistMatrix<BASE(F)>& invNormMap, 
   Complex<BASE(F)> center, Int xSize, Int ySize,
   bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true, 
   Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
-    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
-    auto diag = U.GetDiagonal();
-    const Base<F> radius = MaxNorm( diag );
+    DEBUG_ONLY(CallStackEntry cse("QuasiTriangularPseudospectrum"))
+    DistMatrix<Complex<Base<F>>,STAR,STAR> w( U.Grid() );
+    pspec::TriangEig( U, w );
+    const Base<F> radius = MaxNorm( w );
     const Base<F> oneNorm = OneNorm( U );
 
     // Essentially three cases are handled here:
@@ -854,7 +1531,7 @@ TriangularPseudospectrum
                       << " based on the one norm, " << oneNorm << std::endl;
     }
 
-    return TriangularPseudospectrum
+    return QuasiTriangularPseudospectrum
            ( U, invNormMap, center, width, width, xSize, ySize, 
              lanczos, krylovSize, reorthog, deflate, maxIts, tol, progress );
 }
@@ -906,23 +1583,22 @@ Pseudospectrum
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
-    const Int n = A.Height();
-    Matrix<C> B( n, n );
-    for( Int j=0; j<n; ++j )
-        for( Int i=0; i<n; ++i )
-            B.Set( i, j, A.Get(i,j) );
-
     if( schur )
     {
-        Matrix<C> w;
-        schur::QR( B, w );
-        return TriangularPseudospectrum
-               ( B, invNormMap, center, xSize, ySize, 
+        Matrix<F> U( A );
+        pspec::SchurFactor( U );
+        return QuasiTriangularPseudospectrum
+               ( U, invNormMap, center, xSize, ySize,
                  lanczos, krylovSize, reorthog, deflate, maxIts, tol, 
                  progress );
     }
     else
     {
+        const Int n = A.Height();
+        Matrix<C> B( n, n );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<n; ++i )
+                B.Set( i, j, A.Get(i,j) );
         Hessenberg( UPPER, B );
         return HessenbergPseudospectrum
                ( B, invNormMap, center, xSize, ySize, 
@@ -974,7 +1650,7 @@ Pseudospectrum
           spreadFactor, random, progress );
         X.Empty();
  
-        return TriangularPseudospectrum
+        return QuasiTriangularPseudospectrum
                ( B, invNormMap, center, xSize, ySize,
                  lanczos, krylovSize, reorthog, deflate, maxIts, tol, 
                  progress );
@@ -989,6 +1665,144 @@ Pseudospectrum
     }
 }
 
+// Only the upper triangle of U is referenced by the following routines; see
+// the QuasiTriangularPseudospectrum routines for real Schur factors
+
+template<typename F>
+inline Matrix<Int>
+TriangularPseudospectrum
+( const Matrix<F>& U, const Matrix<Complex<BASE(F)> >& shifts, 
+  Matrix<BASE(F)>& invNorms, bool lanczos=true, Int krylovSize=10, 
+  bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    Matrix<F> UTri;
+    pspec::UpperTriangle( U, UTri );
+    return QuasiTriangularPseudospectrum
+           ( UTri, shifts, invNorms, lanczos, krylovSize, reorthog, deflate,
+             maxIts, tol, progress );
+}
+
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+TriangularPseudospectrum
+( const DistMatrix<F>& U, const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+  DistMatrix<BASE(F),VR,STAR>& invNorms, bool lanczos=true, Int krylovSize=10, 
+  bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    DistMatrix<F> UTri( U.Grid() );
+    pspec::UpperTriangle( U, UTri );
+    return QuasiTriangularPseudospectrum
+           ( UTri, shifts, invNorms, lanczos, krylovSize, reorthog, deflate,
+             maxIts, tol, progress );
+}
+
+template<typename F>
+inline Matrix<Int>
+TriangularPseudospectrum
+( const Matrix<F>& U, Matrix<BASE(F)>& invNormMap, 
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth,
+  Int xSize, Int ySize, bool lanczos=true, Int krylovSize=10, 
+  bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    Matrix<F> UTri;
+    pspec::UpperTriangle( U, UTri );
+    return QuasiTriangularPseudospectrum
+           ( UTri, invNormMap, center, xWidth, yWidth, xSize, ySize,
+             lanczos, krylovSize, reorthog, deflate, maxIts, tol, progress );
+}
+
+template<typename F>
+inline DistMatrix<Int>
+TriangularPseudospectrum
+( const DistMatrix<F>& U, DistMatrix<BASE(F)>& invNormMap, 
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth, Int xSize, Int ySize,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true, 
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    DistMatrix<F> UTri( U.Grid() );
+    pspec::UpperTriangle( U, UTri );
+    return QuasiTriangularPseudospectrum
+           ( UTri, invNormMap, center, xWidth, yWidth, xSize, ySize,
+             lanczos, krylovSize, reorthog, deflate, maxIts, tol, progress );
+}
+
+template<typename F>
+inline Matrix<Int>
+TriangularPseudospectrum
+( const Matrix<F>& U, Matrix<BASE(F)>& invNormMap,
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth,
+  Int xSize, Int ySize, const std::vector<BASE(F)>& contours,
+  Int numRefinements=3, bool lanczos=true, Int krylovSize=10,
+  bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6,
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    Matrix<F> UTri;
+    pspec::UpperTriangle( U, UTri );
+    return QuasiTriangularPseudospectrum
+           ( UTri, invNormMap, center, xWidth, yWidth, xSize, ySize,
+             contours, numRefinements, lanczos, krylovSize, reorthog,
+             deflate, maxIts, tol, progress );
+}
+
+template<typename F>
+inline DistMatrix<Int>
+TriangularPseudospectrum
+( const DistMatrix<F>& U, DistMatrix<BASE(F)>& invNormMap,
+  Complex<BASE(F)> center, BASE(F) xWidth, BASE(F) yWidth, Int xSize, Int ySize,
+  const std::vector<BASE(F)>& contours, Int numRefinements=3,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true,
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    DistMatrix<F> UTri( U.Grid() );
+    pspec::UpperTriangle( U, UTri );
+    return QuasiTriangularPseudospectrum
+           ( UTri, invNormMap, center, xWidth, yWidth, xSize, ySize,
+             contours, numRefinements, lanczos, krylovSize, reorthog,
+             deflate, maxIts, tol, progress );
+}
+
+template<typename F>
+inline Matrix<Int>
+TriangularPseudospectrum
+( const Matrix<F>& U, Matrix<BASE(F)>& invNormMap, 
+  Complex<BASE(F)> center,
+  Int xSize, Int ySize, bool lanczos=true, Int krylovSize=10, 
+  bool reorthog=true, bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, 
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    Matrix<F> UTri;
+    pspec::UpperTriangle( U, UTri );
+    return QuasiTriangularPseudospectrum
+           ( UTri, invNormMap, center, xSize, ySize, lanczos, krylovSize,
+             reorthog, deflate, maxIts, tol, progress );
+}
+
+template<typename F>
+inline DistMatrix<Int>
+TriangularPseudospectrum
+( const DistMatrix<F>& U, DistMatrix<BASE(F)>& invNormMap, 
+  Complex<BASE(F)> center, Int xSize, Int ySize,
+  bool lanczos=true, Int krylovSize=10, bool reorthog=true, bool deflate=true, 
+  Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularPseudospectrum"))
+    DistMatrix<F> UTri( U.Grid() );
+    pspec::UpperTriangle( U, UTri );
+    return QuasiTriangularPseudospectrum
+           ( UTri, invNormMap, center, xSize, ySize, lanczos, krylovSize,
+             reorthog, deflate, maxIts, tol, progress );
+}
+
 } // namespace elem
 
 #endif // ifndef ELEM_PSEUDOSPECTRUM_HPP
@@ -0,0 +1,580 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_PSEUDOSPECTRUM_ADAPTIVE_HPP
+#define ELEM_PSEUDOSPECTRUM_ADAPTIVE_HPP
+
+// Rather than evaluating the inverse norm at every point of an xSize x ySize
+// lattice, a lattice with a stride of 2^numRefinements is first evaluated,
+// and then only the cells whose corners straddle one of the requested
+// contours, ||inv(A - z I)||_2 = 1/epsilon, are recursively bisected. Cells
+// containing an eigenvalue of a triangular matrix are treated as if they
+// straddle every contour above their corner values, but, in the Hessenberg
+// case, components of the pseudospectrum which fit within a single coarse
+// cell can be missed. The remaining entries of the map are bilinearly
+// interpolated in log-space and are given an iteration count of zero. Each
+// newly-introduced shift is warm-started from the final power or
+// Krylov-spectral iterate of the nearest corner of its parent cell.
+
+namespace elem {
+namespace pspec {
+
+// The final iterates of previously-solved shifts, indexed by their position
+// in the lattice, so that they may be used as initial guesses for neighbors.
+// In the distributed case, only the local rows of the [MC,* ] iterates are
+// stored.
+template<typename F>
+class IterateStore
+{
+public:
+    IterateStore( Int numPoints ) : columns_(numPoints,-1), numStored_(0) { }
+
+    bool Has( Int point ) const
+    { return point >= 0 && columns_[point] >= 0; }
+
+    const F* LockedBuffer( Int point ) const
+    { return vectors_.LockedBuffer(0,columns_[point]); }
+
+    // Append the new iterates after the stored ones, doubling the capacity
+    // whenever it is exhausted so that previous iterates are rarely moved
+    void Add( const std::vector<Int>& points, const Matrix<F>& X )
+    {
+        DEBUG_ONLY(CallStackEntry cse("pspec::IterateStore::Add"))
+        const Int height = X.Height();
+        const Int numNew = points.size();
+        if( numStored_+numNew > vectors_.Width() )
+        {
+            const Int capacity = Max( 2*vectors_.Width(), numStored_+numNew );
+            Matrix<F> vectors( height, capacity );
+            if( numStored_ > 0 )
+                MemCopy
+                ( vectors.Buffer(0,0), vectors_.LockedBuffer(0,0),
+                  height*numStored_ );
+            vectors_ = vectors;
+        }
+        for( Int k=0; k<numNew; ++k )
+        {
+            MemCopy
+            ( vectors_.Buffer(0,numStored_), X.LockedBuffer(0,k), height );
+            columns_[points[k]] = numStored_++;
+        }
+    }
+
+    // Throw away every iterate which is not needed for the next refinement
+    // by compacting the retained ones towards the front (in place)
+    void Retain( const std::vector<Int>& points )
+    {
+        DEBUG_ONLY(CallStackEntry cse("pspec::IterateStore::Retain"))
+        const Int height = vectors_.Height();
+        std::vector<std::pair<Int,Int> > kept;
+        for( Int k=0; k<Int(points.size()); ++k )
+        {
+            if( Has(points[k]) )
+            {
+                kept.push_back( std::make_pair(columns_[points[k]],points[k]) );
+                columns_[points[k]] = -1;
+            }
+        }
+        std::fill( columns_.begin(), columns_.end(), -1 );
+        // Moving the columns in increasing order never overwrites one which
+        // has yet to be moved
+        std::sort( kept.begin(), kept.end() );
+        numStored_ = kept.size();
+        for( Int k=0; k<numStored_; ++k )
+        {
+            if( kept[k].first != k )
+                MemCopy
+                ( vectors_.Buffer(0,k), vectors_.LockedBuffer(0,kept[k].first),
+                  height );
+            columns_[kept[k].second] = k;
+        }
+    }
+
+private:
+    std::vector<Int> columns_;
+    Int numStored_;
+    Matrix<F> vectors_;
+};
+
+// The cell [x0,x1] x [y0,y1] of the lattice
+struct LatticeCell
+{
+    Int x0, x1, y0, y1;
+
+    LatticeCell( Int xBeg, Int xEnd, Int yBeg, Int yEnd )
+    : x0(xBeg), x1(xEnd), y0(yBeg), y1(yEnd) { }
+};
+
+// Whether any of the (known) eigenvalues lie within the given cell
+template<typename Real>
+inline bool
+ContainsEigenvalue
+( const std::vector<Complex<Real> >& eigs, Complex<Real> corner,
+  Real xStep, Real yStep, const LatticeCell& cell )
+{
+    for( Int k=0; k<Int(eigs.size()); ++k )
+    {
+        const Real x = (eigs[k].real()-corner.real())/xStep;
+        const Real y = (eigs[k].imag()-corner.imag())/yStep;
+        if( x >= cell.x0 && x <= cell.x1 && y >= cell.y0 && y <= cell.y1 )
+            return true;
+    }
+    return false;
+}
+
+// Evaluates the inverse norms of a batch of lattice points, where the lattice
+// point with index j = x*ySize + y corresponds to the shift
+// corner + (x*xStep,y*yStep) (the same ordering as for uniform grids).
+// Numerically normal triangular matrices are handled analytically.
+template<typename M>
+class ShiftBatch;
+
+template<typename F>
+class ShiftBatch<Matrix<F> >
+{
+public:
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+
+    ShiftBatch
+    ( const Matrix<F>& A, bool hessenberg, bool normal, C corner,
+      Real xStep, Real yStep, Int xSize, Int ySize, bool lanczos,
+      Int krylovSize, bool reorthog, bool deflate, Int maxIts, Real tol,
+      bool progress )
+    : A_(A), hessenberg_(hessenberg), normal_(normal), corner_(corner),
+      xStep_(xStep), yStep_(yStep), ySize_(ySize), lanczos_(lanczos),
+      krylovSize_(krylovSize), reorthog_(reorthog), deflate_(deflate),
+      maxIts_(maxIts), tol_(tol), progress_(progress), store_(xSize*ySize)
+    {
+        if( !hessenberg )
+        {
+            Matrix<C> w;
+            TriangEig( A, w );
+            const Int n = A.Height();
+            eigs_.resize( n );
+            for( Int i=0; i<n; ++i )
+                eigs_[i] = w.Get(i,0);
+        }
+    }
+
+    void Solve
+    ( const std::vector<Int>& points, const std::vector<Int>& sources,
+      std::vector<Real>& invNorms, std::vector<Int>& itCounts )
+    {
+        DEBUG_ONLY(CallStackEntry cse("pspec::ShiftBatch::Solve"))
+        const Int n = A_.Height();
+        const Int numShifts = points.size();
+        Matrix<C> shifts( numShifts, 1 );
+        for( Int j=0; j<numShifts; ++j )
+            shifts.Set( j, 0, Shift(points[j]) );
+
+        Matrix<C> X;
+        Gaussian( X, n, numShifts );
+        for( Int j=0; j<numShifts; ++j )
+            if( store_.Has(sources[j]) )
+                MemCopy( X.Buffer(0,j), store_.LockedBuffer(sources[j]), n );
+
+        Matrix<Real> invNormVec;
+        Matrix<Int> itCountVec;
+        if( hessenberg_ )
+            itCountVec =
+                HessenbergPseudospectrum
+                ( A_, shifts, invNormVec, X, lanczos_, krylovSize_,
+                  reorthog_, deflate_, maxIts_, tol_, progress_ );
+        else
+            itCountVec =
+                QuasiTriangularPseudospectrum
+                ( A_, shifts, invNormVec, X, lanczos_, krylovSize_,
+                  reorthog_, deflate_, maxIts_, tol_, progress_ );
+        if( KeepsIterates() )
+            store_.Add( points, X );
+
+        invNorms.resize( numShifts );
+        itCounts.resize( numShifts );
+        for( Int j=0; j<numShifts; ++j )
+        {
+            invNorms[j] = invNormVec.Get(j,0);
+            itCounts[j] = itCountVec.Get(j,0);
+        }
+    }
+
+    void Retain( const std::vector<Int>& points ) { store_.Retain( points ); }
+
+    // Whether this process should report the progress of the refinement
+    bool Root() const { return true; }
+
+    // The resolvent norm is unbounded within cells containing an eigenvalue
+    bool ContainsEigenvalue( const LatticeCell& cell ) const
+    {
+        return pspec::ContainsEigenvalue
+               ( eigs_, corner_, xStep_, yStep_, cell );
+    }
+
+private:
+    const Matrix<F>& A_;
+    bool hessenberg_, normal_;
+    C corner_;
+    Real xStep_, yStep_;
+    Int ySize_;
+    bool lanczos_;
+    Int krylovSize_;
+    bool reorthog_, deflate_;
+    Int maxIts_;
+    Real tol_;
+    bool progress_;
+    IterateStore<C> store_;
+    std::vector<C> eigs_;
+
+    C Shift( Int point ) const
+    { return corner_ + C((point/ySize_)*xStep_,(point%ySize_)*yStep_); }
+
+    // Single-vector Lanczos does not form an estimate of the dominant
+    // singular vector, and normal matrices are handled analytically
+    bool KeepsIterates() const
+    { return !normal_ && (!lanczos_ || krylovSize_ > 1); }
+};
+
+template<typename F>
+class ShiftBatch<DistMatrix<F> >
+{
+public:
+    typedef Base<F> Real;
+    typedef Complex<Real> C;
+
+    ShiftBatch
+    ( const DistMatrix<F>& A, bool hessenberg, bool normal, C corner,
+      Real xStep, Real yStep, Int xSize, Int ySize, bool lanczos,
+      Int krylovSize, bool reorthog, bool deflate, Int maxIts, Real tol,
+      bool progress )
+    : A_(A), hessenberg_(hessenberg), normal_(normal), corner_(corner),
+      xStep_(xStep), yStep_(yStep), ySize_(ySize), lanczos_(lanczos),
+      krylovSize_(krylovSize), reorthog_(reorthog), deflate_(deflate),
+      maxIts_(maxIts), tol_(tol), progress_(progress), store_(xSize*ySize)
+    {
+        if( !hessenberg )
+        {
+            DistMatrix<C,STAR,STAR> w( A.Grid() );
+            TriangEig( A, w );
+            const Int n = A.Height();
+            eigs_.resize( n );
+            for( Int i=0; i<n; ++i )
+                eigs_[i] = w.GetLocal(i,0);
+        }
+    }
+
+    void Solve
+    ( const std::vector<Int>& points, const std::vector<Int>& sources,
+      std::vector<Real>& invNorms, std::vector<Int>& itCounts )
+    {
+        DEBUG_ONLY(CallStackEntry cse("pspec::ShiftBatch::Solve"))
+        const Grid& g = A_.Grid();
+        const Int n = A_.Height();
+        const Int numShifts = points.size();
+        DistMatrix<C,VR,STAR> shifts( numShifts, 1, g );
+        const Int numLocShifts = shifts.LocalHeight();
+        for( Int jLoc=0; jLoc<numLocShifts; ++jLoc )
+        {
+            const Int j = shifts.ColShift() + jLoc*shifts.ColStride();
+            shifts.SetLocal( jLoc, 0, Shift(points[j]) );
+        }
+
+        // The iterates are stored in [MC,* ] form so that forming the
+        // initial guesses does not require any communication
+        DistMatrix<C> X(g);
+        Gaussian( X, n, numShifts );
+        const Int mLocal = X.LocalHeight();
+        const Int nLocal = X.LocalWidth();
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        {
+            const Int j = X.RowShift() + jLoc*X.RowStride();
+            if( store_.Has(sources[j]) )
+                MemCopy
+                ( X.Buffer(0,jLoc), store_.LockedBuffer(sources[j]), mLocal );
+        }
+
+        DistMatrix<Real,VR,STAR> invNormVec(g);
+        DistMatrix<Int,STAR,STAR> itCountVec(g);
+        if( hessenberg_ )
+            itCountVec =
+                HessenbergPseudospectrum
+                ( A_, shifts, invNormVec, X, lanczos_, krylovSize_,
+                  reorthog_, deflate_, maxIts_, tol_, progress_ );
+        else
+            itCountVec =
+                QuasiTriangularPseudospectrum
+                ( A_, shifts, invNormVec, X, lanczos_, krylovSize_,
+                  reorthog_, deflate_, maxIts_, tol_, progress_ );
+        if( KeepsIterates() )
+        {
+            DistMatrix<C,MC,STAR> X_MC_STAR(g);
+            X_MC_STAR.AlignWith( X );
+            X_MC_STAR = X;
+            store_.Add( points, X_MC_STAR.LockedMatrix() );
+        }
+
+        DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNormVec );
+        invNorms.resize( numShifts );
+        itCounts.resize( numShifts );
+        for( Int j=0; j<numShifts; ++j )
+        {
+            invNorms[j] = invNorms_STAR_STAR.GetLocal(j,0);
+            itCounts[j] = itCountVec.GetLocal(j,0);
+        }
+    }
+
+    void Retain( const std::vector<Int>& points ) { store_.Retain( points ); }
+
+    // Whether this process should report the progress of the refinement
+    bool Root() const { return A_.Grid().Rank() == 0; }
+
+    // The resolvent norm is unbounded within cells containing an eigenvalue
+    bool ContainsEigenvalue( const LatticeCell& cell ) const
+    {
+        return pspec::ContainsEigenvalue
+               ( eigs_, corner_, xStep_, yStep_, cell );
+    }
+
+private:
+    const DistMatrix<F>& A_;
+    bool hessenberg_, normal_;
+    C corner_;
+    Real xStep_, yStep_;
+    Int ySize_;
+    bool lanczos_;
+    Int krylovSize_;
+    bool reorthog_, deflate_;
+    Int maxIts_;
+    Real tol_;
+    bool progress_;
+    IterateStore<C> store_;
+    std::vector<C> eigs_;
+
+    C Shift( Int point ) const
+    { return corner_ + C((point/ySize_)*xStep_,(point%ySize_)*yStep_); }
+
+    // Single-vector Lanczos does not form an estimate of the dominant
+    // singular vector, and normal matrices are handled analytically
+    bool KeepsIterates() const
+    { return !normal_ && (!lanczos_ || krylovSize_ > 1); }
+};
+
+// The coarse lattice coordinates 0, stride, 2 stride, ..., size-1
+inline std::vector<Int>
+CoarseCoordinates( Int size, Int stride )
+{
+    std::vector<Int> coords;
+    for( Int x=0; x<size-1; x+=stride )
+        coords.push_back( x );
+    coords.push_back( size-1 );
+    return coords;
+}
+
+template<typename Real>
+inline bool
+CrossesContour
+( const Matrix<Real>& invNormMap, const LatticeCell& cell,
+  const std::vector<Real>& contours, bool containsEigenvalue=false )
+{
+    const Real alpha00 = invNormMap.Get(cell.y0,cell.x0);
+    const Real alpha01 = invNormMap.Get(cell.y1,cell.x0);
+    const Real alpha10 = invNormMap.Get(cell.y0,cell.x1);
+    const Real alpha11 = invNormMap.Get(cell.y1,cell.x1);
+    const Real minInvNorm = Min(Min(alpha00,alpha01),Min(alpha10,alpha11));
+    const Real maxInvNorm =
+        ( containsEigenvalue ? NormCap<Real>()
+                             : Max(Max(alpha00,alpha01),Max(alpha10,alpha11)) );
+    for( Int k=0; k<Int(contours.size()); ++k )
+    {
+        const Real level = Real(1)/contours[k];
+        if( minInvNorm <= level && level <= maxInvNorm )
+            return true;
+    }
+    return false;
+}
+
+// Fill in the entries of the cell which were not explicitly computed by
+// bilinearly interpolating the logarithms of the corner inverse norms
+template<typename Real>
+inline void
+InterpolateCell
+( const LatticeCell& cell, const std::vector<bool>& computed, Int ySize,
+  Matrix<Real>& invNormMap, Matrix<Int>& itCountMap )
+{
+    const Real minInvNorm = lapack::MachineSafeMin<Real>();
+    const Real log00 = Log(Max(invNormMap.Get(cell.y0,cell.x0),minInvNorm));
+    const Real log01 = Log(Max(invNormMap.Get(cell.y1,cell.x0),minInvNorm));
+    const Real log10 = Log(Max(invNormMap.Get(cell.y0,cell.x1),minInvNorm));
+    const Real log11 = Log(Max(invNormMap.Get(cell.y1,cell.x1),minInvNorm));
+    const Real xWidth = cell.x1 - cell.x0;
+    const Real yWidth = cell.y1 - cell.y0;
+    for( Int x=cell.x0; x<=cell.x1; ++x )
+    {
+        const Real s = ( xWidth == Real(0) ? Real(0) : (x-cell.x0)/xWidth );
+        for( Int y=cell.y0; y<=cell.y1; ++y )
+        {
+            if( computed[x*ySize+y] )
+                continue;
+            const Real t = ( yWidth == Real(0) ? Real(0) : (y-cell.y0)/yWidth );
+            const Real logInvNorm = (1-s)*(1-t)*log00 + (1-s)*t*log01 +
+                                    s*(1-t)*log10 + s*t*log11;
+            invNormMap.Set( y, x, Exp(logInvNorm) );
+            itCountMap.Set( y, x, 0 );
+        }
+    }
+}
+
+template<typename Real,class Batch>
+inline void
+SolveBatch
+( Batch& batch, const std::vector<Int>& points,
+  const std::vector<Int>& sources, Int ySize,
+  Matrix<Real>& invNormMap, Matrix<Int>& itCountMap )
+{
+    std::vector<Real> invNorms;
+    std::vector<Int> itCounts;
+    batch.Solve( points, sources, invNorms, itCounts );
+    for( Int k=0; k<Int(points.size()); ++k )
+    {
+        const Int x = points[k] / ySize;
+        const Int y = points[k] % ySize;
+        invNormMap.Set( y, x, invNorms[k] );
+        itCountMap.Set( y, x, itCounts[k] );
+    }
+}
+
+// Fills the ySize x xSize maps (with entry (y,x) corresponding to lattice
+// point x*ySize+y) by adaptively refining a coarse lattice towards the
+// requested contours
+template<typename Real,class Batch>
+inline void
+AdaptiveGrid
+( Batch& batch, Int xSize, Int ySize, const std::vector<Real>& contours,
+  Int numRefinements, Matrix<Real>& invNormMap, Matrix<Int>& itCountMap,
+  bool progress=false )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("pspec::AdaptiveGrid");
+        if( xSize < 2 || ySize < 2 )
+            LogicError("Adaptive grids must be at least 2 x 2");
+        if( numRefinements < 0 )
+            LogicError("Number of refinements must be non-negative");
+    )
+    Zeros( invNormMap, ySize, xSize );
+    Zeros( itCountMap, ySize, xSize );
+    std::vector<bool> computed( xSize*ySize, false );
+    const Int stride = Int(1) << numRefinements;
+
+    std::vector<Int> points, sources;
+
+    // Evaluate the coarse lattice
+    const std::vector<Int> xCoarse = CoarseCoordinates( xSize, stride );
+    const std::vector<Int> yCoarse = CoarseCoordinates( ySize, stride );
+    for( Int k=0; k<Int(xCoarse.size()); ++k )
+    {
+        for( Int l=0; l<Int(yCoarse.size()); ++l )
+        {
+            const Int point = xCoarse[k]*ySize + yCoarse[l];
+            points.push_back( point );
+            sources.push_back( -1 );
+            computed[point] = true;
+        }
+    }
+    Int numSolved = points.size();
+    SolveBatch( batch, points, sources, ySize, invNormMap, itCountMap );
+
+    std::vector<LatticeCell> cells, finalCells;
+    for( Int k=0; k<Int(xCoarse.size())-1; ++k )
+        for( Int l=0; l<Int(yCoarse.size())-1; ++l )
+            cells.push_back
+            ( LatticeCell(xCoarse[k],xCoarse[k+1],yCoarse[l],yCoarse[l+1]) );
+
+    Int level=0;
+    while( !cells.empty() )
+    {
+        // Bisect each unresolved cell which the contours pass through
+        std::vector<LatticeCell> children;
+        std::vector<Int> corners;
+        points.resize( 0 );
+        sources.resize( 0 );
+        for( Int c=0; c<Int(cells.size()); ++c )
+        {
+            const LatticeCell& cell = cells[c];
+            const bool xSplit = ( cell.x1-cell.x0 > 1 );
+            const bool ySplit = ( cell.y1-cell.y0 > 1 );
+            if( (!xSplit && !ySplit) ||
+                !CrossesContour
+                 ( invNormMap, cell, contours,
+                   batch.ContainsEigenvalue(cell) ) )
+            {
+                finalCells.push_back( cell );
+                continue;
+            }
+            corners.push_back( cell.x0*ySize+cell.y0 );
+            corners.push_back( cell.x0*ySize+cell.y1 );
+            corners.push_back( cell.x1*ySize+cell.y0 );
+            corners.push_back( cell.x1*ySize+cell.y1 );
+
+            const Int xMid = ( xSplit ? (cell.x0+cell.x1)/2 : cell.x1 );
+            const Int yMid = ( ySplit ? (cell.y0+cell.y1)/2 : cell.y1 );
+            Int xBounds[3] = { cell.x0, xMid, cell.x1 };
+            Int yBounds[3] = { cell.y0, yMid, cell.y1 };
+            const Int numX = ( xSplit ? 2 : 1 );
+            const Int numY = ( ySplit ? 2 : 1 );
+            for( Int k=0; k<numX; ++k )
+                for( Int l=0; l<numY; ++l )
+                    children.push_back
+                    ( LatticeCell
+                      (xBounds[k],xBounds[k+1],yBounds[l],yBounds[l+1]) );
+            for( Int k=0; k<=numX; ++k )
+            {
+                const Int x = ( xSplit ? xBounds[k] : xBounds[2*k] );
+                for( Int l=0; l<=numY; ++l )
+                {
+                    const Int y = ( ySplit ? yBounds[l] : yBounds[2*l] );
+                    const Int point = x*ySize + y;
+                    if( computed[point] )
+                        continue;
+                    // Warm-start from the nearest corner of the parent
+                    const Int xNear =
+                        ( x-cell.x0 <= cell.x1-x ? cell.x0 : cell.x1 );
+                    const Int yNear =
+                        ( y-cell.y0 <= cell.y1-y ? cell.y0 : cell.y1 );
+                    points.push_back( point );
+                    sources.push_back( xNear*ySize+yNear );
+                    computed[point] = true;
+                }
+            }
+        }
+        cells.swap( children );
+        if( points.empty() )
+            continue;
+
+        batch.Retain( corners );
+        numSolved += points.size();
+        SolveBatch( batch, points, sources, ySize, invNormMap, itCountMap );
+        ++level;
+        if( progress && batch.Root() )
+            std::cout << "refinement " << level << ": solved "
+                      << points.size() << " shifts, " << cells.size()
+                      << " active cells" << std::endl;
+    }
+    batch.Retain( std::vector<Int>() );
+
+    for( Int c=0; c<Int(finalCells.size()); ++c )
+        InterpolateCell
+        ( finalCells[c], computed, ySize, invNormMap, itCountMap );
+    if( progress && batch.Root() )
+        std::cout << "Solved for " << numSolved << " of " << xSize*ySize
+                  << " shifts" << std::endl;
+}
+
+} // namespace pspec
+} // namespace elem
+
+#endif // ifndef ELEM_PSEUDOSPECTRUM_ADAPTIVE_HPP
@@ -15,6 +15,104 @@
 namespace elem {
 namespace pspec {
 
+// The eigenvalues of an upper triangular matrix or of a real upper
+// quasi-triangular matrix, whose 2x2 diagonal blocks (marked by nonzero
+// subdiagonal entries) each hold a pair of eigenvalues
+
+template<typename Real>
+inline void
+QuasiTriangEig
+( const Matrix<Real>& diag, const Matrix<Real>& superDiag,
+  const Matrix<Real>& subDiag, Matrix<Complex<Real> >& w )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::QuasiTriangEig"))
+    typedef Complex<Real> C;
+    const Int n = diag.Height();
+    w.Resize( n, 1 );
+    Int i = 0;
+    while( i < n )
+    {
+        if( i < n-1 && subDiag.Get(i,0) != Real(0) )
+        {
+            // The eigenvalues of [alpha, beta; gamma, delta] are
+            // (alpha+delta)/2 +- sqrt(((alpha-delta)/2)^2 + beta gamma)
+            const Real alpha = diag.Get(i,0);
+            const Real beta = superDiag.Get(i,0);
+            const Real gamma = subDiag.Get(i,0);
+            const Real delta = diag.Get(i+1,0);
+            const Real mean = (alpha+delta)/2;
+            const Real halfDiff = (alpha-delta)/2;
+            const Real disc = halfDiff*halfDiff + beta*gamma;
+            if( disc < Real(0) )
+            {
+                const Real root = Sqrt(-disc);
+                w.Set( i,   0, C(mean, root) );
+                w.Set( i+1, 0, C(mean,-root) );
+            }
+            else
+            {
+                const Real root = Sqrt(disc);
+                w.Set( i,   0, mean+root );
+                w.Set( i+1, 0, mean-root );
+            }
+            i += 2;
+        }
+        else
+        {
+            w.Set( i, 0, diag.Get(i,0) );
+            i += 1;
+        }
+    }
+}
+
+template<typename Real>
+inline void
+TriangEig( const Matrix<Complex<Real> >& U, Matrix<Complex<Real> >& w )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangEig"))
+    U.GetDiagonal( w );
+}
+
+template<typename Real>
+inline void
+TriangEig( const Matrix<Real>& U, Matrix<Complex<Real> >& w )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangEig"))
+    auto diag = U.GetDiagonal();
+    auto superDiag = U.GetDiagonal(1);
+    auto subDiag = U.GetDiagonal(-1);
+    QuasiTriangEig( diag, superDiag, subDiag, w );
+}
+
+template<typename Real>
+inline void
+TriangEig
+( const DistMatrix<Complex<Real> >& U,
+  DistMatrix<Complex<Real>,STAR,STAR>& w )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangEig"))
+    auto diag = U.GetDiagonal();
+    w = diag;
+}
+
+template<typename Real>
+inline void
+TriangEig
+( const DistMatrix<Real>& U, DistMatrix<Complex<Real>,STAR,STAR>& w )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangEig"))
+    const Grid& g = U.Grid();
+    DistMatrix<Real,STAR,STAR> diag(g), superDiag(g), subDiag(g);
+    diag = U.GetDiagonal();
+    superDiag = U.GetDiagonal(1);
+    subDiag = U.GetDiagonal(-1);
+    w.SetGrid( g );
+    w.Resize( diag.Height(), 1 );
+    QuasiTriangEig
+    ( diag.LockedMatrix(), superDiag.LockedMatrix(), subDiag.LockedMatrix(),
+      w.Matrix() );
+}
+
 template<typename Real>
 inline void
 Analytic
@@ -119,7 +119,8 @@ Restart
   std::vector<DistMatrix<Complex<Real> > >& VList )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::Restart"))
-    const Int krylovSize = HDiagList[0].size();
+    // HDiagList is empty if this process was not assigned any shifts
+    const Int krylovSize = VList.size()-1;
     std::vector<Matrix<Complex<Real>>> VLocList(krylovSize+1);
     for( Int j=0; j<krylovSize+1; ++j )
         VLocList[j] = View( VList[j].Matrix() );
@@ -127,18 +128,28 @@ Restart
     ( HDiagList, HSubdiagList, activeConverged.LockedMatrix(), VLocList );
 }
 
-template<typename Real>
+// On entry, the columns of X should contain initial guesses for the
+// dominant right singular vectors of inv(U - shift I), and, on exit, they
+// will contain the final restarted iterates (in the original ordering of the
+// shifts)
+template<typename F>
 inline Matrix<Int>
 TriangularKrylovSpectral
-( const Matrix<Complex<Real> >& U, const Matrix<Complex<Real> >& shifts, 
-  Matrix<Real>& invNorms, const Int krylovSize=10, bool reorthog=true,
-  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+( const Matrix<F>& U, const Matrix<Complex<BASE(F)> >& shifts,
+  Matrix<BASE(F)>& invNorms, Matrix<Complex<BASE(F)> >& X,
+  const Int krylovSize=10, bool reorthog=true,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::TriangularKrylovSpectral"))
+    typedef Base<F> Real;
     using namespace pspec;
     typedef Complex<Real> C;
     const Int n = U.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( X.Height() != n || X.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
 
     // Keep track of the number of iterations per shift
     Matrix<Int> itCounts;
@@ -158,7 +169,7 @@ TriangularKrylovSpectral
     std::vector<Matrix<C>> VList(krylovSize+1), activeVList(krylovSize+1);
     for( Int j=0; j<krylovSize+1; ++j )
         Zeros( VList[j], n, numShifts );
-    Gaussian( VList[0], n, numShifts );
+    VList[0] = X;
     std::vector<std::vector<Real>> 
         HDiagList(numShifts), HSubdiagList(numShifts);
     std::vector<Complex<Real>> components;
@@ -206,10 +217,10 @@ TriangularKrylovSpectral
             activeVList[j+1] = activeVList[j];
             if( progress )
                 subtimer.Start();
-            MultiShiftTrsm
-            ( LEFT, UPPER, NORMAL, C(1), U, activeShifts, activeVList[j+1] );
-            MultiShiftTrsm
-            ( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, activeVList[j+1] );
+            MultiShiftTriSolve
+            ( NORMAL, U, activeShifts, activeVList[j+1] );
+            MultiShiftTriSolve
+            ( ADJOINT, U, activeShifts, activeVList[j+1] );
             if( progress )
             {
                 const double msTime = subtimer.Stop();
@@ -251,7 +262,7 @@ TriangularKrylovSpectral
         if( progress )
             subtimer.Start();
         Restart
-        ( HDiagList, HSubdiagList, activeVList, activeConverged, activeEsts );
+        ( HDiagList, HSubdiagList, activeConverged, activeVList );
         if( progress )
             std::cout << "Krylov-spectral contraction: " << subtimer.Stop()
                       << " seconds" << std::endl;
@@ -286,17 +297,42 @@ TriangularKrylovSpectral
         RuntimeError("Two-norm estimates did not converge in time");
 
     invNorms = estimates;
+    X = VList[0];
     if( deflate )
+    {
         RestoreOrdering( preimage, invNorms, itCounts );
+        RestoreOrdering( preimage, X );
+    }
 
     return itCounts;
 }
 
+template<typename F>
+inline Matrix<Int>
+TriangularKrylovSpectral
+( const Matrix<F>& U, const Matrix<Complex<BASE(F)> >& shifts,
+  Matrix<BASE(F)>& invNorms, const Int krylovSize=10, bool reorthog=true,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularKrylovSpectral"))
+    typedef Base<F> Real;
+    Matrix<Complex<Real> > X;
+    Gaussian( X, U.Height(), shifts.Height() );
+    return TriangularKrylovSpectral
+    ( U, shifts, invNorms, X, krylovSize, reorthog, deflate, maxIts, tol,
+      progress );
+}
+
+// On entry, the columns of X should contain initial guesses for the
+// dominant right singular vectors of inv(H - shift I), and, on exit, they
+// will contain the final restarted iterates (in the original ordering of the
+// shifts)
 template<typename Real>
 inline Matrix<Int>
 HessenbergKrylovSpectral
 ( const Matrix<Complex<Real> >& H, const Matrix<Complex<Real> >& shifts, 
-  Matrix<Real>& invNorms, const Int krylovSize=10, bool reorthog=true,
+  Matrix<Real>& invNorms, Matrix<Complex<Real> >& X,
+  const Int krylovSize=10, bool reorthog=true,
   bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergKrylovSpectral"))
@@ -304,6 +340,10 @@ HessenbergKrylovSpectral
     typedef Complex<Real> C;
     const Int n = H.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( X.Height() != n || X.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
 
     // Keep track of the number of iterations per shift
     Matrix<Int> itCounts;
@@ -327,7 +367,7 @@ HessenbergKrylovSpectral
     std::vector<Matrix<C>> VList(krylovSize+1), activeVList(krylovSize+1);
     for( Int j=0; j<krylovSize+1; ++j )
         Zeros( VList[j], n, numShifts );
-    Gaussian( VList[0], n, numShifts );
+    VList[0] = X;
     std::vector<std::vector<Real>> 
         HDiagList(numShifts), HSubdiagList(numShifts);
     std::vector<Complex<Real>> components;
@@ -421,7 +461,7 @@ HessenbergKrylovSpectral
         if( progress )
             subtimer.Start();
         Restart
-        ( HDiagList, HSubdiagList, activeVList, activeConverged, activeEsts );
+        ( HDiagList, HSubdiagList, activeConverged, activeVList );
         if( progress )
             std::cout << "Krylov-spectral contraction: " << subtimer.Stop()
                       << " seconds" << std::endl;
@@ -456,26 +496,55 @@ HessenbergKrylovSpectral
         RuntimeError("Two-norm estimates did not converge in time");
 
     invNorms = estimates;
+    X = VList[0];
     if( deflate )
+    {
         RestoreOrdering( preimage, invNorms, itCounts );
+        RestoreOrdering( preimage, X );
+    }
 
     return itCounts;
 }
 
 template<typename Real>
+inline Matrix<Int>
+HessenbergKrylovSpectral
+( const Matrix<Complex<Real> >& H, const Matrix<Complex<Real> >& shifts, 
+  Matrix<Real>& invNorms, const Int krylovSize=10, bool reorthog=true,
+  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergKrylovSpectral"))
+    Matrix<Complex<Real> > X;
+    Gaussian( X, H.Height(), shifts.Height() );
+    return HessenbergKrylovSpectral
+    ( H, shifts, invNorms, X, krylovSize, reorthog, deflate, maxIts, tol,
+      progress );
+}
+
+// On entry, the columns of X should contain initial guesses for the
+// dominant right singular vectors of inv(U - shift I), and, on exit, they
+// will contain the final restarted iterates (in the original ordering of the
+// shifts)
+template<typename F>
 inline DistMatrix<Int,VR,STAR>
 TriangularKrylovSpectral
-( const DistMatrix<Complex<Real>        >& U, 
-  const DistMatrix<Complex<Real>,VR,STAR>& shifts, 
-        DistMatrix<Real,         VR,STAR>& invNorms, 
+( const DistMatrix<F>& U,
+  const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+        DistMatrix<BASE(F),VR,STAR>& invNorms,
+        DistMatrix<Complex<BASE(F)> >& X,
         Int krylovSize=10, bool reorthog=true,
-  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::TriangularKrylovSpectral"))
+    typedef Base<F> Real;
     using namespace pspec;
     typedef Complex<Real> C;
     const Int n = U.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( X.Height() != n || X.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
     const Grid& g = U.Grid();
     if( deflate && U.Grid().Rank() == 0 ) 
         std::cerr << "WARNING: Deflation swaps not yet optimized!" << std::endl;
@@ -506,7 +575,7 @@ TriangularKrylovSpectral
         VList[j].SetGrid( U.Grid() );
         Zeros( VList[j], n, numShifts );
     }
-    Gaussian( VList[0], n, numShifts );
+    VList[0] = X;
     const Int numMRShifts = VList[0].LocalWidth();
     std::vector<std::vector<Real>> HDiagList(numMRShifts), 
                                    HSubdiagList(numMRShifts);
@@ -564,10 +633,10 @@ TriangularKrylovSpectral
                 if( U.Grid().Rank() == 0 )
                     subtimer.Start();
             }
-            MultiShiftTrsm
-            ( LEFT, UPPER, NORMAL, C(1), U, activeShifts, activeVList[j+1] );
-            MultiShiftTrsm
-            ( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, activeVList[j+1] );
+            MultiShiftTriSolve
+            ( NORMAL, U, activeShifts, activeVList[j+1] );
+            MultiShiftTriSolve
+            ( ADJOINT, U, activeShifts, activeVList[j+1] );
             if( progress )
             {
                 mpi::Barrier( U.Grid().Comm() );
@@ -660,18 +729,45 @@ TriangularKrylovSpectral
         RuntimeError("Two-norm estimates did not converge in time");
 
     invNorms = estimates;
+    X = VList[0];
     if( deflate )
+    {
         RestoreOrdering( preimage, invNorms, itCounts );
+        RestoreOrdering( preimage, X );
+    }
 
     return itCounts;
 }
 
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+TriangularKrylovSpectral
+( const DistMatrix<F>& U,
+  const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+        DistMatrix<BASE(F),VR,STAR>& invNorms,
+        Int krylovSize=10, bool reorthog=true,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularKrylovSpectral"))
+    typedef Base<F> Real;
+    DistMatrix<Complex<Real> > X( U.Grid() );
+    Gaussian( X, U.Height(), shifts.Height() );
+    return TriangularKrylovSpectral
+    ( U, shifts, invNorms, X, krylovSize, reorthog, deflate, maxIts, tol,
+      progress );
+}
+
+// On entry, the columns of X should contain initial guesses for the
+// dominant right singular vectors of inv(H - shift I), and, on exit, they
+// will contain the final restarted iterates (in the original ordering of the
+// shifts)
 template<typename Real>
 inline DistMatrix<Int,VR,STAR>
 HessenbergKrylovSpectral
 ( const DistMatrix<Complex<Real>        >& H, 
   const DistMatrix<Complex<Real>,VR,STAR>& shifts, 
         DistMatrix<Real,         VR,STAR>& invNorms, 
+        DistMatrix<Complex<Real>        >& X,
         Int krylovSize=10, bool reorthog=true,
   bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
 {
@@ -680,6 +776,10 @@ HessenbergKrylovSpectral
     typedef Complex<Real> C;
     const Int n = H.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( X.Height() != n || X.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
     const Grid& g = H.Grid();
     if( deflate && H.Grid().Rank() == 0 ) 
         std::cerr << "WARNING: Deflation swaps not yet optimized!" << std::endl;
@@ -716,7 +816,7 @@ HessenbergKrylovSpectral
         VList[j].SetGrid( H.Grid() );
         Zeros( VList[j], n, numShifts );
     }
-    Gaussian( VList[0], n, numShifts );
+    VList[0] = X;
     const Int numMRShifts = VList[0].LocalWidth();
     std::vector<std::vector<Real>> HDiagList(numMRShifts), 
                                    HSubdiagList(numMRShifts);
@@ -876,12 +976,33 @@ HessenbergKrylovSpectral
         RuntimeError("Two-norm estimates did not converge in time");
 
     invNorms = estimates;
+    X = VList[0];
     if( deflate )
+    {
         RestoreOrdering( preimage, invNorms, itCounts );
+        RestoreOrdering( preimage, X );
+    }
 
     return itCounts;
 }
 
+template<typename Real>
+inline DistMatrix<Int,VR,STAR>
+HessenbergKrylovSpectral
+( const DistMatrix<Complex<Real>        >& H, 
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts, 
+        DistMatrix<Real,         VR,STAR>& invNorms, 
+        Int krylovSize=10, bool reorthog=true,
+  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergKrylovSpectral"))
+    DistMatrix<Complex<Real> > X( H.Grid() );
+    Gaussian( X, H.Height(), shifts.Height() );
+    return HessenbergKrylovSpectral
+    ( H, shifts, invNorms, X, krylovSize, reorthog, deflate, maxIts, tol,
+      progress );
+}
+
 } // namespace pspec
 } // namespace elem
 
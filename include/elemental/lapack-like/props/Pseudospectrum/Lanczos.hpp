@@ -545,18 +545,25 @@ Deflate
     }
 }
 
-template<typename Real>
+// The columns of XInit should contain the initial Lanczos vectors, e.g.,
+// guesses for the dominant right singular vectors of inv(U - shift I)
+template<typename F>
 inline Matrix<Int>
 TriangularLanczos
-( const Matrix<Complex<Real> >& U, const Matrix<Complex<Real> >& shifts, 
-  Matrix<Real>& invNorms, 
-  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+( const Matrix<F>& U, const Matrix<Complex<BASE(F)> >& shifts,
+  Matrix<BASE(F)>& invNorms, const Matrix<Complex<BASE(F)> >& XInit,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::TriangularLanczos"))
+    typedef Base<F> Real;
     using namespace pspec;
     typedef Complex<Real> C;
     const Int n = U.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( XInit.Height() != n || XInit.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
 
     // Keep track of the number of iterations per shift
     Matrix<Int> itCounts;
@@ -575,7 +582,7 @@ TriangularLanczos
     // Simultaneously run Lanczos for various shifts
     Matrix<C> XOld, X, XNew;
     Zeros( XOld, n, numShifts );
-    Gaussian( X, n, numShifts );
+    X = XInit;
     FixColumns( X );
     Zeros( XNew, n, numShifts );
     std::vector<std::vector<Real>> HDiagList( numShifts ),
@@ -609,10 +616,8 @@ TriangularLanczos
         activeXNew = activeX;
         if( progress )
             subtimer.Start();
-        MultiShiftTrsm
-        ( LEFT, UPPER, NORMAL, C(1), U, activeShifts, activeXNew );
-        MultiShiftTrsm
-        ( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, activeXNew );
+        MultiShiftTriSolve( NORMAL, U, activeShifts, activeXNew );
+        MultiShiftTriSolve( ADJOINT, U, activeShifts, activeXNew );
         if( progress )
         {
             const double msTime = subtimer.Stop();
@@ -672,11 +677,28 @@ TriangularLanczos
     return itCounts;
 }
 
+template<typename F>
+inline Matrix<Int>
+TriangularLanczos
+( const Matrix<F>& U, const Matrix<Complex<BASE(F)> >& shifts,
+  Matrix<BASE(F)>& invNorms,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularLanczos"))
+    typedef Base<F> Real;
+    Matrix<Complex<Real> > XInit;
+    Gaussian( XInit, U.Height(), shifts.Height() );
+    return TriangularLanczos
+    ( U, shifts, invNorms, XInit, deflate, maxIts, tol, progress );
+}
+
+// The columns of XInit should contain the initial Lanczos vectors, e.g.,
+// guesses for the dominant right singular vectors of inv(H - shift I)
 template<typename Real>
 inline Matrix<Int>
 HessenbergLanczos
 ( const Matrix<Complex<Real> >& H, const Matrix<Complex<Real> >& shifts, 
-  Matrix<Real>& invNorms, 
+  Matrix<Real>& invNorms, const Matrix<Complex<Real> >& XInit,
   bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergLanczos"))
@@ -684,6 +706,10 @@ HessenbergLanczos
     typedef Complex<Real> C;
     const Int n = H.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( XInit.Height() != n || XInit.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
 
     // Keep track of the number of iterations per shift
     Matrix<Int> itCounts;
@@ -706,7 +732,7 @@ HessenbergLanczos
     // Simultaneously run Lanczos for various shifts
     Matrix<C> XOld, X, XNew;
     Zeros( XOld, n, numShifts );
-    Gaussian( X, n, numShifts );
+    X = XInit;
     FixColumns( X );
     Zeros( XNew, n, numShifts );
     std::vector<std::vector<Real>> HDiagList( numShifts ),
@@ -805,18 +831,40 @@ HessenbergLanczos
 }
 
 template<typename Real>
+inline Matrix<Int>
+HessenbergLanczos
+( const Matrix<Complex<Real> >& H, const Matrix<Complex<Real> >& shifts, 
+  Matrix<Real>& invNorms, 
+  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergLanczos"))
+    Matrix<Complex<Real> > XInit;
+    Gaussian( XInit, H.Height(), shifts.Height() );
+    return HessenbergLanczos
+    ( H, shifts, invNorms, XInit, deflate, maxIts, tol, progress );
+}
+
+// The columns of XInit should contain the initial Lanczos vectors, e.g.,
+// guesses for the dominant right singular vectors of inv(U - shift I)
+template<typename F>
 inline DistMatrix<Int,VR,STAR>
 TriangularLanczos
-( const DistMatrix<Complex<Real>        >& U, 
-  const DistMatrix<Complex<Real>,VR,STAR>& shifts, 
-        DistMatrix<Real,         VR,STAR>& invNorms, 
-  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+( const DistMatrix<F>& U,
+  const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+        DistMatrix<BASE(F),VR,STAR>& invNorms,
+  const DistMatrix<Complex<BASE(F)> >& XInit,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::TriangularLanczos"))
+    typedef Base<F> Real;
     using namespace pspec;
     typedef Complex<Real> C;
     const Int n = U.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( XInit.Height() != n || XInit.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
     const Grid& g = U.Grid();
     if( deflate && U.Grid().Rank() == 0 ) 
         std::cerr << "WARNING: Deflation swaps not yet optimized!" << std::endl;
@@ -843,7 +891,7 @@ TriangularLanczos
     // Simultaneously run Lanczos for various shifts
     DistMatrix<C> XOld(g), X(g), XNew(g);
     Zeros( XOld, n, numShifts );
-    Gaussian( X, n, numShifts );
+    X = XInit;
     FixColumns( X );
     Zeros( XNew, n, numShifts );
     std::vector<std::vector<Real>> HDiagList( X.LocalWidth() ),
@@ -886,10 +934,8 @@ TriangularLanczos
             if( U.Grid().Rank() == 0 )
                 subtimer.Start();
         }
-        MultiShiftTrsm
-        ( LEFT, UPPER, NORMAL, C(1), U, activeShifts, activeXNew );
-        MultiShiftTrsm
-        ( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, activeXNew );
+        MultiShiftTriSolve( NORMAL, U, activeShifts, activeXNew );
+        MultiShiftTriSolve( ADJOINT, U, activeShifts, activeXNew );
         if( progress )
         {
             mpi::Barrier( U.Grid().Comm() );
@@ -965,12 +1011,31 @@ TriangularLanczos
     return itCounts;
 }
 
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+TriangularLanczos
+( const DistMatrix<F>& U,
+  const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+        DistMatrix<BASE(F),VR,STAR>& invNorms,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularLanczos"))
+    typedef Base<F> Real;
+    DistMatrix<Complex<Real> > XInit( U.Grid() );
+    Gaussian( XInit, U.Height(), shifts.Height() );
+    return TriangularLanczos
+    ( U, shifts, invNorms, XInit, deflate, maxIts, tol, progress );
+}
+
+// The columns of XInit should contain the initial Lanczos vectors, e.g.,
+// guesses for the dominant right singular vectors of inv(H - shift I)
 template<typename Real>
 inline DistMatrix<Int,VR,STAR>
 HessenbergLanczos
 ( const DistMatrix<Complex<Real>        >& H, 
   const DistMatrix<Complex<Real>,VR,STAR>& shifts, 
         DistMatrix<Real,         VR,STAR>& invNorms, 
+  const DistMatrix<Complex<Real>        >& XInit,
   bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergLanczos"))
@@ -978,6 +1043,10 @@ HessenbergLanczos
     typedef Complex<Real> C;
     const Int n = H.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( XInit.Height() != n || XInit.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
     const Grid& g = H.Grid();
     if( deflate && H.Grid().Rank() == 0 ) 
         std::cerr << "WARNING: Deflation swaps not yet optimized!" << std::endl;
@@ -1010,7 +1079,7 @@ HessenbergLanczos
     // Simultaneously run Lanczos for various shifts
     DistMatrix<C> XOld(g), X(g), XNew(g);
     Zeros( XOld, n, numShifts );
-    Gaussian( X, n, numShifts );
+    X = XInit;
     FixColumns( X );
     Zeros( XNew, n, numShifts );
     std::vector<std::vector<Real>> HDiagList( X.LocalWidth() ),
@@ -1138,6 +1207,21 @@ HessenbergLanczos
     return itCounts;
 }
 
+template<typename Real>
+inline DistMatrix<Int,VR,STAR>
+HessenbergLanczos
+( const DistMatrix<Complex<Real>        >& H, 
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts, 
+        DistMatrix<Real,         VR,STAR>& invNorms, 
+  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergLanczos"))
+    DistMatrix<Complex<Real> > XInit( H.Grid() );
+    Gaussian( XInit, H.Height(), shifts.Height() );
+    return HessenbergLanczos
+    ( H, shifts, invNorms, XInit, deflate, maxIts, tol, progress );
+}
+
 } // namespace pspec
 } // namespace elem
 
@@ -11,6 +11,7 @@
 #define ELEM_PSEUDOSPECTRUM_POWER_HPP
 
 #include ELEM_MULTISHIFTTRSM_INC
+#include ELEM_MULTISHIFTQUASITRSM_INC
 #include ELEM_MULTISHIFTHESSSOLVE_INC
 #include ELEM_ZERONORM_INC
 #include ELEM_ONES_INC
@@ -22,6 +23,98 @@ template<typename F>
 inline Base<F> NormCap()
 { return Base<F>(1)/lapack::MachineEpsilon<Base<F>>(); }
 
+// Complex matrices are viewed, while real matrices are copied into complex
+// matrices, so that drivers may pass either to the complex-only solvers
+
+template<typename Real>
+inline void
+ComplexView( const Matrix<Complex<Real> >& A, Matrix<Complex<Real> >& ACpx )
+{ ACpx = LockedView( A ); }
+
+template<typename Real>
+inline void
+ComplexView( const Matrix<Real>& A, Matrix<Complex<Real> >& ACpx )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::ComplexView"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    ACpx.Resize( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            ACpx.Set( i, j, A.Get(i,j) );
+}
+
+template<typename Real>
+inline void
+ComplexView
+( const DistMatrix<Complex<Real> >& A, DistMatrix<Complex<Real> >& ACpx )
+{ ACpx = LockedView( A ); }
+
+template<typename Real>
+inline void
+ComplexView( const DistMatrix<Real>& A, DistMatrix<Complex<Real> >& ACpx )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::ComplexView"))
+    ACpx.SetGrid( A.Grid() );
+    ACpx.AlignWith( A );
+    ACpx.Resize( A.Height(), A.Width() );
+    const Int mLocal = A.LocalHeight();
+    const Int nLocal = A.LocalWidth();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            ACpx.SetLocal( iLoc, jLoc, A.GetLocal(iLoc,jLoc) );
+}
+
+// Apply inv(op(U - shift I)) to each column of X, where U is either complex
+// upper triangular or a real upper quasi-triangular Schur factor; the latter
+// avoids promoting U to complex and halves the cost of its updates
+
+template<typename Real>
+inline void
+MultiShiftTriSolve
+( Orientation orientation, const Matrix<Complex<Real> >& U,
+  const Matrix<Complex<Real> >& shifts, Matrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::MultiShiftTriSolve"))
+    MultiShiftTrsm
+    ( LEFT, UPPER, orientation, Complex<Real>(1), U, shifts, X );
+}
+
+template<typename Real>
+inline void
+MultiShiftTriSolve
+( Orientation orientation, const Matrix<Real>& U,
+  const Matrix<Complex<Real> >& shifts, Matrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::MultiShiftTriSolve"))
+    MultiShiftQuasiTrsm
+    ( LEFT, UPPER, orientation, Complex<Real>(1), U, shifts, X );
+}
+
+template<typename Real>
+inline void
+MultiShiftTriSolve
+( Orientation orientation, const DistMatrix<Complex<Real> >& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+  DistMatrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::MultiShiftTriSolve"))
+    MultiShiftTrsm
+    ( LEFT, UPPER, orientation, Complex<Real>(1), U, shifts, X );
+}
+
+template<typename Real>
+inline void
+MultiShiftTriSolve
+( Orientation orientation, const DistMatrix<Real>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+  DistMatrix<Complex<Real> >& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::MultiShiftTriSolve"))
+    MultiShiftQuasiTrsm
+    ( LEFT, UPPER, orientation, Complex<Real>(1), U, shifts, X );
+}
+
 template<typename F>
 inline void
 ColumnNorms( const Matrix<F>& X, Matrix<BASE(F)>& norms )
@@ -339,18 +432,66 @@ RestoreOrdering
     }
 }
 
-template<typename Real>
+template<typename F>
+inline void
+RestoreOrdering( const Matrix<Int>& preimage, Matrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::RestoreOrdering"))
+    auto XCopy = X;
+    const Int numShifts = preimage.Height();
+    for( Int j=0; j<numShifts; ++j )
+    {
+        const Int dest = preimage.Get(j,0);
+        MemCopy( X.Buffer(0,dest), XCopy.LockedBuffer(0,j), X.Height() );
+    }
+}
+
+template<typename F>
+inline void
+RestoreOrdering( const DistMatrix<Int,VR,STAR>& preimage, DistMatrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::RestoreOrdering"))
+    DistMatrix<Int,STAR,STAR> preimageCopy( preimage );
+    DistMatrix<F,MC,STAR> X_MC_STAR( X.Grid() );
+    X_MC_STAR.AlignWith( X );
+    X_MC_STAR = X;
+
+    // Invert the permutation so that each process can fill its local columns
+    const Int numShifts = preimage.Height();
+    std::vector<Int> image( numShifts );
+    for( Int j=0; j<numShifts; ++j )
+        image[preimageCopy.GetLocal(j,0)] = j;
+
+    const Int mLocal = X.LocalHeight();
+    const Int nLocal = X.LocalWidth();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Int dest = X.RowShift() + jLoc*X.RowStride();
+        MemCopy
+        ( X.Buffer(0,jLoc), X_MC_STAR.LockedBuffer(0,image[dest]), mLocal );
+    }
+}
+
+// On entry, the columns of X should contain initial guesses for the
+// dominant right singular vectors of inv(U - shift I), and, on exit, they
+// will contain the final iterates (in the original ordering of the shifts)
+template<typename F>
 inline Matrix<Int>
 TriangularPower
-( const Matrix<Complex<Real> >& U, const Matrix<Complex<Real> >& shifts, 
-  Matrix<Real>& invNorms, 
-  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+( const Matrix<F>& U, const Matrix<Complex<BASE(F)> >& shifts,
+  Matrix<BASE(F)>& invNorms, Matrix<Complex<BASE(F)> >& X,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::TriangularPower"))
+    typedef Base<F> Real;
     using namespace pspec;
     typedef Complex<Real> C;
     const Int n = U.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( X.Height() != n || X.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
 
     // Keep track of the number of iterations per shift
     Matrix<Int> itCounts;
@@ -368,8 +509,6 @@ TriangularPower
 
     // Simultaneously run inverse iteration for various shifts
     Timer timer;
-    Matrix<C> X;
-    Gaussian( X, n, numShifts );
     FixColumns( X );
     Int numIts=0, numDone=0;
     Matrix<Real> estimates(numShifts,1);
@@ -388,9 +527,9 @@ TriangularPower
 
         if( progress )
             timer.Start(); 
-        MultiShiftTrsm( LEFT, UPPER, NORMAL, C(1), U, activeShifts, activeX );
+        MultiShiftTriSolve( NORMAL, U, activeShifts, activeX );
         FixColumns( activeX );
-        MultiShiftTrsm( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, activeX );
+        MultiShiftTriSolve( ADJOINT, U, activeShifts, activeX );
         ColumnNorms( activeX, activeEsts );
         CapEstimates( activeEsts );
 
@@ -427,16 +566,34 @@ TriangularPower
 
     invNorms = estimates;
     if( deflate )
+    {
         RestoreOrdering( preimage, invNorms, itCounts );
+        RestoreOrdering( preimage, X );
+    }
 
     return itCounts;
 }
 
+template<typename F>
+inline Matrix<Int>
+TriangularPower
+( const Matrix<F>& U, const Matrix<Complex<BASE(F)> >& shifts,
+  Matrix<BASE(F)>& invNorms,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularPower"))
+    typedef Base<F> Real;
+    Matrix<Complex<Real> > X;
+    Gaussian( X, U.Height(), shifts.Height() );
+    return TriangularPower
+    ( U, shifts, invNorms, X, deflate, maxIts, tol, progress );
+}
+
 template<typename Real>
 inline Matrix<Int>
 HessenbergPower
 ( const Matrix<Complex<Real> >& H, const Matrix<Complex<Real> >& shifts, 
-  Matrix<Real>& invNorms, 
+  Matrix<Real>& invNorms, Matrix<Complex<Real> >& X,
   bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergPower"))
@@ -444,6 +601,10 @@ HessenbergPower
     typedef Complex<Real> C;
     const Int n = H.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( X.Height() != n || X.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
 
     // Keep track of the number of iterations per shift
     Matrix<Int> itCounts;
@@ -466,8 +627,6 @@ HessenbergPower
 
     // Simultaneously run inverse iteration for various shifts
     Timer timer;
-    Matrix<C> X;
-    Gaussian( X, n, numShifts );
     FixColumns( X );
     Int numIts=0, numDone=0;
     Matrix<Real> estimates(numShifts,1);
@@ -528,24 +687,47 @@ HessenbergPower
 
     invNorms = estimates;
     if( deflate )
+    {
         RestoreOrdering( preimage, invNorms, itCounts );
+        RestoreOrdering( preimage, X );
+    }
 
     return itCounts;
 }
 
 template<typename Real>
+inline Matrix<Int>
+HessenbergPower
+( const Matrix<Complex<Real> >& H, const Matrix<Complex<Real> >& shifts,
+  Matrix<Real>& invNorms,
+  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergPower"))
+    Matrix<Complex<Real> > X;
+    Gaussian( X, H.Height(), shifts.Height() );
+    return HessenbergPower
+    ( H, shifts, invNorms, X, deflate, maxIts, tol, progress );
+}
+
+template<typename F>
 inline DistMatrix<Int,VR,STAR>
 TriangularPower
-( const DistMatrix<Complex<Real>        >& U, 
-  const DistMatrix<Complex<Real>,VR,STAR>& shifts, 
-        DistMatrix<Real,         VR,STAR>& invNorms, 
-  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+( const DistMatrix<F>& U,
+  const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+        DistMatrix<BASE(F),VR,STAR>& invNorms,
+        DistMatrix<Complex<BASE(F)> >& X,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::TriangularPower"))
+    typedef Base<F> Real;
     using namespace pspec;
     typedef Complex<Real> C;
     const Int n = U.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( X.Height() != n || X.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
     const Grid& g = U.Grid();
 
     // Keep track of the number of iterations per shift
@@ -569,8 +751,6 @@ TriangularPower
 
     // Simultaneously run inverse iteration for various shifts
     Timer timer;
-    DistMatrix<C> X(g);
-    Gaussian( X, n, numShifts );
     FixColumns( X );
     Int numIts=0, numDone=0;
     DistMatrix<Real,MR,STAR> estimates(g);
@@ -590,9 +770,9 @@ TriangularPower
 
         if( progress && U.Grid().Rank() == 0 )
             timer.Start();
-        MultiShiftTrsm( LEFT, UPPER, NORMAL, C(1), U, activeShifts, activeX );
+        MultiShiftTriSolve( NORMAL, U, activeShifts, activeX );
         FixColumns( activeX );
-        MultiShiftTrsm( LEFT, UPPER, ADJOINT, C(1), U, activeShifts, activeX );
+        MultiShiftTriSolve( ADJOINT, U, activeShifts, activeX );
         ColumnNorms( activeX, activeEsts );
         CapEstimates( activeEsts );
 
@@ -629,17 +809,37 @@ TriangularPower
 
     invNorms = estimates;
     if( deflate )
+    {
         RestoreOrdering( preimage, invNorms, itCounts );
+        RestoreOrdering( preimage, X );
+    }
 
     return itCounts;
 }
 
+template<typename F>
+inline DistMatrix<Int,VR,STAR>
+TriangularPower
+( const DistMatrix<F>& U,
+  const DistMatrix<Complex<BASE(F)>,VR,STAR>& shifts,
+        DistMatrix<BASE(F),VR,STAR>& invNorms,
+  bool deflate=true, Int maxIts=1000, BASE(F) tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularPower"))
+    typedef Base<F> Real;
+    DistMatrix<Complex<Real> > X( U.Grid() );
+    Gaussian( X, U.Height(), shifts.Height() );
+    return TriangularPower
+    ( U, shifts, invNorms, X, deflate, maxIts, tol, progress );
+}
+
 template<typename Real>
 inline DistMatrix<Int,VR,STAR>
 HessenbergPower
 ( const DistMatrix<Complex<Real>        >& H, 
   const DistMatrix<Complex<Real>,VR,STAR>& shifts, 
-        DistMatrix<Real,         VR,STAR>& invNorms, 
+        DistMatrix<Real,         VR,STAR>& invNorms,
+        DistMatrix<Complex<Real>        >& X,
   bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergPower"))
@@ -647,6 +847,10 @@ HessenbergPower
     typedef Complex<Real> C;
     const Int n = H.Height();
     const Int numShifts = shifts.Height();
+    DEBUG_ONLY(
+        if( X.Height() != n || X.Width() != numShifts )
+            LogicError("Initial vectors were of the wrong size");
+    )
     const Grid& g = H.Grid();
 
     // Keep track of the number of iterations per shift
@@ -679,8 +883,6 @@ HessenbergPower
 
     // Simultaneously run inverse iteration for various shifts
     Timer timer;
-    DistMatrix<C> X(g);
-    Gaussian( X, n, numShifts );
     FixColumns( X );
     Int numIts=0, numDone=0;
     DistMatrix<Real,MR,STAR> estimates(g);
@@ -747,11 +949,29 @@ HessenbergPower
 
     invNorms = estimates;
     if( deflate )
+    {
         RestoreOrdering( preimage, invNorms, itCounts );
+        RestoreOrdering( preimage, X );
+    }
 
     return itCounts;
 }
 
+template<typename Real>
+inline DistMatrix<Int,VR,STAR>
+HessenbergPower
+( const DistMatrix<Complex<Real>        >& H,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+        DistMatrix<Real,         VR,STAR>& invNorms,
+  bool deflate=true, Int maxIts=1000, Real tol=1e-6, bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergPower"))
+    DistMatrix<Complex<Real> > X( H.Grid() );
+    Gaussian( X, H.Height(), shifts.Height() );
+    return HessenbergPower
+    ( H, shifts, invNorms, X, deflate, maxIts, tol, progress );
+}
+
 } // namespace pspec
 } // namespace elem
 
@@ -19,185 +19,419 @@
 namespace elem {
 namespace mshs {
 
+// The shifts are processed in blocks whose right-hand sides, working vectors,
+// and Givens rotations are stored transposed, so that the updates performed
+// for each column of H are vectorizable loops over the shifts of a block.
+// Furthermore, the updates of the rows below (or above) a group of
+// SweepDepth() consecutive iterations are deferred and then applied in a
+// single pass, so that each row of XT and WT is reused from cache rather than
+// being streamed from memory once per iteration.
+
 template<typename F>
-inline void
-LN( F alpha, const Matrix<F>& H, const Matrix<F>& shifts, Matrix<F>& X ) 
+struct ShiftBlock
 {
-    DEBUG_ONLY(CallStackEntry cse("mshs::LN"))
-    Scale( alpha, X );
+    Matrix<F> shifts, XT, WT, S;
+    Matrix<Base<F>> C;
+};
 
+inline Int ShiftBlocksize() { return 32; }
+inline Int SweepDepth() { return 16; }
+
+template<typename F>
+inline void
+LoadBlock
+( const Matrix<F>& shifts, const Matrix<F>& X, Int s0, Int sb, 
+  ShiftBlock<F>& block )
+{
+    DEBUG_ONLY(CallStackEntry cse("mshs::LoadBlock"))
     const Int m = X.Height();
-    const Int n = X.Width();
-    if( m == 0 )
-        return;
+    // Force the leading dimensions to be sb so that the sweeps may share them
+    block.shifts.Resize( sb, 1 );
+    block.XT.Resize( sb, m, sb );
+    block.WT.Resize( sb, m, sb );
+    block.C.Resize( sb, m, sb );
+    block.S.Resize( sb, m, sb );
+    F* XTBuf = block.XT.Buffer();
+    for( Int j=0; j<sb; ++j )
+    {
+        block.shifts.Set( j, 0, shifts.Get(s0+j,0) );
+        const F* x = X.LockedBuffer(0,s0+j);
+        for( Int i=0; i<m; ++i )
+            XTBuf[j+i*sb] = x[i];
+    }
+}
 
-    // Initialize storage for Givens rotations
-    typedef Base<F> Real;
-    Matrix<Real> C(m,n);
-    Matrix<F> S(m,n);
+template<typename F>
+inline void
+StoreBlock( const ShiftBlock<F>& block, Int s0, Matrix<F>& X )
+{
+    DEBUG_ONLY(CallStackEntry cse("mshs::StoreBlock"))
+    const Int m = X.Height();
+    const Int sb = block.XT.Height();
+    const F* XTBuf = block.XT.LockedBuffer();
+    for( Int j=0; j<sb; ++j )
+    {
+        F* x = X.Buffer(0,s0+j);
+        for( Int i=0; i<m; ++i )
+            x[i] = XTBuf[j+i*sb];
+    }
+}
 
-    // Initialize the workspace for shifted columns of H
-    Matrix<F> W(m,n);
-    for( Int j=0; j<n; ++j )
+// Initialize the working vectors with the shifted first column of H
+template<typename F>
+inline void
+LInitialize( const F* h0, ShiftBlock<F>& block )
+{
+    DEBUG_ONLY(CallStackEntry cse("mshs::LInitialize"))
+    const Int sb = block.WT.Height();
+    const Int m = block.WT.Width();
+    for( Int i=0; i<m; ++i )
     {
-        MemCopy( W.Buffer(0,j), H.LockedBuffer(), m );
-        W.Update( 0, j, -shifts.Get(j,0) );
+        F* w = block.WT.Buffer(0,i);
+        for( Int j=0; j<sb; ++j )
+            w[j] = h0[i];
     }
-     
-    // Simultaneously find the LQ factorization and solve against L
-    for( Int k=0; k<m-1; ++k )
+    F* w0 = block.WT.Buffer();
+    const F* mu = block.shifts.LockedBuffer();
+    for( Int j=0; j<sb; ++j )
+        w0[j] -= mu[j];
+}
+
+// Run iterations [kBeg,kEnd) of the simultaneous LQ factorization and solve
+// against L, where H(i,j) is stored in hBuf[(i-rowOff)+(j-colOff)*ldim]
+template<typename F>
+inline void
+LSweep
+( Int kBeg, Int kEnd, const F* hBuf, Int ldim, Int rowOff, Int colOff,
+  ShiftBlock<F>& block )
+{
+    DEBUG_ONLY(CallStackEntry cse("mshs::LSweep"))
+    typedef Base<F> Real;
+    const Int sb = block.XT.Height();
+    const Int m = block.XT.Width();
+    const F* mu = block.shifts.LockedBuffer();
+    const Int depth = SweepDepth();
+    Matrix<F> XC( sb, depth ), XS( sb, depth );
+    F* XTBuf = block.XT.Buffer();
+    F* WTBuf = block.WT.Buffer();
+    Real* CBuf = block.C.Buffer();
+    F* SBuf = block.S.Buffer();
+    F* XCBuf = XC.Buffer();
+    F* XSBuf = XS.Buffer();
+    for( Int k0=kBeg; k0<kEnd; k0+=depth )
     {
-        auto hB = LockedViewRange( H, k+2, k+1, m, k+2 );
-        const F etakkp1 = H.Get(k,k+1);
-        const F etakp1kp1 = H.Get(k+1,k+1);
-        for( Int j=0; j<n; ++j )
+        const Int k1 = Min(k0+depth,kEnd);
+        for( Int k=k0; k<k1; ++k )
+        {
+            // hCol[t] = H(k+t,k+1)
+            const F* hCol = &hBuf[(k-rowOff)+(k+1-colOff)*ldim];
+            const F etakkp1 = hCol[0];
+            const F etakp1kp1 = hCol[1];
+            F* xk = &XTBuf[k*sb];
+            F* wk = &WTBuf[k*sb];
+            F* xkp1 = &XTBuf[(k+1)*sb];
+            F* wkp1 = &WTBuf[(k+1)*sb];
+            Real* c = &CBuf[k*sb];
+            F* s = &SBuf[k*sb];
+            F* xc = &XCBuf[(k-k0)*sb];
+            F* xs = &XSBuf[(k-k0)*sb];
+            for( Int j=0; j<sb; ++j )
+            {
+                // Find the Givens rotation needed to zero H(k,k+1),
+                //   | c        s | | H(k,k)   | = | gamma |
+                //   | -conj(s) c | | H(k,k+1) |   | 0     |
+                lapack::Givens( wk[j], etakkp1, &c[j], &s[j] );
+
+                // Divide our current entry of x by the new diagonal of L
+                const F lambdakk = c[j]*wk[j] + s[j]*etakkp1;
+                xk[j] /= lambdakk;
+
+                // x(k+1:end) -= x(k) * L(k+1:end,k), where
+                // L(k+1:end,k) = c H(k+1:end,k) + s H(k+1:end,k+1). We 
+                // express this more concisely as xB -= x(k) * ( c wB + s hB ).
+                // Note that we carefully handle updating the k+1'th entry 
+                // since it is shift-dependent.
+                xc[j] = xk[j]*c[j];
+                xs[j] = xk[j]*s[j];
+                xkp1[j] -= xc[j]*wkp1[j] + xs[j]*(etakp1kp1-mu[j]);
+
+                // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1)
+                wkp1[j] = -Conj(s[j])*wkp1[j] + c[j]*(etakp1kp1-mu[j]);
+            }
+
+            // Only update the rows needed by the remaining iterations of 
+            // this group
+            for( Int i=k+2; i<=Min(k1,m-1); ++i )
+            {
+                const F eta = hCol[i-k];
+                F* xi = &XTBuf[i*sb];
+                F* wi = &WTBuf[i*sb];
+                for( Int j=0; j<sb; ++j )
+                {
+                    xi[j] -= FastMul(xc[j],wi[j]) + FastMul(xs[j],eta);
+                    wi[j] = c[j]*eta - FastMul(Conj(s[j]),wi[j]);
+                }
+            }
+        }
+
+        // Apply the deferred updates from this group of iterations
+        for( Int i=k1+1; i<m; ++i )
         {
-            // Find the Givens rotation needed to zero H(k,k+1),
-            //   | c        s | | H(k,k)   | = | gamma |
-            //   | -conj(s) c | | H(k,k+1) |   | 0     |
-            Real c; F s;
-            lapack::Givens( W.Get(k,j), etakkp1, &c, &s );
-            C.Set( k, j, c );
-            S.Set( k, j, s );
-
-            // The new diagonal value of L
-            const F lambdakk = c*W.Get(k,j) + s*etakkp1;
-
-            // Divide our current entry of x by the diagonal value of L
-            X.Set( k, j, X.Get(k,j)/lambdakk );
-
-            // x(k+1:end) -= x(k) * L(k+1:end,k), where
-            // L(k+1:end,k) = c H(k+1:end,k) + s H(k+1:end,k+1). We express this
-            // more concisely as xB -= x(k) * ( c wB + s hB ).
-            // Note that we carefully handle updating the k+1'th entry since
-            // it is shift-dependent.
-            const F mu = shifts.Get( j, 0 );
-            const F xc = X.Get(k,j)*c;
-            const F xs  = X.Get(k,j)*s;
-            X.Update( k+1, j, -xc*W.Get(k+1,j)-xs*(etakp1kp1-mu) );
-            blas::Axpy
-            ( m-(k+2), -xc, W.LockedBuffer(k+2,j), 1, X.Buffer(k+2,j), 1 );
-            blas::Axpy
-            ( m-(k+2), -xs, hB.LockedBuffer(),     1, X.Buffer(k+2,j), 1 );
-
-            // Change the working vector, wB, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last 
-            // to a fully-updated portion of the k+1'th column of this iteration
-            //
-            // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1)
-            W.Set( k+1, j, -Conj(s)*W.Get(k+1,j)+c*(etakp1kp1-mu) );
-            blas::Scal( m-(k+2), -Conj(s), W.Buffer(k+2,j), 1 );
-            blas::Axpy( m-(k+2), c, hB.LockedBuffer(), 1, W.Buffer(k+2,j), 1 );
+            F* xi = &XTBuf[i*sb];
+            F* wi = &WTBuf[i*sb];
+            for( Int k=k0; k<k1; ++k )
+            {
+                const F eta = hBuf[(i-rowOff)+(k+1-colOff)*ldim];
+                const Real* c = &CBuf[k*sb];
+                const F* s = &SBuf[k*sb];
+                const F* xc = &XCBuf[(k-k0)*sb];
+                const F* xs = &XSBuf[(k-k0)*sb];
+                for( Int j=0; j<sb; ++j )
+                {
+                    xi[j] -= FastMul(xc[j],wi[j]) + FastMul(xs[j],eta);
+                    wi[j] = c[j]*eta - FastMul(Conj(s[j]),wi[j]);
+                }
+            }
         }
     }
+}
+
+template<typename F>
+inline void
+LFinish( ShiftBlock<F>& block )
+{
+    DEBUG_ONLY(CallStackEntry cse("mshs::LFinish"))
+    typedef Base<F> Real;
+    const Int sb = block.XT.Height();
+    const Int m = block.XT.Width();
+
     // Divide x(end) by L(end,end)
-    for( Int j=0; j<n; ++j )
-        X.Set( m-1, j, X.Get(m-1,j)/W.Get(m-1,j) );
+    F* xLast = block.XT.Buffer(0,m-1);
+    const F* wLast = block.WT.LockedBuffer(0,m-1);
+    for( Int j=0; j<sb; ++j )
+        xLast[j] /= wLast[j];
 
     // Solve against Q
-    for( Int j=0; j<n; ++j )        
+    std::vector<F> tau0( xLast, xLast+sb );
+    for( Int k=m-2; k>=0; --k )
     {
-        F* x = X.Buffer(0,j);
-        const Real* c = C.LockedBuffer(0,j);
-        const F*    s = S.LockedBuffer(0,j);
-        F tau0 = x[m-1];
-        for( Int k=m-2; k>=0; --k )
+        const Real* c = block.C.LockedBuffer(0,k);
+        const F* s = block.S.LockedBuffer(0,k);
+        F* xk = block.XT.Buffer(0,k);
+        F* xkp1 = block.XT.Buffer(0,k+1);
+        for( Int j=0; j<sb; ++j )
         {
-            F tau1 = x[k];
-            x[k+1] =       c[k] *tau0 + s[k]*tau1;
-            tau0   = -Conj(s[k])*tau0 + c[k]*tau1;
+            const F tau1 = xk[j];
+            xkp1[j] =        c[j] *tau0[j] + s[j]*tau1;
+            tau0[j] = -Conj(s[j])*tau0[j] + c[j]*tau1;
         }
-        x[0] = tau0;
     }
+    F* x0 = block.XT.Buffer();
+    for( Int j=0; j<sb; ++j )
+        x0[j] = tau0[j];
 }
 
+// Initialize the working vectors with the shifted last column of H
 template<typename F>
 inline void
-UN( F alpha, const Matrix<F>& H, const Matrix<F>& shifts, Matrix<F>& X ) 
+UInitialize( const F* hLast, ShiftBlock<F>& block )
 {
-    DEBUG_ONLY(CallStackEntry cse("mshs::UN"))
-    Scale( alpha, X );
-
-    const Int m = X.Height();
-    const Int n = X.Width();
-    if( m == 0 )
-        return;
-
-    // Initialize storage for Givens rotations
-    typedef Base<F> Real;
-    Matrix<Real> C(m,n);
-    Matrix<F> S(m,n);
-
-    // Initialize the workspace for shifted columns of H
-    Matrix<F> W(m,n);
-    for( Int j=0; j<n; ++j )
+    DEBUG_ONLY(CallStackEntry cse("mshs::UInitialize"))
+    const Int sb = block.WT.Height();
+    const Int m = block.WT.Width();
+    for( Int i=0; i<m; ++i )
     {
-        MemCopy( W.Buffer(0,j), H.LockedBuffer(0,m-1), m );
-        W.Update( m-1, j, -shifts.Get(j,0) );
+        F* w = block.WT.Buffer(0,i);
+        for( Int j=0; j<sb; ++j )
+            w[j] = hLast[i];
     }
-     
-    // Simultaneously form the RQ factorization and solve against R
-    for( Int k=m-1; k>0; --k )
+    F* wLast = block.WT.Buffer(0,m-1);
+    const F* mu = block.shifts.LockedBuffer();
+    for( Int j=0; j<sb; ++j )
+        wLast[j] -= mu[j];
+}
+
+// Run iterations kHigh, kHigh-1, ..., kLow of the simultaneous RQ 
+// factorization and solve against R, where H(i,j) is stored in
+// hBuf[i+(j-colOff)*ldim]
+template<typename F>
+inline void
+USweep
+( Int kHigh, Int kLow, const F* hBuf, Int ldim, Int colOff, 
+  ShiftBlock<F>& block )
+{
+    DEBUG_ONLY(CallStackEntry cse("mshs::USweep"))
+    typedef Base<F> Real;
+    const Int sb = block.XT.Height();
+    const F* mu = block.shifts.LockedBuffer();
+    const Int depth = SweepDepth();
+    Matrix<F> XC( sb, depth ), XS( sb, depth );
+    F* XTBuf = block.XT.Buffer();
+    F* WTBuf = block.WT.Buffer();
+    Real* CBuf = block.C.Buffer();
+    F* SBuf = block.S.Buffer();
+    F* XCBuf = XC.Buffer();
+    F* XSBuf = XS.Buffer();
+    for( Int k0=kHigh; k0>=kLow; k0-=depth )
     {
-        auto hT = LockedView( H, 0, k-1, k-1, 1 );
-        const F etakkm1 = H.Get(k,k-1);
-        const F etakm1km1 = H.Get(k-1,k-1);
-        for( Int j=0; j<n; ++j )
+        const Int k1 = Max(k0-depth+1,kLow);
+        for( Int k=k0; k>=k1; --k )
         {
-            // Find the Givens rotation needed to zero H(k,k-1),
-            //   | c        s | | H(k,k)   | = | gamma |
-            //   | -conj(s) c | | H(k,k-1) |   | 0     |
-            Real c; F s;
-            lapack::Givens( W.Get(k,j), etakkm1, &c, &s );
-            C.Set( k, j, c );
-            S.Set( k, j, s );
-
-            // The new diagonal value of R
-            const F rhokk = c*W.Get(k,j) + s*etakkm1;
-
-            // Divide our current entry of x by the diagonal value of R
-            X.Set( k, j, X.Get(k,j)/rhokk );
-
-            // x(0:k-1) -= x(k) * R(0:k-1,k), where
-            // R(0:k-1,k) = c H(0:k-1,k) + s H(0:k-1,k-1). We express this
-            // more concisely as xT -= x(k) * ( c wT + s hT ).
-            // Note that we carefully handle updating the k-1'th entry since
-            // it is shift-dependent.
-            const F mu = shifts.Get( j, 0 );
-            const F xc = X.Get(k,j)*c;
-            const F xs  = X.Get(k,j)*s;
-            blas::Axpy( k-1, -xc, W.LockedBuffer(0,j), 1, X.Buffer(0,j), 1 );
-            blas::Axpy( k-1, -xs, hT.LockedBuffer(),   1, X.Buffer(0,j), 1 );
-            X.Update( k-1, j, -xc*W.Get(k-1,j)-xs*(etakm1km1-mu) );
-
-            // Change the working vector, wT, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last 
-            // to a fully-updated portion of the k-1'th column of this iteration
-            //
-            // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1)
-            blas::Scal( k-1, -Conj(s), W.Buffer(0,j), 1 );
-            blas::Axpy( k-1, c, hT.LockedBuffer(), 1, W.Buffer(0,j), 1 );
-            W.Set( k-1, j, -Conj(s)*W.Get(k-1,j)+c*(etakm1km1-mu) );
+            // hCol[i] = H(i,k-1)
+            const F* hCol = &hBuf[(k-1-colOff)*ldim];
+            const F etakkm1 = hCol[k];
+            const F etakm1km1 = hCol[k-1];
+            F* xk = &XTBuf[k*sb];
+            F* wk = &WTBuf[k*sb];
+            F* xkm1 = &XTBuf[(k-1)*sb];
+            F* wkm1 = &WTBuf[(k-1)*sb];
+            Real* c = &CBuf[k*sb];
+            F* s = &SBuf[k*sb];
+            F* xc = &XCBuf[(k0-k)*sb];
+            F* xs = &XSBuf[(k0-k)*sb];
+            for( Int j=0; j<sb; ++j )
+            {
+                // Find the Givens rotation needed to zero H(k,k-1),
+                //   | c        s | | H(k,k)   | = | gamma |
+                //   | -conj(s) c | | H(k,k-1) |   | 0     |
+                lapack::Givens( wk[j], etakkm1, &c[j], &s[j] );
+
+                // Divide our current entry of x by the new diagonal of R
+                const F rhokk = c[j]*wk[j] + s[j]*etakkm1;
+                xk[j] /= rhokk;
+
+                // x(0:k-1) -= x(k) * R(0:k-1,k), where
+                // R(0:k-1,k) = c H(0:k-1,k) + s H(0:k-1,k-1). We express 
+                // this more concisely as xT -= x(k) * ( c wT + s hT ).
+                // Note that we carefully handle updating the k-1'th entry 
+                // since it is shift-dependent.
+                xc[j] = xk[j]*c[j];
+                xs[j] = xk[j]*s[j];
+                xkm1[j] -= xc[j]*wkm1[j] + xs[j]*(etakm1km1-mu[j]);
+
+                // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1)
+                wkm1[j] = -Conj(s[j])*wkm1[j] + c[j]*(etakm1km1-mu[j]);
+            }
+
+            // Only update the rows needed by the remaining iterations of 
+            // this group
+            for( Int i=Max(k1-1,0); i<k-1; ++i )
+            {
+                const F eta = hCol[i];
+                F* xi = &XTBuf[i*sb];
+                F* wi = &WTBuf[i*sb];
+                for( Int j=0; j<sb; ++j )
+                {
+                    xi[j] -= FastMul(xc[j],wi[j]) + FastMul(xs[j],eta);
+                    wi[j] = c[j]*eta - FastMul(Conj(s[j]),wi[j]);
+                }
+            }
+        }
+
+        // Apply the deferred updates from this group of iterations
+        for( Int i=0; i<k1-1; ++i )
+        {
+            F* xi = &XTBuf[i*sb];
+            F* wi = &WTBuf[i*sb];
+            for( Int k=k0; k>=k1; --k )
+            {
+                const F eta = hBuf[i+(k-1-colOff)*ldim];
+                const Real* c = &CBuf[k*sb];
+                const F* s = &SBuf[k*sb];
+                const F* xc = &XCBuf[(k0-k)*sb];
+                const F* xs = &XSBuf[(k0-k)*sb];
+                for( Int j=0; j<sb; ++j )
+                {
+                    xi[j] -= FastMul(xc[j],wi[j]) + FastMul(xs[j],eta);
+                    wi[j] = c[j]*eta - FastMul(Conj(s[j]),wi[j]);
+                }
+            }
         }
     }
+}
+
+template<typename F>
+inline void
+UFinish( ShiftBlock<F>& block )
+{
+    DEBUG_ONLY(CallStackEntry cse("mshs::UFinish"))
+    typedef Base<F> Real;
+    const Int sb = block.XT.Height();
+    const Int m = block.XT.Width();
+
     // Divide x(0) by R(0,0)
-    for( Int j=0; j<n; ++j )
-        X.Set( 0, j, X.Get(0,j)/W.Get(0,j) );
+    F* x0 = block.XT.Buffer();
+    const F* w0 = block.WT.LockedBuffer();
+    for( Int j=0; j<sb; ++j )
+        x0[j] /= w0[j];
 
     // Solve against Q
-    for( Int j=0; j<n; ++j )        
+    std::vector<F> tau0( x0, x0+sb );
+    for( Int k=1; k<m; ++k )
     {
-        F* x = X.Buffer(0,j);
-        const Real* c = C.LockedBuffer(0,j);
-        const F*    s = S.LockedBuffer(0,j);
-        F tau0 = x[0];
-        for( Int k=1; k<m; ++k )
+        const Real* c = block.C.LockedBuffer(0,k);
+        const F* s = block.S.LockedBuffer(0,k);
+        F* xk = block.XT.Buffer(0,k);
+        F* xkm1 = block.XT.Buffer(0,k-1);
+        for( Int j=0; j<sb; ++j )
         {
-            F tau1 = x[k];
-            x[k-1] =       c[k] *tau0 + s[k]*tau1;
-            tau0   = -Conj(s[k])*tau0 + c[k]*tau1;
+            const F tau1 = xk[j];
+            xkm1[j] =        c[j] *tau0[j] + s[j]*tau1;
+            tau0[j] = -Conj(s[j])*tau0[j] + c[j]*tau1;
         }
-        x[m-1] = tau0;
+    }
+    F* xLast = block.XT.Buffer(0,m-1);
+    for( Int j=0; j<sb; ++j )
+        xLast[j] = tau0[j];
+}
+
+template<typename F>
+inline void
+LN( F alpha, const Matrix<F>& H, const Matrix<F>& shifts, Matrix<F>& X ) 
+{
+    DEBUG_ONLY(CallStackEntry cse("mshs::LN"))
+    Scale( alpha, X );
+
+    const Int m = X.Height();
+    const Int n = X.Width();
+    if( m == 0 )
+        return;
+
+    const Int shiftBlocksize = ShiftBlocksize();
+    ShiftBlock<F> block;
+    for( Int s0=0; s0<n; s0+=shiftBlocksize )
+    {
+        const Int sb = Min(shiftBlocksize,n-s0);
+        LoadBlock( shifts, X, s0, sb, block );
+        LInitialize( H.LockedBuffer(), block );
+        LSweep( 0, m-1, H.LockedBuffer(), H.LDim(), 0, 0, block );
+        LFinish( block );
+        StoreBlock( block, s0, X );
+    }
+}
+
+template<typename F>
+inline void
+UN( F alpha, const Matrix<F>& H, const Matrix<F>& shifts, Matrix<F>& X ) 
+{
+    DEBUG_ONLY(CallStackEntry cse("mshs::UN"))
+    Scale( alpha, X );
+
+    const Int m = X.Height();
+    const Int n = X.Width();
+    if( m == 0 )
+        return;
+
+    const Int shiftBlocksize = ShiftBlocksize();
+    ShiftBlock<F> block;
+    for( Int s0=0; s0<n; s0+=shiftBlocksize )
+    {
+        const Int sb = Min(shiftBlocksize,n-s0);
+        LoadBlock( shifts, X, s0, sb, block );
+        UInitialize( H.LockedBuffer(0,m-1), block );
+        USweep( m-1, 1, H.LockedBuffer(), H.LDim(), 0, block );
+        UFinish( block );
+        StoreBlock( block, s0, X );
     }
 }
 
@@ -205,6 +439,10 @@ UN( F alpha, const Matrix<F>& H, const Matrix<F>& shifts, Matrix<F>& X )
 //       Hessenberg matrices since whole columns will need to be formed 
 //       on every process and this distribution will keep the communication 
 //       balanced.
+//
+//       Rather than gathering a single column of H for each step, panels of
+//       Blocksize() columns are gathered at once, and every block of local
+//       shifts is swept over each panel before moving to the next.
 
 template<typename F,Dist UH,Dist VH,Dist VX>
 inline void
@@ -220,98 +458,47 @@ LN
     Scale( alpha, X );
 
     const Int m = X.Height();
-    const Int n = X.Width();
     const Int nLoc = X.LocalWidth();
     if( m == 0 )
         return;
 
-    // Initialize storage for Givens rotations
-    typedef Base<F> Real;
-    Matrix<Real> C(m,nLoc);
-    Matrix<F> S(m,nLoc);
+    const Int shiftBlocksize = ShiftBlocksize();
+    const Int numBlocks = (nLoc+shiftBlocksize-1)/shiftBlocksize;
+    std::vector<ShiftBlock<F>> blocks( numBlocks );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int s0 = b*shiftBlocksize;
+        const Int sb = Min(shiftBlocksize,nLoc-s0);
+        LoadBlock( shifts.LockedMatrix(), X.LockedMatrix(), s0, sb, blocks[b] );
+    }
 
     // Initialize the workspace for shifted columns of H
-    Matrix<F> W(m,nLoc);
     {
         auto h0 = LockedView( H, 0, 0, m, 1 );
         DistMatrix<F,STAR,STAR> h0_STAR_STAR( h0 );
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        {
-            MemCopy( W.Buffer(0,jLoc), h0_STAR_STAR.LockedBuffer(), m );
-            W.Update( 0, jLoc, -shifts.GetLocal(jLoc,0) );
-        }
+        for( Int b=0; b<numBlocks; ++b )
+            LInitialize( h0_STAR_STAR.LockedBuffer(), blocks[b] );
     }
      
     // Simultaneously find the LQ factorization and solve against L
-    DistMatrix<F,STAR,STAR> hB_STAR_STAR( H.Grid() );
-    for( Int k=0; k<m-1; ++k )
+    DistMatrix<F,STAR,STAR> HPan_STAR_STAR( H.Grid() );
+    const Int bsize = Blocksize();
+    for( Int k=0; k<m-1; k+=bsize )
     {
-        auto hB = LockedViewRange( H, k+2, k+1, m, k+2 );
-        hB_STAR_STAR = hB;
-        const F etakkp1 = H.Get(k,k+1);
-        const F etakp1kp1 = H.Get(k+1,k+1);
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        {
-            // Find the Givens rotation needed to zero H(k,k+1),
-            //   | c        s | | H(k,k)   | = | gamma |
-            //   | -conj(s) c | | H(k,k+1) |   | 0     |
-            Real c; F s;
-            lapack::Givens( W.Get(k,jLoc), etakkp1, &c, &s );
-            C.Set( k, jLoc, c );
-            S.Set( k, jLoc, s );
-
-            // The new diagonal value of L
-            const F lambdakk = c*W.Get(k,jLoc) + s*etakkp1;
-
-            // Divide our current entry of x by the diagonal value of L
-            X.SetLocal( k, jLoc, X.GetLocal(k,jLoc)/lambdakk );
-
-            // x(k+1:end) -= x(k) * L(k+1:end,k), where
-            // L(k+1:end,k) = c H(k+1:end,k) + s H(k+1:end,k+1). We express this
-            // more concisely as xB -= x(k) * ( c wB + s hB ).
-            // Note that we carefully handle updating the k+1'th entry since
-            // it is shift-dependent.
-            const F mu = shifts.GetLocal( jLoc, 0 );
-            const F xc = X.GetLocal(k,jLoc)*c;
-            const F xs  = X.GetLocal(k,jLoc)*s;
-            X.UpdateLocal( k+1, jLoc, -xc*W.Get(k+1,jLoc)-xs*(etakp1kp1-mu) );
-            blas::Axpy
-            ( m-(k+2), -xc, W.LockedBuffer(k+2,jLoc), 1, 
-                            X.Buffer(k+2,jLoc),       1 );
-            blas::Axpy
-            ( m-(k+2), -xs, hB_STAR_STAR.LockedBuffer(), 1, 
-                            X.Buffer(k+2,jLoc),          1 );
-
-            // Change the working vector, wB, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last 
-            // to a fully-updated portion of the k+1'th column of this iteration
-            //
-            // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1)
-            W.Set( k+1, jLoc, -Conj(s)*W.Get(k+1,jLoc)+c*(etakp1kp1-mu) );
-            blas::Scal( m-(k+2), -Conj(s), W.Buffer(k+2,jLoc), 1 );
-            blas::Axpy
-            ( m-(k+2), c, hB_STAR_STAR.LockedBuffer(), 1, 
-                          W.Buffer(k+2,jLoc),          1 );
-        }
+        // Iterations k through kEnd-1 require H(k:m-1,k+1:kEnd)
+        const Int kEnd = Min(k+bsize,m-1);
+        auto HPan = LockedViewRange( H, k, k+1, m, kEnd+1 );
+        HPan_STAR_STAR = HPan;
+        for( Int b=0; b<numBlocks; ++b )
+            LSweep
+            ( k, kEnd, HPan_STAR_STAR.LockedBuffer(), HPan_STAR_STAR.LDim(),
+              k, k+1, blocks[b] );
     }
-    // Divide x(end) by L(end,end)
-    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        X.SetLocal( m-1, jLoc, X.GetLocal(m-1,jLoc)/W.Get(m-1,jLoc) );
 
-    // Solve against Q
-    for( Int jLoc=0; jLoc<nLoc; ++jLoc ) 
+    for( Int b=0; b<numBlocks; ++b )
     {
-        F* x = X.Buffer(0,jLoc);
-        const Real* c = C.LockedBuffer(0,jLoc);
-        const F*    s = S.LockedBuffer(0,jLoc);
-        F tau0 = x[m-1];
-        for( Int k=m-2; k>=0; --k )
-        {
-            F tau1 = x[k];
-            x[k+1] =       c[k] *tau0 + s[k]*tau1;
-            tau0   = -Conj(s[k])*tau0 + c[k]*tau1;
-        }
-        x[0] = tau0;
+        LFinish( blocks[b] );
+        StoreBlock( blocks[b], b*shiftBlocksize, X.Matrix() );
     }
 }
 
@@ -329,94 +516,47 @@ UN
     Scale( alpha, X );
 
     const Int m = X.Height();
-    const Int n = X.Width();
     const Int nLoc = X.LocalWidth();
     if( m == 0 )
         return;
 
-    // Initialize storage for Givens rotations
-    typedef Base<F> Real;
-    Matrix<Real> C(m,nLoc);
-    Matrix<F> S(m,nLoc);
+    const Int shiftBlocksize = ShiftBlocksize();
+    const Int numBlocks = (nLoc+shiftBlocksize-1)/shiftBlocksize;
+    std::vector<ShiftBlock<F>> blocks( numBlocks );
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int s0 = b*shiftBlocksize;
+        const Int sb = Min(shiftBlocksize,nLoc-s0);
+        LoadBlock( shifts.LockedMatrix(), X.LockedMatrix(), s0, sb, blocks[b] );
+    }
 
     // Initialize the workspace for shifted columns of H
-    Matrix<F> W(m,nLoc);
     {
         auto hLast = LockedView( H, 0, m-1, m, 1 );
         DistMatrix<F,STAR,STAR> hLast_STAR_STAR( hLast );
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        {
-            MemCopy( W.Buffer(0,jLoc), hLast_STAR_STAR.LockedBuffer(), m );
-            W.Update( m-1, jLoc, -shifts.GetLocal(jLoc,0) );
-        }
+        for( Int b=0; b<numBlocks; ++b )
+            UInitialize( hLast_STAR_STAR.LockedBuffer(), blocks[b] );
     }
      
     // Simultaneously form the RQ factorization and solve against R
-    DistMatrix<F,STAR,STAR> hT_STAR_STAR( H.Grid() );
-    for( Int k=m-1; k>0; --k )
+    DistMatrix<F,STAR,STAR> HPan_STAR_STAR( H.Grid() );
+    const Int bsize = Blocksize();
+    for( Int kHigh=m-1; kHigh>0; kHigh-=bsize )
     {
-        auto hT = LockedView( H, 0, k-1, k-1, 1 );
-        hT_STAR_STAR = hT;
-        const F etakkm1 = H.Get(k,k-1);
-        const F etakm1km1 = H.Get(k-1,k-1);
-        for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        {
-            // Find the Givens rotation needed to zero H(k,k-1),
-            //   | c        s | | H(k,k)   | = | gamma |
-            //   | -conj(s) c | | H(k,k-1) |   | 0     |
-            Real c; F s;
-            lapack::Givens( W.Get(k,jLoc), etakkm1, &c, &s );
-            C.Set( k, jLoc, c );
-            S.Set( k, jLoc, s );
-
-            // The new diagonal value of R
-            const F rhokk = c*W.Get(k,jLoc) + s*etakkm1;
-
-            // Divide our current entry of x by the diagonal value of R
-            X.SetLocal( k, jLoc, X.GetLocal(k,jLoc)/rhokk );
-
-            // x(0:k-1) -= x(k) * R(0:k-1,k), where
-            // R(0:k-1,k) = c H(0:k-1,k) + s H(0:k-1,k-1). We express this
-            // more concisely as xT -= x(k) * ( c wT + s hT ).
-            // Note that we carefully handle updating the k-1'th entry since
-            // it is shift-dependent.
-            const F mu = shifts.GetLocal( jLoc, 0 );
-            const F xc = X.GetLocal(k,jLoc)*c;
-            const F xs  = X.GetLocal(k,jLoc)*s;
-            blas::Axpy
-            ( k-1, -xc, W.LockedBuffer(0,jLoc),      1, X.Buffer(0,jLoc), 1 );
-            blas::Axpy
-            ( k-1, -xs, hT_STAR_STAR.LockedBuffer(), 1, X.Buffer(0,jLoc), 1 );
-            X.UpdateLocal( k-1, jLoc, -xc*W.Get(k-1,jLoc)-xs*(etakm1km1-mu) );
-
-            // Change the working vector, wT, from representing a fully-updated
-            // portion of the k'th column of H from the end of the last 
-            // to a fully-updated portion of the k-1'th column of this iteration
-            //
-            // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1)
-            blas::Scal( k-1, -Conj(s), W.Buffer(0,jLoc), 1 );
-            blas::Axpy( k-1, c, hT_STAR_STAR.LockedBuffer(), 1, 
-                                W.Buffer(0,jLoc),            1 );
-            W.Set( k-1, jLoc, -Conj(s)*W.Get(k-1,jLoc)+c*(etakm1km1-mu) );
-        }
+        // Iterations kHigh down to kLow require H(0:kHigh,kLow-1:kHigh-1)
+        const Int kLow = Max(kHigh-bsize+1,1);
+        auto HPan = LockedViewRange( H, 0, kLow-1, kHigh+1, kHigh );
+        HPan_STAR_STAR = HPan;
+        for( Int b=0; b<numBlocks; ++b )
+            USweep
+            ( kHigh, kLow, HPan_STAR_STAR.LockedBuffer(), 
+              HPan_STAR_STAR.LDim(), kLow-1, blocks[b] );
     }
-    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
-        X.SetLocal( 0, jLoc, X.GetLocal(0,jLoc)/W.Get(0,jLoc) );
 
-    // Solve against Q
-    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+    for( Int b=0; b<numBlocks; ++b )
     {
-        F* x = X.Buffer(0,jLoc);
-        const Real* c = C.LockedBuffer(0,jLoc);
-        const F*    s = S.LockedBuffer(0,jLoc);
-        F tau0 = x[0];
-        for( Int k=1; k<m; ++k )
-        {
-            F tau1 = x[k];
-            x[k-1] =       c[k] *tau0 + s[k]*tau1;
-            tau0   = -Conj(s[k])*tau0 + c[k]*tau1;
-        }
-        x[m-1] = tau0;
+        UFinish( blocks[b] );
+        StoreBlock( blocks[b], b*shiftBlocksize, X.Matrix() );
     }
 }
 
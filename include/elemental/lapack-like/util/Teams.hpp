@@ -0,0 +1,72 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef ELEM_TEAMS_HPP
+#define ELEM_TEAMS_HPP
+
+namespace elem {
+
+// Split the grid into numTeams (nearly) equally-sized teams of contiguous
+// ranks. Every team grid is viewed by all of the processes in the original
+// grid, so that matrices may be pushed to, or pulled from, any team by
+// assignment. The team grids must later be freed with FreeTeamGrids.
+inline void
+SplitIntoTeams
+( Int numTeams, const Grid& grid, std::vector<const Grid*>& teamGrids,
+  bool progress=false )
+{
+    DEBUG_ONLY(CallStackEntry cse("SplitIntoTeams"))
+    const Int p = grid.Size();
+    mpi::Group group = grid.OwningGroup();
+    teamGrids.resize( numTeams );
+    for( Int t=0; t<numTeams; ++t )
+    {
+        const Int firstRank = (t*p)/numTeams;
+        const Int teamSize = ((t+1)*p)/numTeams - firstRank;
+        std::vector<int> teamRanks(teamSize);
+        for( Int j=0; j<teamSize; ++j )
+            teamRanks[j] = firstRank + j;
+        mpi::Group teamGroup;
+        mpi::GroupIncl( group, teamSize, teamRanks.data(), teamGroup );
+        const Int r = Grid::FindFactor( teamSize );
+        if( progress && grid.Rank() == 0 )
+            std::cout << "Team " << t << " is a " << r << " x "
+                      << teamSize/r << " grid" << std::endl;
+        teamGrids[t] = new Grid( grid.VCComm(), teamGroup, r );
+    }
+}
+
+inline void
+FreeTeamGrids( std::vector<const Grid*>& teamGrids )
+{
+    DEBUG_ONLY(CallStackEntry cse("FreeTeamGrids"))
+    for( Int t=0; t<Int(teamGrids.size()); ++t )
+    {
+        mpi::Group owning = teamGrids[t]->OwningGroup();
+        delete teamGrids[t];
+        mpi::GroupFree( owning );
+    }
+    teamGrids.resize( 0 );
+}
+
+// The team containing the given rank of a grid split by SplitIntoTeams
+inline Int
+TeamOf( Int rank, Int numTeams, Int p )
+{
+    Int t = (rank*numTeams)/p;
+    while( ((t+1)*p)/numTeams <= rank )
+        ++t;
+    while( (t*p)/numTeams > rank )
+        --t;
+    return t;
+}
+
+} // namespace elem
+
+#endif // ifndef ELEM_TEAMS_HPP
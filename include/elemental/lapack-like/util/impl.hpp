@@ -18,5 +18,6 @@
 #include "./Median.hpp"
 #include "./PivotParity.hpp"
 #include "./Sort.hpp"
+#include "./Teams.hpp"
 
 #endif // ifndef ELEM_LAPACKUTIL_IMPL_HPP
@@ -40,6 +40,8 @@ AbstractDistMatrix<T>::AbstractDistMatrix( AbstractDistMatrix<T>&& A )
 { 
     matrix_.ShallowSwap( A.matrix_ );
     auxMemory_.ShallowSwap( A.auxMemory_ );
+    remoteUpdates_.swap( A.remoteUpdates_ );
+    remoteSets_.swap( A.remoteSets_ );
 }
 
 // Optional to override
@@ -57,6 +59,8 @@ AbstractDistMatrix<T>::operator=( AbstractDistMatrix<T>&& A )
 {
     auxMemory_.ShallowSwap( A.auxMemory_ );
     matrix_.ShallowSwap( A.matrix_ );
+    remoteUpdates_.swap( A.remoteUpdates_ );
+    remoteSets_.swap( A.remoteSets_ );
     viewType_ = A.viewType_;
     height_ = A.height_;
     width_ = A.width_;
@@ -76,6 +80,8 @@ void
 AbstractDistMatrix<T>::Empty()
 {
     matrix_.Empty_();
+    remoteUpdates_.clear();
+    remoteSets_.clear();
     viewType_ = OWNER;
     height_ = 0;
     width_ = 0;
@@ -984,6 +990,185 @@ void
 AbstractDistMatrix<T>::ConjugateLocal( Int iLoc, Int jLoc )
 { matrix_.Conjugate( iLoc, jLoc ); }
 
+// Batched global entry manipulation
+// ---------------------------------
+
+template<typename T>
+void
+AbstractDistMatrix<T>::Reserve( Int numRemoteUpdates, Int numRemoteSets )
+{
+    remoteUpdates_.reserve( numRemoteUpdates );
+    remoteSets_.reserve( numRemoteSets );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::QueueUpdate( Int i, Int j, T value )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ADM::QueueUpdate");
+        AssertValidEntry( i, j );
+    )
+    ValueIntPair<T> entry;
+    entry.value = value;
+    entry.indices[0] = i;
+    entry.indices[1] = j;
+    remoteUpdates_.push_back( entry );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::QueueSet( Int i, Int j, T value )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ADM::QueueSet");
+        AssertValidEntry( i, j );
+    )
+    ValueIntPair<T> entry;
+    entry.value = value;
+    entry.indices[0] = i;
+    entry.indices[1] = j;
+    remoteSets_.push_back( entry );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::ProcessQueues()
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ADM::ProcessQueues");
+        AssertNotLocked();
+    )
+    if( !grid_->InGrid() )
+    {
+        remoteUpdates_.clear();
+        remoteSets_.clear();
+        return;
+    }
+    mpi::Comm comm = grid_->VCComm();
+    const int commSize = mpi::CommSize( comm );
+    const Int colStride = ColStride();
+    const Int rowStride = RowStride();
+
+    // Entry (i,j) is owned by the processes whose shifts are i mod colStride
+    // and j mod rowStride, of which there is more than one when the matrix
+    // is stored redundantly. Form a list of the owners of each class.
+    const Int myClass =
+        ( Participating() ? ColShift()+RowShift()*colStride : -1 );
+    std::vector<Int> classes( commSize );
+    mpi::AllGather( &myClass, 1, classes.data(), 1, comm );
+    const Int numClasses = colStride*rowStride;
+    std::vector<int> ownerOffsets( numClasses+1, 0 ), owners;
+    for( int q=0; q<commSize; ++q )
+        if( classes[q] >= 0 )
+            ++ownerOffsets[classes[q]+1];
+    for( Int c=0; c<numClasses; ++c )
+        ownerOffsets[c+1] += ownerOffsets[c];
+    owners.resize( ownerOffsets[numClasses] );
+    {
+        std::vector<int> offsets( ownerOffsets );
+        for( int q=0; q<commSize; ++q )
+            if( classes[q] >= 0 )
+                owners[offsets[classes[q]]++] = q;
+    }
+
+    // Count the number of overwrites and updates destined for each process
+    const Int numSets = remoteSets_.size();
+    const Int numUpdates = remoteUpdates_.size();
+    std::vector<int> sendCounts( 2*commSize, 0 );
+    for( Int k=0; k<numSets+numUpdates; ++k )
+    {
+        const bool set = ( k < numSets );
+        const ValueIntPair<T>& entry =
+            ( set ? remoteSets_[k] : remoteUpdates_[k-numSets] );
+        const Int c =
+            (entry.indices[0] % colStride) +
+            (entry.indices[1] % rowStride)*colStride;
+        for( int s=ownerOffsets[c]; s<ownerOffsets[c+1]; ++s )
+            ++sendCounts[2*owners[s]+(set?0:1)];
+    }
+    std::vector<int> recvCounts( 2*commSize );
+    mpi::AllToAll( sendCounts.data(), 2, recvCounts.data(), 2, comm );
+
+    // Pack the overwrites before the updates for each process
+    std::vector<int> sendSizes( commSize ), sendDispls( commSize ),
+                     recvSizes( commSize ), recvDispls( commSize );
+    int totalSend=0, totalRecv=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] = sendCounts[2*q] + sendCounts[2*q+1];
+        recvSizes[q] = recvCounts[2*q] + recvCounts[2*q+1];
+        sendDispls[q] = totalSend;
+        recvDispls[q] = totalRecv;
+        totalSend += sendSizes[q];
+        totalRecv += recvSizes[q];
+    }
+    std::vector<T> sendValues( totalSend );
+    std::vector<Int> sendIndices( 2*totalSend );
+    std::vector<int> setOffsets( sendDispls ), updateOffsets( commSize );
+    for( int q=0; q<commSize; ++q )
+        updateOffsets[q] = sendDispls[q] + sendCounts[2*q];
+    for( Int k=0; k<numSets+numUpdates; ++k )
+    {
+        const bool set = ( k < numSets );
+        const ValueIntPair<T>& entry =
+            ( set ? remoteSets_[k] : remoteUpdates_[k-numSets] );
+        const Int c =
+            (entry.indices[0] % colStride) +
+            (entry.indices[1] % rowStride)*colStride;
+        for( int s=ownerOffsets[c]; s<ownerOffsets[c+1]; ++s )
+        {
+            const int q = owners[s];
+            const int offset = ( set ? setOffsets[q]++ : updateOffsets[q]++ );
+            sendValues[offset] = entry.value;
+            sendIndices[2*offset] = entry.indices[0];
+            sendIndices[2*offset+1] = entry.indices[1];
+        }
+    }
+    remoteSets_.clear();
+    remoteUpdates_.clear();
+
+    std::vector<T> recvValues( totalRecv );
+    std::vector<Int> recvIndices( 2*totalRecv );
+    mpi::AllToAll
+    ( sendValues.data(), sendSizes.data(), sendDispls.data(),
+      recvValues.data(), recvSizes.data(), recvDispls.data(), comm );
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] *= 2;
+        sendDispls[q] *= 2;
+        recvSizes[q] *= 2;
+        recvDispls[q] *= 2;
+    }
+    mpi::AllToAll
+    ( sendIndices.data(), sendSizes.data(), sendDispls.data(),
+      recvIndices.data(), recvSizes.data(), recvDispls.data(), comm );
+
+    // Apply all of the overwrites (in rank order) before any of the updates
+    const Int colShift = ColShift();
+    const Int rowShift = RowShift();
+    for( int q=0; q<commSize; ++q )
+    {
+        const int offset = recvDispls[q]/2;
+        for( int s=offset; s<offset+recvCounts[2*q]; ++s )
+        {
+            const Int iLoc = (recvIndices[2*s]-colShift) / colStride;
+            const Int jLoc = (recvIndices[2*s+1]-rowShift) / rowStride;
+            matrix_.Set( iLoc, jLoc, recvValues[s] );
+        }
+    }
+    for( int q=0; q<commSize; ++q )
+    {
+        const int offset = recvDispls[q]/2 + recvCounts[2*q];
+        for( int s=offset; s<offset+recvCounts[2*q+1]; ++s )
+        {
+            const Int iLoc = (recvIndices[2*s]-colShift) / colStride;
+            const Int jLoc = (recvIndices[2*s+1]-rowShift) / rowStride;
+            matrix_.Update( iLoc, jLoc, recvValues[s] );
+        }
+    }
+}
+
 // Diagonal manipulation
 // =====================
 
@@ -1681,6 +1866,8 @@ AbstractDistMatrix<T>::ShallowSwap( AbstractDistMatrix<T>& A )
 {
     matrix_.ShallowSwap( A.matrix_ );
     auxMemory_.ShallowSwap( A.auxMemory_ );
+    remoteUpdates_.swap( A.remoteUpdates_ );
+    remoteSets_.swap( A.remoteSets_ );
     std::swap( viewType_, A.viewType_ );
     std::swap( height_ , A.height_ );
     std::swap( width_, A.width_ );
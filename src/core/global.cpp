@@ -51,6 +51,15 @@ GridOrder gridOrder = ROW_MAJOR;
 // Qt5
 ColorMap colorMap=RED_BLACK_GREEN;
 Int numDiscreteColors = 15;
+
+// One-sided communication within AxpyInterface
+bool axpyInterfaceOneSided = false;
+
+// Checkpointing
+std::string checkpointBasename;
+Int checkpointFrequency = 1;
+bool restartFromCheckpoint = false;
+std::vector<std::string> checkpointScopes;
 #ifdef HAVE_QT5
 bool guiDisabled;
 bool elemInitializedQt = false;
@@ -146,6 +155,54 @@ void SetNumDiscreteColors( Int numChunks )
 Int NumDiscreteColors()
 { return ::numDiscreteColors; }
 
+void SetAxpyInterfaceOneSided( bool oneSided )
+{ ::axpyInterfaceOneSided = oneSided; }
+
+bool AxpyInterfaceOneSided()
+{ return ::axpyInterfaceOneSided; }
+
+void SetCheckpointBasename( std::string basename )
+{ ::checkpointBasename = basename; }
+
+std::string CheckpointBasename()
+{ return ::checkpointBasename; }
+
+void SetCheckpointFrequency( Int frequency )
+{
+    if( frequency < 1 )
+        LogicError("Checkpoint frequency must be positive");
+    ::checkpointFrequency = frequency;
+}
+
+Int CheckpointFrequency()
+{ return ::checkpointFrequency; }
+
+void SetRestartFromCheckpoint( bool restart )
+{ ::restartFromCheckpoint = restart; }
+
+bool RestartFromCheckpoint()
+{ return ::restartFromCheckpoint; }
+
+void PushCheckpointScope( std::string scope )
+{ ::checkpointScopes.push_back( scope ); }
+
+void PopCheckpointScope()
+{
+    DEBUG_ONLY(
+        if( ::checkpointScopes.empty() )
+            LogicError("Attempted to pop an empty checkpoint scope stack");
+    )
+    ::checkpointScopes.pop_back();
+}
+
+std::string CheckpointScope()
+{
+    std::string scope;
+    for( const auto& s : ::checkpointScopes )
+        scope += "." + s;
+    return scope;
+}
+
 #ifdef HAVE_QT5
 bool GuiDisabled()
 { return ::guiDisabled; }
@@ -53,6 +53,14 @@ void LAPACK(dstevr)
   double* w, double* Z, const int* ldz, int* isuppz, 
   double* work, const int* lwork, int* iwork, const int* liwork, int* info );
 
+// Secular equation solvers for rank-one modifications of diagonal matrices
+void LAPACK(slaed4)
+( const int* n, const int* i, const float* d, const float* z, 
+  float* delta, const float* rho, float* lambda, int* info );
+void LAPACK(dlaed4)
+( const int* n, const int* i, const double* d, const double* z, 
+  double* delta, const double* rho, double* lambda, int* info );
+
 // Hermitian eigensolvers (via MRRR)
 void LAPACK(ssyevr)
 ( const char* job, const char* range, const char* uplo, const int* n,
@@ -437,6 +445,34 @@ int SymmetricTridiagEig
     return m;
 }
 
+//
+// Solve the secular equation for a rank-one modification of a diagonal matrix
+//
+
+float SecularEigenvalue
+( int n, int i, const float* d, const float* z, float rho, float* delta )
+{
+    DEBUG_ONLY(CallStackEntry cse("lapack::SecularEigenvalue"))
+    int iFort=i+1, info;
+    float lambda;
+    LAPACK(slaed4)( &n, &iFort, d, z, delta, &rho, &lambda, &info );
+    if( info != 0 )
+        RuntimeError("slaed4 failed to converge");
+    return lambda;
+}
+
+double SecularEigenvalue
+( int n, int i, const double* d, const double* z, double rho, double* delta )
+{
+    DEBUG_ONLY(CallStackEntry cse("lapack::SecularEigenvalue"))
+    int iFort=i+1, info;
+    double lambda;
+    LAPACK(dlaed4)( &n, &iFort, d, z, delta, &rho, &lambda, &info );
+    if( info != 0 )
+        RuntimeError("dlaed4 failed to converge");
+    return lambda;
+}
+
 //
 // Compute the EVD of a Hermitian matrix
 //
@@ -298,6 +298,354 @@ bool IProbe( int source, int tag, Comm comm, Status& status )
 bool IProbe( int source, Comm comm, Status& status )
 { return IProbe( source, 0, comm, status ); }
 
+//-------------------//
+// Derived datatypes //
+//-------------------//
+
+void TypeVector
+( int count, int blockLength, int stride, Datatype oldType, 
+  Datatype& newType )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::TypeVector"))
+    SafeMpi( MPI_Type_vector( count, blockLength, stride, oldType, &newType ) );
+}
+
+void TypeHVector
+( int count, int blockLength, Aint stride, Datatype oldType, 
+  Datatype& newType )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::TypeHVector"))
+    SafeMpi
+    ( MPI_Type_create_hvector
+      ( count, blockLength, stride, oldType, &newType ) );
+}
+
+void TypeCommit( Datatype& type )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::TypeCommit"))
+    SafeMpi( MPI_Type_commit( &type ) );
+}
+
+void TypeFree( Datatype& type )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::TypeFree"))
+    SafeMpi( MPI_Type_free( &type ) );
+}
+
+//-------------------//
+// Parallel file I/O //
+//-------------------//
+
+// NOTE: Unlike most MPI errors, failing to open a file is always reported
+void FileOpen( Comm comm, const std::string filename, int mode, File& file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileOpen"))
+    const int error = 
+      MPI_File_open
+      ( comm, const_cast<char*>(filename.c_str()), mode, MPI_INFO_NULL, 
+        &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+}
+
+void FileClose( File& file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileClose"))
+    SafeMpi( MPI_File_close( &file ) );
+}
+
+Offset FileGetSize( File file )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileGetSize"))
+    Offset size;
+    SafeMpi( MPI_File_get_size( file, &size ) );
+    return size;
+}
+
+void FileSetSize( File file, Offset size )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileSetSize"))
+    SafeMpi( MPI_File_set_size( file, size ) );
+}
+
+void FileSetView( File file, Offset disp, Datatype eType, Datatype fileType )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileSetView"))
+    SafeMpi
+    ( MPI_File_set_view
+      ( file, disp, eType, fileType, const_cast<char*>("native"), 
+        MPI_INFO_NULL ) );
+}
+
+void FileReadAtAll
+( File file, Offset offset, void* buf, int count, Datatype type )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileReadAtAll"))
+    Status status;
+    SafeMpi
+    ( MPI_File_read_at_all( file, offset, buf, count, type, &status ) );
+}
+
+void FileWriteAtAll
+( File file, Offset offset, const void* buf, int count, Datatype type )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileWriteAtAll"))
+    Status status;
+    SafeMpi
+    ( MPI_File_write_at_all
+      ( file, offset, const_cast<void*>(buf), count, type, &status ) );
+}
+
+void FileReadAll( File file, void* buf, int count, Datatype type )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileReadAll"))
+    Status status;
+    SafeMpi( MPI_File_read_all( file, buf, count, type, &status ) );
+}
+
+void FileWriteAll( File file, const void* buf, int count, Datatype type )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FileWriteAll"))
+    Status status;
+    SafeMpi
+    ( MPI_File_write_all
+      ( file, const_cast<void*>(buf), count, type, &status ) );
+}
+
+#ifdef HAVE_MPI3_RMA
+//-------------------------//
+// One-sided communication //
+//-------------------------//
+
+// Callers fall back to two-sided communication when a window is unavailable,
+// so creation errors are returned (and reported) even in release builds
+void WindowCreate
+( void* base, Aint size, int dispUnit, Comm comm, Window& window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowCreate"))
+    MPI_Errhandler oldHandler;
+    SafeMpi( MPI_Comm_get_errhandler( comm, &oldHandler ) );
+    SafeMpi( MPI_Comm_set_errhandler( comm, MPI_ERRORS_RETURN ) );
+    const int error =
+        MPI_Win_create( base, size, dispUnit, MPI_INFO_NULL, comm, &window );
+    SafeMpi( MPI_Comm_set_errhandler( comm, oldHandler ) );
+    SafeMpi( MPI_Errhandler_free( &oldHandler ) );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not create an MPI window");
+    SafeMpi( MPI_Win_set_errhandler( window, MPI_ERRORS_RETURN ) );
+}
+
+void WindowFree( Window& window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowFree"))
+    SafeMpi( MPI_Win_free( &window ) );
+}
+
+// Since conflicting accesses are restricted to accumulates, no process ever
+// needs an exclusive lock
+void WindowLockAll( Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowLockAll"))
+    if( MPI_Win_lock_all( MPI_MODE_NOCHECK, window ) != MPI_SUCCESS )
+        RuntimeError("Could not lock an MPI window");
+}
+
+void WindowUnlockAll( Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowUnlockAll"))
+    SafeMpi( MPI_Win_unlock_all( window ) );
+}
+
+void WindowFlushAll( Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::WindowFlushAll"))
+    SafeMpi( MPI_Win_flush_all( window ) );
+}
+
+template<typename R>
+void Accumulate
+( const R* buf, int count, int target, Aint disp, Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Accumulate"))
+    SafeMpi
+    ( MPI_Accumulate
+      ( const_cast<R*>(buf), count, TypeMap<R>(), target, disp, count,
+        TypeMap<R>(), MPI_SUM, window ) );
+}
+
+// Summation acts independently on the real and imaginary components, so
+// complex data is always accumulated as pairs of reals
+template<typename R>
+void Accumulate
+( const Complex<R>* buf, int count, int target, Aint disp, Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Accumulate"))
+    SafeMpi
+    ( MPI_Accumulate
+      ( const_cast<Complex<R>*>(buf), 2*count, TypeMap<R>(), target, disp,
+        2*count, TypeMap<R>(), MPI_SUM, window ) );
+}
+
+template void Accumulate
+( const int* buf, int count, int target, Aint disp, Window window );
+template void Accumulate
+( const float* buf, int count, int target, Aint disp, Window window );
+template void Accumulate
+( const double* buf, int count, int target, Aint disp, Window window );
+template void Accumulate
+( const Complex<float>* buf, int count, int target, Aint disp,
+  Window window );
+template void Accumulate
+( const Complex<double>* buf, int count, int target, Aint disp,
+  Window window );
+
+template<typename R>
+void Get( R* buf, int count, int target, Aint disp, Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Get"))
+    SafeMpi
+    ( MPI_Get
+      ( buf, count, TypeMap<R>(), target, disp, count, TypeMap<R>(),
+        window ) );
+}
+
+template<typename R>
+void Get( Complex<R>* buf, int count, int target, Aint disp, Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Get"))
+    SafeMpi
+    ( MPI_Get
+      ( buf, 2*count, TypeMap<R>(), target, disp, 2*count, TypeMap<R>(),
+        window ) );
+}
+
+template void Get
+( int* buf, int count, int target, Aint disp, Window window );
+template void Get
+( float* buf, int count, int target, Aint disp, Window window );
+template void Get
+( double* buf, int count, int target, Aint disp, Window window );
+template void Get
+( Complex<float>* buf, int count, int target, Aint disp, Window window );
+template void Get
+( Complex<double>* buf, int count, int target, Aint disp, Window window );
+
+// The strided blocks at the target are described by a vector datatype, which
+// may be freed as soon as the operation has been issued
+template<typename R>
+void Accumulate
+( const R* buf, int height, int width, int ldim, int target, Aint disp, 
+  Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Accumulate"))
+    Datatype targetType;
+    TypeVector( width, height, ldim, TypeMap<R>(), targetType );
+    TypeCommit( targetType );
+    SafeMpi
+    ( MPI_Accumulate
+      ( const_cast<R*>(buf), height*width, TypeMap<R>(), target, disp, 1,
+        targetType, MPI_SUM, window ) );
+    TypeFree( targetType );
+}
+
+template<typename R>
+void Accumulate
+( const Complex<R>* buf, int height, int width, int ldim, int target, 
+  Aint disp, Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Accumulate"))
+    Datatype targetType;
+    TypeVector( width, 2*height, 2*ldim, TypeMap<R>(), targetType );
+    TypeCommit( targetType );
+    SafeMpi
+    ( MPI_Accumulate
+      ( const_cast<Complex<R>*>(buf), 2*height*width, TypeMap<R>(), target,
+        disp, 1, targetType, MPI_SUM, window ) );
+    TypeFree( targetType );
+}
+
+template void Accumulate
+( const int* buf, int height, int width, int ldim, int target, Aint disp,
+  Window window );
+template void Accumulate
+( const float* buf, int height, int width, int ldim, int target, Aint disp,
+  Window window );
+template void Accumulate
+( const double* buf, int height, int width, int ldim, int target, Aint disp,
+  Window window );
+template void Accumulate
+( const Complex<float>* buf, int height, int width, int ldim, int target,
+  Aint disp, Window window );
+template void Accumulate
+( const Complex<double>* buf, int height, int width, int ldim, int target,
+  Aint disp, Window window );
+
+template<typename R>
+void Get
+( R* buf, int height, int width, int ldim, int target, Aint disp, 
+  Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Get"))
+    Datatype targetType;
+    TypeVector( width, height, ldim, TypeMap<R>(), targetType );
+    TypeCommit( targetType );
+    SafeMpi
+    ( MPI_Get
+      ( buf, height*width, TypeMap<R>(), target, disp, 1, targetType,
+        window ) );
+    TypeFree( targetType );
+}
+
+template<typename R>
+void Get
+( Complex<R>* buf, int height, int width, int ldim, int target, Aint disp, 
+  Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::Get"))
+    Datatype targetType;
+    TypeVector( width, 2*height, 2*ldim, TypeMap<R>(), targetType );
+    TypeCommit( targetType );
+    SafeMpi
+    ( MPI_Get
+      ( buf, 2*height*width, TypeMap<R>(), target, disp, 1, targetType,
+        window ) );
+    TypeFree( targetType );
+}
+
+template void Get
+( int* buf, int height, int width, int ldim, int target, Aint disp,
+  Window window );
+template void Get
+( float* buf, int height, int width, int ldim, int target, Aint disp,
+  Window window );
+template void Get
+( double* buf, int height, int width, int ldim, int target, Aint disp,
+  Window window );
+template void Get
+( Complex<float>* buf, int height, int width, int ldim, int target,
+  Aint disp, Window window );
+template void Get
+( Complex<double>* buf, int height, int width, int ldim, int target,
+  Aint disp, Window window );
+
+// The target is flushed so that the previous value can be returned
+template<typename T>
+T FetchAndAdd( T value, int target, Aint disp, Window window )
+{
+    DEBUG_ONLY(CallStackEntry cse("mpi::FetchAndAdd"))
+    T oldValue;
+    SafeMpi
+    ( MPI_Fetch_and_op
+      ( &value, &oldValue, TypeMap<T>(), target, disp, MPI_SUM, window ) );
+    SafeMpi( MPI_Win_flush( target, window ) );
+    return oldValue;
+}
+
+template int FetchAndAdd( int value, int target, Aint disp, Window window );
+template long long int FetchAndAdd
+( long long int value, int target, Aint disp, Window window );
+#endif // ifdef HAVE_MPI3_RMA
+
 template<typename T>
 int GetCount( Status& status )
 {
@@ -987,7 +987,7 @@ Matrix<T>::LockedAttach_( Int height, Int width, const T* buffer, Int ldim )
     width_ = width;
     ldim_ = ldim;
     data_ = buffer;
-    viewType_ = (ViewType)( viewType_ | VIEW );
+    viewType_ = (ViewType)( viewType_ | LOCKED_VIEW );
 }
 
 template<typename T>
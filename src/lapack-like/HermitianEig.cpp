@@ -199,18 +199,6 @@ void HermitianEig
         Scale( 1/scale, w );
 }
 
-template<>
-void HermitianEig<float>
-( UpperOrLower uplo, DistMatrix<float>& A,
-  DistMatrix<float,VR,STAR>& w, SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
-template<>
-void HermitianEig<Complex<float>>
-( UpperOrLower uplo, DistMatrix<Complex<float>>& A,
-  DistMatrix<float,VR,STAR>& w, SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
 // Compute the full set of eigenpairs
 // ==================================
 
@@ -253,7 +241,8 @@ void HermitianEig
 template<typename F>
 void HermitianEig
 ( UpperOrLower uplo, DistMatrix<F>& A,
-  DistMatrix<Base<F>,VR,STAR>& w, DistMatrix<F>& paddedZ, SortType sort )
+  DistMatrix<Base<F>,VR,STAR>& w, DistMatrix<F>& paddedZ, SortType sort,
+  HermitianTridiagEigAlg alg )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianEig"))
     typedef Base<F> Real;
@@ -271,59 +260,80 @@ void HermitianEig
     DistMatrix<F,STAR,STAR> t(g);
     HermitianTridiag( uplo, A, t );
 
-    // Solve the symmetric tridiagonal EVP. The main subtlety is that we are
-    // using a padded [MC,MR] distributed matrix's local buffer to hold the
-    // local buffer for a [* ,VR].
     const Int n = A.Height();
     const Int k = n; // full set of eigenpairs
-    const Int N = MaxLength(n,g.Height())*g.Height();
-    const Int K = MaxLength(k,g.Size())*g.Size(); 
-    paddedZ.Align( 0, 0 );
-    paddedZ.Resize( N, K );
-    DistMatrix<Real,STAR,VR> Z_STAR_VR(g);
-    {
-        // Grab a slice of size Z_STAR_VR_BufferSize from the very end
-        // of paddedZBuffer so that we can later redistribute in place
-        Real* paddedZBuf = (Real*)paddedZ.Buffer();
-        const Int paddedZBufSize =
-            ( IsComplex<F>::val ? 2*paddedZ.LDim()*paddedZ.LocalWidth()
-                                :   paddedZ.LDim()*paddedZ.LocalWidth() );
-        const Int Z_STAR_VR_LocalWidth = Length(k,g.VRRank(),g.Size());
-        const Int Z_STAR_VR_BufSize = n*Z_STAR_VR_LocalWidth;
-        Real* Z_STAR_VR_Buf = &paddedZBuf[paddedZBufSize-Z_STAR_VR_BufSize];
-        Z_STAR_VR.Attach( n, k, 0, 0, Z_STAR_VR_Buf, n, g );
-    }
     const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
     auto d = A.GetRealPartOfDiagonal();
     auto e = A.GetRealPartOfDiagonal( subdiagonal );
-    HermitianTridiagEig( d, e, w, Z_STAR_VR, UNSORTED );
+    if( alg == HERMITIAN_TRIDIAG_EIG_DC )
     {
-        // Redistribute Z piece-by-piece in place. This is to keep the 
-        // send/recv buffer memory usage low.
-        const Int p = g.Size();
-        const Int numEqualPanels = K/p;
-        const Int numPanelsPerComm = (numEqualPanels / TARGET_CHUNKS) + 1;
-        const Int nbProp = numPanelsPerComm*p;
-
-        // Manually maintain information about the implicit Z[* ,VR] stored 
-        // at the end of the paddedZ[MC,MR] buffers.
-        Int alignment = 0;
-        const Real* readBuffer = Z_STAR_VR.LockedBuffer();
-        for( Int j=0; j<k; j+=nbProp )
+        // Solve the symmetric tridiagonal EVP with divide and conquer and 
+        // then embed the real eigenvectors into the [MC,MR] matrix
+        DistMatrix<Real,VC,STAR> Z_VC_STAR(g);
+        HermitianTridiagEig( d, e, w, Z_VC_STAR, UNSORTED, alg );
+        paddedZ.Align( 0, 0 );
+        paddedZ.Resize( n, k );
+        DistMatrix<Real> ZReal(g);
+        ZReal.AlignWith( paddedZ );
+        ZReal = Z_VC_STAR;
+        Z_VC_STAR.Empty();
+        const Int localHeight = paddedZ.LocalHeight();
+        const Int localWidth = paddedZ.LocalWidth();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                paddedZ.SetLocal( iLoc, jLoc, ZReal.GetLocal(iLoc,jLoc) );
+    }
+    else
+    {
+        // Solve the symmetric tridiagonal EVP. The main subtlety is that we are
+        // using a padded [MC,MR] distributed matrix's local buffer to hold the
+        // local buffer for a [* ,VR].
+        const Int N = MaxLength(n,g.Height())*g.Height();
+        const Int K = MaxLength(k,g.Size())*g.Size(); 
+        paddedZ.Align( 0, 0 );
+        paddedZ.Resize( N, K );
+        DistMatrix<Real,STAR,VR> Z_STAR_VR(g);
         {
-            const Int nb = Min(nbProp,k-j);
-            auto paddedZ1 = View( paddedZ, 0, j, n, nb );
+            // Grab a slice of size Z_STAR_VR_BufferSize from the very end
+            // of paddedZBuffer so that we can later redistribute in place
+            Real* paddedZBuf = (Real*)paddedZ.Buffer();
+            const Int paddedZBufSize =
+                ( IsComplex<F>::val ? 2*paddedZ.LDim()*paddedZ.LocalWidth()
+                                    :   paddedZ.LDim()*paddedZ.LocalWidth() );
+            const Int Z_STAR_VR_LocalWidth = Length(k,g.VRRank(),g.Size());
+            const Int Z_STAR_VR_BufSize = n*Z_STAR_VR_LocalWidth;
+            Real* Z_STAR_VR_Buf = &paddedZBuf[paddedZBufSize-Z_STAR_VR_BufSize];
+            Z_STAR_VR.Attach( n, k, 0, 0, Z_STAR_VR_Buf, n, g );
+        }
+        HermitianTridiagEig( d, e, w, Z_STAR_VR, UNSORTED );
+        {
+            // Redistribute Z piece-by-piece in place. This is to keep the 
+            // send/recv buffer memory usage low.
+            const Int p = g.Size();
+            const Int numEqualPanels = K/p;
+            const Int numPanelsPerComm = (numEqualPanels / TARGET_CHUNKS) + 1;
+            const Int nbProp = numPanelsPerComm*p;
+
+            // Manually maintain information about the implicit Z[* ,VR] stored 
+            // at the end of the paddedZ[MC,MR] buffers.
+            Int alignment = 0;
+            const Real* readBuffer = Z_STAR_VR.LockedBuffer();
+            for( Int j=0; j<k; j+=nbProp )
+            {
+                const Int nb = Min(nbProp,k-j);
+                auto paddedZ1 = View( paddedZ, 0, j, n, nb );
 
-            // Redistribute Z1[MC,MR] <- Z1[* ,VR] in place.
-            herm_eig::InPlaceRedist( paddedZ1, alignment, readBuffer );
+                // Redistribute Z1[MC,MR] <- Z1[* ,VR] in place.
+                herm_eig::InPlaceRedist( paddedZ1, alignment, readBuffer );
             
-            // Update the Z1[* ,VR] information
-            const Int localWidth = nb/p;
-            readBuffer = &readBuffer[localWidth*n];
-            alignment = (alignment+nb) % p;
+                // Update the Z1[* ,VR] information
+                const Int localWidth = nb/p;
+                readBuffer = &readBuffer[localWidth*n];
+                alignment = (alignment+nb) % p;
+            }
         }
+        paddedZ.Resize( n, k ); // We can simply shrink matrices
     }
-    paddedZ.Resize( n, k ); // We can simply shrink matrices
 
     // Backtransform the tridiagonal eigenvectors, Z
     herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, paddedZ );
@@ -335,19 +345,6 @@ void HermitianEig
     herm_eig::Sort( w, paddedZ, sort );
 }
 
-template<>
-void HermitianEig<float>
-( UpperOrLower uplo, DistMatrix<float>& A,
-  DistMatrix<float,VR,STAR>& w, DistMatrix<float>& paddedZ, SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
-template<>
-void HermitianEig<Complex<float>>
-( UpperOrLower uplo, DistMatrix<Complex<float>>& A,
-  DistMatrix<float,VR,STAR>& w, DistMatrix<Complex<float>>& paddedZ,
-  SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
 // Compute the eigenvalues within an inclusive index range
 // =======================================================
 
@@ -421,18 +418,6 @@ void HermitianEig
         Scale( 1/scale, w );
 }
 
-template<>
-void HermitianEig<float>
-( UpperOrLower uplo, DistMatrix<float >& A,
-  DistMatrix<float,VR,STAR>& w, Int il, Int iu, SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
-template<>
-void HermitianEig<Complex<float>>
-( UpperOrLower uplo, DistMatrix<Complex<float>>& A,
-  DistMatrix<float,VR,STAR>& w, Int il, Int iu, SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
 // Compute the eigenpairs within an inclusive index range
 // ======================================================
 
@@ -567,20 +552,6 @@ void HermitianEig
     herm_eig::Sort( w, paddedZ, sort );
 }
 
-template<>
-void HermitianEig<float>
-( UpperOrLower uplo, DistMatrix<float>& A,
-  DistMatrix<float,VR,STAR>& w, DistMatrix<float>& paddedZ,
-  Int il, Int iu, SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
-template<>
-void HermitianEig<Complex<float>>
-( UpperOrLower uplo, DistMatrix<Complex<float>>& A,
-  DistMatrix<float,VR,STAR>& w, DistMatrix<Complex<float>>& paddedZ,
-  Int il, Int iu, SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
 // Compute the eigenvalues within a half-open, (a,b], interval
 // ===========================================================
 
@@ -668,20 +639,6 @@ void HermitianEig
         Scale( 1/scale, w );
 }
 
-template<>
-void HermitianEig<float>
-( UpperOrLower uplo, DistMatrix<float>& A,
-  DistMatrix<float,VR,STAR>& w, float vl, float vu,
-  SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
-template<>
-void HermitianEig<Complex<float>>
-( UpperOrLower uplo, DistMatrix<Complex<float>>& A,
-  DistMatrix<float,VR,STAR>& w, float vl, float vu,
-  SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
 // Compute the eigenpairs with eigenvalues in a half-open, (a,b], interval
 // =======================================================================
 
@@ -841,20 +798,6 @@ void HermitianEig
     herm_eig::Sort( w, paddedZ, sort );
 }
 
-template<>
-void HermitianEig<float>
-( UpperOrLower uplo, DistMatrix<float>& A,
-  DistMatrix<float,VR,STAR>& w, DistMatrix<float>& paddedZ,
-  float vl, float vu, SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
-template<>
-void HermitianEig<Complex<float>>
-( UpperOrLower uplo, DistMatrix<Complex<float>>& A,
-  DistMatrix<float,VR,STAR>& w, DistMatrix<Complex<float>>& paddedZ,
-  float vl, float vu, SortType sort )
-{ LogicError("HermitianEig not yet implemented for float"); }
-
 // Full set of eigenvalues
 #define FULL_EIGVAL(F) \
   template void HermitianEig\
@@ -876,7 +819,7 @@ void HermitianEig<Complex<float>>
     SortType sort ); \
   template void HermitianEig\
   ( UpperOrLower uplo, DistMatrix<F>& A, DistMatrix<Base<F>,VR,STAR>& w,\
-    DistMatrix<F>& Z, SortType sort )
+    DistMatrix<F>& Z, SortType sort, HermitianTridiagEigAlg alg )
 // Integer range of eigenvalues
 #define INT_EIGVAL(F) \
   template void HermitianEig\
@@ -11,6 +11,7 @@
 
 #include ELEM_ZERO_INC
 #include ELEM_GEMV_INC
+#include ELEM_SYMV_INC
 #include ELEM_REFLECTOR_INC
 
 namespace elem {
@@ -342,94 +343,13 @@ void LPanSquare
         // Form the local portions of (A22 a21) into p21[MC,* ] and q21[MR,* ]:
         //   p21[MC,* ] := tril(A22)[MC,MR] a21[MR,* ]
         //   q21[MR,* ] := tril(A22,-1)'[MR,MC] a21[MC,* ]
-        if( A22.ColShift() > A22.RowShift() )
-        {
-            // We are below the diagonal, so we can multiply without an 
-            // offset for tril(A22)[MC,MR] and tril(A22,-1)'[MR,MC]
-            if( A22.LocalHeight() != 0 )
-            {
-                MemCopy
-                ( p21_MC_STAR.Buffer(),
-                  a21_MR_STAR.Buffer(), A22.LocalHeight() );
-                blas::Trmv
-                ( 'L', 'N', 'N', A22.LocalHeight(), A22.Buffer(), A22.LDim(), 
-                  p21_MC_STAR.Buffer(), 1 );
-            }
-            if( A22.LocalWidth() != 0 )
-            {
-                // Our local portion of q21[MR,* ] might be one entry longer 
-                // than A22.LocalHeight(), so go ahead and set the last entry 
-                // to 0.
-                F* q21_MR_STAR_Buffer = q21_MR_STAR.Buffer();
-                q21_MR_STAR_Buffer[A22.LocalWidth()-1] = 0;
-                MemCopy
-                ( q21_MR_STAR_Buffer, a21_MC_STAR.Buffer(), A22.LocalHeight() );
-                blas::Trmv
-                ( 'L', 'C', 'N', A22.LocalHeight(), A22.Buffer(), A22.LDim(),
-                  q21_MR_STAR_Buffer, 1 );
-            }
-        }
-        else if( A22.ColShift() < A22.RowShift() )
-        {
-            // We are above the diagonal, so we need to use an offset of +1
-            // for both tril(A22)[MC,MR] and tril(A22,-1)'[MR,MC]
-            const F* a21_MC_STAR_Buffer = a21_MC_STAR.Buffer();
-            const F* a21_MR_STAR_Buffer = a21_MR_STAR.Buffer();
-            const F* A22Buffer = A22.Buffer();
-            if( A22.LocalHeight() != 0 )
-            {
-                // The first entry of p21[MC,* ] will always be zero due to 
-                // the forced offset.
-                F* p21_MC_STAR_Buffer = p21_MC_STAR.Buffer();
-                p21_MC_STAR_Buffer[0] = 0;
-                MemCopy
-                ( &p21_MC_STAR_Buffer[1],
-                  a21_MR_STAR_Buffer, A22.LocalHeight()-1 );
-                blas::Trmv
-                ( 'L', 'N', 'N', A22.LocalHeight()-1, &A22Buffer[1], A22.LDim(),
-                  &p21_MC_STAR_Buffer[1], 1 );
-            }
-            if( A22.LocalWidth() != 0 )
-            {
-                // The last entry of q21[MR,* ] will be zero if the local
-                // height and width are equal.
-                F* q21_MR_STAR_Buffer = q21_MR_STAR.Buffer();
-                q21_MR_STAR_Buffer[A22.LocalWidth()-1] = 0;
-                MemCopy
-                ( q21_MR_STAR_Buffer,
-                  &a21_MC_STAR_Buffer[1], A22.LocalHeight()-1 );
-                blas::Trmv
-                ( 'L', 'C', 'N', A22.LocalHeight()-1, &A22Buffer[1], A22.LDim(),
-                  q21_MR_STAR_Buffer, 1 );
-            }
-        }
-        else
-        {
-            // We are on the diagonal, so we only need an offset of +1 for
-            // tril(A22,-1)'[MR,MC]
-            if( A22.LocalHeight() != 0 )
-            {
-                MemCopy
-                ( p21_MC_STAR.Buffer(),
-                  a21_MR_STAR.Buffer(), A22.LocalHeight() );
-                blas::Trmv
-                ( 'L', 'N', 'N', A22.LocalHeight(), A22.Buffer(), A22.LDim(), 
-                  p21_MC_STAR.Buffer(), 1 );
-
-                // The last entry of q21[MR,* ] will be zero if the local 
-                // height and width are equal.
-                const F* a21_MC_STAR_Buffer = a21_MC_STAR.Buffer();
-                const F* A22Buffer = A22.Buffer();
-                F* q21_MR_STAR_Buffer = q21_MR_STAR.Buffer();
-                q21_MR_STAR_Buffer[A22.LocalWidth()-1] = 0;
-                MemCopy
-                ( q21_MR_STAR_Buffer,
-                  &a21_MC_STAR_Buffer[1], A22.LocalHeight()-1 );
-                blas::Trmv
-                ( 'L', 'C', 'N', A22.LocalHeight()-1, &A22Buffer[1], A22.LDim(),
-                  q21_MR_STAR_Buffer, 1 );
-            }
-        }
+        // with a single (threaded) sweep over the local portion of tril(A22)
+        Zero( p21_MC_STAR );
+        Zero( q21_MR_STAR );
+        internal::LocalFusedSymv
+        ( LOWER, F(1), A22,
+          a21_MC_STAR.LockedBuffer(), 1, a21_MR_STAR.LockedBuffer(), 1,
+          p21_MC_STAR.Buffer(),       1, q21_MR_STAR.Buffer(),       1, true );
 
         x01_MR_STAR.AlignWith( W20B );
         y01_MR_STAR.AlignWith( W20B );
@@ -11,6 +11,7 @@
 
 #include ELEM_ZERO_INC
 #include ELEM_GEMV_INC
+#include ELEM_SYMV_INC
 #include ELEM_REFLECTOR_INC
 
 namespace elem {
@@ -321,98 +322,13 @@ void UPanSquare
         // Form the local portions of (A00 a01) into p01[MC,* ] and q01[MR,* ]:
         //   p01[MC,* ] := triu(A00)[MC,MR] a01[MR,* ]
         //   q01[MR,* ] := triu(A00,+1)'[MR,MC] a01[MC,* ]
-        if( A00.ColShift() < A00.RowShift() )
-        {
-            // We are above the diagonal, so we can multiply without an 
-            // offset for triu(A00)[MC,MR] and triu(A00,1)'[MR,MC]
-            if( A00.LocalHeight() != 0 )
-            {
-                // Our local portion of p01[MC,* ] might be one entry longer
-                // than A00.LocalWidth(), so go ahead and set the last entry
-                // to 0.
-                F* p01_MC_STAR_Buffer = p01_MC_STAR.Buffer();
-                p01_MC_STAR_Buffer[A00.LocalHeight()-1] = 0;
-                MemCopy
-                ( p01_MC_STAR.Buffer(), 
-                  a01_MR_STAR.Buffer(), A00.LocalWidth() );
-                blas::Trmv
-                ( 'U', 'N', 'N', A00.LocalWidth(), A00.Buffer(), A00.LDim(),
-                  p01_MC_STAR.Buffer(), 1 );
-            }
-            if( A00.LocalWidth() != 0 )
-            {
-                MemCopy
-                ( q01_MR_STAR.Buffer(),
-                  a01_MC_STAR.Buffer(), A00.LocalWidth() );
-                blas::Trmv
-                ( 'U', 'C', 'N', A00.LocalWidth(), A00.Buffer(), A00.LDim(),
-                  q01_MR_STAR.Buffer(), 1 );
-            }
-        }
-        else if( A00.ColShift() > A00.RowShift() )
-        {
-            // We are below the diagonal, so we need to use an offset 
-            // for both triu(A00)[MC,MR] and triu(A00,+1)'[MR,MC]
-            const F* a01_MC_STAR_Buffer = a01_MC_STAR.Buffer();
-            const F* a01_MR_STAR_Buffer = a01_MR_STAR.Buffer();
-            const F* A00Buffer = A00.Buffer();
-            if( A00.LocalHeight() != 0 )
-            {
-                // The last entry of p01[MC,* ] will be zero due to the forced
-                // offset
-                F* p01_MC_STAR_Buffer = p01_MC_STAR.Buffer();
-                p01_MC_STAR_Buffer[A00.LocalHeight()-1] = 0;
-                MemCopy
-                ( p01_MC_STAR_Buffer,
-                  &a01_MR_STAR_Buffer[1], A00.LocalWidth()-1 );
-                blas::Trmv
-                ( 'U', 'N', 'N', A00.LocalWidth()-1,
-                  &A00Buffer[A00.LDim()], A00.LDim(),
-                  p01_MC_STAR_Buffer, 1 );
-            }
-            if( A00.LocalWidth() != 0 )
-            {
-                // The first entry of q01[MR,* ] will be zero due to the forced
-                // offset
-                F* q01_MR_STAR_Buffer = q01_MR_STAR.Buffer();
-                q01_MR_STAR_Buffer[0] = 0;
-                MemCopy
-                ( &q01_MR_STAR_Buffer[1],
-                  a01_MC_STAR_Buffer, A00.LocalWidth()-1 );
-                blas::Trmv
-                ( 'U', 'C', 'N', A00.LocalWidth()-1,
-                  &A00Buffer[A00.LDim()], A00.LDim(),
-                  &q01_MR_STAR_Buffer[1], 1 );
-            }
-        }
-        else
-        {
-            // We are on the diagonal, so we only need an offset for
-            // triu(A00,+1)'[MR,MC]
-            if( A00.LocalWidth() != 0 )
-            {
-                MemCopy
-                ( p01_MC_STAR.Buffer(),
-                  a01_MR_STAR.Buffer(), A00.LocalHeight() );
-                blas::Trmv
-                ( 'U', 'N', 'N', A00.LocalHeight(), A00.Buffer(), A00.LDim(),
-                  p01_MC_STAR.Buffer(), 1 );
-
-                // The first entry of q01[MR,* ] must be zero due to the forced
-                // offset
-                const F* a01_MC_STAR_Buffer = a01_MC_STAR.Buffer();
-                const F* A00Buffer = A00.Buffer();
-                F* q01_MR_STAR_Buffer = q01_MR_STAR.Buffer();
-                q01_MR_STAR_Buffer[0] = 0;
-                MemCopy
-                ( &q01_MR_STAR_Buffer[1],
-                  a01_MC_STAR_Buffer, A00.LocalWidth()-1 );
-                blas::Trmv
-                ( 'U', 'C', 'N', A00.LocalWidth()-1,
-                  &A00Buffer[A00.LDim()], A00.LDim(),
-                  &q01_MR_STAR_Buffer[1], 1 );
-            }
-        }
+        // with a single (threaded) sweep over the local portion of triu(A00)
+        Zero( p01_MC_STAR );
+        Zero( q01_MR_STAR );
+        internal::LocalFusedSymv
+        ( UPPER, F(1), A00,
+          a01_MC_STAR.LockedBuffer(), 1, a01_MR_STAR.LockedBuffer(), 1,
+          p01_MC_STAR.Buffer(),       1, q01_MR_STAR.Buffer(),       1, true );
 
         x21_MR_STAR.AlignWith( A02T );
         y21_MR_STAR.AlignWith( A02T );
@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_AXPY_INC
+#include ELEM_CONJUGATE_INC
+#include ELEM_ENTRYWISEMAP_INC
+#include ELEM_ENTRYWISEREDUCE_INC
+#include ELEM_MAKEHERMITIAN_INC
+#include ELEM_MAKETRIANGULAR_INC
+#include ELEM_MAKETRAPEZOIDAL_INC
+#include ELEM_ENTRYWISENORM_INC
+#include ELEM_ENTRYWISEONENORM_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_MAXNORM_INC
+#include ELEM_ZERONORM_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestEntrywise
+( UpperOrLower uplo, Int m, Int n, Int offset, bool print, const Grid& g )
+{
+    typedef Base<F> Real;
+    const Real p = 3;
+    DistMatrix<F> A(g), B(g);
+    Uniform( A, m, n );
+    MakeTrapezoidal( LOWER, A, m/2 );
+    if( print )
+        Print( A, "A" );
+
+    // Brute-force the reductions from a redundant copy
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A );
+    const Matrix<F>& ALoc = A_STAR_STAR.LockedMatrix();
+    Real maxAbs=0, oneSum=0, pSum=0, trapSum=0;
+    Int numNonzeros=0;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const Real alpha = Abs(ALoc.Get(i,j));
+            maxAbs = Max( maxAbs, alpha );
+            oneSum += alpha;
+            pSum += Pow( alpha, p );
+            if( alpha != Real(0) )
+                ++numNonzeros;
+            if( (uplo==LOWER && i >= j-offset) ||
+                (uplo==UPPER && i <= j-offset) )
+                trapSum += alpha;
+        }
+    }
+    const Real trapSumEngine = EntrywiseReduce
+    ( uplo, A, Real(0), []( F alpha ) { return Abs(alpha); },
+      SumReduction<Real>(), offset );
+
+    // Compare the Hermitian variants against the explicit Hermitian matrix
+    Real hermOneError=0, hermPError=0, hermMaxError=0;
+    if( m == n )
+    {
+        B = A;
+        MakeTriangular( uplo, B );
+        MakeHermitian( uplo, B );
+        hermOneError =
+            Abs(HermitianEntrywiseOneNorm(uplo,B)-EntrywiseOneNorm(B));
+        hermPError =
+            Abs(HermitianEntrywiseNorm(uplo,B,p)-EntrywiseNorm(B,p));
+        hermMaxError = Abs(HermitianMaxNorm(uplo,B)-MaxNorm(B));
+    }
+
+    // Conjugate twice, with the second time being out-of-place
+    Conjugate( A, B );
+    Conjugate( B );
+    Axpy( F(-1), A, B );
+    const Real conjError = FrobeniusNorm( B );
+
+    // Zero the trapezoid in place and check the remainder
+    B = A;
+    EntrywiseMap( uplo, B, []( F alpha ) { return F(0); }, offset );
+    const Real remainder = EntrywiseOneNorm( B );
+
+    const Real maxError = Abs(MaxNorm(A)-maxAbs);
+    const Real oneError = Abs(EntrywiseOneNorm(A)-oneSum);
+    const Real pError = Abs(EntrywiseNorm(A,p)-Pow(pSum,1/p));
+    const Int nnzError = ZeroNorm(A)-numNonzeros;
+    if( g.Rank() == 0 )
+        cout << "  |MaxNorm - max|          = " << maxError << "\n"
+             << "  |EntrywiseOneNorm - sum| = " << oneError << "\n"
+             << "  |EntrywiseNorm - p-norm| = " << pError << "\n"
+             << "  ZeroNorm - nnz           = " << nnzError << "\n"
+             << "  trapezoidal sum error    = " << Abs(trapSumEngine-trapSum)
+             << "\n"
+             << "  remainder error          = "
+             << Abs(remainder-(oneSum-trapSum)) << "\n"
+             << "  Hermitian one-norm error = " << hermOneError << "\n"
+             << "  Hermitian p-norm error   = " << hermPError << "\n"
+             << "  Hermitian max-norm error = " << hermMaxError << "\n"
+             << "  conjugation error        = " << conjError << "\n"
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int offset = Input("--offset","trapezoidal offset",-3);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestEntrywise<double>( uplo, m, n, offset, print, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestEntrywise<Complex<double>>( uplo, m, n, offset, print, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_AXPY_INC
+#include ELEM_FUSED_INC
+#include ELEM_HADAMARD_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_SOFTTHRESHOLD_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+// Apply the scalar soft-threshold entry by entry so that the reference does
+// not route through the fused engine being tested
+template<typename F>
+void EntrywiseSoftThreshold( Matrix<F>& A, Base<F> tau )
+{
+    const Int height = A.Height();
+    const Int width = A.Width();
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            A.Set( i, j, SoftThreshold(A.Get(i,j),tau) );
+}
+
+template<typename F>
+void TestFused( Int m, Int n, Base<F> tau, bool print, const Grid& g )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), B(g), C(g), D(g), DRef(g), T(g);
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    Uniform( C, m, n );
+    const F alpha = F(2);
+
+    // D := ST_tau(A - B + C/alpha) in a single sweep
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting fused evaluation...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    fused::Evaluate
+    ( fused::SoftThreshold
+      ( fused::Ref(A)-fused::Ref(B)+fused::Ref(C)/alpha, tau ), D );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. Time = " << runTime << " seconds." << endl;
+    if( print )
+        Print( D, "D" );
+
+    // Compare against the separate passes
+    DRef = A;
+    Axpy( F(-1), B, DRef );
+    Axpy( F(1)/alpha, C, DRef );
+    EntrywiseSoftThreshold( DRef.Matrix(), tau );
+    Axpy( F(-1), D, DRef );
+    const Real error = FrobeniusNorm( DRef );
+
+    // Overwrite an operand with the entrywise product A .* (A + B)
+    Hadamard( A, B, T );
+    Hadamard( A, A, DRef );
+    Axpy( F(1), T, DRef );
+    fused::Evaluate
+    ( fused::Hadamard( fused::Ref(A), fused::Ref(A)+fused::Ref(B) ), A );
+    Axpy( F(-1), A, DRef );
+    const Real aliasError = FrobeniusNorm( DRef );
+
+    // Repeat the first test with the local matrices
+    Matrix<F> DLoc;
+    fused::Evaluate
+    ( fused::SoftThreshold
+      ( fused::Ref(B.Matrix())-fused::Ref(C.Matrix()), tau ), DLoc );
+    Matrix<F> DLocRef( B.Matrix() );
+    Axpy( F(-1), C.Matrix(), DLocRef );
+    EntrywiseSoftThreshold( DLocRef, tau );
+    Axpy( F(-1), DLoc, DLocRef );
+    const Real localError =
+        mpi::AllReduce( FrobeniusNorm( DLocRef ), mpi::MAX, g.Comm() );
+
+    if( g.Rank() == 0 )
+        cout << "  || D - DRef ||_F           = " << error << "\n"
+             << "  || aliased - reference ||_F = " << aliasError << "\n"
+             << "  max local error             = " << localError << "\n"
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const double tau = Input("--tau","soft-threshold parameter",0.5);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestFused<double>( m, n, tau, print, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestFused<Complex<double>>( m, n, tau, print, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_MAKETRAPEZOIDAL_INC
+#include ELEM_UPDATEDIAGONAL_INC
+#include ELEM_AXPY_INC
+#include ELEM_GEMM_INC
+#include ELEM_MULTISHIFTQUASITRSM_INC
+#include ELEM_INFINITYNORM_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+// Test if (op(U) - mu_j I) x_j = alpha y_j for each j by checking the norm
+// of op(U) X - X op(Mu) - alpha Y
+template<typename Real>
+void TestCorrectness
+( Orientation orientation, Complex<Real> alpha, const DistMatrix<Real>& U,
+  const DistMatrix<Complex<Real>,VR,STAR>& shifts,
+  const DistMatrix<Complex<Real> >& X, const DistMatrix<Complex<Real> >& Y,
+  bool print )
+{
+    typedef Complex<Real> C;
+    const Int m = X.Height();
+    const Int n = X.Width();
+
+    DistMatrix<C> UCpx( U.Grid() );
+    UCpx.AlignWith( U );
+    UCpx.Resize( m, m );
+    for( Int jLoc=0; jLoc<U.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<U.LocalHeight(); ++iLoc )
+            UCpx.SetLocal( iLoc, jLoc, U.GetLocal(iLoc,jLoc) );
+
+    DistMatrix<C> Z( Y );
+    Scale( alpha, Z );
+    for( Int j=0; j<n; ++j )
+    {
+        auto x = LockedView( X, 0, j, m, 1 );
+        auto z =       View( Z, 0, j, m, 1 );
+        const C mu = shifts.Get(j,0);
+        Axpy( orientation==ADJOINT ? Conj(mu) : mu, x, z );
+    }
+    Gemm( orientation, NORMAL, C(-1), UCpx, X, C(1), Z );
+    if( print )
+        Print( Z, "-op(U) X + X op(Mu) + alpha Y" );
+
+    const Real UFrob = FrobeniusNorm( U );
+    const Real YFrob = FrobeniusNorm( Y );
+    const Real ZFrob = FrobeniusNorm( Z );
+    const Real ZInf = InfinityNorm( Z );
+    if( U.Grid().Rank() == 0 )
+    {
+        cout << "    || U ||_F  = " << UFrob << "\n"
+             << "    || Y ||_F  = " << YFrob << "\n"
+             << "    || op(U) X - X op(Mu) - alpha Y ||_F  = " << ZFrob
+             << "\n"
+             << "    || op(U) X - X op(Mu) - alpha Y ||_oo = " << ZInf
+             << "\n" << endl;
+    }
+}
+
+template<typename Real>
+void TestMultiShiftQuasiTrsm
+( bool testCorrectness, bool print, Orientation orientation,
+  Int m, Int n, Complex<Real> alpha, const Grid& g )
+{
+    typedef Complex<Real> C;
+    DistMatrix<Real> U(g);
+    DistMatrix<C> X(g), Y(g);
+    DistMatrix<C,VR,STAR> shifts(g);
+
+    // Form an upper quasi-triangular matrix with a 2x2 diagonal block
+    // starting at every third index
+    Uniform( U, m, m );
+    MakeTrapezoidal( UPPER, U, -1 );
+    for( Int i=0; i<m-1; ++i )
+        if( i % 3 != 0 )
+            U.Set( i+1, i, Real(0) );
+    UpdateDiagonal( U, Real(5) ); // ensure that U-mu is far from singular
+    Uniform( Y, m, n );
+    Uniform( shifts, n, 1 );
+    X = Y;
+
+    if( print )
+    {
+        Print( U, "U" );
+        Print( shifts, "shifts" );
+        Print( Y, "Y" );
+    }
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting MultiShiftQuasiTrsm...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    MultiShiftQuasiTrsm( LEFT, UPPER, orientation, alpha, U, shifts, X );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    const double gFlops = 2.*double(m)*double(m)*double(n)/(1.e9*runTime);
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. \n"
+             << "  Time = " << runTime << " seconds. GFlops = " << gFlops
+             << endl;
+    }
+    if( print )
+        Print( X, "X after solve" );
+    if( testCorrectness )
+        TestCorrectness( orientation, alpha, U, shifts, X, Y, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        Int r = Input("--r","height of process grid",0);
+        const char transChar = Input
+            ("--trans","orientation of quasi-triangular matrix: N/T/C",'N');
+        const Int m = Input("--m","height of result",100);
+        const Int n = Input("--n","number of shifts",100);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        const Orientation orientation = CharToOrientation( transChar );
+        SetBlocksize( nb );
+
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test MultiShiftQuasiTrsm LU" << transChar << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestMultiShiftQuasiTrsm<double>
+        ( testCorrectness, print, orientation, m, n, Complex<double>(3), g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_MAKETRIANGULAR_INC
+#include ELEM_UPDATEDIAGONAL_INC
+#include ELEM_AXPY_INC
+#include ELEM_GEMM_INC
+#include ELEM_MULTISHIFTTRSM_INC
+#include ELEM_INFINITYNORM_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+// Test if (op(U) - mu_j I) x_j = alpha y_j for each j by checking the norm
+// of op(U) X - X op(Mu) - alpha Y
+template<typename F>
+void TestCorrectness
+( Orientation orientation, F alpha, const DistMatrix<F>& U,
+  const DistMatrix<F,VR,STAR>& shifts, const DistMatrix<F>& X,
+  const DistMatrix<F>& Y, bool print )
+{
+    typedef Base<F> Real;
+    const Int m = X.Height();
+    const Int n = X.Width();
+
+    DistMatrix<F> Z( Y );
+    Scale( alpha, Z );
+    for( Int j=0; j<n; ++j )
+    {
+        auto x = LockedView( X, 0, j, m, 1 );
+        auto z =       View( Z, 0, j, m, 1 );
+        const F mu = shifts.Get(j,0);
+        Axpy( orientation==ADJOINT ? Conj(mu) : mu, x, z );
+    }
+    Gemm( orientation, NORMAL, F(-1), U, X, F(1), Z );
+    if( print )
+        Print( Z, "-op(U) X + X op(Mu) + alpha Y" );
+
+    const Real UFrob = FrobeniusNorm( U );
+    const Real YFrob = FrobeniusNorm( Y );
+    const Real ZFrob = FrobeniusNorm( Z );
+    const Real ZInf = InfinityNorm( Z );
+    if( U.Grid().Rank() == 0 )
+    {
+        cout << "    || U ||_F  = " << UFrob << "\n"
+             << "    || Y ||_F  = " << YFrob << "\n"
+             << "    || op(U) X - X op(Mu) - alpha Y ||_F  = " << ZFrob
+             << "\n"
+             << "    || op(U) X - X op(Mu) - alpha Y ||_oo = " << ZInf
+             << "\n" << endl;
+    }
+}
+
+template<typename F>
+void TestMultiShiftTrsm
+( bool testCorrectness, bool print, Orientation orientation,
+  Int m, Int n, F alpha, const Grid& g )
+{
+    DistMatrix<F> U(g), X(g), Y(g);
+    DistMatrix<F,VR,STAR> shifts(g);
+
+    Uniform( U, m, m );
+    MakeTriangular( UPPER, U );
+    UpdateDiagonal( U, F(5) ); // ensure that U-mu is far from singular
+    Uniform( Y, m, n );
+    Uniform( shifts, n, 1 );
+    X = Y;
+
+    if( print )
+    {
+        Print( U, "U" );
+        Print( shifts, "shifts" );
+        Print( Y, "Y" );
+    }
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting MultiShiftTrsm...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    MultiShiftTrsm( LEFT, UPPER, orientation, alpha, U, shifts, X );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    const double realGFlops = double(m)*double(m)*double(n)/(1.e9*runTime);
+    const double gFlops = ( IsComplex<F>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "DONE. \n"
+             << "  Time = " << runTime << " seconds. GFlops = " << gFlops
+             << endl;
+    }
+    if( print )
+        Print( X, "X after solve" );
+    if( testCorrectness )
+        TestCorrectness( orientation, alpha, U, shifts, X, Y, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        Int r = Input("--r","height of process grid",0);
+        const char transChar = Input
+            ("--trans","orientation of triangular matrix: N/T/C",'N');
+        const Int m = Input("--m","height of result",100);
+        const Int n = Input("--n","number of shifts",100);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        const Orientation orientation = CharToOrientation( transChar );
+        SetBlocksize( nb );
+
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test MultiShiftTrsm LU" << transChar << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestMultiShiftTrsm<double>
+        ( testCorrectness, print, orientation, m, n, 3., g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestMultiShiftTrsm<Complex<double>>
+        ( testCorrectness, print, orientation, m, n, Complex<double>(3), g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
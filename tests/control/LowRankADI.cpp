@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_LAPLACIAN_INC
+#include ELEM_UNIFORM_INC
+#include "elemental/control.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& Z )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+
+    // Form E := A Z Z^H + Z Z^H A^H - B B^H
+    DistMatrix<F> X(g), E(g), AX(g);
+    Zeros( X, n, n );
+    Zeros( E, n, n );
+    Herk( LOWER, NORMAL, F(1), Z, F(0), X );
+    MakeHermitian( LOWER, X );
+    Herk( LOWER, NORMAL, F(-1), B, F(0), E );
+    MakeHermitian( LOWER, E );
+    Gemm( NORMAL, NORMAL, F(1), A, X, AX );
+    Axpy( F(1), AX, E );
+    Adjoint( AX, X );
+    Axpy( F(1), X, E );
+    DistMatrix<F> BBAdj(g);
+    Zeros( BBAdj, n, n );
+    Herk( LOWER, NORMAL, F(1), B, F(0), BBAdj );
+    const Real frobBBAdj = HermitianFrobeniusNorm( LOWER, BBAdj );
+    const Real frobE = FrobeniusNorm( E );
+    if( g.Rank() == 0 )
+        cout << "    || A Z Z^H + Z Z^H A^H - B B^H ||_F / || B B^H ||_F = "
+             << frobE/frobBBAdj << endl;
+}
+
+template<typename F>
+void TestCorrectness
+( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& Z )
+{
+    typedef Base<F> Real;
+    const Int n = A.Height();
+
+    // Form E := A Z Z^H + Z Z^H A^H - B B^H
+    Matrix<F> X, E, AX;
+    Zeros( X, n, n );
+    Zeros( E, n, n );
+    Herk( LOWER, NORMAL, F(1), Z, F(0), X );
+    MakeHermitian( LOWER, X );
+    Herk( LOWER, NORMAL, F(-1), B, F(0), E );
+    MakeHermitian( LOWER, E );
+    Gemm( NORMAL, NORMAL, F(1), A, X, AX );
+    Axpy( F(1), AX, E );
+    Adjoint( AX, X );
+    Axpy( F(1), X, E );
+    Matrix<F> BBAdj;
+    Zeros( BBAdj, n, n );
+    Herk( LOWER, NORMAL, F(1), B, F(0), BBAdj );
+    const Real frobBBAdj = HermitianFrobeniusNorm( LOWER, BBAdj );
+    const Real frobE = FrobeniusNorm( E );
+    if( mpi::WorldRank() == 0 )
+        cout << "    || A Z Z^H + Z Z^H A^H - B B^H ||_F / || B B^H ||_F = "
+             << frobE/frobBBAdj << endl;
+}
+
+template<typename F>
+void TestLowRankADI
+( bool testCorrectness, bool progress, Int nx, Int ny, Int k,
+  Int numShifts, const Grid& g )
+{
+    DistMatrix<F> A(g), B(g), Z(g);
+    Laplacian( A, nx, ny );
+    Uniform( B, nx*ny, k );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting low-rank ADI...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    const Int numIts =
+        lyapunov::LowRankADI( A, B, Z, numShifts, 100, Base<F>(0), progress );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n  Time = " << runTime << " seconds.\n"
+             << "  Iterations = " << numIts << ", width of Z = " << Z.Width()
+             << endl;
+    if( testCorrectness )
+        TestCorrectness( A, B, Z );
+
+    // Each process redundantly runs the sequential implementation
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    Matrix<F> ZSeq;
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting sequential low-rank ADI...";
+        cout.flush();
+    }
+    const Int numItsSeq = lyapunov::LowRankADI
+    ( A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix(), ZSeq,
+      numShifts, 100, Base<F>(0) );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n  Iterations = " << numItsSeq << ", width of Z = "
+             << ZSeq.Width() << endl;
+    if( testCorrectness )
+        TestCorrectness
+        ( A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix(), ZSeq );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const Int nx = Input("--nx","size of the grid in x",20);
+        const Int ny = Input("--ny","size of the grid in y",20);
+        const Int k = Input("--k","rank of the right-hand side",2);
+        const Int numShifts = Input("--numShifts","number of ADI shifts",10);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test low-rank ADI for A X + X A^H = B B^H" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestLowRankADI<double>
+        ( testCorrectness, progress, nx, ny, k, numShifts, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestLowRankADI<Complex<double>>
+        ( testCorrectness, progress, nx, ny, k, numShifts, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_UPDATEDIAGONAL_INC
+#include ELEM_UNIFORM_INC
+#include "elemental/control.hpp"
+using namespace std;
+using namespace elem;
+
+// Returns || A X + X B - C ||_F / || C ||_F
+template<typename F>
+Base<F> Residual
+( const Matrix<F>& A, const Matrix<F>& B, const Matrix<F>& C,
+  const Matrix<F>& X )
+{
+    Matrix<F> E( C );
+    Gemm( NORMAL, NORMAL, F(1), A, X, F(-1), E );
+    Gemm( NORMAL, NORMAL, F(1), X, B, F(1), E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( C );
+}
+
+template<typename F>
+Base<F> Residual
+( const DistMatrix<F>& A, const DistMatrix<F>& B, const DistMatrix<F>& C,
+  const DistMatrix<F>& X )
+{
+    DistMatrix<F> E( C );
+    Gemm( NORMAL, NORMAL, F(1), A, X, F(-1), E );
+    Gemm( NORMAL, NORMAL, F(1), X, B, F(1), E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( C );
+}
+
+template<typename F>
+void TestSylvester( bool print, Int m, Int n, const Grid& g )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g), B(g), C(g), X(g), AAdj(g);
+    // Shift the spectra of A and B into the right half-plane so that the
+    // spectra of A and -B are well-separated
+    Uniform( A, m, m );
+    Uniform( B, n, n );
+    Uniform( C, m, n );
+    UpdateDiagonal( A, F(m) );
+    UpdateDiagonal( B, F(n) );
+    if( print )
+    {
+        Print( A, "A" );
+        Print( B, "B" );
+        Print( C, "C" );
+    }
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting distributed Bartels-Stewart Sylvester solve...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    sylvester::BartelsStewart( A, B, C, X );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    Real residual = Residual( A, B, C, X );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n  Time = " << runTime << " seconds.\n"
+             << "    || A X + X B - C ||_F / || C ||_F = " << residual
+             << endl;
+    if( print )
+        Print( X, "X" );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting distributed Bartels-Stewart Lyapunov solve...";
+        cout.flush();
+    }
+    DistMatrix<F> D(g);
+    Uniform( D, m, m );
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    lyapunov::BartelsStewart( A, D, X );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    Adjoint( A, AAdj );
+    residual = Residual( A, AAdj, D, X );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n  Time = " << runTime << " seconds.\n"
+             << "    || A X + X A^H - C ||_F / || C ||_F = " << residual
+             << endl;
+
+    // Every process redundantly solves the sequential problems, which, for
+    // real data, exercises the quasi-triangular kernels
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+                            C_STAR_STAR( C ), D_STAR_STAR( D );
+    Matrix<F> XLoc, AAdjLoc;
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting sequential Bartels-Stewart Sylvester solve...";
+        cout.flush();
+    }
+    startTime = mpi::Time();
+    sylvester::BartelsStewart
+    ( A_STAR_STAR.Matrix(), B_STAR_STAR.Matrix(), C_STAR_STAR.Matrix(), XLoc );
+    runTime = mpi::Time() - startTime;
+    residual =
+        Residual
+        ( A_STAR_STAR.Matrix(), B_STAR_STAR.Matrix(), C_STAR_STAR.Matrix(),
+          XLoc );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n  Time = " << runTime << " seconds.\n"
+             << "    || A X + X B - C ||_F / || C ||_F = " << residual
+             << endl;
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting sequential Bartels-Stewart Lyapunov solve...";
+        cout.flush();
+    }
+    startTime = mpi::Time();
+    lyapunov::BartelsStewart
+    ( A_STAR_STAR.Matrix(), D_STAR_STAR.Matrix(), XLoc );
+    runTime = mpi::Time() - startTime;
+    Adjoint( A_STAR_STAR.Matrix(), AAdjLoc );
+    residual =
+        Residual( A_STAR_STAR.Matrix(), AAdjLoc, D_STAR_STAR.Matrix(), XLoc );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n  Time = " << runTime << " seconds.\n"
+             << "    || A X + X A^H - C ||_F / || C ||_F = " << residual
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of X",100);
+        const Int n = Input("--n","width of X",80);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test Bartels-Stewart solvers" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestSylvester<double>( print, m, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestSylvester<Complex<double>>( print, m, n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_AXPY_INC
+#include ELEM_GEMM_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_SVT_INC
+#include ELEM_GAUSSIAN_INC
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestPartialSVT
+( bool print, Int m, Int n, Int r, Int numSteps, const Grid& g,
+  Base<F> tau, Base<F> noise )
+{
+    typedef Base<F> Real;
+
+    // A := X Y^H + noise * N, where X and Y have r columns
+    DistMatrix<F> X(g), Y(g), A(g);
+    Gaussian( X, m, r );
+    Gaussian( Y, n, r );
+    Gaussian( A, m, n );
+    Scale( noise, A );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, F(1), A );
+    if( print )
+        Print( A, "A" );
+
+    // Repeatedly threshold small perturbations of A so that the warm start
+    // from the previous subspace is exercised
+    DistMatrix<F> V(g), B(g), BNormal(g), E(g);
+    for( Int step=0; step<numSteps; ++step )
+    {
+        if( step > 0 )
+        {
+            Gaussian( E, m, n );
+            Axpy( noise, E, A );
+        }
+
+        B = A;
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        const Int rank = svt::Partial( B, tau, V );
+        mpi::Barrier( g.Comm() );
+        const double runTime = mpi::Time() - startTime;
+
+        BNormal = A;
+        const Int rankNormal = svt::Normal( BNormal, tau );
+        Axpy( F(-1), B, BNormal );
+        const Real BFrob = FrobeniusNorm( B );
+        const Real errorFrob = FrobeniusNorm( BNormal );
+        if( g.Rank() == 0 )
+            cout << "  step " << step << ": time = " << runTime
+                 << " seconds, rank = " << rank
+                 << ", full rank = " << rankNormal << "\n"
+                 << "    || B ||_F = " << BFrob << "\n"
+                 << "    || B - BNormal ||_F = " << errorFrob << endl;
+        if( print )
+            Print( B, "B" );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",80);
+        const Int r = Input("--rank","rank of the dominant part",5);
+        const Int numSteps = Input("--numSteps","number of thresholds",3);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const double tau = Input("--tau","soft-threshold parameter",1.);
+        const double noise = Input("--noise","noise level",0.01);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestPartialSVT<double>( print, m, n, r, numSteps, g, tau, noise );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestPartialSVT<Complex<double>>
+        ( print, m, n, r, numSteps, g, tau, noise );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
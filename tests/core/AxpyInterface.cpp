@@ -9,6 +9,7 @@
 */
 // NOTE: It is possible to simply include "elemental.hpp" instead
 #include "elemental-lite.hpp"
+#include ELEM_MAXNORM_INC
 #include ELEM_ZEROS_INC
 using namespace elem;
 
@@ -22,6 +23,11 @@ main( int argc, char* argv[] )
 
     try 
     {
+        const bool oneSided = Input("--oneSided","try one-sided RMA?",false);
+        ProcessInput();
+        PrintInputReport();
+        SetAxpyInterfaceOneSided( oneSided );
+
         const Int m = 3*commSize;
         const Int n = 2*commSize;
 
@@ -60,9 +66,23 @@ main( int argc, char* argv[] )
             interface.Detach();
 
             if( commRank == 0 )
+            {
                 Print( Y, "Copy of global matrix on root process:" );
 
-            // TODO: Check to ensure that the result is correct
+                // Each process added ten copies of its rank plus one into
+                // columns rank and rank+1 of rows 2*rank:2*rank+commSize-1
+                for( Int q=0; q<commSize; ++q )
+                {
+                    for( Int i=2*q; i<2*q+commSize; ++i )
+                    {
+                        Y.Update( i, q,   -10*(q+1) );
+                        Y.Update( i, q+1, -10*(q+1) );
+                    }
+                }
+                const double error = MaxNorm( Y );
+                if( error != 0 )
+                    LogicError("Copy was off by as much as ",error);
+            }
         }
     }
     catch( std::exception& e ) { ReportException(e); }
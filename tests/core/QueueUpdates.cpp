@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_IO_INC
+#include ELEM_UNIFORM_INC
+#include ELEM_ZEROS_INC
+using namespace elem;
+
+// Every process queues a pseudo-random set of updates to arbitrary entries,
+// as well as an overwrite of the top-left entry, so that the result can be
+// formed redundantly on every process
+template<typename T,Dist U,Dist V>
+void
+Check( DistMatrix<T,U,V>& A, Int m, Int n, Int numUpdates, bool print )
+{
+    DEBUG_ONLY(CallStackEntry cse("Check"))
+    const Grid& g = A.Grid();
+    const Int commRank = g.Rank();
+    const Int commSize = g.Size();
+    if( commRank == 0 )
+    {
+        std::cout << "Testing [" << DistToString(U) << ","
+                                 << DistToString(V) << "]...";
+        std::cout.flush();
+    }
+    Int colAlign = SampleUniform<Int>(0,A.ColStride());
+    Int rowAlign = SampleUniform<Int>(0,A.RowStride());
+    mpi::Broadcast( colAlign, 0, mpi::COMM_WORLD );
+    mpi::Broadcast( rowAlign, 0, mpi::COMM_WORLD );
+    A.Align( colAlign, rowAlign );
+    Zeros( A, m, n );
+    // Ensure that the overwrite is applied before the updates
+    A.QueueUpdate( 0, 0, T(1) );
+
+    Matrix<T> B;
+    Zeros( B, m, n );
+    B.Set( 0, 0, T(commSize) );
+    A.Reserve( numUpdates, 1 );
+    for( Int q=0; q<commSize; ++q )
+    {
+        for( Int k=0; k<numUpdates; ++k )
+        {
+            const Int i = (7*q+13*k) % m;
+            const Int j = (5*q+3*k*k) % n;
+            const T value = T(q+k%3+1);
+            if( q == commRank )
+                A.QueueUpdate( i, j, value );
+            B.Update( i, j, value );
+        }
+        B.Update( 0, 0, T(1) );
+    }
+    A.QueueSet( 0, 0, T(commRank+1) );
+    A.ProcessQueues();
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Int myErrorFlag = 0;
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( A_STAR_STAR.GetLocal(i,j) != B.Get(i,j) )
+                myErrorFlag = 1;
+    const Int summedErrorFlag = mpi::AllReduce( myErrorFlag, g.Comm() );
+    if( summedErrorFlag == 0 )
+    {
+        if( commRank == 0 )
+            std::cout << "PASSED" << std::endl;
+    }
+    else
+    {
+        if( commRank == 0 )
+            std::cout << "FAILED" << std::endl;
+        if( print )
+            Print( A, "A" );
+        if( print && commRank == 0 )
+            Print( B, "B" );
+    }
+}
+
+template<typename T>
+void
+QueueUpdatesTest( Int m, Int n, Int numUpdates, const Grid& g, bool print )
+{
+    DEBUG_ONLY(CallStackEntry cse("QueueUpdatesTest"))
+    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC(g);
+    DistMatrix<T,MC,  MR  > A_MC_MR(g);
+    DistMatrix<T,MC,  STAR> A_MC_STAR(g);
+    DistMatrix<T,MD,  STAR> A_MD_STAR(g);
+    DistMatrix<T,MR,  MC  > A_MR_MC(g);
+    DistMatrix<T,STAR,MC  > A_STAR_MC(g);
+    DistMatrix<T,STAR,VR  > A_STAR_VR(g);
+    DistMatrix<T,VC,  STAR> A_VC_STAR(g);
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+
+    Check( A_CIRC_CIRC, m, n, numUpdates, print );
+    Check( A_MC_MR,     m, n, numUpdates, print );
+    Check( A_MC_STAR,   m, n, numUpdates, print );
+    Check( A_MD_STAR,   m, n, numUpdates, print );
+    Check( A_MR_MC,     m, n, numUpdates, print );
+    Check( A_STAR_MC,   m, n, numUpdates, print );
+    Check( A_STAR_VR,   m, n, numUpdates, print );
+    Check( A_VC_STAR,   m, n, numUpdates, print );
+    Check( A_STAR_STAR, m, n, numUpdates, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",50);
+        const Int numUpdates =
+            Input("--numUpdates","number of updates per process",1000);
+        const bool print = Input("--print","print wrong matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+
+        if( commRank == 0 )
+        {
+            std::cout << "---------------------\n"
+                      << "Testing with doubles:\n"
+                      << "---------------------" << std::endl;
+        }
+        QueueUpdatesTest<double>( m, n, numUpdates, g, print );
+
+        if( commRank == 0 )
+        {
+            std::cout << "--------------------------------------\n"
+                      << "Testing with double-precision complex:\n"
+                      << "--------------------------------------" << std::endl;
+        }
+        QueueUpdatesTest<Complex<double>>( m, n, numUpdates, g, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,194 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+// Return the offset of the first entry of a text file
+mpi::Offset DataOffset( const string filename, FileFormat format )
+{
+    ifstream file( filename.c_str(), ios::binary );
+    if( format == MATRIX_MARKET )
+        return ascii::ReadMatrixMarketHeader( file ).dataOffset;
+    else
+        return ascii::DataOffset( file, format == ASCII_MATLAB );
+}
+
+// Count the boundaries between the byte ranges which the processes of a
+// communicator of size commSize load that fall strictly inside of a row
+Int NumStraddles( const string filename, FileFormat format, int commSize )
+{
+    const mpi::Offset offset = DataOffset( filename, format );
+    ifstream file( filename.c_str(), ios::binary );
+    const string text
+    ( (istreambuf_iterator<char>(file)), istreambuf_iterator<char>() );
+    const mpi::Offset length =
+        Max( mpi::Offset(text.size())-offset, mpi::Offset(0) );
+    const bool semicolons = ( format == ASCII_MATLAB );
+    Int numStraddles = 0;
+    for( int q=1; q<commSize; ++q )
+    {
+        const mpi::Offset rangeBeg = offset + (length*q)/commSize;
+        if( rangeBeg > offset && rangeBeg < offset+length &&
+            !ascii::IsRowEnd(text[rangeBeg-1],semicolons) )
+            ++numStraddles;
+    }
+    return numStraddles;
+}
+
+template<typename T,Dist U,Dist V>
+void CheckEqual
+( const DistMatrix<T,STAR,STAR>& A, const DistMatrix<T,U,V>& B,
+  const string desc )
+{
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        LogicError(desc,": read a ",B.Height()," x ",B.Width(),
+                   " matrix instead of ",A.Height()," x ",A.Width());
+    DistMatrix<T,STAR,STAR> B_STAR_STAR( B );
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( B_STAR_STAR.GetLocal(i,j) != A.GetLocal(i,j) )
+                LogicError(desc,": entry ",i,",",j," changed");
+}
+
+// Write an m x n matrix and read it back sequentially, on a single process,
+// and on all processes in a few distributions. Returns the number of
+// boundaries between the byte ranges of the processes which fell inside of
+// a row.
+template<typename T>
+Int RoundTrip( Int m, Int n, FileFormat format, const string basename )
+{
+    typedef Base<T> Real;
+    const Grid& g = DefaultGrid();
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    // Entries with large and small exponents should also be recovered exactly
+    A.Set( 0, n-1, T(Real(1.2345678901234567e300)) );
+    A.Set( m-1, 0, T(Real(-9.8765432109876543e-300)) );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+
+    Write( A, basename, format );
+    const string filename = basename + "." + FileExtension(format);
+    mpi::Barrier( mpi::COMM_WORLD );
+
+    Matrix<T> BSeq;
+    Read( BSeq, filename, format );
+    DistMatrix<T,STAR,STAR> BSeq_STAR_STAR( BSeq.Height(), BSeq.Width(), g );
+    BSeq_STAR_STAR.Matrix() = BSeq;
+    CheckEqual( A_STAR_STAR, BSeq_STAR_STAR, "Sequential read" );
+
+    const Grid gSelf( mpi::COMM_SELF );
+    DistMatrix<T> BSelf(gSelf);
+    Read( BSelf, filename, format );
+    if( BSelf.Height() != m || BSelf.Width() != n )
+        LogicError("Single-process read has the wrong dimensions");
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( BSelf.GetLocal(i,j) != A_STAR_STAR.GetLocal(i,j) )
+                LogicError("Single-process read changed entry ",i,",",j);
+
+    DistMatrix<T> B(g);
+    Read( B, filename, format );
+    CheckEqual( A_STAR_STAR, B, "[MC,MR] read" );
+
+    DistMatrix<T,VC,STAR> B_VC_STAR(g);
+    B_VC_STAR.Align( g.Size()-1, 0 );
+    Read( B_VC_STAR, filename, format );
+    CheckEqual( A_STAR_STAR, B_VC_STAR, "[VC,* ] read" );
+
+    Int numStraddles = 0;
+    if( mpi::WorldRank() == 0 )
+        numStraddles = NumStraddles( filename, format, g.Size() );
+    mpi::Broadcast( numStraddles, 0, mpi::COMM_WORLD );
+    if( mpi::WorldRank() == 0 )
+        std::remove( filename.c_str() );
+    return numStraddles;
+}
+
+template<typename T>
+void TestFormat( Int m, Int n, FileFormat format, const string basename )
+{
+    const int commSize = mpi::CommSize( mpi::COMM_WORLD );
+    Int numStraddles = 0;
+
+    // A single row and a single column leave most processes without any rows
+    numStraddles += RoundTrip<T>( 1, n, format, basename );
+    numStraddles += RoundTrip<T>( m, 1, format, basename );
+
+    // Varying the widths moves the process boundaries around within the rows
+    for( Int k=0; k<4; ++k )
+        numStraddles += RoundTrip<T>( m+k, n+k, format, basename );
+
+    if( commSize > 1 && numStraddles == 0 )
+        LogicError("No process boundary fell inside of a row");
+    if( mpi::WorldRank() == 0 )
+        cout << "passed (" << numStraddles << " boundaries inside of rows)"
+             << endl;
+}
+
+// Every process must throw, rather than leaving some of them waiting on the
+// others, if the file cannot be read
+template<typename T>
+void TestMissingFile( FileFormat format, const string basename )
+{
+    const string filename = basename + "-missing." + FileExtension(format);
+    DistMatrix<T,VC,STAR> A;
+    bool threw = false;
+    try { Read( A, filename, format ); }
+    catch( std::exception& e ) { threw = true; }
+    if( !threw )
+        LogicError("Reading a missing file did not throw");
+    mpi::Barrier( mpi::COMM_WORLD );
+}
+
+template<typename T>
+void TestFormats( Int m, Int n, const string basename )
+{
+    const FileFormat formats[3] = { ASCII, ASCII_MATLAB, MATRIX_MARKET };
+    const string names[3] = { "ASCII", "ASCII_MATLAB", "MATRIX_MARKET" };
+    for( Int k=0; k<3; ++k )
+    {
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "  " << names[k] << "...";
+            cout.flush();
+        }
+        TestFormat<T>( m, n, formats[k], basename );
+        TestMissingFile<T>( formats[k], basename );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",37);
+        const Int n = Input("--width","width of matrix",11);
+        ProcessInput();
+        PrintInputReport();
+        if( m < 1 || n < 1 )
+            LogicError("Matrix must be nonempty");
+
+        if( mpi::WorldRank() == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestFormats<double>( m, n, "ascii-test" );
+
+        if( mpi::WorldRank() == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestFormats<Complex<double>>( m, n, "ascii-test" );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_SIGN_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+// A diagonally dominant matrix whose eigenvalues lie in the open left and
+// right half-planes, so that the Newton iteration for its sign converges
+template<typename F>
+void MakeSignMatrix( DistMatrix<F>& A, Int n )
+{
+    Uniform( A, n, n );
+    for( Int i=0; i<n; ++i )
+        A.Set( i, i, F( i % 2 == 0 ? n : -n ) );
+}
+
+template<typename F>
+void TestCheckpoint( Int n, Int killIts, const string basename )
+{
+    typedef Base<F> Real;
+    const Grid& g = DefaultGrid();
+    const Grid gRestart( mpi::COMM_WORLD, 1 );
+    const string filename = basename + "-sign.ckpt";
+
+    DistMatrix<F> A(g);
+    MakeSignMatrix( A, n );
+
+    // The fingerprint may not depend upon the grid or the alignments
+    DistMatrix<F> ARestart(gRestart);
+    ARestart.Align( gRestart.Height()-1, 0 );
+    ARestart = A;
+    if( checkpoint::Fingerprint(A) != checkpoint::Fingerprint(ARestart) )
+        LogicError("Fingerprint depends upon the distribution");
+
+    // An uninterrupted run without checkpointing
+    SetCheckpointBasename( "" );
+    auto X( A );
+    const Int numIts = sign::Newton( X );
+    if( killIts >= numIts )
+        LogicError("The run must be killed before it converges");
+
+    // A run which is killed after killIts iterations. Since each checkpoint
+    // is written synchronously, the file left behind is the same as if the
+    // processes had died right after the last iteration completed.
+    SetCheckpointBasename( basename );
+    SetCheckpointFrequency( 1 );
+    SetRestartFromCheckpoint( false );
+    auto XKilled( A );
+    sign::Newton( XKilled, SIGN_SCALE_FROB, killIts );
+    if( !checkpoint::Exists( filename, mpi::COMM_WORLD ) )
+        LogicError("The killed run did not leave a checkpoint");
+    if( checkpoint::Exists( filename+".tmp", mpi::COMM_WORLD ) )
+        LogicError("The checkpoint was left in its temporary file");
+
+    // A perturbed input must not pick up the checkpoint
+    SetRestartFromCheckpoint( true );
+    auto APerturbed( A );
+    APerturbed.Update( n-1, 0, F(1)/F(1024) );
+    vector<double> state;
+    if( checkpoint::Load
+        ( "sign", APerturbed, checkpoint::Fingerprint(APerturbed), state ) )
+        LogicError("Checkpoint of a different input was loaded");
+
+    // Restart on a different grid and finish the iteration
+    auto XRestart( ARestart );
+    const Int numItsRestart = sign::Newton( XRestart );
+    if( numItsRestart != numIts )
+        LogicError
+        ("Restarted run took ",numItsRestart," iterations instead of ",numIts);
+    // The two results live on different grids, so compare full local copies
+    DistMatrix<F,STAR,STAR> X_STAR_STAR( X ), XRestart_STAR_STAR( XRestart );
+    Matrix<F> E( XRestart_STAR_STAR.Matrix() );
+    Axpy( F(-1), X_STAR_STAR.LockedMatrix(), E );
+    const Real relError =
+        FrobeniusNorm( E ) / FrobeniusNorm( X_STAR_STAR.LockedMatrix() );
+    const Real tol = n*n*lapack::MachineEpsilon<Real>();
+    if( relError > tol )
+        LogicError("Restarted run differs from the uninterrupted one: ",
+                   relError," > ",tol);
+    if( checkpoint::Exists( filename, mpi::COMM_WORLD ) )
+        LogicError("The checkpoint was not removed after convergence");
+
+    SetCheckpointBasename( "" );
+    SetRestartFromCheckpoint( false );
+    if( mpi::WorldRank() == 0 )
+        cout << "passed (" << killIts << " of " << numIts
+             << " iterations restored, relative error = " << relError << ")"
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    try
+    {
+        const Int n = Input("--size","size of matrix",100);
+        const Int nb = Input("--nb","algorithmic blocksize",32);
+        const Int killIts = Input("--killIts","iterations before the kill",2);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "Testing with doubles...";
+            cout.flush();
+        }
+        TestCheckpoint<double>( n, killIts, "checkpoint-test" );
+
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "Testing with double-precision complex...";
+            cout.flush();
+        }
+        TestCheckpoint<Complex<double>>( n, killIts, "checkpoint-test" );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
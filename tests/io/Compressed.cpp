@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+// Write A in the BINARY_COMPRESSED format and read it back into B
+template<typename T>
+void RoundTrip
+( const Matrix<T>& A, Matrix<T>& B, const string basename,
+  CompressedStorage storage, Int mantissaBits )
+{
+    write::BinaryCompressed( A, basename, storage, mantissaBits );
+    const string filename = basename + "." + FileExtension(BINARY_COMPRESSED);
+    Read( B, filename, BINARY_COMPRESSED );
+    std::remove( filename.c_str() );
+}
+
+template<typename T>
+void TestCompressed( Int m, Int n, Int mantissaBits, const string basename )
+{
+    typedef Base<T> Real;
+    Matrix<T> A, B;
+    Uniform( A, m, n );
+
+    // The largest finite value must not round up to infinity
+    A.Set( 0, 0, T(std::numeric_limits<Real>::max()) );
+    A.Set( m-1, n-1, T(-std::numeric_limits<Real>::max()) );
+
+    // Lossless storage of the full matrix
+    RoundTrip( A, B, basename, COMPRESSED_FULL, 0 );
+    if( B.Height() != m || B.Width() != n )
+        LogicError("Lossless round trip changed the dimensions");
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( B.Get(i,j) != A.Get(i,j) )
+                LogicError("Lossless round trip changed entry ",i,",",j);
+
+    // Lossless storage of the lower trapezoid
+    RoundTrip( A, B, basename, COMPRESSED_LOWER, 0 );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( B.Get(i,j) != ( i>=j ? A.Get(i,j) : T(0) ) )
+                LogicError("Lower round trip changed entry ",i,",",j);
+
+    // Rounding each real mantissa to mantissaBits bits
+    RoundTrip( A, B, basename, COMPRESSED_FULL, mantissaBits );
+    const Real tol = Pow( Real(2), Real(-mantissaBits) );
+    Real maxRelError = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            const T alpha = A.Get(i,j);
+            const T beta = B.Get(i,j);
+            if( !std::isfinite(RealPart(beta)) ||
+                !std::isfinite(ImagPart(beta)) )
+                LogicError("Truncated round trip overflowed at ",i,",",j);
+            const Real realError = Abs(RealPart(alpha)-RealPart(beta));
+            const Real imagError = Abs(ImagPart(alpha)-ImagPart(beta));
+            if( realError > tol*Abs(RealPart(alpha)) ||
+                imagError > tol*Abs(ImagPart(alpha)) )
+                LogicError("Truncated round trip too inaccurate at ",i,",",j);
+            if( Abs(alpha) != Real(0) )
+                maxRelError = Max( maxRelError, Abs(alpha-beta)/Abs(alpha) );
+        }
+    }
+    if( mpi::WorldRank() == 0 )
+        cout << "passed (max relative truncation error = " << maxRelError
+             << ")" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",3000);
+        const Int mantissaBits =
+            Input("--mantissaBits","number of retained mantissa bits",12);
+        ProcessInput();
+        PrintInputReport();
+        if( m < 1 || n < 1 )
+            LogicError("Matrix must be nonempty");
+
+        // Each process writes its own file
+        ostringstream os;
+        os << "compressed-" << mpi::WorldRank();
+        const string basename = os.str();
+
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "Testing with floats...";
+            cout.flush();
+        }
+        TestCompressed<float>( m, n, mantissaBits, basename );
+
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "Testing with doubles...";
+            cout.flush();
+        }
+        TestCompressed<double>( m, n, mantissaBits, basename );
+
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "Testing with double-precision complex...";
+            cout.flush();
+        }
+        TestCompressed<Complex<double>>( m, n, mantissaBits, basename );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
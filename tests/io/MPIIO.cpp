@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+template<typename T>
+void CheckEqual
+( const Matrix<T>& A, const Matrix<T>& B, const string desc )
+{
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        LogicError(desc,": read a ",B.Height()," x ",B.Width(),
+                   " matrix instead of ",A.Height()," x ",A.Width());
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( B.Get(i,j) != A.Get(i,j) )
+                LogicError(desc,": entry ",i,",",j," changed");
+}
+
+// Use the last possible alignments so that they differ from the defaults
+template<typename T,Dist U,Dist V>
+void AlignLast( DistMatrix<T,U,V>& A )
+{ A.Align( A.ColStride()-1, A.RowStride()-1 ); }
+
+template<typename T>
+void AlignLast( DistMatrix<T,CIRC,CIRC>& A )
+{ A.SetRoot( A.Grid().Size()-1 ); }
+
+template<typename T>
+void AlignLast( DistMatrix<T,MD,STAR>& A )
+{ }
+
+// Read the file into an [U,V] matrix with the last alignments and check it
+// against the [* ,* ] copy of the original matrix
+template<typename T,Dist U,Dist V>
+void CheckRead
+( const DistMatrix<T,STAR,STAR>& A, const string basename, const string desc )
+{
+    DistMatrix<T,U,V> B( A.Grid() );
+    AlignLast( B );
+    read::Binary( B, basename + "." + FileExtension(BINARY) );
+    DistMatrix<T,STAR,STAR> B_STAR_STAR( B );
+    CheckEqual( A.LockedMatrix(), B_STAR_STAR.LockedMatrix(), desc );
+
+    DistMatrix<T,U,V> BFlat( A.Grid() );
+    read::BinaryFlat
+    ( BFlat, A.Height(), A.Width(), basename+"."+FileExtension(BINARY_FLAT) );
+    B_STAR_STAR = BFlat;
+    CheckEqual( A.LockedMatrix(), B_STAR_STAR.LockedMatrix(), desc+" (flat)" );
+}
+
+// Write A from an [U,V] distribution with the last alignments, check the
+// image of the file sequentially, and read it back into several other
+// distributions
+template<typename T,Dist U,Dist V>
+void TestDist
+( const DistMatrix<T,STAR,STAR>& A, const string basename, const string desc )
+{
+    if( mpi::WorldRank() == 0 )
+    {
+        cout << "  Writing from " << desc << "...";
+        cout.flush();
+    }
+    DistMatrix<T,U,V> AWrite( A.Grid() );
+    AlignLast( AWrite );
+    AWrite = A;
+    write::Binary( AWrite, basename );
+    write::BinaryFlat( AWrite, basename );
+    mpi::Barrier( mpi::COMM_WORLD );
+
+    Matrix<T> B;
+    read::Binary( B, basename + "." + FileExtension(BINARY) );
+    CheckEqual( A.LockedMatrix(), B, "Sequential read" );
+    read::BinaryFlat
+    ( B, A.Height(), A.Width(), basename+"."+FileExtension(BINARY_FLAT) );
+    CheckEqual( A.LockedMatrix(), B, "Sequential flat read" );
+
+    CheckRead<T,MC,  MR  >( A, basename, "[MC,MR] read" );
+    CheckRead<T,MR,  MC  >( A, basename, "[MR,MC] read" );
+    CheckRead<T,VC,  STAR>( A, basename, "[VC,* ] read" );
+    CheckRead<T,STAR,VR  >( A, basename, "[* ,VR] read" );
+    CheckRead<T,MC,  STAR>( A, basename, "[MC,* ] read" );
+    CheckRead<T,STAR,MR  >( A, basename, "[* ,MR] read" );
+    CheckRead<T,CIRC,CIRC>( A, basename, "[o ,o ] read" );
+    mpi::Barrier( mpi::COMM_WORLD );
+    if( mpi::WorldRank() == 0 )
+        cout << "passed" << endl;
+}
+
+template<typename T>
+void TestMPIIO( Int m, Int n, const Grid& g, const string basename )
+{
+    DistMatrix<T,STAR,STAR> A(g);
+    Uniform( A, m, n );
+
+    TestDist<T,MC,  MR  >( A, basename, "[MC,MR]" );
+    TestDist<T,MR,  MC  >( A, basename, "[MR,MC]" );
+    TestDist<T,VC,  STAR>( A, basename, "[VC,* ]" );
+    TestDist<T,VR,  STAR>( A, basename, "[VR,* ]" );
+    TestDist<T,STAR,VC  >( A, basename, "[* ,VC]" );
+    TestDist<T,MC,  STAR>( A, basename, "[MC,* ]" );
+    TestDist<T,STAR,MC  >( A, basename, "[* ,MC]" );
+    TestDist<T,MD,  STAR>( A, basename, "[MD,* ]" );
+    TestDist<T,STAR,STAR>( A, basename, "[* ,* ]" );
+    TestDist<T,CIRC,CIRC>( A, basename, "[o ,o ]" );
+
+    if( mpi::WorldRank() == 0 )
+    {
+        std::remove( (basename+"."+FileExtension(BINARY)).c_str() );
+        std::remove( (basename+"."+FileExtension(BINARY_FLAT)).c_str() );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",53);
+        const Int n = Input("--width","width of matrix",29);
+        ProcessInput();
+        PrintInputReport();
+
+        // Use the squarest grid which has fewer rows than columns
+        const int commSize = mpi::CommSize( mpi::COMM_WORLD );
+        int r = 1;
+        for( int q=2; q*q<commSize; ++q )
+            if( commSize % q == 0 )
+                r = q;
+        const Grid g( mpi::COMM_WORLD, r );
+        if( mpi::WorldRank() == 0 )
+            cout << "Using a " << g.Height() << " x " << g.Width() << " grid"
+                 << endl;
+
+        if( mpi::WorldRank() == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestMPIIO<double>( m, n, g, "mpiio-test" );
+
+        if( mpi::WorldRank() == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestMPIIO<Complex<double>>( m, n, g, "mpiio-test" );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+template<typename T>
+void CheckEqual
+( const Matrix<T>& A, const Matrix<T>& B, const string desc )
+{
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        LogicError(desc,": found a ",B.Height()," x ",B.Width(),
+                   " matrix instead of ",A.Height()," x ",A.Width());
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( B.Get(i,j) != A.Get(i,j) )
+                LogicError(desc,": entry ",i,",",j," differs");
+}
+
+// Map the file both read-only and copy-on-write, check the contents of both,
+// and ensure that modifying the copy-on-write mapping leaves the file (and
+// the read-only mapping) untouched. The function map(B,file,copyOnWrite)
+// must attach B to a mapping of the file, and read(B) must read the file.
+template<typename T,typename MapFunc,typename ReadFunc>
+void TestMapping
+( const Matrix<T>& A, MapFunc map, ReadFunc read, const string desc )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    MappedFile readOnlyFile;
+    Matrix<T> BReadOnly;
+    map( BReadOnly, readOnlyFile, false );
+    if( readOnlyFile.CopyOnWrite() || !BReadOnly.Locked() )
+        LogicError(desc,": read-only mapping is modifiable");
+    CheckEqual( A, BReadOnly, desc+" read-only mapping" );
+
+    MappedFile cowFile;
+    Matrix<T> BCow;
+    map( BCow, cowFile, true );
+    if( !cowFile.CopyOnWrite() || BCow.Locked() )
+        LogicError(desc,": copy-on-write mapping is not modifiable");
+    CheckEqual( A, BCow, desc+" copy-on-write mapping" );
+
+    // Overwrite every entry of the copy-on-write mapping
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            BCow.Set( i, j, BCow.Get(i,j)+T(1) );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( BCow.Get(i,j) != A.Get(i,j)+T(1) )
+                LogicError(desc,": copy-on-write update was lost");
+
+    // Neither the file nor the shared mapping may observe the updates, even
+    // after the copy-on-write mapping has been released
+    CheckEqual( A, BReadOnly, desc+" read-only mapping after update" );
+    BCow.Empty();
+    cowFile.Close();
+    Matrix<T> C;
+    read( C );
+    CheckEqual( A, C, desc+" file after copy-on-write update" );
+    MappedFile remappedFile;
+    Matrix<T> BRemapped;
+    map( BRemapped, remappedFile, false );
+    CheckEqual( A, BRemapped, desc+" remapping after update" );
+}
+
+template<typename T>
+void TestMap( Int m, Int n, const string basename )
+{
+    Matrix<T> A;
+    Uniform( A, m, n );
+
+    write::Binary( A, basename );
+    const string binaryName = basename + "." + FileExtension(BINARY);
+    TestMapping
+    ( A,
+      [&]( Matrix<T>& B, MappedFile& file, bool copyOnWrite )
+      { elem::map::Binary( B, file, binaryName, copyOnWrite ); },
+      [&]( Matrix<T>& B ) { read::Binary( B, binaryName ); },
+      "BINARY" );
+    std::remove( binaryName.c_str() );
+
+    write::BinaryFlat( A, basename );
+    const string flatName = basename + "." + FileExtension(BINARY_FLAT);
+    TestMapping
+    ( A,
+      [&]( Matrix<T>& B, MappedFile& file, bool copyOnWrite )
+      { elem::map::BinaryFlat( B, file, m, n, flatName, copyOnWrite ); },
+      [&]( Matrix<T>& B ) { read::BinaryFlat( B, m, n, flatName ); },
+      "BINARY_FLAT" );
+    std::remove( flatName.c_str() );
+
+    if( mpi::WorldRank() == 0 )
+        cout << "passed" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",300);
+        ProcessInput();
+        PrintInputReport();
+#ifndef HAVE_MMAP
+        if( mpi::WorldRank() == 0 )
+            cout << "Memory-mapped files are not supported; skipping" << endl;
+#else
+        // Each process maps its own file
+        ostringstream os;
+        os << "map-test-" << mpi::WorldRank();
+        const string basename = os.str();
+
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "Testing with doubles...";
+            cout.flush();
+        }
+        TestMap<double>( m, n, basename );
+
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "Testing with double-precision complex...";
+            cout.flush();
+        }
+        TestMap<Complex<double>>( m, n, basename );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,151 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_ENTRYWISEREDUCE_INC
+#include ELEM_MAKETRIANGULAR_INC
+#include ELEM_PSEUDOSPECTRUM_INC
+#include ELEM_GRCAR_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+typedef double Real;
+typedef Complex<Real> C;
+
+// The number of requested contours which enclose the given point
+Int Classify( Real invNorm, const vector<Real>& contours )
+{
+    Int numInside = 0;
+    for( Int k=0; k<Int(contours.size()); ++k )
+        if( invNorm*contours[k] >= Real(1) )
+            ++numInside;
+    return numInside;
+}
+
+// Whether the estimate is too close to a contour to be classified reliably
+bool NearContour( Real invNorm, const vector<Real>& contours, Real margin )
+{
+    for( Int k=0; k<Int(contours.size()); ++k )
+        if( Abs(invNorm*contours[k]-Real(1)) <= margin )
+            return true;
+    return false;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const Int matType = Input("--matType","0:uniform,1:Grcar",1);
+        const Int n = Input("--size","height of matrix",60);
+        const Int size = Input("--latticeSize","points in each direction",65);
+        const Real realCenter = Input("--realCenter","real center",1.);
+        const Real imagCenter = Input("--imagCenter","imag center",0.);
+        const Real width = Input("--width","width of the lattice",4.);
+        const Int numContours =
+            Input("--numContours","contours at 10^-1,...,10^-numContours",3);
+        const Int numRefine =
+            Input("--numRefine","number of adaptive refinements",3);
+        const bool lanczos = Input("--lanczos","use Lanczos?",true);
+        const Real tol = Input("--tol","tolerance for norm estimates",1e-8);
+        ProcessInput();
+        PrintInputReport();
+
+        DistMatrix<C> U;
+        if( matType == 0 )
+            Uniform( U, n, n );
+        else
+            Grcar( U, n );
+        MakeTriangular( UPPER, U );
+        const C center( realCenter, imagCenter );
+        vector<Real> contours( numContours );
+        for( Int k=0; k<numContours; ++k )
+            contours[k] = Pow( Real(10), Real(-(k+1)) );
+
+        if( commRank == 0 )
+        {
+            cout << "Computing the uniform " << size << " x " << size
+                 << " lattice...";
+            cout.flush();
+        }
+        DistMatrix<Real> uniformMap, adaptiveMap;
+        mpi::Barrier( comm );
+        double startTime = mpi::Time();
+        auto uniformCounts =
+            TriangularPseudospectrum
+            ( U, uniformMap, center, width, width, size, size, lanczos,
+              10, true, true, 1000, tol );
+        mpi::Barrier( comm );
+        const double uniformTime = mpi::Time() - startTime;
+        if( commRank == 0 )
+        {
+            cout << "DONE. Time = " << uniformTime << " seconds." << endl;
+            cout << "Computing the adaptive lattice...";
+            cout.flush();
+        }
+        startTime = mpi::Time();
+        auto adaptiveCounts =
+            TriangularPseudospectrum
+            ( U, adaptiveMap, center, width, width, size, size, contours,
+              numRefine, lanczos, 10, true, true, 1000, tol );
+        mpi::Barrier( comm );
+        const double adaptiveTime = mpi::Time() - startTime;
+        if( commRank == 0 )
+            cout << "DONE. Time = " << adaptiveTime << " seconds." << endl;
+
+        // The interpolated points of the adaptive lattice cost no iterations
+        const Int uniformIts = EntrywiseReduce
+            ( uniformCounts, Int(0), []( Int alpha ) { return alpha; },
+              SumReduction<Int>() );
+        const Int adaptiveIts = EntrywiseReduce
+            ( adaptiveCounts, Int(0), []( Int alpha ) { return alpha; },
+              SumReduction<Int>() );
+
+        // Compare the contour classification of every lattice point, other
+        // than those whose resolvent norm is within the estimation tolerance
+        // of a contour
+        const Real margin = 100*tol;
+        Int numMismatches = 0, numSkipped = 0;
+        const Int mLocal = uniformMap.LocalHeight();
+        const Int nLocal = uniformMap.LocalWidth();
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        {
+            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            {
+                const Real uniform = uniformMap.GetLocal(iLoc,jLoc);
+                const Real adaptive = adaptiveMap.GetLocal(iLoc,jLoc);
+                if( NearContour( uniform, contours, margin ) )
+                    ++numSkipped;
+                else if( Classify(uniform,contours) !=
+                         Classify(adaptive,contours) )
+                    ++numMismatches;
+            }
+        }
+        numMismatches = mpi::AllReduce( numMismatches, comm );
+        numSkipped = mpi::AllReduce( numSkipped, comm );
+        if( commRank == 0 )
+            cout << "  total iterations (uniform)  = " << uniformIts << "\n"
+                 << "  total iterations (adaptive) = " << adaptiveIts << "\n"
+                 << "  points within margin        = " << numSkipped << "\n"
+                 << "  misclassified points        = " << numMismatches
+                 << endl;
+        if( numMismatches != 0 )
+            LogicError
+            ("Adaptive lattice misclassified ",numMismatches," points");
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_HERK_INC
+#include ELEM_CHOLESKY_INC
+#include ELEM_LU_INC
+#include ELEM_CONDITIONESTIMATE_INC
+#include ELEM_TWONORM_INC
+#include ELEM_TWONORMESTIMATE_INC
+#include ELEM_IDENTITY_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestConditionEstimate
+( Int m, Int numCols, Int blockSize, bool print, const Grid& g )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> A(g);
+    Uniform( A, m, m );
+    if( print )
+        Print( A, "A" );
+
+    // Estimates are lower bounds which are typically within a small factor
+    // of the true values, which are computed from explicit inverses
+    DistMatrix<F> B( A ), AInv(g);
+    DistMatrix<Int,VC,STAR> p(g);
+    LU( B, p );
+    Identity( AInv, m, m );
+    lu::SolveAfter( NORMAL, B, p, AInv );
+    const Real oneCond = OneNorm( A )*OneNorm( AInv );
+    const Real infCond = InfinityNorm( A )*InfinityNorm( AInv );
+
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    const Real oneCondEst = OneConditionEstimate( A, numCols );
+    const Real infCondEst = InfinityConditionEstimate( A, numCols );
+    mpi::Barrier( g.Comm() );
+    const double estTime = mpi::Time() - startTime;
+
+    // An HPD matrix, C := A A^H + m I, for the Cholesky-based estimate
+    DistMatrix<F> C(g), CInv(g);
+    Identity( C, m, m );
+    Herk( LOWER, NORMAL, F(1), A, F(m), C );
+    Cholesky( LOWER, C );
+    Identity( CInv, m, m );
+    cholesky::SolveAfter( LOWER, NORMAL, C, CInv );
+    const Real invOneNorm = OneNorm( CInv );
+    const Real invOneNormEst =
+        cholesky::InverseOneNormEstimate( LOWER, C, numCols );
+
+    const Real twoNorm = TwoNorm( A );
+    const Real twoNormEst = TwoNormEstimate( A, Real(1e-6), 1000, blockSize );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  kappa_1(A)               = " << oneCond << "\n"
+             << "  estimate                 = " << oneCondEst << "\n"
+             << "  kappa_oo(A)              = " << infCond << "\n"
+             << "  estimate                 = " << infCondEst << "\n"
+             << "  estimate time            = " << estTime << " secs\n"
+             << "  || inv(A A^H + m I) ||_1 = " << invOneNorm << "\n"
+             << "  Cholesky estimate        = " << invOneNormEst << "\n"
+             << "  || A ||_2                = " << twoNorm << "\n"
+             << "  block power estimate     = " << twoNormEst << "\n"
+             << endl;
+    }
+    const Real tol = Pow(lapack::MachineEpsilon<Real>(),Real(0.5));
+    if( oneCondEst > oneCond*(1+tol) || infCondEst > infCond*(1+tol) ||
+        invOneNormEst > invOneNorm*(1+tol) )
+        LogicError("Condition estimates exceeded the true values");
+    if( Abs(twoNorm-twoNormEst) > 1e-3*twoNorm )
+        LogicError("Two-norm estimate was inaccurate");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const Int m = Input("--height","height of matrix",100);
+        const Int numCols = Input
+            ("--numCols","number of columns in the 1-norm estimator",2);
+        const Int blockSize = Input
+            ("--blockSize","number of vectors in the power iteration",4);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const Grid g( comm, r );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestConditionEstimate<double>( m, numCols, blockSize, print, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestConditionEstimate<Complex<double>>
+        ( m, numCols, blockSize, print, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -100,7 +100,8 @@ template<typename F>
 void TestHermitianEig
 ( bool testCorrectness, bool print,
   bool onlyEigvals, char range, bool clustered, UpperOrLower uplo, Int m, 
-  Base<F> vl, Base<F> vu, Int il, Int iu, SortType sort, const Grid& g )
+  Base<F> vl, Base<F> vu, Int il, Int iu, SortType sort, 
+  HermitianTridiagEigAlg alg, const Grid& g )
 {
     typedef Base<F> Real;
     DistMatrix<F> A(g), AOrig(g), Z(g);
@@ -143,7 +144,7 @@ void TestHermitianEig
     else
     {
         if( range == 'A' )
-            HermitianEig( uplo, A, w, Z, sort );
+            HermitianEig( uplo, A, w, Z, sort, alg );
         else if( range == 'I' )
             HermitianEig( uplo, A, w, Z, il, iu, sort );
         else
@@ -190,6 +191,8 @@ main( int argc, char* argv[] )
         const Int sortInt = Input("--sort","sort type",0);
         const bool clustered = Input
             ("--cluster","force clustered eigenvalues?",false);
+        const bool divideAndConquer = Input
+            ("--dc","use divide and conquer tridiagonal solver?",false);
         const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
@@ -207,9 +210,14 @@ main( int argc, char* argv[] )
         SetBlocksize( nb );
         SetLocalSymvBlocksize<double>( nbLocal );
         SetLocalSymvBlocksize<Complex<double>>( nbLocal );
+        SetLocalSymvBlocksize<float>( nbLocal );
+        SetLocalSymvBlocksize<Complex<float>>( nbLocal );
         if( range != 'A' && range != 'I' && range != 'V' )
             LogicError("'range' must be 'A', 'I', or 'V'");
         const SortType sort = static_cast<SortType>(sortInt);
+        const HermitianTridiagEigAlg alg = 
+            ( divideAndConquer ? HERMITIAN_TRIDIAG_EIG_DC 
+                               : HERMITIAN_TRIDIAG_EIG_MRRR );
         if( onlyEigvals && testCorrectness && commRank==0 )
             cout << "Cannot test correctness with only eigenvalues." << endl;
         ComplainIfDebug();
@@ -225,7 +233,8 @@ main( int argc, char* argv[] )
         SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_NORMAL );
         TestHermitianEig<double>
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, 
+          alg, g );
 
         if( commRank == 0 )
         {
@@ -238,7 +247,8 @@ main( int argc, char* argv[] )
         SetHermitianTridiagGridOrder( ROW_MAJOR );
         TestHermitianEig<double>
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, 
+          alg, g );
  
         if( commRank == 0 )
         {
@@ -251,7 +261,8 @@ main( int argc, char* argv[] )
         SetHermitianTridiagGridOrder( COLUMN_MAJOR );
         TestHermitianEig<double>
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, 
+          alg, g );
 
         if( commRank == 0 )
         {
@@ -263,7 +274,8 @@ main( int argc, char* argv[] )
         SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_NORMAL );
         TestHermitianEig<Complex<double>>
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, 
+          alg, g );
 
         if( commRank == 0 )
         {
@@ -277,7 +289,8 @@ main( int argc, char* argv[] )
         SetHermitianTridiagGridOrder( ROW_MAJOR );
         TestHermitianEig<Complex<double>>
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, 
+          alg, g );
 
         if( commRank == 0 )
         {
@@ -291,7 +304,33 @@ main( int argc, char* argv[] )
         SetHermitianTridiagGridOrder( COLUMN_MAJOR );
         TestHermitianEig<Complex<double>>
         ( testCorrectness, print, 
-          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, g );
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, 
+          alg, g );
+
+        if( commRank == 0 )
+        {
+            cout << "------------------------------------------\n"
+                 << "Single-precision normal tridiag algorithm:\n"
+                 << "------------------------------------------" << endl;
+        }
+        SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_NORMAL );
+        TestHermitianEig<float>
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, 
+          alg, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------------------\n"
+                 << "Single-precision complex normal tridiag algorithm:\n"
+                 << "--------------------------------------------------" 
+                 << endl;
+        }
+        SetHermitianTridiagApproach( HERMITIAN_TRIDIAG_NORMAL );
+        TestHermitianEig<Complex<float>>
+        ( testCorrectness, print, 
+          onlyEigvals, range, clustered, uplo, m, vl, vu, il, iu, sort, 
+          alg, g );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_INFINITYNORM_INC
+#include ELEM_ONENORM_INC
+#include ELEM_QR_INC
+#include ELEM_IDENTITY_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& Q, const DistMatrix<F>& QDense )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+
+    // Form I - Q^H Q
+    if( g.Rank() == 0 )
+        cout << "  Testing orthogonality of Q..." << endl;
+    auto Z = Identity<F>( g, n, n );
+    Herk( UPPER, ADJOINT, F(-1), Q, F(1), Z );
+    Real oneNormOfError = HermitianOneNorm( UPPER, Z );
+    Real infNormOfError = HermitianInfinityNorm( UPPER, Z );
+    Real frobNormOfError = HermitianFrobeniusNorm( UPPER, Z );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||Q^H Q - I||_1  = " << oneNormOfError << "\n"
+             << "    ||Q^H Q - I||_oo = " << infNormOfError << "\n"
+             << "    ||Q^H Q - I||_F  = " << frobNormOfError << endl;
+    }
+
+    // Form A - Q Q^H A
+    if( g.Rank() == 0 )
+        cout << "  Testing if A is in the range of Q..." << endl;
+    const Real frobNormOfA = FrobeniusNorm( A );
+    DistMatrix<F> B(g), E( A );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, B );
+    Gemm( NORMAL, NORMAL, F(-1), Q, B, F(1), E );
+    frobNormOfError = FrobeniusNorm( E );
+    if( g.Rank() == 0 )
+    {
+        cout << "    ||A||_F           = " << frobNormOfA << "\n"
+             << "    ||A - QQ^H A||_F  = " << frobNormOfError << endl;
+    }
+
+    // Compare against the unstructured explicit QR
+    if( g.Rank() == 0 )
+        cout << "  Comparing against the unstructured factor..." << endl;
+    E = QDense;
+    Axpy( F(-1), Q, E );
+    frobNormOfError = FrobeniusNorm( E );
+    if( g.Rank() == 0 )
+        cout << "    ||Q - QDense||_F  = " << frobNormOfError << endl;
+}
+
+template<typename F>
+void TestQR( bool testCorrectness, bool print, Int m, Int n, const Grid& g )
+{
+    DistMatrix<F> A(g), AT(g), AB(g);
+    Uniform( A, m+n, n );
+    PartitionDown( A, AT, AB, m );
+    MakeIdentity( AB );
+    if( print )
+        Print( A, "A" );
+    DistMatrix<F> Q( A ), QDense( A );
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting unstructured explicit QR...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    qr::Explicit( QDense );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n  Time = " << runTime << " seconds." << endl;
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting structured explicit QR...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    qr::ExplicitStackedIdentity( Q );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE.\n  Time = " << runTime << " seconds." << endl;
+    if( print )
+        Print( Q, "Q" );
+    if( testCorrectness )
+        TestCorrectness( A, Q, QDense );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of top block",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will test QR of [X; I]" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestQR<double>( testCorrectness, print, m, n, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestQR<Complex<double>>( testCorrectness, print, m, n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
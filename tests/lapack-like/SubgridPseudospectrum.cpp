@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_HESSENBERG_INC
+#include ELEM_MAKETRAPEZOIDAL_INC
+#include ELEM_MAKETRIANGULAR_INC
+#include ELEM_PSEUDOSPECTRUM_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+typedef double Real;
+typedef Complex<Real> C;
+
+// The largest relative difference between the farmed and single-grid results
+Real MaxRelativeDifference
+( const DistMatrix<Real,VR,STAR>& invNorms,
+  const DistMatrix<Real,VR,STAR>& invNormsRef )
+{
+    DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNorms ),
+                               invNormsRef_STAR_STAR( invNormsRef );
+    Real maxDiff = 0;
+    for( Int i=0; i<invNorms.Height(); ++i )
+    {
+        const Real alpha = invNorms_STAR_STAR.GetLocal(i,0);
+        const Real alphaRef = invNormsRef_STAR_STAR.GetLocal(i,0);
+        maxDiff = Max( maxDiff, Abs(alpha-alphaRef)/Abs(alphaRef) );
+    }
+    return maxDiff;
+}
+
+void TestFarm
+( bool hessenberg, const DistMatrix<C>& A,
+  const DistMatrix<C,VR,STAR>& shifts, Int numSubgrids, Int chunkSize,
+  Real tol )
+{
+    const Grid& g = A.Grid();
+    if( g.Rank() == 0 )
+        cout << "Testing " << ( hessenberg ? "Hessenberg" : "triangular" )
+             << " farming over " << numSubgrids << " subgrids" << endl;
+    DistMatrix<Real,VR,STAR> invNorms(g), invNormsRef(g);
+    DistMatrix<Int,VR,STAR> itCounts(g), itCountsRef(g);
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    if( hessenberg )
+        itCountsRef =
+            HessenbergPseudospectrum
+            ( A, shifts, invNormsRef, true, 10, true, true, 1000, tol );
+    else
+        itCountsRef =
+            TriangularPseudospectrum
+            ( A, shifts, invNormsRef, true, 10, true, true, 1000, tol );
+    mpi::Barrier( g.Comm() );
+    const double singleTime = mpi::Time() - startTime;
+
+    startTime = mpi::Time();
+    if( hessenberg )
+        itCounts =
+            SubgridHessenbergPseudospectrum
+            ( A, shifts, invNorms, numSubgrids, chunkSize, true, 10, true,
+              true, 1000, tol );
+    else
+        itCounts =
+            SubgridTriangularPseudospectrum
+            ( A, shifts, invNorms, numSubgrids, chunkSize, true, 10, true,
+              true, 1000, tol );
+    mpi::Barrier( g.Comm() );
+    const double farmTime = mpi::Time() - startTime;
+
+    // Both results are estimates to within a relative tolerance of tol
+    const Real maxDiff = MaxRelativeDifference( invNorms, invNormsRef );
+    if( g.Rank() == 0 )
+        cout << "  single grid time = " << singleTime << " seconds\n"
+             << "  farmed time      = " << farmTime << " seconds\n"
+             << "  max relative difference = " << maxDiff << endl;
+    if( invNorms.Height() != shifts.Height() ||
+        itCounts.Height() != shifts.Height() )
+        LogicError("Farmed results have the wrong height");
+    if( maxDiff > 100*tol )
+        LogicError("Farmed inverse norms differ from the single grid");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--size","height of matrix",50);
+        const Int numShifts = Input("--numShifts","number of shifts",100);
+        const Int numSubgrids = Input("--numSubgrids","number of subgrids",0);
+        const Int chunkSize = Input("--chunkSize","shifts per chunk",0);
+        const Real tol = Input("--tol","tolerance for norm estimates",1e-8);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        DistMatrix<C> A(g), U(g), H(g);
+        Uniform( A, n, n );
+        U = A;
+        MakeTriangular( UPPER, U );
+        H = A;
+        Hessenberg( UPPER, H );
+        MakeTrapezoidal( UPPER, H, -1 );
+
+        DistMatrix<C,VR,STAR> shifts(g);
+        Uniform( shifts, numShifts, 1, C(0), Real(2) );
+
+        TestFarm( false, U, shifts, numSubgrids, chunkSize, tol );
+        TestFarm( true, H, shifts, numSubgrids, chunkSize, tol );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_SIGN_INC
+#include ELEM_POLAR_INC
+#include ELEM_HERMITIANEIG_INC
+#include ELEM_SCHUR_INC
+#include ELEM_SORT_INC
+#include ELEM_UNIFORM_INC
+#include ELEM_HERMITIANUNIFORMSPECTRUM_INC
+#include ELEM_WIGNER_INC
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void CheckClose
+( const DistMatrix<F>& X, const DistMatrix<F>& XRef, const string desc )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> E( XRef );
+    Axpy( F(-1), X, E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( XRef );
+    const Real tol = X.Height()*lapack::MachineEpsilon<Real>();
+    if( relError > tol )
+        LogicError(desc,": relative error of ",relError," > ",tol);
+}
+
+// Compare sorted eigenvalues against those of the Hermitian eigensolver
+template<typename Real>
+void CheckSpectrum
+( DistMatrix<Real,STAR,STAR>& w, DistMatrix<Real,VR,STAR>& wRef,
+  Real scale, const string desc )
+{
+    Sort( w );
+    Sort( wRef );
+    DistMatrix<Real,STAR,STAR> wRef_STAR_STAR( wRef );
+    const Int n = w.Height();
+    const Real tol = 100*n*scale*lapack::MachineEpsilon<Real>();
+    for( Int i=0; i<n; ++i )
+    {
+        const Real error =
+            Abs(w.GetLocal(i,0)-wRef_STAR_STAR.GetLocal(i,0));
+        if( error > tol )
+            LogicError(desc,": eigenvalue ",i," is off by ",error," > ",tol);
+    }
+}
+
+template<typename F>
+void MakeSignMatrix( DistMatrix<F>& A, Int n )
+{
+    Uniform( A, n, n );
+    for( Int i=0; i<n; ++i )
+        A.Set( i, i, F( i % 2 == 0 ? n : -n ) );
+}
+
+// Run each iteration with one workspace per routine over a sequence of
+// problems of growing, shrinking, and repeated sizes on two different grids,
+// and check that the results agree with those computed from fresh workspaces
+template<typename F>
+void TestWorkspaces
+( const vector<Int>& sizes, const Grid& g0, const Grid& g1, Int cutoff )
+{
+    typedef Base<F> Real;
+    sign::DistNewtonWorkspace<F> signWork( g0 );
+    polar::DistQDWHWorkspace<F> qdwhWork( g0 );
+    const Grid* grids[2] = { &g0, &g1 };
+    for( Int k=0; k<2; ++k )
+    {
+        const Grid& g = *grids[k];
+        for( Int s=0; s<Int(sizes.size()); ++s )
+        {
+            const Int n = sizes[s];
+            ostringstream os;
+            os << "grid " << k << ", n=" << n;
+            const string desc = os.str();
+
+            DistMatrix<F> A(g);
+            MakeSignMatrix( A, n );
+            auto X( A ), XRef( A );
+            sign::Newton( X, signWork );
+            sign::Newton( XRef );
+            CheckClose( X, XRef, desc+" sign" );
+
+            HermitianUniformSpectrum( A, n, 1, 10 );
+            X = A;
+            XRef = A;
+            herm_polar::QDWH( LOWER, X, qdwhWork );
+            herm_polar::QDWH( LOWER, XRef );
+            CheckClose( X, XRef, desc+" Hermitian QDWH" );
+
+            // The spectral divide and conquer schemes draw random shifts, so
+            // compare their spectra against the Hermitian eigensolver. Their
+            // subproblems move the workspaces onto subgrids.
+            Wigner( A, n );
+            DistMatrix<Real,VR,STAR> wRef(g);
+            auto ACopy( A );
+            HermitianEig( LOWER, ACopy, wRef );
+
+            DistMatrix<Real,VR,STAR> w(g);
+            ACopy = A;
+            herm_eig::SDC( LOWER, ACopy, w, qdwhWork, cutoff );
+            DistMatrix<Real,STAR,STAR> w_STAR_STAR( w );
+            CheckSpectrum( w_STAR_STAR, wRef, Real(10), desc+" Hermitian SDC" );
+
+            DistMatrix<Complex<Real>,VR,STAR> wCpx(g);
+            ACopy = A;
+            schur::SDC( ACopy, wCpx, signWork, cutoff );
+            DistMatrix<Complex<Real>,STAR,STAR> wCpx_STAR_STAR( wCpx );
+            DistMatrix<Real,STAR,STAR> wReal( n, 1, g );
+            for( Int i=0; i<n; ++i )
+                wReal.SetLocal( i, 0, RealPart(wCpx_STAR_STAR.GetLocal(i,0)) );
+            CheckSpectrum( wReal, wRef, Real(10), desc+" Schur SDC" );
+        }
+    }
+    if( mpi::WorldRank() == 0 )
+        cout << "passed" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    try
+    {
+        const Int n = Input("--size","largest problem size",60);
+        const Int nb = Input("--nb","algorithmic blocksize",16);
+        const Int cutoff = Input("--cutoff","SDC cutoff",12);
+        ProcessInput();
+        PrintInputReport();
+        SetBlocksize( nb );
+
+        // Grow, shrink, and repeat the problem size
+        vector<Int> sizes(4);
+        sizes[0] = n/2;
+        sizes[1] = n;
+        sizes[2] = n/3;
+        sizes[3] = n/3;
+
+        // Switch from the default grid to a single row of processes
+        const Grid& g0 = DefaultGrid();
+        const Grid g1( mpi::COMM_WORLD, 1 );
+
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "Testing with doubles...";
+            cout.flush();
+        }
+        TestWorkspaces<double>( sizes, g0, g1, cutoff );
+
+        if( mpi::WorldRank() == 0 )
+        {
+            cout << "Testing with double-precision complex...";
+            cout.flush();
+        }
+        TestWorkspaces<Complex<double>>( sizes, g0, g1, cutoff );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include ELEM_MAKEHERMITIAN_INC
+#include ELEM_FROBENIUSNORM_INC
+#include ELEM_POLAR_INC
+#include ELEM_IDENTITY_INC
+#include ELEM_UNIFORM_INC
+using namespace std;
+using namespace elem;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& Q, const DistMatrix<F>& P )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Width();
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const Real tol = 100*Max(A.Height(),n)*eps;
+
+    const Real frobA = FrobeniusNorm( A );
+    DistMatrix<F> B( A );
+    Gemm( NORMAL, NORMAL, F(-1), Q, P, F(1), B );
+    const Real relError = FrobeniusNorm( B ) / frobA;
+
+    Identity( B, n, n );
+    Herk( LOWER, ADJOINT, F(-1), Q, F(1), B );
+    const Real orthogError = HermitianFrobeniusNorm( LOWER, B );
+    if( g.Rank() == 0 )
+        cout << "    ||A - QP||_F / ||A||_F = " << relError << "\n"
+             << "    ||I - Q^H Q||_F        = " << orthogError << endl;
+    if( relError > tol || orthogError > tol )
+        LogicError("Polar decomposition was not accurate enough");
+}
+
+template<typename F>
+void TestZolotarev( Int m, Int n, Int numTerms, Int numTeams, const Grid& g )
+{
+    DistMatrix<F> A(g), Q(g), P(g);
+    Uniform( A, m, n );
+    Q = A;
+    if( g.Rank() == 0 )
+    {
+        cout << "  General Zolotarev with numTeams=" << numTeams << "...";
+        cout.flush();
+    }
+    const Int numIts = polar::Zolotarev( Q, P, numTerms, numTeams );
+    if( g.Rank() == 0 )
+        cout << "DONE. " << numIts << " iterations" << endl;
+    TestCorrectness( A, Q, P );
+}
+
+template<typename F>
+void TestHermitianZolotarev
+( UpperOrLower uplo, Int n, Int numTerms, Int numTeams, const Grid& g )
+{
+    DistMatrix<F> A(g), Q(g), P(g);
+    Uniform( A, n, n );
+    MakeHermitian( uplo, A );
+    Q = A;
+    if( g.Rank() == 0 )
+    {
+        cout << "  Hermitian Zolotarev with numTeams=" << numTeams << "...";
+        cout.flush();
+    }
+    const Int numIts =
+        herm_polar::Zolotarev( uplo, Q, P, numTerms, numTeams );
+    MakeHermitian( uplo, P );
+    if( g.Rank() == 0 )
+        cout << "DONE. " << numIts << " iterations" << endl;
+    TestCorrectness( A, Q, P );
+}
+
+template<typename F>
+void TestPolarAlg( UpperOrLower uplo, Int m, Int n, const Grid& g )
+{
+    DistMatrix<F> A(g), Q(g), P(g);
+    Uniform( A, m, n );
+    Q = A;
+    if( g.Rank() == 0 )
+        cout << "  Polar with POLAR_ZOLOTAREV..." << endl;
+    Polar( Q, P, POLAR_ZOLOTAREV );
+    TestCorrectness( A, Q, P );
+
+    Uniform( A, n, n );
+    MakeHermitian( uplo, A );
+    Q = A;
+    if( g.Rank() == 0 )
+        cout << "  HermitianPolar with POLAR_ZOLOTAREV..." << endl;
+    HermitianPolar( uplo, Q, P, POLAR_ZOLOTAREV );
+    TestCorrectness( A, Q, P );
+}
+
+template<typename F>
+void TestAll
+( UpperOrLower uplo, Int m, Int n, Int numTerms, Int numTeams,
+  const Grid& g )
+{
+    TestZolotarev<F>( m, n, numTerms, 1, g );
+    TestZolotarev<F>( m, n, numTerms, numTeams, g );
+    TestHermitianZolotarev<F>( uplo, n, numTerms, 1, g );
+    TestHermitianZolotarev<F>( uplo, n, numTerms, numTeams, g );
+    TestPolarAlg<F>( uplo, m, n, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::CommRank( comm );
+    const Int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",80);
+        const Int numTerms =
+            Input("--numTerms","terms per iteration (0=auto)",4);
+        const Int numTeams =
+            Input("--numTeams","number of subgrids (>1)",Min(commSize,4));
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestAll<double>( uplo, m, n, numTerms, numTeams, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestAll<Complex<double>>( uplo, m, n, numTerms, numTeams, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}